@@ -436,16 +436,18 @@ void DoScalarDependentDefinitions(py::module m, T) {
             py::arg("geometry_id"), py_rvp::reference_internal,
             cls_doc.GetPoseInWorld.doc_1args_geometry_id)
         .def("ComputeSignedDistancePairwiseClosestPoints",
-            &QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints,
+            overload_cast_explicit<std::vector<SignedDistancePair<T>>, double>(
+                &QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints),
             py::arg("max_distance") = std::numeric_limits<double>::infinity(),
-            cls_doc.ComputeSignedDistancePairwiseClosestPoints.doc)
+            cls_doc.ComputeSignedDistancePairwiseClosestPoints.doc_1args)
         .def("ComputeSignedDistancePairClosestPoints",
             &QueryObject<T>::ComputeSignedDistancePairClosestPoints,
             py::arg("geometry_id_A"), py::arg("geometry_id_B"),
             cls_doc.ComputeSignedDistancePairClosestPoints.doc)
         .def("ComputePointPairPenetration",
-            &QueryObject<T>::ComputePointPairPenetration,
-            cls_doc.ComputePointPairPenetration.doc)
+            overload_cast_explicit<std::vector<PenetrationAsPointPair<T>>>(
+                &QueryObject<T>::ComputePointPairPenetration),
+            cls_doc.ComputePointPairPenetration.doc_0args)
         .def("ComputeSignedDistanceToPoint",
             &QueryObject<T>::ComputeSignedDistanceToPoint, py::arg("p_WQ"),
             py::arg("threshold") = std::numeric_limits<double>::infinity(),
@@ -495,8 +497,11 @@ void DoScalarDependentDefinitions(py::module m, T) {
     if constexpr (scalar_predicate<T>::is_bool) {
       cls  // BR
           .def("ComputeContactSurfaces",
-              &Class::template ComputeContactSurfaces<T>,
-              py::arg("representation"), cls_doc.ComputeContactSurfaces.doc)
+              overload_cast_explicit<std::vector<ContactSurface<T>>,
+                  HydroelasticContactRepresentation>(
+                  &Class::template ComputeContactSurfaces<T>),
+              py::arg("representation"),
+              cls_doc.ComputeContactSurfaces.doc_1args)
           .def(
               "ComputeContactSurfacesWithFallback",
               [](const Class* self,
@@ -91,6 +91,14 @@ void DoScalarDependentDefinitions(py::module m, T) {
             cls_doc.set_point_size.doc)
         .def("set_default_rgba", &Class::set_default_rgba,
             cls_doc.set_default_rgba.doc)
+        .def("set_quantize", &Class::set_quantize, py::arg("quantize"),
+            cls_doc.set_quantize.doc)
+        .def("set_max_points", &Class::set_max_points, py::arg("max_points"),
+            cls_doc.set_max_points.doc)
+        .def("set_lod_voxel_size", &Class::set_lod_voxel_size,
+            py::arg("voxel_size"), cls_doc.set_lod_voxel_size.doc)
+        .def("set_adapt_to_throughput", &Class::set_adapt_to_throughput,
+            py::arg("adapt"), cls_doc.set_adapt_to_throughput.doc)
         .def("Delete", &Class::Delete, cls_doc.Delete.doc)
         .def("cloud_input_port", &Class::cloud_input_port,
             py_rvp::reference_internal, cls_doc.cloud_input_port.doc)
@@ -115,6 +123,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("StartRecording", &Class::StartRecording,
             py::arg("set_transforms_while_recording") = true,
             py_rvp::reference_internal, cls_doc.StartRecording.doc)
+        .def("StartRecordingToFile", &Class::StartRecordingToFile,
+            py::arg("filename"), py::arg("params") = MeshcatRecordingParams{},
+            py::arg("set_visualizations_while_recording") = true,
+            cls_doc.StartRecordingToFile.doc)
         .def("StopRecording", &Class::StopRecording, cls_doc.StopRecording.doc)
         .def("PublishRecording", &Class::PublishRecording,
             cls_doc.PublishRecording.doc)
@@ -181,6 +193,19 @@ void DoScalarIndependentDefinitions(py::module m) {
     DefCopyAndDeepCopy(&cls);
   }
 
+  // MeshcatRecordingParams
+  {
+    using Class = MeshcatRecordingParams;
+    constexpr auto& cls_doc = doc.MeshcatRecordingParams;
+    py::class_<Class> cls(
+        m, "MeshcatRecordingParams", py::dynamic_attr(), cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   // Meshcat
   {
     using Class = Meshcat;
@@ -209,6 +234,8 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def("ws_url", &Class::ws_url, cls_doc.ws_url.doc)
         .def("GetNumActiveConnections", &Class::GetNumActiveConnections,
             cls_doc.GetNumActiveConnections.doc)
+        .def("GetTransportStatistics", &Class::GetTransportStatistics,
+            cls_doc.GetTransportStatistics.doc)
         .def("Flush", &Class::Flush,
             // Internally this function both blocks on a worker thread and
             // sleeps; for both reasons, we must release the GIL.
@@ -223,6 +250,10 @@ void DoScalarIndependentDefinitions(py::module m) {
                 double, const Rgba&>(&Class::SetObject),
             py::arg("path"), py::arg("cloud"), py::arg("point_size") = 0.001,
             py::arg("rgba") = Rgba(.9, .9, .9, 1.), cls_doc.SetObject.doc_cloud)
+        .def("SetQuantizedPointCloud", &Class::SetQuantizedPointCloud,
+            py::arg("path"), py::arg("cloud"), py::arg("point_size") = 0.001,
+            py::arg("rgba") = Rgba(.9, .9, .9, 1.),
+            cls_doc.SetQuantizedPointCloud.doc)
         .def("SetObject",
             py::overload_cast<std::string_view,
                 const TriangleSurfaceMesh<double>&, const Rgba&, bool, double,
@@ -289,6 +320,10 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"), py::arg("tolerance") = 0.0,
+            py::arg("time_in_recording") = std::nullopt,
+            cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetRealtimeRate", &Class::SetRealtimeRate, py::arg("rate"),
             cls_doc.SetRealtimeRate.doc)
@@ -413,6 +448,16 @@ void DoScalarIndependentDefinitions(py::module m) {
     DefReprUsingSerialize(&orthographic_camera_cls);
     DefCopyAndDeepCopy(&orthographic_camera_cls);
 
+    const auto& transport_statistics_doc = doc.Meshcat.TransportStatistics;
+    py::class_<Meshcat::TransportStatistics> transport_statistics_cls(
+        meshcat, "TransportStatistics", transport_statistics_doc.doc);
+    transport_statistics_cls  // BR
+        .def(ParamInit<Meshcat::TransportStatistics>());
+    DefAttributesUsingSerialize(
+        &transport_statistics_cls, transport_statistics_doc);
+    DefReprUsingSerialize(&transport_statistics_cls);
+    DefCopyAndDeepCopy(&transport_statistics_cls);
+
     const auto& gamepad_doc = doc.Meshcat.Gamepad;
     py::class_<Meshcat::Gamepad> gamepad_cls(
         meshcat, "Gamepad", gamepad_doc.doc);
@@ -481,6 +526,23 @@ void DoScalarIndependentDefinitions(py::module m) {
             loop_doc.kLoopPingPong.doc);
   }
 
+  // MeshcatRecordingReader
+  {
+    using Class = MeshcatRecordingReader;
+    constexpr auto& cls_doc = doc.MeshcatRecordingReader;
+    py::class_<Class>(m, "MeshcatRecordingReader", cls_doc.doc)
+        .def(py::init<const std::filesystem::path&>(), py::arg("filename"),
+            cls_doc.ctor.doc)
+        .def("num_chunks", &Class::num_chunks, cls_doc.num_chunks.doc)
+        .def("start_time", &Class::start_time, cls_doc.start_time.doc)
+        .def("end_time", &Class::end_time, cls_doc.end_time.doc)
+        .def("Seek", &Class::Seek, py::arg("time"), py::arg("meshcat"),
+            cls_doc.Seek.doc)
+        .def("ToAnimation", &Class::ToAnimation, py::arg("start_time"),
+            py::arg("end_time"), py::arg("frames_per_second") = 32.0,
+            cls_doc.ToAnimation.doc);
+  }
+
   // MeshcatVisualizerParams
   {
     using Class = MeshcatVisualizerParams;
@@ -1,6 +1,7 @@
 import pydrake.geometry as mut
 
 import copy
+import os
 import unittest
 import urllib.request
 
@@ -109,11 +110,22 @@ class TestGeometryVisualizers(unittest.TestCase):
                              X_ParentPath=RigidTransform(),
                              time_in_recording=0.2)
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box"],
+                              X_ParentPaths=[RigidTransform()],
+                              tolerance=1e-6,
+                              time_in_recording=0.2)
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
         meshcat.SetObject(path="/test/cloud", cloud=cloud,
                           point_size=0.01, rgba=mut.Rgba(.5, .5, .5))
+        meshcat.SetQuantizedPointCloud(path="/test/quantized_cloud",
+                                       cloud=cloud, point_size=0.01,
+                                       rgba=mut.Rgba(.5, .5, .5))
+        statistics = meshcat.GetTransportStatistics()
+        self.assertIsInstance(statistics, mut.Meshcat.TransportStatistics)
+        self.assertGreaterEqual(statistics.bytes_published, 0)
+        self.assertEqual(statistics.backpressure, 0)
         mesh = mut.TriangleSurfaceMesh(
             triangles=[mut.SurfaceTriangle(
                 0, 1, 2), mut.SurfaceTriangle(3, 0, 2)],
@@ -215,6 +227,21 @@ class TestGeometryVisualizers(unittest.TestCase):
         meshcat.PublishRecording()
         meshcat.DeleteRecording()
 
+        filename = os.path.join(os.environ["TEST_TMPDIR"], "recording.bin")
+        params = mut.MeshcatRecordingParams(chunk_duration=1.0)
+        meshcat.StartRecordingToFile(filename=filename, params=params)
+        meshcat.SetTransform(path="/test/box", X_ParentPath=RigidTransform(),
+                             time_in_recording=0.5)
+        meshcat.StopRecording()
+        reader = mut.MeshcatRecordingReader(filename=filename)
+        self.assertEqual(reader.num_chunks(), 1)
+        self.assertEqual(reader.start_time(), 0.5)
+        self.assertEqual(reader.end_time(), 0.5)
+        reader.Seek(time=1.0, meshcat=meshcat)
+        animation = reader.ToAnimation(start_time=0.0, end_time=1.0,
+                                       frames_per_second=64.0)
+        self.assertEqual(animation.frames_per_second(), 64.0)
+
         # PerspectiveCamera
         camera = mut.Meshcat.PerspectiveCamera(fov=80,
                                                aspect=1.2,
@@ -349,6 +376,10 @@ class TestGeometryVisualizers(unittest.TestCase):
             meshcat=meshcat, path="cloud", publish_period=1/12.0)
         visualizer.set_point_size(0.1)
         visualizer.set_default_rgba(mut.Rgba(0, 0, 1, 1))
+        visualizer.set_quantize(quantize=True)
+        visualizer.set_max_points(max_points=1000)
+        visualizer.set_lod_voxel_size(voxel_size=0.01)
+        visualizer.set_adapt_to_throughput(adapt=True)
         context = visualizer.CreateDefaultContext()
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
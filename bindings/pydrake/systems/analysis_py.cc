@@ -6,6 +6,7 @@
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/common/scope_exit.h"
+#include "drake/systems/analysis/dense_output_config.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/monte_carlo.h"
 #include "drake/systems/analysis/region_of_attraction.h"
@@ -44,6 +45,17 @@ PYBIND11_MODULE(analysis, m) {
   py::module::import("pydrake.systems.framework");
   py::module::import("pydrake.solvers");
 
+  {
+    using Class = DenseOutputConfig;
+    constexpr auto& cls_doc = pydrake_doc.drake.systems.DenseOutputConfig;
+    py::class_<Class> cls(m, "DenseOutputConfig", cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = SimulatorConfig;
     constexpr auto& cls_doc = pydrake_doc.drake.systems.SimulatorConfig;
@@ -137,8 +149,13 @@ PYBIND11_MODULE(analysis, m) {
               cls_doc.get_throw_on_minimum_step_size_violation.doc)
           .def("Reset", &Class::Reset, cls_doc.Reset.doc)
           .def("Initialize", &Class::Initialize, cls_doc.Initialize.doc)
-          .def("StartDenseIntegration", &Class::StartDenseIntegration,
-              cls_doc.StartDenseIntegration.doc)
+          .def("StartDenseIntegration",
+              py::overload_cast<>(&Class::StartDenseIntegration),
+              cls_doc.StartDenseIntegration.doc_0args)
+          .def("StartDenseIntegration",
+              py::overload_cast<const DenseOutputConfig&>(
+                  &Class::StartDenseIntegration),
+              py::arg("config"), cls_doc.StartDenseIntegration.doc_1args)
           .def("get_dense_output", &Class::get_dense_output,
               py_rvp::reference_internal, py_rvp::reference_internal,
               cls_doc.get_dense_output.doc)
@@ -297,6 +314,12 @@ Parameter ``interruptible``:
         .def("set_publish_at_initialization",
             &Simulator<T>::set_publish_at_initialization, py::arg("publish"),
             doc.Simulator.set_publish_at_initialization.doc)
+        .def("set_dense_output_config",
+            &Simulator<T>::set_dense_output_config, py::arg("config"),
+            doc.Simulator.set_dense_output_config.doc)
+        .def("get_dense_output_config",
+            &Simulator<T>::get_dense_output_config,
+            doc.Simulator.get_dense_output_config.doc)
         .def("set_target_realtime_rate",
             &Simulator<T>::set_target_realtime_rate, py::arg("realtime_rate"),
             doc.Simulator.set_target_realtime_rate.doc)
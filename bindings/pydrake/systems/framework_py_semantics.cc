@@ -179,6 +179,43 @@ void DoScalarIndependentDefinitions(py::module m) {
             cls_doc.KeepMoreSevere.doc);
   }
 
+  {
+    using Class = CacheProfiler;
+    constexpr auto& cls_doc = doc.CacheProfiler;
+    py::class_<Class> cls(m, "CacheProfiler", cls_doc.doc);
+    {
+      using Nested = CacheProfiler::EntryStatistics;
+      constexpr auto& nested_doc = cls_doc.EntryStatistics;
+      py::class_<Nested>(cls, "EntryStatistics", nested_doc.doc)
+          .def("num_evaluations", &Nested::num_evaluations,
+              nested_doc.num_evaluations.doc)
+          .def_readonly("system_pathname", &Nested::system_pathname,
+              nested_doc.system_pathname.doc)
+          .def_readonly(
+              "description", &Nested::description, nested_doc.description.doc)
+          .def_readonly("is_output_port", &Nested::is_output_port,
+              nested_doc.is_output_port.doc)
+          .def_readonly("num_hits", &Nested::num_hits, nested_doc.num_hits.doc)
+          .def_readonly(
+              "num_misses", &Nested::num_misses, nested_doc.num_misses.doc)
+          .def_readonly("compute_time", &Nested::compute_time,
+              nested_doc.compute_time.doc)
+          .def_readonly(
+              "self_time", &Nested::self_time, nested_doc.self_time.doc)
+          .def_readonly("num_invalidations", &Nested::num_invalidations,
+              nested_doc.num_invalidations.doc)
+          .def_readonly("invalidation_sources", &Nested::invalidation_sources,
+              nested_doc.invalidation_sources.doc);
+    }
+    cls  // BR
+        .def("GetStatistics", &Class::GetStatistics, cls_doc.GetStatistics.doc)
+        .def("GetReport", &Class::GetReport, py::arg("max_entries") = 25,
+            cls_doc.GetReport.doc)
+        .def("GetGraphvizString", &Class::GetGraphvizString,
+            py::arg("max_edges") = 50, cls_doc.GetGraphvizString.doc)
+        .def("Reset", &Class::Reset, cls_doc.Reset.doc);
+  }
+
   py::class_<ContextBase>(m, "ContextBase", doc.ContextBase.doc)
       .def("num_input_ports", &ContextBase::num_input_ports,
           doc.ContextBase.num_input_ports.doc)
@@ -196,7 +233,13 @@ void DoScalarIndependentDefinitions(py::module m) {
       .def("UnfreezeCache", &ContextBase::UnfreezeCache,
           doc.ContextBase.UnfreezeCache.doc)
       .def("is_cache_frozen", &ContextBase::is_cache_frozen,
-          doc.ContextBase.is_cache_frozen.doc);
+          doc.ContextBase.is_cache_frozen.doc)
+      .def("EnableCacheProfiling", &ContextBase::EnableCacheProfiling,
+          py_rvp::reference_internal, doc.ContextBase.EnableCacheProfiling.doc)
+      .def("DisableCacheProfiling", &ContextBase::DisableCacheProfiling,
+          doc.ContextBase.DisableCacheProfiling.doc)
+      .def("get_cache_profiler", &ContextBase::get_cache_profiler,
+          py_rvp::reference_internal, doc.ContextBase.get_cache_profiler.doc);
   // TODO(russt, eric.cousineau): Add remaining methods from ContextBase here.
 
   {
@@ -444,6 +487,8 @@ void DoScalarDependentDefinitions(py::module m) {
       // header file.
       // TODO(EricCousineau-TRI): Replace these with DefClone.
       .def("Clone", &Context<T>::Clone, doc.Context.Clone.doc)
+      .def("CloneCopyOnWrite", &Context<T>::CloneCopyOnWrite,
+          doc.Context.CloneCopyOnWrite.doc)
       .def("__copy__", &Context<T>::Clone)
       .def("__deepcopy__", [](const Context<T>* self,
                                py::dict /* memo */) { return self->Clone(); })
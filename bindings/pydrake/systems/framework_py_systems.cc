@@ -1095,7 +1095,11 @@ Note: The above is for the C++ documentation. For Python, use
             py::arg("name"), py_rvp::reference_internal,
             doc.Diagram.GetSubsystemByName.doc)
         .def("GetSystems", &Diagram<T>::GetSystems, py_rvp::reference_internal,
-            doc.Diagram.GetSystems.doc);
+            doc.Diagram.GetSystems.doc)
+        .def("set_parallelism", &Diagram<T>::set_parallelism,
+            py::arg("parallelism"), doc.Diagram.set_parallelism.doc)
+        .def("parallelism", &Diagram<T>::parallelism,
+            doc.Diagram.parallelism.doc);
 
     // N.B. This will effectively allow derived classes of `VectorSystem` to
     // override `LeafSystem` methods, disrespecting `final`-ity.
@@ -1,3 +1,6 @@
+#include <memory>
+#include <utility>
+
 #include "drake/bindings/pydrake/common/cpp_template_pybind.h"
 #include "drake/bindings/pydrake/common/eigen_pybind.h"
 #include "drake/bindings/pydrake/common/value_pybind.h"
@@ -10,8 +13,6 @@ namespace drake {
 namespace pydrake {
 namespace internal {
 
-using Eigen::Map;
-
 void DefineSensorsImage(py::module m) {
   // NOLINTNEXTLINE(build/namespaces): Emulate placement in namespace.
   using namespace drake::systems::sensors;
@@ -64,13 +65,32 @@ void DefineSensorsImage(py::module m) {
       traits.attr("kPixelFormat") = PixelFormat{ImageTraitsT::kPixelFormat};
       AddTemplateClass(m, "ImageTraits", traits, py_param);
 
-      auto at = [](ImageT* self, int x, int y) {
+      // The NumPy views own a reference to the pixels, so they remain valid
+      // even after the image is resized or destroyed. While a view is alive,
+      // the image writes its pixels in place and its copies don't share them
+      // (see Image::MakeDataView()), so the view only ever aliases this image.
+      auto make_view = [](ImageT* self, auto* data) {
+        std::shared_ptr<T> view = self->MakeDataView();
+        *data = view.get();
+        py::capsule owner(
+            new std::shared_ptr<T>(std::move(view)), [](void* owned) {
+              delete static_cast<std::shared_ptr<T>*>(owned);
+            });
+        return owner;
+      };
+      auto at = [=](ImageT* self, int x, int y) {
         // Since Image<>::at(...) uses DRAKE_ASSERT for performance reasons,
         // rewrite the checks here using DRAKE_THROW_UNLESS so that it will not
         // segfault in Python.
         DRAKE_THROW_UNLESS(x >= 0 && x < self->width());
         DRAKE_THROW_UNLESS(y >= 0 && y < self->height());
-        Map<VectorX<T>> pixel(self->at(x, y), int{ImageTraitsT::kNumChannels});
+        T* data{};
+        py::capsule owner = make_view(self, &data);
+        constexpr int kNumChannels = ImageTraitsT::kNumChannels;
+        py::object pixel =
+            ToArray(data + (x + y * self->width()) * kNumChannels,
+                kNumChannels, py::make_tuple(kNumChannels),
+                py_rvp::reference_internal, owner);
         return pixel;
       };
       // Shape for use with NumPy, OpenCV, etc. Using same shape as what is
@@ -79,14 +99,18 @@ void DefineSensorsImage(py::module m) {
         return py::make_tuple(
             self->height(), self->width(), int{ImageTraitsT::kNumChannels});
       };
-      auto get_data = [=](const ImageT* self) {
-        py::object array = ToArray(self->at(0, 0), self->size(),
-            get_shape(self), py_rvp::reference_internal, py::cast(self));
+      auto get_data = [=](ImageT* self) {
+        const T* data{};
+        py::capsule owner = make_view(self, &data);
+        py::object array = ToArray(data, self->size(), get_shape(self),
+            py_rvp::reference_internal, owner);
         return array;
       };
       auto get_mutable_data = [=](ImageT* self) {
-        py::object array = ToArray(self->at(0, 0), self->size(),
-            get_shape(self), py_rvp::reference_internal, py::cast(self));
+        T* data{};
+        py::capsule owner = make_view(self, &data);
+        py::object array = ToArray(data, self->size(), get_shape(self),
+            py_rvp::reference_internal, owner);
         return array;
       };
 
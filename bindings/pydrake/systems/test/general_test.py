@@ -10,7 +10,7 @@ import unittest
 import numpy as np
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import RandomGenerator
+from pydrake.common import Parallelism, RandomGenerator
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.value import AbstractValue, Value
 from pydrake.examples import PendulumPlant, RimlessWheel
@@ -26,6 +26,7 @@ from pydrake.systems.analysis import (
 from pydrake.systems.framework import (
     BasicVector, BasicVector_,
     CacheEntry,
+    CacheProfiler,
     ContextBase,
     Context, Context_,
     ContinuousState, ContinuousState_,
@@ -148,6 +149,22 @@ class TestGeneral(unittest.TestCase):
         self.assertTrue(context.is_cache_frozen())
         context.UnfreezeCache()
         self.assertFalse(context.is_cache_frozen())
+        self.assertIsNone(context.get_cache_profiler())
+        profiler = context.EnableCacheProfiling()
+        self.assertIsInstance(profiler, CacheProfiler)
+        for i in range(3):
+            system.get_input_port(i).FixValue(context, np.ones(10))
+        system.get_output_port(0).Eval(context)
+        stats = [x for x in context.get_cache_profiler().GetStatistics()
+                 if x.is_output_port]
+        self.assertEqual(len(stats), 1)
+        self.assertEqual(stats[0].num_evaluations(), 1)
+        self.assertEqual(stats[0].num_misses, 1)
+        self.assertIn("cache entry", profiler.GetReport(max_entries=10))
+        self.assertIn("digraph", profiler.GetGraphvizString(max_edges=10))
+        profiler.Reset()
+        context.DisableCacheProfiling()
+        self.assertIsNone(context.get_cache_profiler())
 
     def test_context_api(self):
         system = Adder(3, 10)
@@ -474,6 +491,7 @@ class TestGeneral(unittest.TestCase):
             copy.copy(context),
             copy.deepcopy(context),
             context.Clone(),
+            context.CloneCopyOnWrite(),
         ]
         # TODO(eric.cousineau): Compare copies.
         for context_copy in context_copies:
@@ -942,6 +960,11 @@ class TestGeneral(unittest.TestCase):
         gc.collect()
         self.assertEqual(out_locators[0].get_name(), "adder2")
 
+        adder1, adder2, diagram = make_diagram()
+        self.assertEqual(diagram.parallelism().num_threads(), 1)
+        diagram.set_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(diagram.parallelism().num_threads(), 2)
+
     def test_add_named_system(self):
         builder = DiagramBuilder()
         adder1 = builder.AddNamedSystem("adder1", Adder(2, 3))
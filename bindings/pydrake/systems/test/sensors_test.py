@@ -131,9 +131,8 @@ class TestSensors(unittest.TestCase):
 
             w //= 2
             h //= 2
-            # WARNING: Resizing an image with an existing reference to
-            # `image.data` will cause `image.data` + `image.mutable_data` to be
-            # invalid.
+            # N.B. Resizing an image detaches any existing `image.data` or
+            # `image.mutable_data` views from it; they keep the old pixels.
             image.resize(w, h)
             self.assertEqual(image.shape, (h, w, nc))
 
@@ -206,6 +205,18 @@ class TestSensors(unittest.TestCase):
             np.testing.assert_array_equal(data, channel_default)
             np.testing.assert_array_equal(mutable_data, channel_default)
 
+            # Copies of an image don't share the pixels that a view aliases,
+            # and the view remains valid after the image is resized.
+            image = ImageT(w, h, channel_default)
+            mutable_data = image.mutable_data
+            value = Value[ImageT](image)
+            mutable_data[:] = 2
+            self.assertEqual(image.at(0, 0)[0], 2)
+            self.assertEqual(value.get_value().at(0, 0)[0], channel_default)
+            image.resize(1, 1)
+            mutable_data[:] = 3
+            self.assertEqual(image.at(0, 0)[0], 0)
+
     def test_depth_image_conversion(self):
         foo = mut.ImageDepth32F(width=3, height=4)
         bar = mut.ImageDepth16U()
@@ -0,0 +1,387 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/symbolic/codegen.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+// Lowers expressions into the instructions of a tape, reusing the register of
+// each subexpression and instruction that has already been lowered.
+class ExpressionTape::Compiler {
+ public:
+  Compiler(const vector<Variable>& parameters, ExpressionTape* tape)
+      : tape_(*tape) {
+    tape_.num_parameters_ = static_cast<int>(parameters.size());
+    tape_.registers_.resize(parameters.size(), 0.0);
+    for (int i = 0; i < tape_.num_parameters_; ++i) {
+      parameter_registers_.emplace(parameters[i].get_id(), i);
+    }
+  }
+
+  // Returns the register that holds the value of `e`.
+  int Lower(const Expression& e) {
+    const auto it = expression_registers_.find(e);
+    if (it != expression_registers_.end()) {
+      return it->second;
+    }
+    const int result = VisitExpression<int>(this, e);
+    expression_registers_.emplace(e, result);
+    return result;
+  }
+
+  int VisitVariable(const Expression& e) {
+    const Variable& v = get_variable(e);
+    const auto it = parameter_registers_.find(v.get_id());
+    if (it == parameter_registers_.end()) {
+      throw runtime_error(
+          fmt::format("ExpressionTape: the variable {} is not a parameter.",
+                      v.get_name()));
+    }
+    return it->second;
+  }
+
+  int VisitConstant(const Expression& e) {
+    return Constant(get_constant_value(e));
+  }
+
+  int VisitAddition(const Expression& e) {
+    // c + ∑ᵢ cᵢ eᵢ, accumulated in the order of Expression::Evaluate().
+    const double c = get_constant_in_addition(e);
+    int sum = (c != 0.0) ? Constant(c) : -1;
+    for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+      const int term = Lower(e_i);
+      if (sum < 0) {
+        sum = (c_i == 1.0) ? term : Emit(Op::kScale, term, 0, c_i);
+      } else {
+        sum = (c_i == 1.0) ? Emit(Op::kAdd, sum, term)
+                           : Emit(Op::kAddScaled, sum, term, c_i);
+      }
+    }
+    DRAKE_DEMAND(sum >= 0);
+    return sum;
+  }
+
+  int VisitMultiplication(const Expression& e) {
+    // c ∏ᵢ bᵢ^eᵢ.
+    const double c = get_constant_in_multiplication(e);
+    int product = -1;
+    for (const auto& [base, exponent] :
+         get_base_to_exponent_map_in_multiplication(e)) {
+      const int factor = LowerPow(base, exponent);
+      product = (product < 0) ? factor : Emit(Op::kMultiply, product, factor);
+    }
+    DRAKE_DEMAND(product >= 0);
+    return (c == 1.0) ? product : Emit(Op::kScale, product, 0, c);
+  }
+
+  int VisitPow(const Expression& e) {
+    return LowerPow(get_first_argument(e), get_second_argument(e));
+  }
+
+  int VisitDivision(const Expression& e) { return Binary(Op::kDivide, e); }
+  int VisitAbs(const Expression& e) { return Unary(Op::kAbs, e); }
+  int VisitLog(const Expression& e) { return Unary(Op::kLog, e); }
+  int VisitExp(const Expression& e) { return Unary(Op::kExp, e); }
+  int VisitSqrt(const Expression& e) { return Unary(Op::kSqrt, e); }
+  int VisitSin(const Expression& e) { return Unary(Op::kSin, e); }
+  int VisitCos(const Expression& e) { return Unary(Op::kCos, e); }
+  int VisitTan(const Expression& e) { return Unary(Op::kTan, e); }
+  int VisitAsin(const Expression& e) { return Unary(Op::kAsin, e); }
+  int VisitAcos(const Expression& e) { return Unary(Op::kAcos, e); }
+  int VisitAtan(const Expression& e) { return Unary(Op::kAtan, e); }
+  int VisitAtan2(const Expression& e) { return Binary(Op::kAtan2, e); }
+  int VisitSinh(const Expression& e) { return Unary(Op::kSinh, e); }
+  int VisitCosh(const Expression& e) { return Unary(Op::kCosh, e); }
+  int VisitTanh(const Expression& e) { return Unary(Op::kTanh, e); }
+  int VisitMin(const Expression& e) { return Binary(Op::kMin, e); }
+  int VisitMax(const Expression& e) { return Binary(Op::kMax, e); }
+  int VisitCeil(const Expression& e) { return Unary(Op::kCeil, e); }
+  int VisitFloor(const Expression& e) { return Unary(Op::kFloor, e); }
+
+  int VisitIfThenElse(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support if-then-else expressions.");
+  }
+
+  int VisitUninterpretedFunction(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support uninterpreted functions.");
+  }
+
+ private:
+  // Returns the register of the constant `value`.
+  int Constant(double value) {
+    const auto [it, inserted] = constant_registers_.emplace(
+        std::bit_cast<uint64_t>(value), tape_.num_registers());
+    if (inserted) {
+      tape_.registers_.push_back(value);
+    }
+    return it->second;
+  }
+
+  // Returns the register of the result of the operation `op` on the registers
+  // `a` and `b` with the coefficient `c`.
+  int Emit(Op op, int a, int b = 0, double c = 0.0) {
+    if ((op == Op::kAdd || op == Op::kMultiply) && a > b) {
+      std::swap(a, b);
+    }
+    const auto key = std::make_tuple(op, a, b, std::bit_cast<uint64_t>(c));
+    const auto [it, inserted] =
+        instruction_registers_.emplace(key, tape_.num_registers());
+    if (inserted) {
+      tape_.instructions_.push_back({op, it->second, a, b, c});
+      tape_.registers_.push_back(0.0);
+    }
+    return it->second;
+  }
+
+  int Unary(Op op, const Expression& e) {
+    return Emit(op, Lower(get_argument(e)));
+  }
+
+  int Binary(Op op, const Expression& e) {
+    const int a = Lower(get_first_argument(e));
+    const int b = Lower(get_second_argument(e));
+    return Emit(op, a, b);
+  }
+
+  // Returns the register of base^exponent, which squares by multiplication.
+  int LowerPow(const Expression& base, const Expression& exponent) {
+    if (is_constant(exponent, 1.0)) {
+      return Lower(base);
+    }
+    const int a = Lower(base);
+    if (is_constant(exponent, 2.0)) {
+      return Emit(Op::kMultiply, a, a);
+    }
+    return Emit(Op::kPow, a, Lower(exponent));
+  }
+
+  ExpressionTape& tape_;
+  std::unordered_map<Variable::Id, int> parameter_registers_;
+  std::unordered_map<uint64_t, int> constant_registers_;
+  std::unordered_map<Expression, int> expression_registers_;
+  std::map<std::tuple<Op, int, int, uint64_t>, int> instruction_registers_;
+};
+
+ExpressionTape::ExpressionTape(
+    const vector<Variable>& parameters,
+    const Eigen::Ref<const VectorX<Expression>>& expressions) {
+  Compiler compiler(parameters, this);
+  outputs_.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    outputs_.push_back(compiler.Lower(expressions[i]));
+  }
+}
+
+void ExpressionTape::Evaluate(
+    const Eigen::Ref<const Eigen::VectorXd>& parameters,
+    EigenPtr<Eigen::VectorXd> result) const {
+  DRAKE_DEMAND(parameters.size() == num_parameters_);
+  DRAKE_DEMAND(result != nullptr);
+  DRAKE_DEMAND(result->size() == num_outputs());
+  vector<double> r = registers_;
+  std::copy(parameters.data(), parameters.data() + num_parameters_,
+            r.begin());
+  for (const Instruction& instruction : instructions_) {
+    const double a = r[instruction.a];
+    const double b = r[instruction.b];
+    double& out = r[instruction.result];
+    switch (instruction.op) {
+      case Op::kAdd:
+        out = a + b;
+        break;
+      case Op::kAddScaled:
+        out = a + instruction.c * b;
+        break;
+      case Op::kScale:
+        out = instruction.c * a;
+        break;
+      case Op::kMultiply:
+        out = a * b;
+        break;
+      case Op::kDivide:
+        out = a / b;
+        break;
+      case Op::kPow:
+        out = std::pow(a, b);
+        break;
+      case Op::kAbs:
+        out = std::fabs(a);
+        break;
+      case Op::kLog:
+        out = std::log(a);
+        break;
+      case Op::kExp:
+        out = std::exp(a);
+        break;
+      case Op::kSqrt:
+        out = std::sqrt(a);
+        break;
+      case Op::kSin:
+        out = std::sin(a);
+        break;
+      case Op::kCos:
+        out = std::cos(a);
+        break;
+      case Op::kTan:
+        out = std::tan(a);
+        break;
+      case Op::kAsin:
+        out = std::asin(a);
+        break;
+      case Op::kAcos:
+        out = std::acos(a);
+        break;
+      case Op::kAtan:
+        out = std::atan(a);
+        break;
+      case Op::kAtan2:
+        out = std::atan2(a, b);
+        break;
+      case Op::kSinh:
+        out = std::sinh(a);
+        break;
+      case Op::kCosh:
+        out = std::cosh(a);
+        break;
+      case Op::kTanh:
+        out = std::tanh(a);
+        break;
+      case Op::kMin:
+        out = std::min(a, b);
+        break;
+      case Op::kMax:
+        out = std::max(a, b);
+        break;
+      case Op::kCeil:
+        out = std::ceil(a);
+        break;
+      case Op::kFloor:
+        out = std::floor(a);
+        break;
+    }
+  }
+  for (int i = 0; i < num_outputs(); ++i) {
+    (*result)[i] = r[outputs_[i]];
+  }
+}
+
+string ExpressionTape::ToCode(const Instruction& instruction,
+                              const vector<string>& names) {
+  const string& a = names[instruction.a];
+  const string& b = names[instruction.b];
+  const auto unary = [&a](const char* f) {
+    return fmt::format("{}({})", f, a);
+  };
+  const auto binary = [&a, &b](const char* f) {
+    return fmt::format("{}({}, {})", f, a, b);
+  };
+  switch (instruction.op) {
+    case Op::kAdd:
+      return fmt::format("{} + {}", a, b);
+    case Op::kAddScaled:
+      return fmt::format("{} + ({} * {})", a, instruction.c, b);
+    case Op::kScale:
+      return fmt::format("{} * {}", instruction.c, a);
+    case Op::kMultiply:
+      return fmt::format("{} * {}", a, b);
+    case Op::kDivide:
+      return fmt::format("{} / {}", a, b);
+    case Op::kPow:
+      return binary("pow");
+    case Op::kAbs:
+      return unary("fabs");
+    case Op::kLog:
+      return unary("log");
+    case Op::kExp:
+      return unary("exp");
+    case Op::kSqrt:
+      return unary("sqrt");
+    case Op::kSin:
+      return unary("sin");
+    case Op::kCos:
+      return unary("cos");
+    case Op::kTan:
+      return unary("tan");
+    case Op::kAsin:
+      return unary("asin");
+    case Op::kAcos:
+      return unary("acos");
+    case Op::kAtan:
+      return unary("atan");
+    case Op::kAtan2:
+      return binary("atan2");
+    case Op::kSinh:
+      return unary("sinh");
+    case Op::kCosh:
+      return unary("cosh");
+    case Op::kTanh:
+      return unary("tanh");
+    case Op::kMin:
+      return binary("fmin");
+    case Op::kMax:
+      return binary("fmax");
+    case Op::kCeil:
+      return unary("ceil");
+    case Op::kFloor:
+      return unary("floor");
+  }
+  DRAKE_UNREACHABLE();
+}
+
+string CodeGen(const string& function_name, const ExpressionTape& tape) {
+  // Names the registers: the parameters are p[i], the constants are literals,
+  // and the results of the instructions are local variables.
+  vector<string> names(tape.num_registers());
+  for (int i = 0; i < tape.num_parameters(); ++i) {
+    names[i] = fmt::format("p[{}]", i);
+  }
+  for (int i = tape.num_parameters(); i < tape.num_registers(); ++i) {
+    const double value = tape.registers_[i];
+    if (std::isinf(value)) {
+      names[i] = (value > 0) ? "INFINITY" : "(-INFINITY)";
+    } else {
+      names[i] = (value < 0) ? fmt::format("({})", value)
+                             : fmt::format("{}", value);
+    }
+  }
+  for (const auto& instruction : tape.instructions_) {
+    names[instruction.result] = fmt::format("r{}", instruction.result);
+  }
+
+  std::ostringstream oss;
+  oss << "void " << function_name << "(const double* p, double* m) {\n";
+  for (const auto& instruction : tape.instructions_) {
+    oss << fmt::format("    const double {} = {};\n",
+                       names[instruction.result],
+                       ExpressionTape::ToCode(instruction, names));
+  }
+  for (int i = 0; i < tape.num_outputs(); ++i) {
+    oss << fmt::format("    m[{}] = {};\n", i, names[tape.outputs_[i]]);
+  }
+  oss << "}\n";
+  internal::CodeGenDenseMeta(function_name, tape.num_parameters(),
+                             tape.num_outputs(), 1, &oss);
+  return oss.str();
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic/expression.h"
+
+namespace drake {
+namespace symbolic {
+
+/// A vector of symbolic expressions compiled once into a flat, register-based
+/// instruction tape, for the repeated evaluation of the expressions in double
+/// without walking their trees or looking variables up in an Environment.
+///
+/// The registers hold the parameters (in the order given at construction), the
+/// constants, and the result of each instruction. While compiling, equal
+/// subexpressions (and equal instructions over the same registers) are mapped
+/// to a single register, so that a subexpression that is shared by several
+/// expressions, or appears several times in one expression, is evaluated only
+/// once per call to Evaluate(). This matters most when the expressions are
+/// accompanied by their derivatives, which repeat much of the expressions.
+///
+/// For example,
+/// @code
+/// const Variable x("x");
+/// const Variable y("y");
+/// const ExpressionTape tape({x, y}, Vector2<Expression>(sin(x) * y,
+///                                                      sin(x) + y));
+/// Eigen::VectorXd result(2);
+/// tape.Evaluate(Eigen::Vector2d(0.5, 2.0), &result);
+/// @endcode
+/// computes sin(0.5) once.
+///
+/// Unlike Expression::Evaluate(), which throws on a division by zero or on an
+/// argument outside of the domain of a function, the tape follows IEEE 754
+/// arithmetic and evaluates such operations to infinities or NaNs.
+class ExpressionTape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionTape)
+
+  /// Compiles @p expressions, whose variables are mapped to the entries of
+  /// the parameter vector of Evaluate() by their index in @p parameters.
+  /// @throws std::exception if an expression includes a variable that is not
+  ///         in @p parameters, a NaN, an if-then-else expression, or an
+  ///         uninterpreted function.
+  ExpressionTape(const std::vector<Variable>& parameters,
+                 const Eigen::Ref<const VectorX<Expression>>& expressions);
+
+  /// Returns the number of parameters.
+  int num_parameters() const { return num_parameters_; }
+
+  /// Returns the number of expressions.
+  int num_outputs() const { return static_cast<int>(outputs_.size()); }
+
+  /// Returns the number of instructions, i.e., of operations that each call to
+  /// Evaluate() performs.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Returns the number of registers, including those of the parameters and
+  /// the constants.
+  int num_registers() const { return static_cast<int>(registers_.size()); }
+
+  /// Evaluates the expressions with their variables set to the values in
+  /// @p parameters, and stores the results in @p result.
+  /// @pre `parameters.size() == num_parameters()`.
+  /// @pre @p result is not null and `result->size() == num_outputs()`.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& parameters,
+                EigenPtr<Eigen::VectorXd> result) const;
+
+ private:
+  class Compiler;
+
+  // The operations of the instructions. Each one sets its result register from
+  // the registers a and b and the coefficient c.
+  enum class Op : uint8_t {
+    kAdd,        // a + b
+    kAddScaled,  // a + c * b
+    kScale,      // c * a
+    kMultiply,   // a * b
+    kDivide,     // a / b
+    kPow,        // pow(a, b)
+    kAbs,
+    kLog,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,  // atan2(a, b)
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,
+    kMax,
+    kCeil,
+    kFloor,
+  };
+
+  struct Instruction {
+    Op op{};
+    int result{};
+    int a{};
+    int b{};
+    double c{};
+  };
+
+  // Returns the C expression of `instruction`, whose registers have the C
+  // expressions `names`.
+  static std::string ToCode(const Instruction& instruction,
+                            const std::vector<std::string>& names);
+
+  friend std::string CodeGen(const std::string&, const ExpressionTape&);
+
+  int num_parameters_{};
+  std::vector<Instruction> instructions_;
+  // The register of each expression.
+  std::vector<int> outputs_;
+  // The initial values of the registers, i.e., the constants, with zeros in
+  // place of the parameters and of the results of the instructions.
+  std::vector<double> registers_;
+};
+
+/// Generates C99 code that evaluates the expressions compiled into @p tape,
+/// with one statement per instruction of the tape (so that, unlike the code
+/// generated from the expressions themselves, the common subexpressions are
+/// evaluated once). The generated functions have the same signatures as those
+/// generated for a dense column vector of the expressions, see
+/// CodeGen(const std::string&, const std::vector<Variable>&, const
+/// Eigen::PlainObjectBase<Derived>&).
+/// @ingroup codegen
+std::string CodeGen(const std::string& function_name,
+                    const ExpressionTape& tape);
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,166 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using std::vector;
+
+class ExpressionTapeTest : public ::testing::Test {
+ protected:
+  // Expects `tape` to evaluate `expressions` as Expression::Evaluate() does at
+  // the parameter values `p`.
+  void ExpectMatchesEvaluate(const ExpressionTape& tape,
+                             const VectorX<Expression>& expressions,
+                             const Eigen::Vector3d& p) const {
+    const Environment env{{x_, p[0]}, {y_, p[1]}, {z_, p[2]}};
+    Eigen::VectorXd result(expressions.size());
+    tape.Evaluate(p, &result);
+    for (int i = 0; i < expressions.size(); ++i) {
+      const double expected = expressions[i].Evaluate(env);
+      EXPECT_NEAR(result[i], expected,
+                  1e-14 * std::max(1.0, std::abs(expected)))
+          << expressions[i];
+    }
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const vector<Variable> parameters_{x_, y_, z_};
+};
+
+TEST_F(ExpressionTapeTest, Evaluate) {
+  VectorX<Expression> expressions(26);
+  // clang-format off
+  expressions << 3.0,
+                 x_,
+                 2 + x_ - 3 * y_ + 0.5 * z_,
+                 -2 * x_ * pow(y_, 2) * pow(z_, 3),
+                 pow(z_, y_),
+                 pow(z_, 0.5),
+                 x_ / y_,
+                 abs(x_ - 1),
+                 log(z_),
+                 exp(x_),
+                 sqrt(z_),
+                 sin(x_),
+                 cos(x_),
+                 tan(x_),
+                 asin(x_),
+                 acos(x_),
+                 atan(y_),
+                 atan2(x_, y_),
+                 sinh(x_),
+                 cosh(x_),
+                 tanh(x_),
+                 min(x_, y_),
+                 max(x_, y_),
+                 ceil(y_),
+                 floor(y_),
+                 sin(x_ * y_) / (1 + pow(cos(x_ * y_), 2)) - exp(-z_);
+  // clang-format on
+  const ExpressionTape tape(parameters_, expressions);
+  EXPECT_EQ(tape.num_parameters(), 3);
+  EXPECT_EQ(tape.num_outputs(), expressions.size());
+  ExpectMatchesEvaluate(tape, expressions, Eigen::Vector3d(0.3, 1.7, 2.5));
+  ExpectMatchesEvaluate(tape, expressions, Eigen::Vector3d(-0.8, -2.2, 0.1));
+
+  // A tape without expressions evaluates to an empty vector.
+  const ExpressionTape empty(parameters_, VectorX<Expression>(0));
+  Eigen::VectorXd result(0);
+  empty.Evaluate(Eigen::Vector3d::Zero(), &result);
+  EXPECT_EQ(empty.num_instructions(), 0);
+}
+
+// Subexpressions that appear several times are evaluated once.
+TEST_F(ExpressionTapeTest, CommonSubexpressions) {
+  const Expression s = sin(x_);
+  const ExpressionTape tape(parameters_, Vector2<Expression>(s * y_, s + y_));
+  // sin(x), sin(x) * y, and sin(x) + y.
+  EXPECT_EQ(tape.num_instructions(), 3);
+  // The parameters and one register per instruction.
+  EXPECT_EQ(tape.num_registers(), 6);
+
+  // A function and its derivatives share most of their operations.
+  const Expression f = sin(x_ * y_) * exp(x_ * y_) + z_;
+  const Vector3<Expression> gradient(f.Differentiate(x_), f.Differentiate(y_),
+                                     f.Differentiate(z_));
+  const VectorX<Expression> f_and_gradient =
+      (VectorX<Expression>(4) << f, gradient).finished();
+  const ExpressionTape combined(parameters_, f_and_gradient);
+  const ExpressionTape separate_f(parameters_, Vector1<Expression>(f));
+  const ExpressionTape separate_gradient(parameters_, gradient);
+  EXPECT_LT(combined.num_instructions(),
+            separate_f.num_instructions() +
+                separate_gradient.num_instructions());
+  ExpectMatchesEvaluate(combined, f_and_gradient,
+                        Eigen::Vector3d(0.3, 1.7, 2.5));
+}
+
+// The tape follows IEEE arithmetic where Expression::Evaluate() throws.
+TEST_F(ExpressionTapeTest, DomainErrors) {
+  const ExpressionTape tape(parameters_,
+                            Vector2<Expression>(1 / x_, sqrt(x_)));
+  Eigen::VectorXd result(2);
+  tape.Evaluate(Eigen::Vector3d(0.0, 0.0, 0.0), &result);
+  EXPECT_EQ(result[0], std::numeric_limits<double>::infinity());
+  tape.Evaluate(Eigen::Vector3d(-1.0, 0.0, 0.0), &result);
+  EXPECT_TRUE(std::isnan(result[1]));
+}
+
+TEST_F(ExpressionTapeTest, Errors) {
+  const Variable w("w");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(parameters_, Vector1<Expression>(x_ + w)),
+      ".*variable w is not a parameter.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(parameters_,
+                     Vector1<Expression>(if_then_else(x_ > y_, x_, y_))),
+      ".*does not support if-then-else expressions.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(parameters_, Vector1<Expression>(
+                                      uninterpreted_function("f", {x_}))),
+      ".*does not support uninterpreted functions.*");
+  EXPECT_THROW(
+      ExpressionTape(parameters_, Vector1<Expression>(Expression::NaN())),
+      std::exception);
+}
+
+TEST_F(ExpressionTapeTest, CodeGen) {
+  const Expression s = sin(x_);
+  const ExpressionTape tape(parameters_,
+                            Vector3<Expression>(s * y_, s - 2 * z_, 4.0));
+  EXPECT_EQ(CodeGen("f", tape),
+            R"""(void f(const double* p, double* m) {
+    const double r3 = sin(p[0]);
+    const double r4 = p[1] * r3;
+    const double r5 = -2 * p[2];
+    const double r6 = r3 + r5;
+    m[0] = r4;
+    m[1] = r6;
+    m[2] = 4;
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+    /* m: output, matrix */
+    struct { int rows; int cols; } m;
+} f_meta_t;
+f_meta_t f_meta() { return {{3}, {3, 1}}; }
+)""");
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,126 @@
+// @file
+// Benchmarks the cost of updating the poses of many objects in Meshcat, as
+// MeshcatVisualizer does on every publish. It compares one SetTransform() call
+// per path against a single batched SetTransforms() call, for a scene where
+// all or only some of the objects move. Besides the time per frame (which
+// includes the work done on Meshcat's websocket thread), it reports the bytes
+// that Meshcat published, per frame (`bytes_per_frame`) and per second
+// (`bytes_per_second`), as measured by Meshcat::GetTransportStatistics().
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include "drake/geometry/meshcat.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+/* Sets the poses of `state.range(0)` objects, of which the first
+ `state.range(1)` percent move in every frame. */
+class MeshcatTransformsBenchmark : public benchmark::Fixture {
+ public:
+  MeshcatTransformsBenchmark() {
+    tools::performance::AddMinMaxStatistics(this);
+    this->Unit(benchmark::kMicrosecond);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(const benchmark::State& state) override {
+    const int num_objects = state.range(0);
+    num_moving_ = num_objects * state.range(1) / 100;
+    meshcat_ = std::make_shared<Meshcat>();
+    paths_.clear();
+    X_WBs_.clear();
+    for (int i = 0; i < num_objects; ++i) {
+      paths_.push_back(fmt::format("scene/body_{}/visual", i));
+      X_WBs_.emplace_back(RollPitchYawd(0.1 * i, 0.2, 0.3),
+                          Vector3d(i % 40, i / 40, 0.5));
+    }
+    // Every benchmark starts from a scene in which all objects are posed.
+    meshcat_->SetTransforms(paths_, X_WBs_);
+    meshcat_->Flush();
+  }
+
+  void TearDown(const benchmark::State&) override { meshcat_.reset(); }
+
+ protected:
+  // Moves the moving objects to the pose for the given frame number.
+  void MoveObjects(int frame) {
+    for (int i = 0; i < num_moving_; ++i) {
+      X_WBs_[i].set_translation(
+          Vector3d(i % 40, i / 40, 0.5 + 0.01 * (frame % 100)));
+    }
+  }
+
+  int64_t bytes_published() const {
+    return meshcat_->GetTransportStatistics().bytes_published;
+  }
+
+  // Reports the bytes published since `bytes_before` over all iterations.
+  // NOLINTNEXTLINE(runtime/references)
+  void ReportTraffic(benchmark::State& state, int64_t bytes_before) const {
+    const double bytes = bytes_published() - bytes_before;
+    state.counters["bytes_per_frame"] =
+        benchmark::Counter(bytes, benchmark::Counter::kAvgIterations);
+    state.counters["bytes_per_second"] =
+        benchmark::Counter(bytes, benchmark::Counter::kIsRate);
+  }
+
+  int num_moving_{};
+  std::shared_ptr<Meshcat> meshcat_;
+  std::vector<std::string> paths_;
+  std::vector<RigidTransformd> X_WBs_;
+};
+
+BENCHMARK_DEFINE_F(MeshcatTransformsBenchmark, SetTransform)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  const int64_t bytes_before = bytes_published();
+  int frame = 0;
+  for (auto _ : state) {
+    MoveObjects(++frame);
+    for (size_t i = 0; i < paths_.size(); ++i) {
+      meshcat_->SetTransform(paths_[i], X_WBs_[i]);
+    }
+    meshcat_->Flush();
+  }
+  ReportTraffic(state, bytes_before);
+}
+
+BENCHMARK_DEFINE_F(MeshcatTransformsBenchmark, SetTransforms)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  const int64_t bytes_before = bytes_published();
+  int frame = 0;
+  for (auto _ : state) {
+    MoveObjects(++frame);
+    meshcat_->SetTransforms(paths_, X_WBs_);
+    meshcat_->Flush();
+  }
+  ReportTraffic(state, bytes_before);
+}
+
+// The Args are { number of objects, percentage of objects that move }.
+BENCHMARK_REGISTER_F(MeshcatTransformsBenchmark, SetTransform)
+    ->Args({100, 100})
+    ->Args({1500, 100})
+    ->Args({1500, 10});
+BENCHMARK_REGISTER_F(MeshcatTransformsBenchmark, SetTransforms)
+    ->Args({100, 100})
+    ->Args({1500, 100})
+    ->Args({1500, 10});
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,124 @@
+// @file
+// Benchmarks the cost of copying a ProximityEngine whose scene is dominated by
+// anchored geometry (e.g., the engine inside each per-thread
+// CollisionCheckerContext, or a SceneGraph context cloned for a Monte Carlo
+// run). It reports the time per copy and, via the `rss_per_copy_KiB` counter,
+// the approximate growth in resident memory per copy.
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/proximity_engine.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using math::RigidTransformd;
+
+// Returns the resident set size of this process in bytes, or zero if it can't
+// be determined.
+double GetResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  long total_pages{};   // NOLINT(runtime/int)
+  long resident_pages{};  // NOLINT(runtime/int)
+  if (!(statm >> total_pages >> resident_pages)) return 0;
+  return static_cast<double>(resident_pages) * sysconf(_SC_PAGESIZE);
+}
+
+/* Populates an engine with a static environment of `state.range(0)` anchored
+ geometries -- a mix of primitives and meshes, some with rigid hydroelastic
+ representations -- and a handful of dynamic geometries. */
+class ProximityEngineCloneBenchmark : public benchmark::Fixture {
+ public:
+  ProximityEngineCloneBenchmark() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(const benchmark::State& state) override {
+    const int num_anchored = state.range(0);
+    const std::string obj =
+        FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+    ProximityProperties hydro_props;
+    AddRigidHydroelasticProperties(0.5, &hydro_props);
+    const ProximityProperties point_props;
+
+    engine_ = std::make_unique<ProximityEngine<double>>();
+    const int grid = 100;
+    for (int i = 0; i < num_anchored; ++i) {
+      const RigidTransformd X_WG(
+          Vector3<double>(i % grid, (i / grid) % grid, i / (grid * grid)));
+      const GeometryId id = GeometryId::get_new_id();
+      switch (i % 4) {
+        case 0:
+          engine_->AddAnchoredGeometry(Box(0.4, 0.3, 0.2), X_WG, id,
+                                       hydro_props);
+          break;
+        case 1:
+          engine_->AddAnchoredGeometry(Sphere(0.2), X_WG, id, point_props);
+          break;
+        case 2:
+          engine_->AddAnchoredGeometry(Convex(obj, 0.2), X_WG, id,
+                                       hydro_props);
+          break;
+        case 3:
+          engine_->AddAnchoredGeometry(Cylinder(0.1, 0.3), X_WG, id,
+                                       point_props);
+          break;
+      }
+    }
+    for (int i = 0; i < kNumDynamic; ++i) {
+      engine_->AddDynamicGeometry(Sphere(0.1), RigidTransformd::Identity(),
+                                  GeometryId::get_new_id(), point_props);
+    }
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(const benchmark::State&) override { engine_.reset(); }
+
+ protected:
+  static constexpr int kNumDynamic = 20;
+
+  std::unique_ptr<ProximityEngine<double>> engine_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ProximityEngineCloneBenchmark, Copy)
+(benchmark::State& state) {
+  // Measure the memory growth while holding a batch of copies alive.
+  {
+    const int kNumCopies = 16;
+    std::vector<std::unique_ptr<ProximityEngine<double>>> copies;
+    const double before = GetResidentBytes();
+    for (int i = 0; i < kNumCopies; ++i) {
+      copies.push_back(std::make_unique<ProximityEngine<double>>(*engine_));
+    }
+    const double after = GetResidentBytes();
+    state.counters["rss_per_copy_KiB"] = (after - before) / kNumCopies / 1024;
+  }
+
+  for (auto _ : state) {
+    ProximityEngine<double> copy(*engine_);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK_REGISTER_F(ProximityEngineCloneBenchmark, Copy)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(500)
+    ->Arg(5000);
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -3,6 +3,8 @@
 #include <unistd.h>
 
 #include <filesystem>
+#include <future>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <fmt/format.h>
@@ -19,6 +21,7 @@ namespace {
 using Eigen::Vector3d;
 using math::RigidTransformd;
 using math::RotationMatrixd;
+using render::ColorImageRequest;
 using render::ColorRenderCamera;
 using render::DepthRange;
 using render::DepthRenderCamera;
@@ -171,6 +174,57 @@ class RenderBenchmark : public benchmark::Fixture {
     }
   }
 
+  /* Renders the color images of all cameras from a single engine, with the
+   cameras divided among `state.range(4)` threads that render concurrently.  */
+  template <EngineType engine_type>
+  // NOLINTNEXTLINE(runtime/references)
+  void ParallelColorImage(::benchmark::State& state, const std::string& name) {
+    auto renderer = MakeEngine<engine_type>(bg_rgb_);
+    if (!renderer->SupportsConcurrentRendering()) {
+      state.SkipWithError("The engine doesn't support concurrent rendering");
+      return;
+    }
+    auto [sphere_count, camera_count, width, height] = ReadState(state);
+    const int thread_count = state.range(4);
+    SetupScene(sphere_count, camera_count, width, height, renderer.get());
+    std::vector<ImageRgba8U> color_images(thread_count,
+                                          ImageRgba8U(width, height));
+
+    auto render_all_cameras = [&]() {
+      std::vector<std::future<void>> futures;
+      for (int t = 0; t < thread_count; ++t) {
+        futures.push_back(std::async(std::launch::async, [&, t]() {
+          // Concurrent renders carry their viewpoint in each request.
+          for (int i = t; i < camera_count; i += thread_count) {
+            const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                              FLAGS_show_window);
+            renderer->RenderImages(
+                {ColorImageRequest{color_cam, X_WC_, &color_images[t]}});
+          }
+        }));
+      }
+      for (auto& future : futures) {
+        future.get();
+      }
+    };
+
+    /* As above, warm start the engine; in particular, this is where the engine
+     creates whatever it needs to render on multiple threads.  */
+    for (int i = 0; i < 2; ++i) {
+      render_all_cameras();
+    }
+
+    /* Now the timed loop. */
+    for (auto _ : state) {
+      renderer->UpdatePoses(poses_);
+      render_all_cameras();
+    }
+    if (!FLAGS_save_image_path.empty()) {
+      const std::string path_name = image_path_name(name, state, "png");
+      SaveToPng(color_images[0], path_name);
+    }
+  }
+
   /* Parse arguments from the benchmark state.
    @return A tuple representing the sphere count, camera count, width, and
            height.  */
@@ -285,9 +339,9 @@ class RenderBenchmark : public benchmark::Fixture {
     const Vector3d Cx_W{1, 0, 0};
     const Vector3d Cy_W{0, -1, 0};
     const Vector3d Cz_W{0, 0, -1};
-    RigidTransformd X_WC{
+    X_WC_ = RigidTransformd{
         RotationMatrixd::MakeFromOrthonormalColumns(Cx_W, Cy_W, Cz_W)};
-    engine->UpdateViewpoint(X_WC);
+    engine->UpdateViewpoint(X_WC_);
 
     // Add the cameras.
     for (int i = 0; i < camera_count; ++i) {
@@ -301,6 +355,7 @@ class RenderBenchmark : public benchmark::Fixture {
   }
 
   std::vector<DepthRenderCamera> depth_cameras_;
+  RigidTransformd X_WC_;
   PerceptionProperties material_;
   const Vector3d bg_rgb_{200 / 255., 0, 250 / 255.};
   const Rgba sphere_rgba_{0, 0.8, 0.5, 1};
@@ -355,6 +410,28 @@ MAKE_BENCHMARK(Vtk, Color);
 MAKE_BENCHMARK(Vtk, Depth);
 MAKE_BENCHMARK(Vtk, Label);
 
+/* The parallel benchmarks take a fifth parameter: the number of threads. */
+#define MAKE_PARALLEL_BENCHMARK(Renderer)                        \
+  BENCHMARK_DEFINE_F(RenderBenchmark, Renderer##ParallelColor)   \
+  (benchmark::State & state) {                                   \
+    ParallelColorImage<EngineType::Renderer>(                    \
+        state, STR(Renderer##ParallelColor));                    \
+  }                                                              \
+  BENCHMARK_REGISTER_F(RenderBenchmark, Renderer##ParallelColor) \
+      ->Unit(benchmark::kMillisecond)                            \
+      ->UseRealTime()                                            \
+      ->Args({1, 1, 320, 240, 2})                                \
+      ->Args({12, 16, 640, 480, 1})                              \
+      ->Args({12, 16, 640, 480, 2})                              \
+      ->Args({12, 16, 640, 480, 4})                              \
+      ->Args({12, 16, 640, 480, 8})                              \
+      ->Args({12, 16, 640, 480, 16})                             \
+      ->Args({1200, 16, 640, 480, 1})                            \
+      ->Args({1200, 16, 640, 480, 4})                            \
+      ->Args({1200, 16, 640, 480, 16})
+
+MAKE_PARALLEL_BENCHMARK(Vtk);
+
 #ifndef __APPLE__
 MAKE_BENCHMARK(Gl, Color);
 MAKE_BENCHMARK(Gl, Depth);
@@ -53,6 +53,12 @@ namespace render {
  We examine those same properties for all three image types: color, depth, and
  label.
 
+ For render engines that support concurrent rendering (see
+ RenderEngine::SupportsConcurrentRendering()), we additionally examine the
+ scalability w.r.t. the number of rendering threads: the color images of
+ multiple cameras are rendered by a single engine, with the cameras divided
+ evenly among threads that render concurrently.
+
  <h2>Running the benchmark</h2>
 
  The benchmark can be executed as:
@@ -137,6 +143,9 @@ namespace render {
      - __GlColor__: Renders the color image from RenderEngineGl.
      - __GlDepth__: Renders the depth image from RenderEngineGl.
      - __GlLabel__: Renders the label image from RenderEngineGl.
+     - __VtkParallelColor__: Renders the color images from RenderEngineVtk on
+       multiple threads. Its configuration has an additional, final parameter:
+       the number of threads (`thread_count`).
    - __sphere_count__: The total number of spheres.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
@@ -1028,13 +1028,13 @@ void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
         // Pass the geometry to the engine.
         const RigidTransformd& X_WG =
             convert_to_double(kinematics_data_.X_WGs.at(geometry_id));
-        geometry_engine_->AddDynamicGeometry(geometry.shape(), X_WG,
-                                             geometry_id,
-                                             *geometry.proximity_properties());
+        geometry_engine_->AddDynamicGeometry(
+            geometry.shape(), X_WG, geometry_id,
+            *geometry.proximity_properties(), geometry.name());
       } else {
-        geometry_engine_->AddAnchoredGeometry(geometry.shape(), geometry.X_FG(),
-                                              geometry_id,
-                                              *geometry.proximity_properties());
+        geometry_engine_->AddAnchoredGeometry(
+            geometry.shape(), geometry.X_FG(), geometry_id,
+            *geometry.proximity_properties(), geometry.name());
       }
       // The set of geometries G such that I need to introduce filtered pairs
       // (geometry_id, gᵢ) ∀ gᵢ ∈ G. Generally, it consists of those proximity
@@ -1236,6 +1236,29 @@ SignedDistancePair<T> GeometryState<T>::ComputeSignedDistancePairClosestPoints(
       id_A, id_B, kinematics_data_.X_WGs);
 }
 
+template <typename T>
+std::optional<TimeOfImpact> GeometryState<T>::ComputeTimeOfImpact(
+    const std::unordered_map<FrameId, RigidTransformd>& X_WFs_end,
+    double distance_threshold) const {
+  for (const auto& id_pose_pair : X_WFs_end) {
+    const FrameId frame_id = id_pose_pair.first;
+    FindOrThrow(frame_id, frames_, [frame_id]() {
+      return get_missing_id_message(frame_id);
+    });
+  }
+  // The end poses of the proximity geometries affixed to the moving frames;
+  // all other geometries remain at their current poses.
+  std::unordered_map<GeometryId, RigidTransformd> X_WGs_end;
+  for (const auto& [geometry_id, geometry] : geometries_) {
+    if (!geometry.has_proximity_role()) continue;
+    const auto iter = X_WFs_end.find(geometry.frame_id());
+    if (iter == X_WFs_end.end()) continue;
+    X_WGs_end.emplace(geometry_id, iter->second * geometry.X_FG());
+  }
+  return geometry_engine_->ComputeTimeOfImpact(
+      kinematics_data_.X_WGs, X_WGs_end, distance_threshold);
+}
+
 template <typename T>
 void GeometryState<T>::AddRenderer(
     std::string name, std::unique_ptr<render::RenderEngine> renderer) {
@@ -1337,6 +1360,37 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
   engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(
+    const std::vector<render::ImageRequest>& requests) const {
+  // Partition the requests by render engine, preserving their order, so that
+  // each engine renders its share in a single batch.
+  std::vector<std::pair<const render::RenderEngine*,
+                        std::vector<render::ImageRequest>>>
+      batches;
+  for (const render::ImageRequest& request : requests) {
+    const std::string& renderer_name = std::visit(
+        [](const auto& r) -> const std::string& {
+          return r.camera.core().renderer_name();
+        },
+        request);
+    const render::RenderEngine* engine = &GetRenderEngineOrThrow(renderer_name);
+    auto iter = std::find_if(batches.begin(), batches.end(),
+                             [engine](const auto& batch) {
+                               return batch.first == engine;
+                             });
+    if (iter == batches.end()) {
+      iter = batches.emplace(batches.end(), engine,
+                             std::vector<render::ImageRequest>{});
+    }
+    iter->second.push_back(request);
+  }
+  for (const auto& [engine, batch] : batches) {
+    // See note in RenderColorImage() about this const cast.
+    const_cast<render::RenderEngine*>(engine)->RenderImages(batch);
+  }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
@@ -1667,11 +1721,13 @@ void GeometryState<T>::AddToProximityEngineUnchecked(
     const RigidTransformd& X_WG =
         convert_to_double(kinematics_data_.X_WGs.at(geometry_id));
     geometry_engine_->AddDynamicGeometry(geometry.shape(), X_WG, geometry_id,
-                                         *geometry.proximity_properties());
+                                         *geometry.proximity_properties(),
+                                         geometry.name());
   } else {
     geometry_engine_->AddAnchoredGeometry(geometry.shape(), geometry.X_FG(),
                                           geometry_id,
-                                          *geometry.proximity_properties());
+                                          *geometry.proximity_properties(),
+                                          geometry.name());
   }
   geometry_version_.modify_proximity();
 }
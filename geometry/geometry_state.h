@@ -474,6 +474,14 @@ class GeometryState {
         kinematics_data_.X_WGs);
   }
 
+  /** Implementation of QueryObject::ComputePointPairPenetration(
+   std::vector<PenetrationAsPointPair<T>>*).  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+    geometry_engine_->ComputePointPairPenetration(kinematics_data_.X_WGs,
+                                                  point_pairs);
+  }
+
   /** Implementation of QueryObject::ComputeContactSurfaces().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
@@ -484,6 +492,16 @@ class GeometryState {
                                                     kinematics_data_.X_WGs);
   }
 
+  /** Implementation of QueryObject::ComputeContactSurfaces(
+   HydroelasticContactRepresentation, std::vector<ContactSurface<T>>*).  */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         std::vector<ContactSurface<T>>* surfaces) const {
+    geometry_engine_->ComputeContactSurfaces(representation,
+                                             kinematics_data_.X_WGs, surfaces);
+  }
+
   /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
@@ -513,6 +531,22 @@ class GeometryState {
   /** Implementation of QueryObject::HasCollisions().  */
   bool HasCollisions() const { return geometry_engine_->HasCollisions(); }
 
+  /** Implementation of QueryObject::CastRays().  */
+  void CastRays(const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W,
+                double max_distance, EigenPtr<Eigen::VectorXd> distances,
+                std::vector<GeometryId>* geometry_ids,
+                EigenPtr<Eigen::Matrix3Xd> normals_W,
+                Parallelism parallelism) const {
+    geometry_engine_->CastRays(p_WRs, dirs_W, max_distance, distances,
+                               geometry_ids, normals_W, parallelism);
+  }
+
+  /** Implementation of QueryObject::ComputeTimeOfImpact().  */
+  std::optional<TimeOfImpact> ComputeTimeOfImpact(
+      const std::unordered_map<FrameId, math::RigidTransformd>& X_WFs_end,
+      double distance_threshold) const;
+
   //@}
 
   /** @name        Collision filtering    */
@@ -542,6 +576,16 @@ class GeometryState {
         kinematics_data_.X_WGs, max_distance);
   }
 
+  /** Implementation of
+   QueryObject::ComputeSignedDistancePairwiseClosestPoints(double,
+   std::vector<SignedDistancePair<T>>*).  */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance,
+      std::vector<SignedDistancePair<T>>* signed_distances) const {
+    geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
+        kinematics_data_.X_WGs, max_distance, signed_distances);
+  }
+
   /** Implementation of
    QueryObject::ComputeSignedDistancePairClosestPoints().  */
   SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
@@ -606,6 +650,10 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(const std::vector<render::ImageRequest>& requests) const;
+
   //@}
 
   /** @name Scalar conversion */
@@ -3,10 +3,12 @@
 #include <algorithm>
 #include <atomic>
 #include <cctype>
+#include <cmath>
 #include <exception>
 #include <fstream>
 #include <functional>
 #include <future>
+#include <limits>
 #include <map>
 #include <optional>
 #include <regex>
@@ -85,7 +87,7 @@ std::string CreateCommand(const std::string& data) {
   return fmt::format(R"""(
 fetch("data:application/octet-binary;base64,{}")
     .then(res => res.arrayBuffer())
-    .then(buffer => viewer.handle_command_bytearray(new Uint8Array(buffer)));
+    .then(buffer => handle_message({{data: buffer}}));
 )""",
                      common_robotics_utilities::base64_helpers::Encode(
                          std::vector<uint8_t>(data.begin(), data.end())));
@@ -678,7 +680,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
     });
   }
 
@@ -702,6 +704,15 @@ class Meshcat::Impl {
     return num_websockets_.load();
   }
 
+  // This function is public via the PIMPL.
+  Meshcat::TransportStatistics GetTransportStatistics() const {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    Meshcat::TransportStatistics result;
+    result.bytes_published = bytes_published_.load();
+    result.backpressure = backpressure_.load();
+    return result;
+  }
+
   // This function is public via the PIMPL.
   void Flush() const {
     DRAKE_DEMAND(IsThread(main_thread_id_));
@@ -810,7 +821,7 @@ class Meshcat::Impl {
       // (here and throughout) to avoid this copy.
       // https://github.com/redboltz/msgpack-c/wiki/v2_0_cpp_packer
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -853,7 +864,79 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
+      SceneTreeElement& e = scene_tree_root_[data.path];
+      e.object() = std::move(message);
+    });
+  }
+
+  // This function is public via the PIMPL.
+  void SetQuantizedPointCloud(std::string_view path,
+                              const perception::PointCloud& cloud,
+                              double point_size, const Rgba& rgba) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+
+    internal::SetPointCloudData data;
+    data.path = FullPath(path);
+    data.point_size = point_size;
+    data.color = ToMeshcatColor(rgba);
+    data.opacity = rgba.a();
+
+    // Find the bounding box of the finite points.
+    const Eigen::Matrix3Xf& xyzs = cloud.xyzs();
+    Eigen::Vector3f lower =
+        Eigen::Vector3f::Constant(std::numeric_limits<float>::infinity());
+    Eigen::Vector3f upper = -lower;
+    int num_points = 0;
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (xyzs.col(i).allFinite()) {
+        lower = lower.cwiseMin(xyzs.col(i));
+        upper = upper.cwiseMax(xyzs.col(i));
+        ++num_points;
+      }
+    }
+    if (num_points == 0) {
+      lower.setZero();
+      upper.setZero();
+    }
+
+    // Quantize each coordinate to 16 bits relative to the bounding box. We
+    // quantize against the (float) values that the client will decode with,
+    // so that the error is at most half of one step.
+    constexpr int kMaxQuantized = std::numeric_limits<uint16_t>::max();
+    const Eigen::Vector3f scale = (upper - lower) / kMaxQuantized;
+    Eigen::Vector3d inverse_scale;
+    for (int k = 0; k < 3; ++k) {
+      data.lower[k] = lower[k];
+      data.scale[k] = scale[k];
+      inverse_scale[k] = scale[k] > 0 ? 1.0 / scale[k] : 0.0;
+    }
+    const bool has_rgbs = cloud.has_rgbs();
+    data.positions.reserve(3 * num_points);
+    if (has_rgbs) {
+      data.colors.reserve(3 * num_points);
+    }
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (!xyzs.col(i).allFinite()) {
+        continue;
+      }
+      for (int k = 0; k < 3; ++k) {
+        const double quantized = std::round(
+            (static_cast<double>(xyzs(k, i)) - lower[k]) * inverse_scale[k]);
+        data.positions.push_back(static_cast<uint16_t>(
+            std::clamp(quantized, 0.0, static_cast<double>(kMaxQuantized))));
+        if (has_rgbs) {
+          data.colors.push_back(cloud.rgbs()(k, i));
+        }
+      }
+    }
+
+    Defer([this, data = std::move(data)]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, data);
+      std::string message = message_stream.str();
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -936,7 +1019,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -982,7 +1065,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -1029,7 +1112,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -1053,7 +1136,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.object() = std::move(message);
     });
@@ -1064,6 +1147,7 @@ class Meshcat::Impl {
                     const RigidTransformd& X_ParentPath) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
     SetTransform(path, X_ParentPath.GetAsMatrix4());
+    sent_transforms_.insert_or_assign(FullPath(path), X_ParentPath);
   }
 
   // This function is public via the PIMPL.
@@ -1074,6 +1158,11 @@ class Meshcat::Impl {
     internal::SetTransformData data;
     data.path = FullPath(path);
     Eigen::Map<Eigen::Matrix4d>(data.matrix) = matrix;
+    // The matrix need not be a rigid transform, so we forget what was sent.
+    if (auto iter = sent_transforms_.find(data.path);
+        iter != sent_transforms_.end()) {
+      sent_transforms_.erase(iter);
+    }
 
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
@@ -1081,12 +1170,69 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.transform() = std::move(message);
     });
   }
 
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths,
+                     double tolerance) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_DEMAND(paths.size() == X_ParentPaths.size());
+
+    // Only the transforms that changed since they were last sent are sent in
+    // the (single) message to the browsers. The double-precision matrices are
+    // kept for the scene tree, so that browsers which connect later (or the
+    // StaticHtml) receive the same set_transform commands as SetTransform()
+    // would have sent.
+    internal::SetTransformsData data;
+    std::vector<Eigen::Matrix4d> matrices;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      const RigidTransformd& X_ParentPath = X_ParentPaths[i];
+      std::string full_path = FullPath(paths[i]);
+      auto [iter, inserted] =
+          sent_transforms_.try_emplace(full_path, X_ParentPath);
+      if (!inserted) {
+        if (iter->second.IsNearlyEqualTo(X_ParentPath, tolerance)) {
+          continue;
+        }
+        iter->second = X_ParentPath;
+      }
+      const Eigen::Vector3d& p = X_ParentPath.translation();
+      const Eigen::Quaterniond q = X_ParentPath.rotation().ToQuaternion();
+      data.poses.insert(data.poses.end(),
+                        {static_cast<float>(p.x()), static_cast<float>(p.y()),
+                         static_cast<float>(p.z()), static_cast<float>(q.x()),
+                         static_cast<float>(q.y()), static_cast<float>(q.z()),
+                         static_cast<float>(q.w())});
+      data.paths.push_back(std::move(full_path));
+      matrices.push_back(X_ParentPath.GetAsMatrix4());
+    }
+    if (data.paths.empty()) {
+      return;
+    }
+
+    Defer([this, data = std::move(data), matrices = std::move(matrices)]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      DRAKE_DEMAND(app_ != nullptr);
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, data);
+      Publish(message_stream.str());
+      internal::SetTransformData transform;
+      for (size_t i = 0; i < data.paths.size(); ++i) {
+        transform.path = data.paths[i];
+        Eigen::Map<Eigen::Matrix4d>(transform.matrix) = matrices[i];
+        std::stringstream transform_stream;
+        msgpack::pack(transform_stream, transform);
+        SceneTreeElement& e = scene_tree_root_[transform.path];
+        e.transform() = transform_stream.str();
+      }
+    });
+  }
+
   // This function is public via the PIMPL.
   void Delete(std::string_view path) {
     DRAKE_DEMAND(IsThread(main_thread_id_));
@@ -1094,12 +1240,25 @@ class Meshcat::Impl {
     internal::DeleteData data;
     data.path = FullPath(path);
 
+    // Forget the transforms sent to the path and all of its descendants.
+    for (auto iter = sent_transforms_.lower_bound(data.path);
+         iter != sent_transforms_.end() &&
+         iter->first.compare(0, data.path.size(), data.path) == 0;) {
+      const std::string& key = iter->first;
+      if (key.size() == data.path.size() || data.path.back() == '/' ||
+          key[data.path.size()] == '/') {
+        iter = sent_transforms_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+
     Defer([this, data = std::move(data)]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
       scene_tree_root_.Delete(data.path);
     });
   }
@@ -1122,7 +1281,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.properties()[data.property] = std::move(message);
     });
@@ -1207,7 +1366,7 @@ class Meshcat::Impl {
     Defer([this, message = message_stream.str()]() {
       DRAKE_DEMAND(IsThread(websocket_thread_id_));
       DRAKE_DEMAND(app_ != nullptr);
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       animation_ = std::move(message);
     });
   }
@@ -1269,7 +1428,7 @@ class Meshcat::Impl {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      Publish(message);
       camera_target_message_ = std::move(message);
     });
   }
@@ -1338,7 +1497,7 @@ class Meshcat::Impl {
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
     });
   }
 
@@ -1376,7 +1535,7 @@ class Meshcat::Impl {
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
     });
   }
 
@@ -1427,7 +1586,7 @@ class Meshcat::Impl {
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
     });
   }
 
@@ -1458,7 +1617,7 @@ class Meshcat::Impl {
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
     });
   }
 
@@ -1510,7 +1669,7 @@ class Meshcat::Impl {
       DRAKE_DEMAND(app_ != nullptr);
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      Publish(message_stream.str());
     });
   }
 
@@ -1783,6 +1942,10 @@ class Meshcat::Impl {
       // IsThread(websocket_thread_id_) is checked by the Handle... function.
       HandleMessage(ws, message);
     };
+    behavior.drain = [this](WebSocket*) {
+      // IsThread(websocket_thread_id_) is checked by UpdateBackpressure.
+      UpdateBackpressure();
+    };
 
     uWS::App app = uWS::App()
                        .get("/*",
@@ -1897,6 +2060,7 @@ class Meshcat::Impl {
     const int new_count = --num_websockets_;
     DRAKE_DEMAND(new_count >= 0);
     DRAKE_DEMAND(new_count == static_cast<int>(websockets_.size()));
+    UpdateBackpressure();
     if (ws == camera_pose_source_) {
       std::lock_guard<std::mutex> lock(controls_mutex_);
       camera_pose_source_ = nullptr;
@@ -2026,6 +2190,29 @@ class Meshcat::Impl {
     }
   }
 
+  // This function is a private utility for use within this class. It publishes
+  // the given message to all connected clients, and updates the transport
+  // statistics.
+  void Publish(std::string_view message) {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    DRAKE_DEMAND(app_ != nullptr);
+    app_->publish("all", message, uWS::OpCode::BINARY, false);
+    bytes_published_ += message.size();
+    UpdateBackpressure();
+  }
+
+  // This function is a private utility for use within this class. It records
+  // the largest backpressure among the connections, for use by the main thread.
+  void UpdateBackpressure() {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    int64_t backpressure = 0;
+    for (WebSocket* ws : websockets_) {
+      backpressure =
+          std::max<int64_t>(backpressure, ws->getBufferedAmount());
+    }
+    backpressure_ = backpressure;
+  }
+
   // This function is a private utility for use within this class. It closes all
   // sockets therefore will cause the uWS::App::run() function to return, and
   // therefore the worker thread will (eventually) exit. This should only be
@@ -2089,6 +2276,9 @@ class Meshcat::Impl {
   internal::UuidGenerator uuid_generator_{};
   double realtime_rate_{0.0};
   bool is_orthographic_{false};
+  // The most recent rigid transform sent for each (full) path; used by
+  // SetTransforms() to skip the paths whose transform has not changed.
+  std::map<std::string, RigidTransformd, std::less<>> sent_transforms_{};
 
   // These variables should only be accessed in the websocket thread.
   std::thread::id websocket_thread_id_{};
@@ -2102,6 +2292,11 @@ class Meshcat::Impl {
   // in the websocket thread.
   std::atomic<int> num_websockets_{0};
 
+  // These variables may be accessed from any thread, but should only be
+  // modified in the websocket thread. See GetTransportStatistics().
+  std::atomic<int64_t> bytes_published_{0};
+  std::atomic<int64_t> backpressure_{0};
+
   // The loop_ pointer is used to pass functors from the main thread into the
   // websocket worker thread, via loop_->defer(...). See the documentation of
   // uWebSockets for further details:
@@ -2227,6 +2422,10 @@ int Meshcat::GetNumActiveConnections() const {
   return impl().GetNumActiveConnections();
 }
 
+Meshcat::TransportStatistics Meshcat::GetTransportStatistics() const {
+  return impl().GetTransportStatistics();
+}
+
 void Meshcat::Flush() const {
   impl().Flush();
 }
@@ -2242,6 +2441,12 @@ void Meshcat::SetObject(std::string_view path,
   impl().SetObject(path, cloud, point_size, rgba);
 }
 
+void Meshcat::SetQuantizedPointCloud(std::string_view path,
+                                     const perception::PointCloud& cloud,
+                                     double point_size, const Rgba& rgba) {
+  impl().SetQuantizedPointCloud(path, cloud, point_size, rgba);
+}
+
 void Meshcat::SetObject(std::string_view path,
                         const TriangleSurfaceMesh<double>& mesh,
                         const Rgba& rgba, bool wireframe,
@@ -2355,14 +2560,49 @@ void Meshcat::SetTransform(std::string_view path,
                            const RigidTransformd& X_ParentPath,
                            const std::optional<double>& time) {
   if (recording_ && time) {
-    animation_->SetTransform(animation_->frame(*time), std::string(path),
-                             X_ParentPath);
+    if (recording_writer_) {
+      recording_writer_->SetTransform(*time, path, X_ParentPath);
+    } else {
+      animation_->SetTransform(animation_->frame(*time), std::string(path),
+                               X_ParentPath);
+    }
   }
   if (!recording_ || !time || set_visualizations_while_recording_) {
     impl().SetTransform(path, X_ParentPath);
   }
 }
 
+void Meshcat::SetTransforms(
+    const std::vector<std::string>& paths,
+    const std::vector<RigidTransformd>& X_ParentPaths, double tolerance,
+    const std::optional<double>& time) {
+  if (paths.size() != X_ParentPaths.size()) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetTransforms(): got {} paths but {} transforms",
+        paths.size(), X_ParentPaths.size()));
+  }
+  if (!(tolerance >= 0.0)) {
+    throw std::logic_error(fmt::format(
+        "Meshcat::SetTransforms(): the tolerance must be non-negative; got {}",
+        tolerance));
+  }
+  if (recording_ && time) {
+    if (recording_writer_) {
+      for (size_t i = 0; i < paths.size(); ++i) {
+        recording_writer_->SetTransform(*time, paths[i], X_ParentPaths[i]);
+      }
+    } else {
+      const int frame = animation_->frame(*time);
+      for (size_t i = 0; i < paths.size(); ++i) {
+        animation_->SetTransform(frame, paths[i], X_ParentPaths[i]);
+      }
+    }
+  }
+  if (!recording_ || !time || set_visualizations_while_recording_) {
+    impl().SetTransforms(paths, X_ParentPaths, tolerance);
+  }
+}
+
 void Meshcat::SetTransform(std::string_view path,
                            const Eigen::Ref<const Eigen::Matrix4d>& matrix) {
   impl().SetTransform(path, matrix);
@@ -2383,8 +2623,12 @@ double Meshcat::GetRealtimeRate() const {
 void Meshcat::SetProperty(std::string_view path, std::string property,
                           bool value, const std::optional<double>& time) {
   if (recording_ && time) {
-    animation_->SetProperty(animation_->frame(*time), std::string(path),
-                            property, value);
+    if (recording_writer_) {
+      recording_writer_->SetProperty(*time, path, property, value);
+    } else {
+      animation_->SetProperty(animation_->frame(*time), std::string(path),
+                              property, value);
+    }
   }
   if (!recording_ || !time || set_visualizations_while_recording_) {
     impl().SetProperty(path, std::move(property), value);
@@ -2394,8 +2638,12 @@ void Meshcat::SetProperty(std::string_view path, std::string property,
 void Meshcat::SetProperty(std::string_view path, std::string property,
                           double value, const std::optional<double>& time) {
   if (recording_ && time) {
-    animation_->SetProperty(animation_->frame(*time), std::string(path),
-                            property, value);
+    if (recording_writer_) {
+      recording_writer_->SetProperty(*time, path, property, value);
+    } else {
+      animation_->SetProperty(animation_->frame(*time), std::string(path),
+                              property, value);
+    }
   }
   if (!recording_ || set_visualizations_while_recording_) {
     impl().SetProperty(path, std::move(property), value);
@@ -2406,8 +2654,12 @@ void Meshcat::SetProperty(std::string_view path, std::string property,
                           const std::vector<double>& value,
                           const std::optional<double>& time) {
   if (recording_ && time) {
-    animation_->SetProperty(animation_->frame(*time), std::string(path),
-                            property, value);
+    if (recording_writer_) {
+      recording_writer_->SetProperty(*time, path, property, value);
+    } else {
+      animation_->SetProperty(animation_->frame(*time), std::string(path),
+                              property, value);
+    }
   }
   if (!recording_ || set_visualizations_while_recording_) {
     impl().SetProperty(path, std::move(property), value);
@@ -2522,11 +2774,30 @@ std::string Meshcat::StaticHtml() {
 
 void Meshcat::StartRecording(double frames_per_second,
                              bool set_visualizations_while_recording) {
+  recording_writer_.reset();
   animation_ = std::make_unique<MeshcatAnimation>(frames_per_second);
   recording_ = true;
   set_visualizations_while_recording_ = set_visualizations_while_recording;
 }
 
+void Meshcat::StartRecordingToFile(const std::filesystem::path& filename,
+                                   const MeshcatRecordingParams& params,
+                                   bool set_visualizations_while_recording) {
+  recording_writer_.reset();
+  recording_writer_ =
+      std::make_unique<MeshcatRecordingWriter>(filename, params);
+  recording_ = true;
+  set_visualizations_while_recording_ = set_visualizations_while_recording;
+}
+
+void Meshcat::StopRecording() {
+  recording_ = false;
+  if (recording_writer_) {
+    recording_writer_->Close();
+    recording_writer_.reset();
+  }
+}
+
 void Meshcat::PublishRecording() {
   impl().SetAnimation(*animation_);
 }
@@ -11,6 +11,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/name_value.h"
 #include "drake/geometry/meshcat_animation.h"
+#include "drake/geometry/meshcat_recording.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/rgba.h"
 #include "drake/geometry/shape_specification.h"
@@ -204,6 +205,35 @@ class Meshcat {
   /** (Advanced) Returns the number of currently-open websocket connections. */
   int GetNumActiveConnections() const;
 
+  /** (Advanced) Statistics about the data sent over the websocket connections.
+  See GetTransportStatistics(). */
+  struct TransportStatistics {
+    /** Passes this object to an Archive.
+    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    template <typename Archive>
+    void Serialize(Archive* a) {
+      a->Visit(DRAKE_NVP(bytes_published));
+      a->Visit(DRAKE_NVP(backpressure));
+    }
+
+    /** The total size (in bytes) of all messages published to the connected
+    clients so far. Each message is counted once, no matter how many clients
+    are connected. */
+    int64_t bytes_published{};
+
+    /** The number of bytes that have been published but not yet accepted by
+    the slowest connected client (i.e., the largest "backpressure" among the
+    connections), or zero if there are no connections. */
+    int64_t backpressure{};
+  };
+
+  /** (Advanced) Returns the current transport statistics. Unlike Flush(), this
+  does not block on the websocket thread; the values are those as of the last
+  message published (or the last time a connection drained). Sampling them
+  periodically measures the rate at which the clients are receiving data, e.g.,
+  for rate limiting as in MeshcatPointCloudVisualizer. */
+  TransportStatistics GetTransportStatistics() const;
+
   /** Blocks the calling thread until all buffered data in the websocket thread
   has been sent to any connected clients. This can be especially useful when
   sending many or large mesh files / texture maps, to avoid large "backpressure"
@@ -247,6 +277,27 @@ class Meshcat {
                  double point_size = 0.001,
                  const Rgba& rgba = Rgba(.9, .9, .9, 1.));
 
+  /** Sets the "object" at a given `path` in the scene tree to be
+  `point_cloud`, exactly like the point cloud overload of SetObject(), except
+  that the cloud is sent in a compact form: each position is quantized to three
+  16-bit integers relative to the axis-aligned bounding box of the cloud, and
+  each color (if any) to three bytes. That is 6 (or 9, with colors) bytes per
+  point instead of 12 (or 24). The quantization error of each coordinate is
+  (up to float rounding) at most half of one step, i.e., 1/131070 of the extent
+  of the bounding box along that axis (e.g., less than 0.1 mm for a cloud that
+  spans 10 m). Points with non-finite positions are not sent.
+  @param path a "/"-delimited string indicating the path in the scene tree. See
+              @ref meshcat_path "Meshcat paths" for the semantics.
+  @param point_cloud a perception::PointCloud; if `point_cloud.has_rgbs()` is
+                     true, then meshcat will render the colored points.
+  @param point_size is the size of each rendered point.
+  @param rgba is the default color, which is only used if
+              `point_cloud.has_rgbs() == false`. */
+  void SetQuantizedPointCloud(std::string_view path,
+                              const perception::PointCloud& point_cloud,
+                              double point_size = 0.001,
+                              const Rgba& rgba = Rgba(.9, .9, .9, 1.));
+
   /** Sets the "object" at `path` in the scene tree to a TriangleSurfaceMesh.
 
   @param path a "/"-delimited string indicating the path in the scene tree. See
@@ -585,6 +636,36 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the RigidTransform of many paths at once, as if by calling
+  SetTransform(paths[i], X_ParentPaths[i], time_in_recording) for each `i`.
+  Rather than one message per path, the meshcat browsers receive a single
+  compact binary message (in single precision) that carries only the paths
+  whose transform changed since it was last set. This is much cheaper when
+  updating the poses of many objects at once, e.g., every body of a large
+  scene in each publish of a visualizer.
+
+  A path's transform is considered unchanged when every element of its
+  rotation matrix and translation differs by no more than `tolerance` from the
+  transform most recently set for that path (by either this function or
+  SetTransform()); see math::RigidTransform::IsNearlyEqualTo(). With the
+  default tolerance of zero, only exact repeats are skipped.
+
+  @param paths the "/"-delimited paths in the scene tree. See
+              @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transforms from each path to its
+              immediate parent.
+  @param tolerance the largest change of a transform that is not sent.
+  @param time_in_recording (optional). If recording (see StartRecording()),
+              then all of the transforms (whether changed or not) are also
+              saved to the current animation at `time_in_recording`.
+  @throws std::exception if `paths` and `X_ParentPaths` have different sizes
+  or if `tolerance` is negative. */
+  void SetTransforms(
+      const std::vector<std::string>& paths,
+      const std::vector<math::RigidTransformd>& X_ParentPaths,
+      double tolerance = 0.0,
+      const std::optional<double>& time_in_recording = std::nullopt);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -884,9 +965,23 @@ class Meshcat {
   void StartRecording(double frames_per_second = 32.0,
                       bool set_visualizations_while_recording = true);
 
+  /** Like StartRecording(), except that the transforms and properties are
+  streamed to the recording file `filename` (see MeshcatRecordingWriter)
+  instead of being accumulated in a MeshcatAnimation in memory. This is
+  preferred for long recordings. The file is completed by StopRecording(), by
+  a subsequent call to either StartRecording function, or when `this` is
+  destroyed. Use MeshcatRecordingReader to seek within the file or to publish
+  (a portion of) it as an animation; PublishRecording() and
+  get_mutable_recording() only concern in-memory recordings.
+  @throws std::exception if the file cannot be opened for writing. */
+  void StartRecordingToFile(const std::filesystem::path& filename,
+                            const MeshcatRecordingParams& params = {},
+                            bool set_visualizations_while_recording = true);
+
   /** Sets a flag to pause/stop recording.  When stopped, publish events will
-  not add frames to the animation. */
-  void StopRecording() { recording_ = false; }
+  not add frames to the animation. When recording to a file, the file is
+  completed and closed. */
+  void StopRecording();
 
   /** Sends the recording to Meshcat as an animation. The published animation
   only includes transforms and properties; the objects that they modify must be
@@ -978,6 +1073,10 @@ class Meshcat {
   methods to be otherwise const. */
   std::unique_ptr<MeshcatAnimation> animation_;
 
+  /* The file being recorded to by StartRecordingToFile(), if any. While it is
+  set, the recorded frames go to it instead of to the animation_. */
+  std::unique_ptr<MeshcatRecordingWriter> recording_writer_;
+
   /* Recording status.  True means that each new Publish event will record a
   frame in the animation. */
   bool recording_{false};
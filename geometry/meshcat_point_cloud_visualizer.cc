@@ -1,5 +1,7 @@
 #include "drake/geometry/meshcat_point_cloud_visualizer.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -47,6 +49,22 @@ MeshcatPointCloudVisualizer<T>::MeshcatPointCloudVisualizer(
                                   other.publish_period_) {
   set_point_size(other.point_size_);
   set_default_rgba(other.default_rgba_);
+  quantize_ = other.quantize_;
+  max_points_ = other.max_points_;
+  lod_voxel_size_ = other.lod_voxel_size_;
+  adapt_to_throughput_ = other.adapt_to_throughput_;
+}
+
+template <typename T>
+void MeshcatPointCloudVisualizer<T>::set_max_points(int max_points) {
+  DRAKE_THROW_UNLESS(max_points > 0);
+  max_points_ = max_points;
+}
+
+template <typename T>
+void MeshcatPointCloudVisualizer<T>::set_lod_voxel_size(double voxel_size) {
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  lod_voxel_size_ = voxel_size;
 }
 
 template <typename T>
@@ -59,7 +77,71 @@ systems::EventStatus MeshcatPointCloudVisualizer<T>::UpdateMeshcat(
     const systems::Context<T>& context) const {
   const auto& cloud =
       cloud_input_port().template Eval<perception::PointCloud>(context);
-  meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+
+  // The approximate number of bytes sent per point; see
+  // Meshcat::SetQuantizedPointCloud().
+  const int bytes_per_point = quantize_ ? (cloud.has_rgbs() ? 9 : 6)
+                                        : (cloud.has_rgbs() ? 24 : 12);
+
+  // Measure the throughput of the slowest client since the previous publish,
+  // and decide whether to send the cloud and at which level of detail.
+  int max_points = max_points_.value_or(std::numeric_limits<int>::max());
+  bool send_cloud = true;
+  if (adapt_to_throughput_) {
+    const auto now = std::chrono::steady_clock::now();
+    const Meshcat::TransportStatistics statistics =
+        meshcat_->GetTransportStatistics();
+    ThroughputState& previous = throughput_;
+    if (previous.time.has_value() && now > *previous.time) {
+      const double elapsed =
+          std::chrono::duration<double>(now - *previous.time).count();
+      if (statistics.backpressure > 0) {
+        // The bytes that the slowest client received since the previous
+        // publish.
+        const double drained =
+            (statistics.bytes_published - previous.statistics.bytes_published) -
+            (statistics.backpressure - previous.statistics.backpressure);
+        const double measured = std::max(drained, 0.0) / elapsed;
+        previous.bytes_per_second =
+            std::isinf(previous.bytes_per_second)
+                ? measured
+                : 0.5 * (previous.bytes_per_second + measured);
+      } else {
+        // The clients kept up; probe for more throughput.
+        previous.bytes_per_second *= 2;
+      }
+      send_cloud = statistics.backpressure <= previous.cloud_bytes;
+      if (!std::isinf(previous.bytes_per_second)) {
+        // Never reduce the cloud to less than a minimal level of detail.
+        const int kMinPoints = 1000;
+        const double budget_points =
+            previous.bytes_per_second * elapsed / bytes_per_point;
+        max_points = static_cast<int>(std::min<double>(
+            max_points, std::max<double>(budget_points, kMinPoints)));
+      }
+    }
+    previous.time = now;
+    previous.statistics = statistics;
+  }
+
+  if (send_cloud) {
+    // Select the finest level of detail that fits within max_points.
+    const perception::PointCloud* lod = &cloud;
+    perception::PointCloud downsampled;
+    double voxel_size = lod_voxel_size_;
+    while (lod->size() > max_points) {
+      downsampled = lod->VoxelizedDownSample(voxel_size);
+      lod = &downsampled;
+      voxel_size *= 2;
+    }
+    if (quantize_) {
+      meshcat_->SetQuantizedPointCloud(path_, *lod, point_size_,
+                                       default_rgba_);
+    } else {
+      meshcat_->SetObject(path_, *lod, point_size_, default_rgba_);
+    }
+    throughput_.cloud_bytes = int64_t{lod->size()} * bytes_per_point;
+  }
 
   const math::RigidTransformd X_ParentCloud =
       pose_input_port().HasValue(context)
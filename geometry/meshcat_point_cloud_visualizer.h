@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <limits>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -27,6 +30,23 @@ optional.  The optional input port `X_ParentCloud` sets the MeshcatTransform at
 the path representing the `cloud`.  If it is not connected, then we set
 `X_ParentCloud` to the identity transform.
 
+Dense clouds (e.g., from a depth camera) can easily produce more data than a
+browser can receive over the network. To reduce it, the visualizer
+- by default, sends the cloud using Meshcat::SetQuantizedPointCloud(), i.e.,
+  with 16-bit quantized positions. This is lossy: each coordinate is rounded
+  to one of 65536 evenly spaced values across the cloud's bounding box, and
+  points with non-finite positions are dropped (see set_quantize());
+- optionally selects a level of detail for the cloud: if it has more points
+  than the budget allows (see set_max_points()), it is down-sampled using
+  perception::PointCloud::VoxelizedDownSample() with the finest voxel size
+  among set_lod_voxel_size() * 2ᵏ, k = 0, 1, 2, ..., that fits the budget;
+- optionally adapts to the measured throughput of the clients (see
+  set_adapt_to_throughput()).
+By default there is no point budget and no adaptation, so every published
+cloud is sent with all of its points.
+The resulting traffic can be observed with Meshcat::GetTransportStatistics()
+and in the `kB/s` panel of the stats plot in the Meshcat browser window.
+
 @tparam_nonsymbolic_scalar
 */
 template <typename T>
@@ -62,6 +82,39 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   `has_rgbs() == false` for the cloud on the input port. */
   void set_default_rgba(const Rgba& rgba) { default_rgba_ = rgba; }
 
+  /** Sets whether the cloud is sent with quantized positions using
+  Meshcat::SetQuantizedPointCloud() (the default), or with full single
+  precision positions using Meshcat::SetObject(). Quantization is lossy; use
+  `false` if the rendered points must match the input cloud exactly. */
+  void set_quantize(bool quantize) { quantize_ = quantize; }
+
+  /** Sets the maximum number of points sent per publish. Clouds with more
+  points are down-sampled to a coarser level of detail. The default is no
+  limit.
+  @throws std::exception if `max_points` is not positive. */
+  void set_max_points(int max_points);
+
+  /** Sets the voxel size of the finest level of detail; each coarser level
+  doubles the voxel size of the previous one. The default is 0.002 (meters).
+  @throws std::exception if `voxel_size` is not positive. */
+  void set_lod_voxel_size(double voxel_size);
+
+  /** Sets whether the publishing rate and level of detail adapt to the
+  throughput of the connected clients (the default is false). When enabled,
+  the throughput is measured (in wall clock time) from the
+  Meshcat::GetTransportStatistics() of successive publishes:
+  - While the slowest client still has more than a cloud's worth of data left
+    to receive, new clouds are not sent (only the `X_ParentCloud` transform
+    is), so that the backlog does not grow without bound.
+  - Otherwise, the number of points is limited (in addition to
+    set_max_points()) so that the cloud can be received before the next
+    publish at the measured throughput. While the clients keep up, the
+    measured throughput is doubled at each publish, so that the limit recovers
+    once the network does.
+
+  Without any connected clients, there is no limit. */
+  void set_adapt_to_throughput(bool adapt) { adapt_to_throughput_ = adapt; }
+
   /** Calls Meshcat::Delete(path), where `path` is the value passed in the
    constructor. */
   void Delete() const;
@@ -107,6 +160,26 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   double point_size_{0.001};
   Rgba default_rgba_{.9, .9, .9, 1.0};
 
+  /* Transport parameters. */
+  bool quantize_{true};
+  std::optional<int> max_points_;
+  double lod_voxel_size_{0.002};
+  bool adapt_to_throughput_{false};
+
+  /* The state of the throughput measurement, as of the previous publish. This
+  is wall clock state, not simulation state, so it does not belong in the
+  Context; it is mutable so that it can be updated while publishing. */
+  struct ThroughputState {
+    std::optional<std::chrono::steady_clock::time_point> time;
+    Meshcat::TransportStatistics statistics;
+    // The measured throughput in bytes per second; infinite until the clients
+    // fall behind.
+    double bytes_per_second{std::numeric_limits<double>::infinity()};
+    // The (approximate) size of the most recently sent cloud, in bytes.
+    int64_t cloud_bytes{};
+  };
+  mutable ThroughputState throughput_;
+
   /* We store the arguments passed in the constructor to support scalar
   conversion. */
   double publish_period_;
@@ -0,0 +1,608 @@
+#include "drake/geometry/meshcat_recording.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/meshcat.h"
+
+namespace drake {
+namespace geometry {
+
+using Eigen::Quaterniond;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+/* The file starts with kMagic and the (uint32) kVersion, followed by chunks.
+Each chunk is laid out as:
+
+  "CHNK"                                     4 bytes
+  size of the payload                        uint64
+  start time, end time                       double, double
+  payload:
+    number of tracks                         uint32
+    for each track: kind, path, property     uint8, string, string
+    number of keyframes                      uint32
+    for each keyframe:
+      track index, time, is_delta            uint32, double, uint8
+      value                                  (depends on kind and is_delta)
+
+where a string is its (uint32) length followed by its characters. An absolute
+value is a uint8 for a bool, a uint32 count followed by that many doubles for a
+vector, and otherwise doubles (seven for a transform: x, y, z, qw, qx, qy,
+qz). A delta value has a float per element of the (transform or double)
+value. */
+namespace {
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'M', 'C', 'R', 'E', 'C'};
+constexpr uint32_t kVersion = 1;
+constexpr char kChunkTag[4] = {'C', 'H', 'N', 'K'};
+
+// The kinds of value of a track.
+enum Kind : uint8_t {
+  kTransform = 0,
+  kBool = 1,
+  kDouble = 2,
+  kVector = 3,
+};
+
+template <typename T>
+void Put(std::string* out, const T& value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void PutString(std::string* out, std::string_view value) {
+  Put<uint32_t>(out, value.size());
+  out->append(value);
+}
+
+// Reads values from a chunk's payload, throwing when it runs out of data.
+class Cursor {
+ public:
+  explicit Cursor(const std::string& data) : data_(data) {}
+
+  template <typename T>
+  T Get() {
+    Require(sizeof(T));
+    T result;
+    std::memcpy(&result, data_.data() + position_, sizeof(T));
+    position_ += sizeof(T);
+    return result;
+  }
+
+  std::string GetString() {
+    const uint32_t size = Get<uint32_t>();
+    Require(size);
+    std::string result = data_.substr(position_, size);
+    position_ += size;
+    return result;
+  }
+
+  // Reads the number of the items that follow, each of which takes at least
+  // `min_item_size` bytes, throwing if the remaining data cannot hold them.
+  // This keeps a corrupt count from reaching an allocation.
+  uint32_t GetCount(size_t min_item_size) {
+    const uint32_t count = Get<uint32_t>();
+    if (count > (data_.size() - position_) / min_item_size) {
+      throw std::runtime_error("invalid count");
+    }
+    return count;
+  }
+
+ private:
+  void Require(size_t size) const {
+    if (position_ + size > data_.size()) {
+      throw std::runtime_error("truncated data");
+    }
+  }
+
+  const std::string& data_;
+  size_t position_{};
+};
+
+std::vector<double> ToValue(const RigidTransformd& X) {
+  const Vector3d& p = X.translation();
+  const Quaterniond q = X.rotation().ToQuaternion();
+  return {p.x(), p.y(), p.z(), q.w(), q.x(), q.y(), q.z()};
+}
+
+RigidTransformd ToTransform(const std::vector<double>& value) {
+  DRAKE_DEMAND(value.size() == 7);
+  return RigidTransformd(
+      RotationMatrixd(Quaterniond(value[3], value[4], value[5], value[6])),
+      Vector3d(value[0], value[1], value[2]));
+}
+
+bool IsNear(const std::vector<double>& a, const std::vector<double>& b,
+            double tolerance) {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!(std::abs(a[i] - b[i]) <= tolerance)) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+struct MeshcatRecordingWriter::Track {
+  int index{};
+  std::string path;
+  std::string property;
+  uint8_t kind{};
+  // The value (and its time) most recently written; empty until then.
+  std::vector<double> written;
+  double written_time{};
+  // The value most recently written, as the reader will decode it.
+  std::vector<double> decoded;
+  // Whether the current chunk has a keyframe of this track (so that the next
+  // one can be a delta).
+  bool in_chunk{false};
+  // The most recent keyframe that was decimated away, if any.
+  std::optional<std::pair<double, std::vector<double>>> pending;
+};
+
+MeshcatRecordingWriter::MeshcatRecordingWriter(
+    const std::filesystem::path& filename, const MeshcatRecordingParams& params)
+    : params_(params) {
+  if (!(params.chunk_duration > 0) || !std::isfinite(params.chunk_duration) ||
+      !(params.min_period >= 0) || !(params.tolerance >= 0)) {
+    throw std::logic_error(fmt::format(
+        "MeshcatRecordingWriter: invalid parameters chunk_duration={}, "
+        "min_period={}, tolerance={}",
+        params.chunk_duration, params.min_period, params.tolerance));
+  }
+  stream_.open(filename, std::ios::binary | std::ios::trunc);
+  if (!stream_) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingWriter: could not open '{}' for writing",
+        filename.string()));
+  }
+  std::string header(kMagic, sizeof(kMagic));
+  Put<uint32_t>(&header, kVersion);
+  stream_.write(header.data(), header.size());
+}
+
+MeshcatRecordingWriter::~MeshcatRecordingWriter() {
+  try {
+    Close();
+  } catch (const std::exception& e) {
+    log()->error("MeshcatRecordingWriter: {}", e.what());
+  }
+}
+
+void MeshcatRecordingWriter::SetTransform(double time, std::string_view path,
+                                          const RigidTransformd& X_ParentPath) {
+  Add(time, path, "transform", kTransform, ToValue(X_ParentPath));
+}
+
+void MeshcatRecordingWriter::SetProperty(double time, std::string_view path,
+                                         std::string_view property,
+                                         bool value) {
+  Add(time, path, property, kBool, {value ? 1.0 : 0.0});
+}
+
+void MeshcatRecordingWriter::SetProperty(double time, std::string_view path,
+                                         std::string_view property,
+                                         double value) {
+  Add(time, path, property, kDouble, {value});
+}
+
+void MeshcatRecordingWriter::SetProperty(double time, std::string_view path,
+                                         std::string_view property,
+                                         const std::vector<double>& value) {
+  Add(time, path, property, kVector, value);
+}
+
+void MeshcatRecordingWriter::Add(double time, std::string_view path,
+                                 std::string_view property, uint8_t kind,
+                                 std::vector<double> value) {
+  if (is_closed()) {
+    throw std::logic_error(
+        "MeshcatRecordingWriter: cannot record after the writer is closed");
+  }
+  if (!std::isfinite(time) || time < chunk_start_time_) {
+    throw std::logic_error(fmt::format(
+        "MeshcatRecordingWriter: the time {} of '{}' precedes the current "
+        "chunk, which starts at {}",
+        time, path, chunk_start_time_));
+  }
+  if (chunk_open_ && time >= chunk_start_time_ + params_.chunk_duration) {
+    Flush();
+  }
+
+  auto [iter, inserted] = track_index_.try_emplace(
+      std::make_pair(std::string(path), std::string(property)),
+      ssize(tracks_));
+  if (inserted) {
+    auto track = std::make_unique<Track>();
+    track->index = iter->second;
+    track->path = path;
+    track->property = property;
+    track->kind = kind;
+    tracks_.push_back(std::move(track));
+  }
+  Track* track = tracks_[iter->second].get();
+  if (track->kind != kind) {
+    throw std::logic_error(fmt::format(
+        "MeshcatRecordingWriter: the property '{}' of '{}' was already "
+        "recorded with a different type",
+        property, path));
+  }
+
+  if (!chunk_open_) {
+    // Start the chunk with the latest value of every track, so that it can be
+    // decoded without the chunks before it.
+    chunk_open_ = true;
+    chunk_start_time_ = time;
+    chunk_end_time_ = time;
+    for (const auto& other : tracks_) {
+      if (!other->written.empty()) {
+        const std::vector<double> written = other->written;
+        Append(other.get(), time, written);
+      }
+    }
+  }
+
+  if (!track->written.empty()) {
+    if (IsNear(track->written, value, params_.tolerance)) {
+      track->pending.reset();
+      return;
+    }
+    if (time < track->written_time + params_.min_period) {
+      track->pending.emplace(time, std::move(value));
+      return;
+    }
+  }
+  Append(track, time, value);
+  track->pending.reset();
+}
+
+void MeshcatRecordingWriter::Append(Track* track, double time,
+                                    const std::vector<double>& value) {
+  const bool is_delta =
+      track->in_chunk &&
+      (track->kind == kTransform || track->kind == kDouble);
+  Put<uint32_t>(&chunk_keyframes_, track->index);
+  Put<double>(&chunk_keyframes_, time);
+  Put<uint8_t>(&chunk_keyframes_, is_delta);
+  if (is_delta) {
+    // Encode the change from what the reader will have decoded, so that the
+    // rounding to float does not accumulate.
+    for (size_t i = 0; i < value.size(); ++i) {
+      const float delta = static_cast<float>(value[i] - track->decoded[i]);
+      Put<float>(&chunk_keyframes_, delta);
+      track->decoded[i] += delta;
+    }
+  } else {
+    if (track->kind == kBool) {
+      Put<uint8_t>(&chunk_keyframes_, value[0] != 0);
+    } else {
+      if (track->kind == kVector) {
+        Put<uint32_t>(&chunk_keyframes_, value.size());
+      }
+      for (double element : value) {
+        Put<double>(&chunk_keyframes_, element);
+      }
+    }
+    track->decoded = value;
+  }
+  track->written = value;
+  track->written_time = time;
+  track->in_chunk = true;
+  chunk_end_time_ = std::max(chunk_end_time_, time);
+  ++chunk_num_keyframes_;
+  ++num_keyframes_written_;
+}
+
+void MeshcatRecordingWriter::Flush() {
+  if (!chunk_open_) {
+    return;
+  }
+  for (const auto& track : tracks_) {
+    if (track->pending) {
+      const auto [time, value] = std::move(*track->pending);
+      track->pending.reset();
+      Append(track.get(), time, value);
+    }
+  }
+
+  std::string payload;
+  Put<uint32_t>(&payload, tracks_.size());
+  for (const auto& track : tracks_) {
+    Put<uint8_t>(&payload, track->kind);
+    PutString(&payload, track->path);
+    PutString(&payload, track->property);
+  }
+  Put<uint32_t>(&payload, chunk_num_keyframes_);
+  std::string header(kChunkTag, sizeof(kChunkTag));
+  Put<uint64_t>(&header, payload.size() + chunk_keyframes_.size());
+  Put<double>(&header, chunk_start_time_);
+  Put<double>(&header, chunk_end_time_);
+  stream_.write(header.data(), header.size());
+  stream_.write(payload.data(), payload.size());
+  stream_.write(chunk_keyframes_.data(), chunk_keyframes_.size());
+  stream_.flush();
+  if (!stream_) {
+    throw std::runtime_error(
+        "MeshcatRecordingWriter: failed to write to the recording file");
+  }
+  ++num_chunks_written_;
+
+  chunk_open_ = false;
+  chunk_num_keyframes_ = 0;
+  chunk_keyframes_.clear();
+  for (const auto& track : tracks_) {
+    track->in_chunk = false;
+  }
+}
+
+void MeshcatRecordingWriter::Close() {
+  if (is_closed()) {
+    return;
+  }
+  Flush();
+  stream_.close();
+}
+
+struct MeshcatRecordingReader::Chunk {
+  struct Track {
+    uint8_t kind{};
+    std::string path;
+    std::string property;
+  };
+  struct Keyframe {
+    int track{};
+    double time{};
+    std::vector<double> value;
+  };
+  std::vector<Track> tracks;
+  std::vector<Keyframe> keyframes;
+};
+
+MeshcatRecordingReader::MeshcatRecordingReader(
+    const std::filesystem::path& filename)
+    : filename_(filename) {
+  std::ifstream stream(filename, std::ios::binary);
+  char magic[sizeof(kMagic)]{};
+  uint32_t version{};
+  stream.read(magic, sizeof(magic));
+  stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+  if (!stream || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      version != kVersion) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingReader: '{}' is not a Meshcat recording file",
+        filename.string()));
+  }
+  const uint64_t file_size = std::filesystem::file_size(filename);
+  while (true) {
+    char tag[sizeof(kChunkTag)]{};
+    ChunkIndex chunk;
+    stream.read(tag, sizeof(tag));
+    if (stream.gcount() == 0) {
+      break;
+    }
+    stream.read(reinterpret_cast<char*>(&chunk.size), sizeof(chunk.size));
+    stream.read(reinterpret_cast<char*>(&chunk.start_time),
+                sizeof(chunk.start_time));
+    stream.read(reinterpret_cast<char*>(&chunk.end_time),
+                sizeof(chunk.end_time));
+    chunk.offset = stream.tellg();
+    if (!stream || std::memcmp(tag, kChunkTag, sizeof(kChunkTag)) != 0 ||
+        static_cast<uint64_t>(chunk.offset) + chunk.size > file_size) {
+      log()->warn(
+          "MeshcatRecordingReader: ignoring the incomplete chunk at the end of "
+          "'{}'",
+          filename.string());
+      break;
+    }
+    chunks_.push_back(chunk);
+    stream.seekg(chunk.offset + static_cast<std::streamoff>(chunk.size));
+  }
+}
+
+MeshcatRecordingReader::~MeshcatRecordingReader() = default;
+
+double MeshcatRecordingReader::start_time() const {
+  return chunks_.empty() ? 0.0 : chunks_.front().start_time;
+}
+
+double MeshcatRecordingReader::end_time() const {
+  return chunks_.empty() ? 0.0 : chunks_.back().end_time;
+}
+
+const MeshcatRecordingReader::Chunk& MeshcatRecordingReader::LoadChunk(
+    int index) const {
+  DRAKE_DEMAND(index >= 0 && index < num_chunks());
+  if (index == cached_index_) {
+    return *cached_chunk_;
+  }
+  const ChunkIndex& chunk_index = chunks_[index];
+  std::string data(chunk_index.size, '\0');
+  std::ifstream stream(filename_, std::ios::binary);
+  stream.seekg(chunk_index.offset);
+  stream.read(data.data(), data.size());
+  auto chunk = std::make_unique<Chunk>();
+  try {
+    if (!stream) {
+      throw std::runtime_error("read failed");
+    }
+    Cursor cursor(data);
+    // A track has at least its kind and two (empty) strings.
+    const uint32_t num_tracks =
+        cursor.GetCount(sizeof(uint8_t) + 2 * sizeof(uint32_t));
+    for (uint32_t i = 0; i < num_tracks; ++i) {
+      Chunk::Track track;
+      track.kind = cursor.Get<uint8_t>();
+      track.path = cursor.GetString();
+      track.property = cursor.GetString();
+      if (track.kind > kVector) {
+        throw std::runtime_error("invalid track");
+      }
+      chunk->tracks.push_back(std::move(track));
+    }
+    // The most recent value of each track, against which deltas apply.
+    std::vector<std::vector<double>> values(num_tracks);
+    // A keyframe has at least its header and a bool value.
+    const uint32_t num_keyframes = cursor.GetCount(
+        sizeof(uint32_t) + sizeof(double) + 2 * sizeof(uint8_t));
+    chunk->keyframes.reserve(num_keyframes);
+    for (uint32_t i = 0; i < num_keyframes; ++i) {
+      Chunk::Keyframe keyframe;
+      const uint32_t track_index = cursor.Get<uint32_t>();
+      keyframe.time = cursor.Get<double>();
+      const bool is_delta = cursor.Get<uint8_t>() != 0;
+      if (track_index >= num_tracks) {
+        throw std::runtime_error("invalid track index");
+      }
+      keyframe.track = static_cast<int>(track_index);
+      std::vector<double>& value = values[keyframe.track];
+      const uint8_t kind = chunk->tracks[keyframe.track].kind;
+      if (is_delta) {
+        if (value.empty() || kind == kBool || kind == kVector) {
+          throw std::runtime_error("invalid delta");
+        }
+        for (double& element : value) {
+          element += cursor.Get<float>();
+        }
+      } else if (kind == kBool) {
+        value = {static_cast<double>(cursor.Get<uint8_t>())};
+      } else {
+        const uint32_t size = kind == kTransform ? 7
+                              : kind == kDouble
+                                  ? 1
+                                  : cursor.GetCount(sizeof(double));
+        value.resize(size);
+        for (double& element : value) {
+          element = cursor.Get<double>();
+        }
+      }
+      keyframe.value = value;
+      chunk->keyframes.push_back(std::move(keyframe));
+    }
+  } catch (const std::exception& e) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatRecordingReader: chunk {} of '{}' is corrupt ({})", index,
+        filename_.string(), e.what()));
+  }
+  cached_chunk_ = std::move(chunk);
+  cached_index_ = index;
+  return *cached_chunk_;
+}
+
+std::vector<int> MeshcatRecordingReader::FindValuesAt(
+    double time, const Chunk** chunk) const {
+  // Each chunk starts with the values of all tracks, so the last chunk that
+  // starts at or before `time` holds every value that we need.
+  auto iter = std::upper_bound(
+      chunks_.begin(), chunks_.end(), time,
+      [](double t, const ChunkIndex& chunk_index) {
+        return t < chunk_index.start_time;
+      });
+  if (iter == chunks_.begin()) {
+    *chunk = nullptr;
+    return {};
+  }
+  *chunk = &LoadChunk(static_cast<int>(iter - chunks_.begin()) - 1);
+  const std::vector<Chunk::Keyframe>& keyframes = (*chunk)->keyframes;
+  std::vector<int> latest((*chunk)->tracks.size(), -1);
+  for (int i = 0; i < ssize(keyframes); ++i) {
+    const Chunk::Keyframe& keyframe = keyframes[i];
+    int& best = latest[keyframe.track];
+    if (keyframe.time <= time &&
+        (best < 0 || keyframe.time >= keyframes[best].time)) {
+      best = i;
+    }
+  }
+  std::vector<int> result;
+  for (int i : latest) {
+    if (i >= 0) result.push_back(i);
+  }
+  return result;
+}
+
+void MeshcatRecordingReader::Seek(double time, Meshcat* meshcat) const {
+  DRAKE_THROW_UNLESS(meshcat != nullptr);
+  const Chunk* chunk{};
+  const std::vector<int> indices = FindValuesAt(time, &chunk);
+  std::vector<std::string> paths;
+  std::vector<RigidTransformd> X_ParentPaths;
+  for (int i : indices) {
+    const Chunk::Keyframe& keyframe = chunk->keyframes[i];
+    const Chunk::Track& track = chunk->tracks[keyframe.track];
+    switch (track.kind) {
+      case kTransform:
+        paths.push_back(track.path);
+        X_ParentPaths.push_back(ToTransform(keyframe.value));
+        break;
+      case kBool:
+        meshcat->SetProperty(track.path, track.property,
+                             keyframe.value[0] != 0);
+        break;
+      case kDouble:
+        meshcat->SetProperty(track.path, track.property, keyframe.value[0]);
+        break;
+      default:
+        meshcat->SetProperty(track.path, track.property, keyframe.value);
+    }
+  }
+  meshcat->SetTransforms(paths, X_ParentPaths);
+}
+
+std::unique_ptr<MeshcatAnimation> MeshcatRecordingReader::ToAnimation(
+    double start_time, double end_time, double frames_per_second) const {
+  if (!(end_time >= start_time)) {
+    throw std::logic_error(fmt::format(
+        "MeshcatRecordingReader::ToAnimation(): the end time {} precedes the "
+        "start time {}",
+        end_time, start_time));
+  }
+  auto animation = std::make_unique<MeshcatAnimation>(frames_per_second);
+  animation->set_start_time(start_time);
+  const auto add = [&animation](int frame, const Chunk::Track& track,
+                                const std::vector<double>& value) {
+    switch (track.kind) {
+      case kTransform:
+        animation->SetTransform(frame, track.path, ToTransform(value));
+        break;
+      case kBool:
+        animation->SetProperty(frame, track.path, track.property,
+                               value[0] != 0);
+        break;
+      case kDouble:
+        animation->SetProperty(frame, track.path, track.property, value[0]);
+        break;
+      default:
+        animation->SetProperty(frame, track.path, track.property, value);
+    }
+  };
+
+  // The first frame holds the values at the start time.
+  const Chunk* first{};
+  for (int i : FindValuesAt(start_time, &first)) {
+    const Chunk::Keyframe& keyframe = first->keyframes[i];
+    add(0, first->tracks[keyframe.track], keyframe.value);
+  }
+  for (int c = 0; c < num_chunks(); ++c) {
+    if (chunks_[c].end_time <= start_time || chunks_[c].start_time > end_time) {
+      continue;
+    }
+    const Chunk& chunk = LoadChunk(c);
+    for (const Chunk::Keyframe& keyframe : chunk.keyframes) {
+      if (keyframe.time > start_time && keyframe.time <= end_time) {
+        add(animation->frame(keyframe.time), chunk.tracks[keyframe.track],
+            keyframe.value);
+      }
+    }
+  }
+  return animation;
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
+#include "drake/common/ssize.h"
+#include "drake/geometry/meshcat_animation.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+
+// Forward declaration.
+class Meshcat;
+
+/** The set of parameters for configuring a MeshcatRecordingWriter. */
+struct MeshcatRecordingParams {
+  /** Passes this object to an Archive.
+   Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(chunk_duration));
+    a->Visit(DRAKE_NVP(min_period));
+    a->Visit(DRAKE_NVP(tolerance));
+  }
+
+  /** The duration (in recording time) covered by each chunk of the file. Only
+   the current chunk is held in memory while recording, and only the chunks
+   that are needed are loaded during playback. Must be positive. */
+  double chunk_duration{10.0};
+
+  /** Time decimation: a keyframe for a given path and property is only written
+   if at least this much (recording) time has passed since the last keyframe
+   written for it. The most recent value that was decimated away is still
+   written at the end of each chunk, so that the recording ends up in the
+   correct final state. The default of zero writes every keyframe. */
+  double min_period{0.0};
+
+  /** A keyframe is not written if no element of its value (the translation and
+   quaternion of a transform, or the value of a property) differs from the
+   last value written for its path and property by more than this tolerance.
+   The default of zero only skips exact repeats. */
+  double tolerance{0.0};
+};
+
+/** Streams a Meshcat recording (i.e., the keyframes of the transforms and
+properties set over time) into a compact, chunked binary file, so that
+arbitrarily long recordings can be made in bounded memory. Use
+MeshcatRecordingReader to play the file back. Typically, this class is not
+used directly, but through Meshcat::StartRecordingToFile().
+
+The file is a sequence of chunks, each covering (at most)
+MeshcatRecordingParams::chunk_duration of recording time. Each chunk begins
+with the latest value of every path and property recorded so far, so that it
+can be decoded by itself (e.g., to seek to a time). Within a chunk, transforms
+and scalar properties are delta-encoded in single precision against the
+previous keyframe of the same path and property; the deltas are taken against
+the values as they will be decoded, so rounding errors do not accumulate.
+
+A chunk is written once recording time advances past its end, when Flush() is
+called, and when the writer is closed. Keyframes must be added in
+non-decreasing chunk order, i.e., a keyframe's time may not precede the start
+of the current chunk. The file uses the host's (little-endian) byte order. */
+class MeshcatRecordingWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshcatRecordingWriter)
+
+  /** Creates (or overwrites) the recording file `filename`.
+  @throws std::exception if the file cannot be opened for writing, or if the
+  `params` are invalid. */
+  explicit MeshcatRecordingWriter(const std::filesystem::path& filename,
+                                  const MeshcatRecordingParams& params = {});
+
+  /** Closes the file; see Close(). */
+  ~MeshcatRecordingWriter();
+
+  /** Records the transform of `path` at `time`. @see Meshcat::SetTransform.
+  @throws std::exception if `time` precedes the current chunk, or if the
+  writer has been closed. */
+  void SetTransform(double time, std::string_view path,
+                    const math::RigidTransformd& X_ParentPath);
+
+  /** Records the value of a property of `path` at `time`.
+  @see Meshcat::SetProperty.
+  @throws std::exception if this path/property has already been recorded with
+  a different type, if `time` precedes the current chunk, or if the writer has
+  been closed.
+  @pydrake_mkdoc_identifier{bool} */
+  void SetProperty(double time, std::string_view path,
+                   std::string_view property, bool value);
+
+  /** Records the value of a property of `path` at `time`.
+  @see Meshcat::SetProperty.
+  @throws std::exception under the same conditions as the `bool` overload.
+  @pydrake_mkdoc_identifier{double} */
+  void SetProperty(double time, std::string_view path,
+                   std::string_view property, double value);
+
+  /** Records the value of a property of `path` at `time`.
+  @see Meshcat::SetProperty.
+  @throws std::exception under the same conditions as the `bool` overload.
+  @pydrake_mkdoc_identifier{vector_double} */
+  void SetProperty(double time, std::string_view path,
+                   std::string_view property, const std::vector<double>& value);
+
+  /** Writes the current chunk (if it has any keyframes) to the file. The next
+  keyframe starts a new chunk. */
+  void Flush();
+
+  /** Writes the current chunk and closes the file. Subsequent calls to the
+  setters throw. Closing a closed writer does nothing. */
+  void Close();
+
+  /** Returns true iff the writer has been closed. */
+  bool is_closed() const { return !stream_.is_open(); }
+
+  /** Returns the number of chunks written to the file so far. */
+  int num_chunks_written() const { return num_chunks_written_; }
+
+  /** Returns the number of keyframes written to the file so far (including
+  those of the current chunk, which may not have been written yet). */
+  int64_t num_keyframes_written() const { return num_keyframes_written_; }
+
+ private:
+  struct Track;
+
+  // Records `value` for the track (path, property) of the given kind.
+  void Add(double time, std::string_view path, std::string_view property,
+           uint8_t kind, std::vector<double> value);
+
+  // Appends a keyframe of `track` to the current chunk.
+  void Append(Track* track, double time, const std::vector<double>& value);
+
+  const MeshcatRecordingParams params_;
+  std::ofstream stream_;
+
+  // All tracks recorded so far, in order of creation; indexed by their
+  // (path, property).
+  std::vector<std::unique_ptr<Track>> tracks_;
+  std::map<std::pair<std::string, std::string>, int> track_index_;
+
+  // The current chunk, which is not yet written.
+  bool chunk_open_{false};
+  double chunk_start_time_{-std::numeric_limits<double>::infinity()};
+  double chunk_end_time_{};
+  uint32_t chunk_num_keyframes_{};
+  std::string chunk_keyframes_;
+
+  int num_chunks_written_{};
+  int64_t num_keyframes_written_{};
+};
+
+/** Plays back a recording file that was written by MeshcatRecordingWriter.
+Only an index of the chunks is read upon construction; the chunks themselves
+are loaded as needed, so that seeking within (or publishing a portion of) a
+long recording does not load the whole file. A trailing chunk that was not
+completely written (e.g., because the recording process crashed) is ignored.
+*/
+class MeshcatRecordingReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshcatRecordingReader)
+
+  /** Opens the recording file `filename` and reads its index.
+  @throws std::exception if the file cannot be read or is not a recording. */
+  explicit MeshcatRecordingReader(const std::filesystem::path& filename);
+
+  ~MeshcatRecordingReader();
+
+  /** Returns the number of chunks in the file. */
+  int num_chunks() const { return ssize(chunks_); }
+
+  /** Returns the time of the first keyframe in the file, or zero if the file
+  is empty. */
+  double start_time() const;
+
+  /** Returns the time of the last keyframe in the file, or zero if the file is
+  empty. */
+  double end_time() const;
+
+  /** Sets all of the recorded transforms and properties in `meshcat` to their
+  values at `time` (i.e., to the values of their latest keyframes at or before
+  `time`). The transforms are sent in a single message via
+  Meshcat::SetTransforms(). Only one chunk is loaded. */
+  void Seek(double time, Meshcat* meshcat) const;
+
+  /** Returns the portion of the recording between `start_time` and `end_time`
+  as a MeshcatAnimation, which can be published using Meshcat::SetAnimation()
+  and is then also included in Meshcat::StaticHtml(). The first frame of the
+  animation holds the values at `start_time` (see Seek()). Only the chunks that
+  overlap the interval are loaded.
+  @throws std::exception if `end_time` < `start_time`. */
+  std::unique_ptr<MeshcatAnimation> ToAnimation(
+      double start_time, double end_time,
+      double frames_per_second = 32.0) const;
+
+ private:
+  struct ChunkIndex {
+    std::streamoff offset{};
+    uint64_t size{};
+    double start_time{};
+    double end_time{};
+  };
+  struct Chunk;
+
+  // Loads (or returns the cached) chunk `index`.
+  const Chunk& LoadChunk(int index) const;
+
+  // Returns the values of every track at `time`, from the one chunk that
+  // covers it, as indices into `chunk.keyframes`.
+  std::vector<int> FindValuesAt(double time, const Chunk** chunk) const;
+
+  const std::filesystem::path filename_;
+  std::vector<ChunkIndex> chunks_;
+
+  // The most recently loaded chunk.
+  mutable int cached_index_{-1};
+  mutable std::unique_ptr<Chunk> cached_chunk_;
+};
+
+}  // namespace geometry
+}  // namespace drake
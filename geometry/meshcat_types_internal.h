@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <limits>
 #include <map>
 #include <memory>
@@ -411,6 +412,37 @@ struct ShowRealtimeRate {
   MSGPACK_DEFINE_MAP(type, show);
 };
 
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We handle it directly within meshcat.html,
+// without ever feeding it into meshcat.js. It sets the transforms of many
+// paths in a single message; see Meshcat::SetTransforms().
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  // For each path, in order, the translation (x, y, z) followed by the
+  // rotation quaternion (x, y, z, w). This is packed as a Float32Array.
+  std::vector<float> poses;
+};
+
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We handle it directly within meshcat.html,
+// without ever feeding it into meshcat.js. See Meshcat::SetQuantizedPointCloud.
+struct SetPointCloudData {
+  std::string type{"set_point_cloud"};
+  std::string path;
+  double point_size{};
+  int color{};
+  double opacity{1.0};
+  // The position of each point is lower + positions .* scale, per axis.
+  std::array<float, 3> lower{};
+  std::array<float, 3> scale{};
+  // The quantized (x, y, z) of each point. This is packed as binary data.
+  std::vector<uint16_t> positions;
+  // The (r, g, b) of each point, or empty to use the `color`. This is packed
+  // as binary data.
+  std::vector<uint8_t> colors;
+};
+
 struct DeleteData {
   std::string type{"delete"};
   std::string path;
@@ -597,6 +629,63 @@ struct pack<Eigen::Matrix<Scalar, RowsAtCompileTime, ColsAtCompileTime, Options,
   }
 };
 
+template <>
+struct pack<drake::geometry::internal::SetTransformsData> {
+  template <typename Stream>
+  packer<Stream>& operator()(
+      // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack.
+      msgpack::packer<Stream>& o,
+      const drake::geometry::internal::SetTransformsData& data) const {
+    o.pack_map(3);
+    o.pack("type");
+    o.pack(data.type);
+    o.pack("paths");
+    o.pack(data.paths);
+    o.pack("poses");
+    // Packed as a single binary Float32Array (ext 0x17); see pack<Eigen::...>.
+    const size_t s = data.poses.size() * sizeof(float);
+    o.pack_ext(s, 0x17);
+    o.pack_ext_body(reinterpret_cast<const char*>(data.poses.data()), s);
+    return o;
+  }
+};
+
+template <>
+struct pack<drake::geometry::internal::SetPointCloudData> {
+  template <typename Stream>
+  packer<Stream>& operator()(
+      // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack.
+      msgpack::packer<Stream>& o,
+      const drake::geometry::internal::SetPointCloudData& data) const {
+    o.pack_map(9);
+    o.pack("type");
+    o.pack(data.type);
+    o.pack("path");
+    o.pack(data.path);
+    o.pack("point_size");
+    o.pack(data.point_size);
+    o.pack("color");
+    o.pack(data.color);
+    o.pack("opacity");
+    o.pack(data.opacity);
+    o.pack("lower");
+    o.pack(data.lower);
+    o.pack("scale");
+    o.pack(data.scale);
+    // The arrays are packed as raw bytes (which javascript receives as a
+    // Uint8Array) to avoid the per-element overhead of a msgpack array.
+    o.pack("positions");
+    const size_t s = data.positions.size() * sizeof(uint16_t);
+    o.pack_bin(s);
+    o.pack_bin_body(reinterpret_cast<const char*>(data.positions.data()), s);
+    o.pack("colors");
+    o.pack_bin(data.colors.size());
+    o.pack_bin_body(reinterpret_cast<const char*>(data.colors.data()),
+                    data.colors.size());
+    return o;
+  }
+};
+
 template <>
 struct pack<drake::geometry::Meshcat::OrthographicCamera> {
   template <typename Stream>
@@ -16,6 +16,7 @@ struct MeshcatVisualizerParams {
   template <typename Archive>
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(publish_period));
+    a->Visit(DRAKE_NVP(transform_tolerance));
     a->Visit(DRAKE_NVP(role));
     a->Visit(DRAKE_NVP(default_color));
     a->Visit(DRAKE_NVP(prefix));
@@ -32,6 +33,13 @@ struct MeshcatVisualizerParams {
    drake#15021 for details.) */
   double publish_period{1 / 64.0};
 
+  /** On each publish, the pose of a frame is only sent to Meshcat if it
+   changed by more than this tolerance since it was last sent (see
+   Meshcat::SetTransforms()). The default of zero sends every change; a small
+   positive value (e.g., 1e-6) avoids sending the poses of bodies that are
+   nearly at rest. */
+  double transform_tolerance{0.0};
+
   /** The role of the geometries to be sent to the visualizer. */
   Role role{Role::kIllustration};
 
@@ -205,6 +205,15 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
+  /* Constructs the hierarchy from an already-built tree (e.g., one restored
+   from a serialized representation). The caller is responsible for making sure
+   that the tree is consistent with the mesh it will be used with.
+   @pre root_node != nullptr. */
+  explicit Bvh(std::unique_ptr<NodeType> root_node)
+      : root_node_(std::move(root_node)) {
+    DRAKE_DEMAND(root_node_ != nullptr);
+  }
+
   const NodeType& root_node() const { return *root_node_; }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
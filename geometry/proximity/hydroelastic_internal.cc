@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <string>
 
 #include <fmt/format.h>
 
+#include "drake/geometry/proximity/hydroelastic_mesh_cache.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -20,6 +22,7 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/mesh_asset_registry.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/tessellation_strategy.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
@@ -33,12 +36,33 @@ using std::make_unique;
 
 SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
   if (this == &s) return *this;
+  if (s.mesh_ == nullptr) {
+    // Copying a default-constructed (or moved-from) soft mesh.
+    mesh_.reset();
+    pressure_.reset();
+    bvh_.reset();
+    return *this;
+  }
 
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
+  mesh_ = std::make_shared<const VolumeMesh<double>>(s.mesh());
   // We can't simply copy the mesh field; the copy must contain a pointer to
   // the new mesh. So, we use CloneAndSetMesh() instead.
   pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<Obb, VolumeMesh<double>>>(s.bvh());
+  bvh_ = std::make_shared<const Bvh<Obb, VolumeMesh<double>>>(s.bvh());
+
+  return *this;
+}
+
+RigidMesh& RigidMesh::operator=(const RigidMesh& r) {
+  if (this == &r) return *this;
+  if (r.mesh_ == nullptr) {
+    mesh_.reset();
+    bvh_.reset();
+    return *this;
+  }
+
+  mesh_ = std::make_shared<const TriangleSurfaceMesh<double>>(r.mesh());
+  bvh_ = std::make_shared<const Bvh<Obb, TriangleSurfaceMesh<double>>>(r.bvh());
 
   return *this;
 }
@@ -119,13 +143,15 @@ void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
 void Geometries::AddGeometry(GeometryId id, SoftGeometry geometry) {
   DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kUndefined);
   supported_geometries_[id] = HydroelasticType::kSoft;
-  soft_geometries_.insert({id, std::move(geometry)});
+  soft_geometries_.insert(
+      {id, std::make_shared<const SoftGeometry>(std::move(geometry))});
 }
 
 void Geometries::AddGeometry(GeometryId id, RigidGeometry geometry) {
   DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kUndefined);
   supported_geometries_[id] = HydroelasticType::kRigid;
-  rigid_geometries_.insert({id, std::move(geometry)});
+  rigid_geometries_.insert(
+      {id, std::make_shared<const RigidGeometry>(std::move(geometry))});
 }
 
 // Validator interface for use with extracting valid properties. It is
@@ -191,6 +217,63 @@ class PositiveDouble : public Validator<double> {
   }
 };
 
+namespace {
+
+// Returns the soft mesh computed by `make`. If the persistent hydroelastic
+// mesh cache is enabled, the result is first looked up (and, on a miss,
+// stored) under the key derived from `description` and the contents of the
+// (optional) file named `filename`. The description must encode every
+// parameter that affects the result of `make`.
+SoftMesh MakeSoftMeshMaybeCached(const std::string& description,
+                                 const std::string& filename,
+                                 const std::function<SoftMesh()>& make) {
+  const SoftMeshCache* const cache = GetDefaultSoftMeshCache();
+  if (cache == nullptr) {
+    return make();
+  }
+  return cache->LoadOrMake(ComputeSoftMeshCacheKey(description, filename),
+                           make);
+}
+
+// Returns a rigid mesh that shares its (immutable) surface mesh and Bvh with
+// every other rigid mesh made from the same `variant` and contents of the file
+// named `filename` (see MeshAssetRegistry). Only on the first request is the
+// surface mesh created with `make_mesh`.
+RigidMesh MakeSharedRigidMesh(
+    const std::string& variant, const std::string& filename,
+    const std::function<std::unique_ptr<TriangleSurfaceMesh<double>>()>&
+        make_mesh) {
+  const std::shared_ptr<const RigidMesh> asset =
+      MeshAssetRegistry::GetInstance().GetOrCreate<RigidMesh>(
+          variant, filename, [&make_mesh]() {
+            return make_unique<RigidMesh>(make_mesh());
+          });
+  // Aliasing shared pointers keep the whole asset alive.
+  return RigidMesh(
+      std::shared_ptr<const TriangleSurfaceMesh<double>>(asset, &asset->mesh()),
+      std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>>(
+          asset, &asset->bvh()));
+}
+
+// The compliant analog of MakeSharedRigidMesh().
+SoftMesh MakeSharedSoftMesh(const std::string& variant,
+                            const std::string& filename,
+                            const std::function<SoftMesh()>& make) {
+  const std::shared_ptr<const SoftMesh> asset =
+      MeshAssetRegistry::GetInstance().GetOrCreate<SoftMesh>(
+          variant, filename, [&make]() {
+            return make_unique<SoftMesh>(make());
+          });
+  return SoftMesh(
+      std::shared_ptr<const VolumeMesh<double>>(asset, &asset->mesh()),
+      std::shared_ptr<const VolumeMeshFieldLinear<double, double>>(
+          asset, &asset->pressure()),
+      std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>>(asset,
+                                                          &asset->bvh()));
+}
+
+}  // namespace
+
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const HalfSpace& hs, const ProximityProperties&) {
   return RigidGeometry(hs);
@@ -251,15 +334,20 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Mesh& mesh_spec, const ProximityProperties&) {
   // Mesh does not use any properties.
-  std::unique_ptr<TriangleSurfaceMesh<double>> mesh;
+  std::function<std::unique_ptr<TriangleSurfaceMesh<double>>()> make_mesh;
 
   const std::string extension = mesh_spec.extension();
   if (extension == ".obj") {
-    mesh = make_unique<TriangleSurfaceMesh<double>>(
-        ReadObjToTriangleSurfaceMesh(mesh_spec.filename(), mesh_spec.scale()));
+    make_mesh = [&mesh_spec]() {
+      return make_unique<TriangleSurfaceMesh<double>>(
+          ReadObjToTriangleSurfaceMesh(mesh_spec.filename(),
+                                       mesh_spec.scale()));
+    };
   } else if (extension == ".vtk") {
-    mesh = make_unique<TriangleSurfaceMesh<double>>(
-        ConvertVolumeToSurfaceMesh(MakeVolumeMeshFromVtk<double>(mesh_spec)));
+    make_mesh = [&mesh_spec]() {
+      return make_unique<TriangleSurfaceMesh<double>>(
+          ConvertVolumeToSurfaceMesh(MakeVolumeMeshFromVtk<double>(mesh_spec)));
+    };
   } else {
     throw(std::runtime_error(fmt::format(
         "hydroelastic::MakeRigidRepresentation(): for rigid hydroelastic Mesh "
@@ -267,22 +355,30 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
         mesh_spec.filename())));
   }
 
-  return RigidGeometry(RigidMesh(std::move(mesh)));
+  return RigidGeometry(MakeSharedRigidMesh(
+      fmt::format("hydroelastic rigid {} scale={:a}", extension,
+                  mesh_spec.scale()),
+      mesh_spec.filename(), make_mesh));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
     const Convex& convex_spec, const ProximityProperties&) {
   // Convex does not use any properties.
-  std::unique_ptr<TriangleSurfaceMesh<double>> mesh;
+  std::function<std::unique_ptr<TriangleSurfaceMesh<double>>()> make_mesh;
 
   const std::string extension = convex_spec.extension();
   if (extension == ".obj") {
-    mesh =
-        make_unique<TriangleSurfaceMesh<double>>(ReadObjToTriangleSurfaceMesh(
-            convex_spec.filename(), convex_spec.scale()));
+    make_mesh = [&convex_spec]() {
+      return make_unique<TriangleSurfaceMesh<double>>(
+          ReadObjToTriangleSurfaceMesh(convex_spec.filename(),
+                                       convex_spec.scale()));
+    };
   } else if (extension == ".vtk") {
-    mesh = make_unique<TriangleSurfaceMesh<double>>(
-        ConvertVolumeToSurfaceMesh(MakeVolumeMeshFromVtk<double>(convex_spec)));
+    make_mesh = [&convex_spec]() {
+      return make_unique<TriangleSurfaceMesh<double>>(
+          ConvertVolumeToSurfaceMesh(
+              MakeVolumeMeshFromVtk<double>(convex_spec)));
+    };
   } else {
     throw(std::runtime_error(
         fmt::format("hydroelastic::MakeRigidRepresentation(): for rigid "
@@ -291,7 +387,12 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
                     convex_spec.filename())));
   }
 
-  return RigidGeometry(RigidMesh(std::move(mesh)));
+  // The rigid representation of a Convex is the same as that of a Mesh with
+  // the same file and scale, so they share the variant string.
+  return RigidGeometry(MakeSharedRigidMesh(
+      fmt::format("hydroelastic rigid {} scale={:a}", extension,
+                  convex_spec.scale()),
+      convex_spec.filename(), make_mesh));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -303,16 +404,20 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeSphereVolumeMesh<double>(sphere, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(MakeSoftMeshMaybeCached(
+      fmt::format("Sphere(radius={:a}) edge_length={:a} strategy={} E={:a}",
+                  sphere.radius(), edge_length, static_cast<int>(strategy),
+                  hydroelastic_modulus),
+      {}, [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeSphereVolumeMesh<double>(sphere, edge_length, strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -336,16 +441,21 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   PositiveDouble validator("Cylinder", "soft");
   // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCylinderVolumeMeshWithMa<double>(cylinder, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCylinderPressureField(cylinder, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(MakeSoftMeshMaybeCached(
+      fmt::format("Cylinder(radius={:a}, length={:a}) edge_length={:a} E={:a}",
+                  cylinder.radius(), cylinder.length(), edge_length,
+                  hydroelastic_modulus),
+      {}, [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCylinderVolumeMeshWithMa<double>(cylinder, edge_length));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCylinderPressureField(cylinder, mesh.get(),
+                                      hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -353,16 +463,21 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   PositiveDouble validator("Capsule", "soft");
   // First, create the mesh.
   const double edge_length = validator.Extract(props, kHydroGroup, kRezHint);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeCapsuleVolumeMesh<double>(capsule, edge_length));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeCapsulePressureField(capsule, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(MakeSoftMeshMaybeCached(
+      fmt::format("Capsule(radius={:a}, length={:a}) edge_length={:a} E={:a}",
+                  capsule.radius(), capsule.length(), edge_length,
+                  hydroelastic_modulus),
+      {}, [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeCapsuleVolumeMesh<double>(capsule, edge_length));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeCapsulePressureField(capsule, mesh.get(),
+                                     hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -374,16 +489,22 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   const TessellationStrategy strategy =
       props.GetPropertyOrDefault(kHydroGroup, "tessellation_strategy",
                                  TessellationStrategy::kSingleInteriorVertex);
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeEllipsoidVolumeMesh<double>(ellipsoid, edge_length, strategy));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeEllipsoidPressureField(ellipsoid, mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(MakeSoftMeshMaybeCached(
+      fmt::format("Ellipsoid(a={:a}, b={:a}, c={:a}) edge_length={:a} "
+                  "strategy={} E={:a}",
+                  ellipsoid.a(), ellipsoid.b(), ellipsoid.c(), edge_length,
+                  static_cast<int>(strategy), hydroelastic_modulus),
+      {}, [&]() {
+        auto mesh = make_unique<VolumeMesh<double>>(
+            MakeEllipsoidVolumeMesh<double>(ellipsoid, edge_length, strategy));
+        auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+            MakeEllipsoidPressureField(ellipsoid, mesh.get(),
+                                       hydroelastic_modulus));
+        return SoftMesh(std::move(mesh), std::move(pressure));
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -411,32 +532,51 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
                     "shapes can only use .obj files; given: {}",
                     convex_spec.filename())));
   }
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeConvexVolumeMesh<double>(convex_spec));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  const std::string description =
+      fmt::format("Convex(extension={}, scale={:a}) E={:a}", extension,
+                  convex_spec.scale(), hydroelastic_modulus);
+  return SoftGeometry(
+      MakeSharedSoftMesh(description, convex_spec.filename(), [&]() {
+        return MakeSoftMeshMaybeCached(
+            description, convex_spec.filename(), [&]() {
+              auto mesh = make_unique<VolumeMesh<double>>(
+                  MakeConvexVolumeMesh<double>(convex_spec));
+              auto pressure =
+                  make_unique<VolumeMeshFieldLinear<double, double>>(
+                      MakeConvexPressureField(mesh.get(),
+                                              hydroelastic_modulus));
+              return SoftMesh(std::move(mesh), std::move(pressure));
+            });
+      }));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Mesh& mesh_specification, const ProximityProperties& props) {
   PositiveDouble validator("Mesh", "soft");
 
-  auto mesh = make_unique<VolumeMesh<double>>(
-      MakeVolumeMeshFromVtk<double>(mesh_specification));
-
   const double hydroelastic_modulus =
       validator.Extract(props, kHydroGroup, kElastic);
 
-  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
-      MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus));
-
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  const std::string description =
+      fmt::format("Mesh(extension={}, scale={:a}) E={:a}",
+                  mesh_specification.extension(), mesh_specification.scale(),
+                  hydroelastic_modulus);
+  return SoftGeometry(
+      MakeSharedSoftMesh(description, mesh_specification.filename(), [&]() {
+        return MakeSoftMeshMaybeCached(
+            description, mesh_specification.filename(), [&]() {
+              auto mesh = make_unique<VolumeMesh<double>>(
+                  MakeVolumeMeshFromVtk<double>(mesh_specification));
+              auto pressure =
+                  make_unique<VolumeMeshFieldLinear<double, double>>(
+                      MakeVolumeMeshPressureField(mesh.get(),
+                                                  hydroelastic_modulus));
+              return SoftMesh(std::move(mesh), std::move(pressure));
+            });
+      }));
 }
 
 }  // namespace hydroelastic
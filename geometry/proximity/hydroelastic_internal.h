@@ -6,7 +6,6 @@
 #include <utility>
 #include <variant>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_ids.h"
@@ -27,7 +26,12 @@ namespace hydroelastic {
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
  bounding volume hierarchy. While this class retains ownership of the mesh,
  we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ are derived from the mesh.
+
+ The mesh, field, and hierarchy are immutable once constructed. Several soft
+ meshes can therefore share them (e.g., all instances of one mesh file, see
+ MeshAssetRegistry). Copying a soft mesh, however, always produces an
+ independent deep copy. */
 class SoftMesh {
  public:
   SoftMesh() = default;
@@ -36,8 +40,38 @@ class SoftMesh {
            std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
       : mesh_(std::move(mesh)),
         pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
+        bvh_(std::make_shared<const Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
+    DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
+  }
+
+  /* Constructs a soft mesh that shares its (immutable) mesh, pressure field,
+   and bounding volume hierarchy with other soft meshes.
+   @pre pressure refers to `mesh` and bvh was built for `mesh`.  */
+  SoftMesh(
+      std::shared_ptr<const VolumeMesh<double>> mesh,
+      std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure,
+      std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh)
+      : mesh_(std::move(mesh)),
+        pressure_(std::move(pressure)),
+        bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr);
+    DRAKE_DEMAND(pressure_ != nullptr);
+    DRAKE_DEMAND(bvh_ != nullptr);
+    DRAKE_DEMAND(mesh_.get() == &pressure_->mesh());
+  }
+
+  /* Constructs a soft mesh from a previously computed bounding volume
+   hierarchy (e.g., one loaded from the hydroelastic disk cache) instead of
+   building it from the mesh.
+   @pre bvh was built for `mesh`.  */
+  SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
+           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure,
+           std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh)
+      : mesh_(std::move(mesh)),
+        pressure_(std::move(pressure)),
+        bvh_(std::move(bvh)) {
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
+    DRAKE_DEMAND(bvh_ != nullptr);
   }
 
   SoftMesh(const SoftMesh& s) { *this = s; }
@@ -59,9 +93,9 @@ class SoftMesh {
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure_;
-  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh_;
+  std::shared_ptr<const VolumeMesh<double>> mesh_;
+  std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure_;
+  std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -178,16 +212,33 @@ class SoftGeometry {
 
 /* Defines a rigid mesh -- a surface mesh and its bounding volume hierarchy.
  This class retains ownership of the mesh, with the bounding volume hierarchy
- just referencing it.  */
+ just referencing it.
+
+ As with SoftMesh, the mesh and hierarchy are immutable and may be shared
+ among several rigid meshes, but copying a rigid mesh produces a deep copy.  */
 class RigidMesh {
  public:
   RigidMesh() = default;
 
   explicit RigidMesh(std::unique_ptr<TriangleSurfaceMesh<double>> mesh)
       : mesh_(std::move(mesh)),
-        bvh_(std::make_unique<Bvh<Obb, TriangleSurfaceMesh<double>>>(*mesh_)) {}
+        bvh_(std::make_shared<const Bvh<Obb, TriangleSurfaceMesh<double>>>(
+            *mesh_)) {}
+
+  /* Constructs a rigid mesh that shares its (immutable) mesh and bounding
+   volume hierarchy with other rigid meshes.
+   @pre bvh was built for `mesh`.  */
+  RigidMesh(std::shared_ptr<const TriangleSurfaceMesh<double>> mesh,
+            std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>> bvh)
+      : mesh_(std::move(mesh)), bvh_(std::move(bvh)) {
+    DRAKE_DEMAND(mesh_ != nullptr);
+    DRAKE_DEMAND(bvh_ != nullptr);
+  }
 
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
+  RigidMesh(const RigidMesh& r) { *this = r; }
+  RigidMesh& operator=(const RigidMesh& r);
+  RigidMesh(RigidMesh&&) = default;
+  RigidMesh& operator=(RigidMesh&&) = default;
 
   const TriangleSurfaceMesh<double>& mesh() const {
     DRAKE_DEMAND(mesh_ != nullptr);
@@ -199,8 +250,8 @@ class RigidMesh {
   }
 
  private:
-  copyable_unique_ptr<TriangleSurfaceMesh<double>> mesh_;
-  copyable_unique_ptr<Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
+  std::shared_ptr<const TriangleSurfaceMesh<double>> mesh_;
+  std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
 };
 
 /* The base representation of rigid geometries. Generally, a rigid geometry
@@ -271,7 +322,11 @@ class RigidGeometry {
      RemoveGeometry().
 
  If two geometries are in contact, in order to produce the corresponding
- ContactSurface, both ids must have a valid representation in this set.  */
+ ContactSurface, both ids must have a valid representation in this set.
+
+ Representations are immutable once added (changing a geometry's properties
+ replaces its representation). Copies of a Geometries instance therefore share
+ the representations rather than copying the meshes.  */
 class Geometries final : public ShapeReifier {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Geometries);
@@ -295,14 +350,14 @@ class Geometries final : public ShapeReifier {
    @pre hydroelastic_type(id) returns HydroelasticType::kSoft.  */
   const SoftGeometry& soft_geometry(GeometryId id) const {
     DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kSoft);
-    return soft_geometries_.at(id);
+    return *soft_geometries_.at(id);
   }
 
   /* Returns the representation of the rigid geometry with the given `id`.
    @pre hydroelastic_type(id) returns HydroelasticType::kRigid.  */
   const RigidGeometry& rigid_geometry(GeometryId id) const {
     DRAKE_DEMAND(hydroelastic_type(id) == HydroelasticType::kRigid);
-    return rigid_geometries_.at(id);
+    return *rigid_geometries_.at(id);
   }
 
   /* Removes the geometry (if it has a hydroelastic representation).  */
@@ -360,10 +415,12 @@ class Geometries final : public ShapeReifier {
   std::unordered_map<GeometryId, HydroelasticType> supported_geometries_;
 
   // The representations of all soft geometries.
-  std::unordered_map<GeometryId, SoftGeometry> soft_geometries_;
+  std::unordered_map<GeometryId, std::shared_ptr<const SoftGeometry>>
+      soft_geometries_;
 
   // The representations of all rigid geometries.
-  std::unordered_map<GeometryId, RigidGeometry> rigid_geometries_;
+  std::unordered_map<GeometryId, std::shared_ptr<const RigidGeometry>>
+      rigid_geometries_;
 };
 
 /* @name Creating hydroelastic representations of shapes
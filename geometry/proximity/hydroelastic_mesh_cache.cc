@@ -0,0 +1,380 @@
+#include "drake/geometry/proximity/hydroelastic_mesh_cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/find_cache.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace hydroelastic {
+
+namespace fs = std::filesystem;
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using std::make_unique;
+
+namespace {
+
+using VolumeBvh = Bvh<Obb, VolumeMesh<double>>;
+using VolumeBvNode = BvNode<Obb, VolumeMesh<double>>;
+
+constexpr char kMagic[8] = {'D', 'R', 'K', 'S', 'O', 'F', 'T', '1'};
+
+struct Header {
+  char magic[8];
+  uint32_t num_vertices;
+  uint32_t num_tetrahedra;
+  uint32_t num_bvh_nodes;
+  uint32_t reserved;
+};
+static_assert(sizeof(Header) == 24);
+
+struct PackedBvNode {
+  double R_MB[9];
+  double p_MBo[3];
+  double half_width[3];
+  int32_t num_index;
+  int32_t element_index;
+};
+static_assert(sizeof(PackedBvNode) == 128);
+static_assert(VolumeBvNode::kMaxElementPerLeaf == 1);
+
+template <typename T>
+void Append(const T& value, std::string* out) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Sequentially copies plain-old-data out of a byte buffer, keeping track of
+// whether the buffer was long enough.
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  template <typename T>
+  bool Read(T* value) {
+    if (data_.size() - offset_ < sizeof(T)) return false;
+    std::memcpy(value, data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool at_end() const { return offset_ == data_.size(); }
+
+ private:
+  std::string_view data_;
+  size_t offset_{0};
+};
+
+void CountNodes(const VolumeBvNode& node, int* count) {
+  ++(*count);
+  if (!node.is_leaf()) {
+    CountNodes(node.left(), count);
+    CountNodes(node.right(), count);
+  }
+}
+
+void AppendNodes(const VolumeBvNode& node, std::string* out) {
+  PackedBvNode packed{};
+  const Matrix3d& R_MB = node.bv().pose().rotation().matrix();
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      packed.R_MB[3 * r + c] = R_MB(r, c);
+    }
+  }
+  const Vector3d& p_MBo = node.bv().pose().translation();
+  const Vector3d& half_width = node.bv().half_width();
+  for (int i = 0; i < 3; ++i) {
+    packed.p_MBo[i] = p_MBo[i];
+    packed.half_width[i] = half_width[i];
+  }
+  if (node.is_leaf()) {
+    DRAKE_DEMAND(node.num_element_indices() == 1);
+    packed.num_index = 1;
+    packed.element_index = node.element_index(0);
+  } else {
+    packed.num_index = -1;
+    packed.element_index = 0;
+  }
+  Append(packed, out);
+  if (!node.is_leaf()) {
+    AppendNodes(node.left(), out);
+    AppendNodes(node.right(), out);
+  }
+}
+
+// Reads the (sub)tree rooted at the next node in pre-order. Returns nullptr
+// if the data is malformed.
+std::unique_ptr<VolumeBvNode> ReadNodes(Reader* reader, int num_tetrahedra,
+                                        int* num_nodes_remaining) {
+  if (*num_nodes_remaining <= 0) return nullptr;
+  --(*num_nodes_remaining);
+  PackedBvNode packed;
+  if (!reader->Read(&packed)) return nullptr;
+  Matrix3d R_MB;
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      R_MB(r, c) = packed.R_MB[3 * r + c];
+    }
+  }
+  const Vector3d p_MBo(packed.p_MBo[0], packed.p_MBo[1], packed.p_MBo[2]);
+  const Vector3d half_width(packed.half_width[0], packed.half_width[1],
+                            packed.half_width[2]);
+  if (!(half_width.array() >= 0.0).all() || !half_width.allFinite() ||
+      !p_MBo.allFinite()) {
+    return nullptr;
+  }
+  // RotationMatrixd only checks its argument in Debug builds; a corrupted
+  // rotation must not reach the BVH in Release builds either.
+  if (!RotationMatrixd::IsValid(R_MB)) return nullptr;
+  Obb bv = Obb::MakeFromPaddedBox(
+      RigidTransformd(RotationMatrixd(R_MB), p_MBo), half_width);
+
+  if (packed.num_index == 1) {
+    if (packed.element_index < 0 || packed.element_index >= num_tetrahedra) {
+      return nullptr;
+    }
+    typename VolumeBvNode::LeafData leaf{1, {packed.element_index}};
+    return make_unique<VolumeBvNode>(std::move(bv), leaf);
+  }
+  if (packed.num_index != -1) return nullptr;
+  auto left = ReadNodes(reader, num_tetrahedra, num_nodes_remaining);
+  if (left == nullptr) return nullptr;
+  auto right = ReadNodes(reader, num_tetrahedra, num_nodes_remaining);
+  if (right == nullptr) return nullptr;
+  return make_unique<VolumeBvNode>(std::move(bv), std::move(left),
+                                   std::move(right));
+}
+
+// Returns the contents of the named file, or nullopt on error.
+std::optional<std::string> ReadFileContents(const std::string& filename) {
+  std::ifstream input(filename, std::ios::binary);
+  if (!input.is_open()) return std::nullopt;
+  std::stringstream buffer;
+  buffer << input.rdbuf();
+  if (input.bad()) return std::nullopt;
+  return std::move(buffer).str();
+}
+
+}  // namespace
+
+std::string SerializeSoftMesh(const SoftMesh& soft_mesh) {
+  const VolumeMesh<double>& mesh = soft_mesh.mesh();
+  const VolumeMeshFieldLinear<double, double>& pressure = soft_mesh.pressure();
+  int num_bvh_nodes = 0;
+  CountNodes(soft_mesh.bvh().root_node(), &num_bvh_nodes);
+
+  Header header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.num_vertices = mesh.num_vertices();
+  header.num_tetrahedra = mesh.num_elements();
+  header.num_bvh_nodes = num_bvh_nodes;
+
+  std::string result;
+  result.reserve(sizeof(Header) +
+                 header.num_vertices * 4 * sizeof(double) +
+                 header.num_tetrahedra * (4 * sizeof(int32_t) +
+                                          3 * sizeof(double)) +
+                 header.num_bvh_nodes * sizeof(PackedBvNode));
+  Append(header, &result);
+  for (const Vector3d& p_MV : mesh.vertices()) {
+    for (int i = 0; i < 3; ++i) Append(p_MV[i], &result);
+  }
+  for (const VolumeElement& tet : mesh.tetrahedra()) {
+    for (int i = 0; i < 4; ++i) {
+      Append(static_cast<int32_t>(tet.vertex(i)), &result);
+    }
+  }
+  for (const double value : pressure.values()) {
+    Append(value, &result);
+  }
+  for (int e = 0; e < mesh.num_elements(); ++e) {
+    const Vector3d grad_p_M = pressure.EvaluateGradient(e);
+    for (int i = 0; i < 3; ++i) Append(grad_p_M[i], &result);
+  }
+  AppendNodes(soft_mesh.bvh().root_node(), &result);
+  return result;
+}
+
+std::optional<SoftMesh> DeserializeSoftMesh(std::string_view data) {
+  Reader reader(data);
+  Header header;
+  if (!reader.Read(&header)) return std::nullopt;
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    return std::nullopt;
+  }
+  const size_t expected_size =
+      sizeof(Header) + size_t{header.num_vertices} * 4 * sizeof(double) +
+      size_t{header.num_tetrahedra} * (4 * sizeof(int32_t) +
+                                       3 * sizeof(double)) +
+      size_t{header.num_bvh_nodes} * sizeof(PackedBvNode);
+  if (data.size() != expected_size || header.num_tetrahedra == 0 ||
+      header.num_bvh_nodes == 0) {
+    return std::nullopt;
+  }
+  const int num_vertices = header.num_vertices;
+  const int num_tetrahedra = header.num_tetrahedra;
+
+  std::vector<Vector3d> vertices(num_vertices);
+  for (Vector3d& p_MV : vertices) {
+    for (int i = 0; i < 3; ++i) reader.Read(&p_MV[i]);
+  }
+  std::vector<VolumeElement> tetrahedra;
+  tetrahedra.reserve(num_tetrahedra);
+  for (int e = 0; e < num_tetrahedra; ++e) {
+    int32_t v[4];
+    for (int i = 0; i < 4; ++i) {
+      reader.Read(&v[i]);
+      if (v[i] < 0 || v[i] >= num_vertices) return std::nullopt;
+    }
+    tetrahedra.emplace_back(v[0], v[1], v[2], v[3]);
+  }
+  std::vector<double> values(num_vertices);
+  for (double& value : values) reader.Read(&value);
+  std::vector<Vector3d> gradients(num_tetrahedra);
+  for (Vector3d& grad_p_M : gradients) {
+    for (int i = 0; i < 3; ++i) reader.Read(&grad_p_M[i]);
+  }
+  int num_nodes_remaining = header.num_bvh_nodes;
+  std::unique_ptr<VolumeBvNode> root =
+      ReadNodes(&reader, num_tetrahedra, &num_nodes_remaining);
+  if (root == nullptr || num_nodes_remaining != 0 || !reader.at_end()) {
+    return std::nullopt;
+  }
+
+  auto mesh = make_unique<VolumeMesh<double>>(std::move(tetrahedra),
+                                              std::move(vertices));
+  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+      std::move(values), mesh.get(), std::move(gradients));
+  auto bvh = make_unique<VolumeBvh>(std::move(root));
+  return SoftMesh(std::move(mesh), std::move(pressure), std::move(bvh));
+}
+
+Sha256 ComputeSoftMeshCacheKey(std::string_view description,
+                               const std::string& filename) {
+  // The version string must be bumped whenever the algorithms that compute
+  // the compliant representations change in a way that affects their results.
+  std::string key_data = "drake/hydroelastic/soft_mesh/v1\n";
+  key_data.append(description);
+  if (!filename.empty()) {
+    key_data.append("\nfile:");
+    const std::optional<std::string> contents = ReadFileContents(filename);
+    key_data.append(contents.has_value() ? *contents : "<unreadable>");
+  }
+  return Sha256::Checksum(key_data);
+}
+
+SoftMeshCache::SoftMeshCache(fs::path directory)
+    : directory_(std::move(directory)) {}
+
+std::optional<SoftMesh> SoftMeshCache::Load(const Sha256& key) const {
+  const fs::path path = directory_ / key.to_string();
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) return std::nullopt;
+  ScopeExit close_guard([fd]() {
+    ::close(fd);
+  });
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    return std::nullopt;
+  }
+  const size_t size = file_stat.st_size;
+  void* const mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (mapped == MAP_FAILED) {
+    log()->debug("SoftMeshCache: could not map {}", path.string());
+    return std::nullopt;
+  }
+  ScopeExit unmap_guard([mapped, size]() {
+    ::munmap(mapped, size);
+  });
+  std::optional<SoftMesh> result =
+      DeserializeSoftMesh(std::string_view(static_cast<char*>(mapped), size));
+  if (!result.has_value()) {
+    log()->debug("SoftMeshCache: ignoring malformed entry {}", path.string());
+  }
+  return result;
+}
+
+void SoftMeshCache::Store(const Sha256& key, const SoftMesh& soft_mesh) const {
+  static std::atomic<int> next_temp_index{0};
+  const fs::path path = directory_ / key.to_string();
+  const fs::path temp_path =
+      directory_ / fmt::format("{}.tmp.{}.{}", key.to_string(), ::getpid(),
+                               next_temp_index++);
+  const std::string data = SerializeSoftMesh(soft_mesh);
+  {
+    std::ofstream output(temp_path, std::ios::binary | std::ios::trunc);
+    output.write(data.data(), data.size());
+    if (!output.good()) {
+      log()->debug("SoftMeshCache: could not write {}", temp_path.string());
+      std::error_code ec;
+      fs::remove(temp_path, ec);
+      return;
+    }
+  }
+  std::error_code ec;
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    log()->debug("SoftMeshCache: could not rename {}: {}", temp_path.string(),
+                 ec.message());
+    fs::remove(temp_path, ec);
+  }
+}
+
+SoftMesh SoftMeshCache::LoadOrMake(
+    const Sha256& key, const std::function<SoftMesh()>& make) const {
+  std::optional<SoftMesh> cached = Load(key);
+  if (cached.has_value()) {
+    return std::move(*cached);
+  }
+  SoftMesh result = make();
+  Store(key, result);
+  return result;
+}
+
+const SoftMeshCache* GetDefaultSoftMeshCache() {
+  static const never_destroyed<std::optional<SoftMeshCache>> cache(
+      []() -> std::optional<SoftMeshCache> {
+        const char* const enabled = std::getenv("DRAKE_HYDROELASTIC_CACHE");
+        if (enabled == nullptr || std::string_view(enabled).empty() ||
+            std::string_view(enabled) == "0") {
+          return std::nullopt;
+        }
+        drake::internal::PathOrError try_cache =
+            drake::internal::FindOrCreateCache("hydroelastic");
+        if (!try_cache.error.empty()) {
+          log()->warn("Disabling the hydroelastic mesh cache: {}",
+                      try_cache.error);
+          return std::nullopt;
+        }
+        return SoftMeshCache(std::move(try_cache.abspath));
+      }());
+  const std::optional<SoftMeshCache>& result = cache.access();
+  return result.has_value() ? &(*result) : nullptr;
+}
+
+}  // namespace hydroelastic
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
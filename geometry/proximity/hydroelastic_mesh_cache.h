@@ -0,0 +1,118 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/sha256.h"
+#include "drake/geometry/proximity/hydroelastic_internal.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace hydroelastic {
+
+/* @name Persistent cache of compliant hydroelastic meshes
+
+ Building the compliant representation of a shape (its tetrahedral mesh, the
+ pressure field defined on it, and the mesh's bounding volume hierarchy) can
+ dominate the start up time of scenes with many or finely-resolved compliant
+ geometries. These functions support storing those representations on disk
+ so that subsequent processes can simply load them.
+
+ The cache is content addressed: every entry is keyed by the SHA-256 checksum
+ of *everything* that influenced the computed representation -- the shape
+ type and its parameters, the resolution hint, the hydroelastic modulus, and
+ (for file-based shapes) the bytes of the referenced file. Changing any of
+ those leads to a different key; stale entries are never reused.
+
+ The on-disk format is a flat, native-endian, 8-byte aligned binary layout
+ so that it can be memory mapped and copied directly into the in-memory
+ representation:
+
+ <pre>
+   char[8]   magic "DRKSOFT1"
+   uint32    num_vertices (V)
+   uint32    num_tetrahedra (E)
+   uint32    num_bvh_nodes (N)
+   uint32    reserved (zero)
+   double    vertices[V][3]              (p_MV)
+   int32     tetrahedra[E][4]
+   double    pressure_values[V]
+   double    pressure_gradients[E][3]    (∇p expressed in M)
+   BvhNode   nodes[N]                    (pre-order traversal)
+ </pre>
+
+ where each `BvhNode` is 15 doubles followed by 2 int32:
+
+ <pre>
+   double    R_MB[3][3] (row major), p_MBo[3], half_width[3]
+   int32     num_index (-1 for branch nodes)
+   int32     element_index (leaf nodes only)
+ </pre>
+
+ The cache is opt-in: the default cache (see GetDefaultSoftMeshCache()) is
+ only enabled when the environment variable `DRAKE_HYDROELASTIC_CACHE` is set
+ to a non-empty value other than "0". Its entries live in the Drake cache
+ directory (e.g., `~/.cache/drake/hydroelastic`); it is always safe to delete
+ that directory.  */
+//@{
+
+/* Serializes the given soft mesh into the binary format documented above. */
+std::string SerializeSoftMesh(const SoftMesh& soft_mesh);
+
+/* Deserializes a soft mesh from the binary format documented above. Returns
+ std::nullopt if `data` is not a well-formed serialization (wrong magic,
+ truncated, or inconsistent sizes).  */
+std::optional<SoftMesh> DeserializeSoftMesh(std::string_view data);
+
+/* Computes the cache key for a compliant representation.
+ @param description  A string that uniquely encodes the shape type and all of
+                     the (exact) numerical parameters that affect the result.
+ @param filename     If not empty, the name of a file whose *contents* also
+                     determine the result. */
+Sha256 ComputeSoftMeshCacheKey(std::string_view description,
+                               const std::string& filename = {});
+
+/* A directory of serialized soft meshes, each stored in a file named by the
+ hex representation of its key. Storing is atomic (write to a temporary file
+ followed by a rename) so that concurrent processes can safely share one
+ cache directory. I/O errors are never fatal; they are logged at debug level
+ and simply lead to cache misses.  */
+class SoftMeshCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMeshCache)
+
+  /* Creates a cache rooted in the given (existing, writeable) directory. */
+  explicit SoftMeshCache(std::filesystem::path directory);
+
+  const std::filesystem::path& directory() const { return directory_; }
+
+  /* Returns the cached soft mesh for the given `key`, if present and valid. */
+  std::optional<SoftMesh> Load(const Sha256& key) const;
+
+  /* Writes the given soft mesh as the entry for `key`. */
+  void Store(const Sha256& key, const SoftMesh& soft_mesh) const;
+
+  /* Returns the soft mesh for `key` from the cache, or, on a cache miss,
+   invokes `make`, stores its result, and returns it. */
+  SoftMesh LoadOrMake(const Sha256& key,
+                      const std::function<SoftMesh()>& make) const;
+
+ private:
+  std::filesystem::path directory_;
+};
+
+/* Returns the process-wide default cache, or nullptr if caching is disabled
+ (see above) or the Drake cache directory cannot be created.  */
+const SoftMeshCache* GetDefaultSoftMeshCache();
+
+//@}
+
+}  // namespace hydroelastic
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,90 @@
+#include "drake/geometry/proximity/mesh_asset_registry.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+namespace fs = std::filesystem;
+
+MeshAssetRegistry& MeshAssetRegistry::GetInstance() {
+  static never_destroyed<MeshAssetRegistry> instance;
+  return instance.access();
+}
+
+int MeshAssetRegistry::num_live_assets() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  int result = 0;
+  for (const auto& [_, asset] : assets_) {
+    if (!asset.expired()) ++result;
+  }
+  return result;
+}
+
+std::optional<Sha256> MeshAssetRegistry::GetFileChecksum(
+    const std::string& filename) {
+  std::error_code ec;
+  const fs::path path = fs::canonical(filename, ec);
+  if (ec) return std::nullopt;
+  const std::uintmax_t size = fs::file_size(path, ec);
+  if (ec) return std::nullopt;
+  const fs::file_time_type last_write_time = fs::last_write_time(path, ec);
+  if (ec) return std::nullopt;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = stamps_.find(path);
+    if (iter != stamps_.end() && iter->second.size == size &&
+        iter->second.last_write_time == last_write_time) {
+      return iter->second.checksum;
+    }
+  }
+
+  std::ifstream input(path, std::ios::binary);
+  if (!input.is_open()) return std::nullopt;
+  const Sha256 checksum = Sha256::Checksum(&input);
+  if (input.bad()) return std::nullopt;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  stamps_[path] = FileStamp{size, last_write_time, checksum};
+  return checksum;
+}
+
+std::shared_ptr<const void> MeshAssetRegistry::Find(const Key& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = assets_.find(key);
+  if (iter == assets_.end()) return nullptr;
+  return iter->second.lock();
+}
+
+std::shared_ptr<const void> MeshAssetRegistry::Insert(
+    const Key& key, std::shared_ptr<const void> asset) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::weak_ptr<const void>& entry = assets_[key];
+  if (std::shared_ptr<const void> existing = entry.lock()) {
+    return existing;
+  }
+  entry = asset;
+  // Drop the entries of assets that have been released. To keep insertion
+  // amortized O(log n), we only sweep when the map has doubled in size.
+  if (assets_.size() > prune_threshold_) {
+    for (auto iter = assets_.begin(); iter != assets_.end();) {
+      if (iter->second.expired()) {
+        iter = assets_.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    prune_threshold_ =
+        std::max<size_t>(kMinPruneThreshold, 2 * assets_.size());
+  }
+  return asset;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <typeindex>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/sha256.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A process-wide registry of immutable, reference-counted assets derived from
+ mesh files (e.g., parsed vertex and face data, surface meshes, and their
+ bounding volume hierarchies).
+
+ When a scene contains many instances of the same mesh file, every consumer
+ would otherwise parse the file and build its derived data once per instance.
+ Consumers can instead ask the registry for the asset: the first request
+ creates it, and subsequent requests -- from the same or from other engines --
+ receive a shared pointer to the same immutable object. Memory and load time
+ then scale with the number of *unique* assets rather than with the number of
+ instances.
+
+ Assets are keyed by:
+
+   - the C++ type of the asset,
+   - a caller-provided `variant` string that must encode every parameter
+     (other than the file contents) that affects the asset (e.g., the scale
+     of the mesh, or the elastic modulus of a compliant mesh), and
+   - the SHA-256 checksum of the *contents* of the mesh file.
+
+ Because the key depends on file contents (rather than the file name), an
+ edited file leads to a new asset, and identical files with different names
+ share one asset. The checksum of each file is remembered by its canonical
+ path, size, and modification time, so repeated requests for an unchanged
+ file do not re-read it.
+
+ The registry only holds weak references; an asset is destroyed as soon as
+ the last consumer releases it. All member functions are thread safe.  */
+class MeshAssetRegistry {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshAssetRegistry)
+
+  MeshAssetRegistry() = default;
+
+  /* Returns the process-wide registry. */
+  static MeshAssetRegistry& GetInstance();
+
+  /* Returns the asset of type `Asset` for the given `variant` and the current
+   contents of the file named `filename`, invoking `make` to create it if no
+   live asset matches. If the file cannot be read, `make` is invoked and its
+   result is returned without being registered (so that `make` can report the
+   error in its usual way).
+
+   @pre make() never returns nullptr. */
+  template <typename Asset>
+  std::shared_ptr<const Asset> GetOrCreate(
+      std::string_view variant, const std::string& filename,
+      const std::function<std::unique_ptr<Asset>()>& make) {
+    const std::optional<Sha256> checksum = GetFileChecksum(filename);
+    if (!checksum.has_value()) {
+      return std::shared_ptr<const Asset>(make());
+    }
+    const Key key{std::type_index(typeid(Asset)), std::string(variant),
+                  *checksum};
+    if (std::shared_ptr<const void> found = Find(key)) {
+      return std::static_pointer_cast<const Asset>(std::move(found));
+    }
+    // Note: we don't hold the lock while creating the asset. If another thread
+    // registers the same asset in the meantime, Insert() returns that one and
+    // our copy gets discarded.
+    std::shared_ptr<const Asset> created(make());
+    return std::static_pointer_cast<const Asset>(
+        Insert(key, std::move(created)));
+  }
+
+  /* Reports the number of registered assets that are still alive. */
+  int num_live_assets() const;
+
+ private:
+  using Key = std::tuple<std::type_index, std::string, Sha256>;
+
+  struct FileStamp {
+    std::uintmax_t size{};
+    std::filesystem::file_time_type last_write_time;
+    Sha256 checksum;
+  };
+
+  std::optional<Sha256> GetFileChecksum(const std::string& filename);
+
+  std::shared_ptr<const void> Find(const Key& key);
+
+  std::shared_ptr<const void> Insert(const Key& key,
+                                     std::shared_ptr<const void> asset);
+
+  static constexpr size_t kMinPruneThreshold = 16;
+
+  mutable std::mutex mutex_;
+  std::map<Key, std::weak_ptr<const void>> assets_;
+  size_t prune_threshold_{kMinPruneThreshold};
+  std::map<std::filesystem::path, FileStamp> stamps_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
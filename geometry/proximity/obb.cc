@@ -27,6 +27,16 @@ Obb::Obb(const RigidTransformd& X_HB, const Vector3<double>& half_width)
   PadBoundary();
 }
 
+Obb Obb::MakeFromPaddedBox(const RigidTransformd& X_HB,
+                           const Vector3<double>& half_width) {
+  DRAKE_DEMAND(half_width.x() >= 0.0);
+  DRAKE_DEMAND(half_width.y() >= 0.0);
+  DRAKE_DEMAND(half_width.z() >= 0.0);
+  Obb result(X_HB, Vector3<double>::Zero());
+  result.half_width_ = half_width;
+  return result;
+}
+
 bool Obb::HasOverlap(const Obb& a, const Obb& b, const RigidTransformd& X_GH) {
   // The canonical frame A of box `a` is posed in the hierarchy frame G, and
   // the canonical frame B of box `b` is posed in the hierarchy frame H.
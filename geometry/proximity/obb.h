@@ -53,6 +53,14 @@ class Obb {
   */
   Obb(const math::RigidTransformd& X_HB, const Vector3<double>& half_width);
 
+  /* Reconstructs an oriented bounding box from the pose and half_width
+   reported by a previously constructed box (e.g., one that has been
+   serialized). Unlike the constructor, this does *not* pad the given
+   half_width again, so the result is bit-for-bit identical to the original.
+   @pre half_width.x(), half_width.y(), half_width.z() are not negative.  */
+  static Obb MakeFromPaddedBox(const math::RigidTransformd& X_HB,
+                               const Vector3<double>& half_width);
+
   /* Returns the center of the box -- equivalent to the position vector from
    the hierarchy frame's origin Ho to `this` box's origin Bo: `p_HoBo_H`. */
   const Vector3<double>& center() const { return pose_.translation(); }
@@ -0,0 +1,444 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <libqhullcpp/Qhull.h>
+#include <libqhullcpp/QhullFacetList.h>
+#include <libqhullcpp/QhullVertexSet.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/geometry/proximity/make_mesh_from_vtk.h"
+#include "drake/geometry/proximity/mesh_asset_registry.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/volume_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using std::make_unique;
+
+namespace {
+
+using MeshBvh = Bvh<Obb, TriangleSurfaceMesh<double>>;
+using RayPacketDirections = Eigen::Matrix<double, 3, kRayPacketSize>;
+
+/* Casts the `active` rays against the triangle with index `e`. This is the
+ Möller-Trumbore algorithm, evaluated for all rays at once. Because the rays
+ share their origin, the quantities that depend only on the origin and the
+ triangle are computed once per packet.  */
+RayPacketMask CastRayPacketTriangle(const RayPacket& rays_M,
+                                    const TriangleSurfaceMesh<double>& mesh_M,
+                                    int e, const RayPacketMask& active,
+                                    RayPacketHits* hits) {
+  const SurfaceTriangle& triangle = mesh_M.element(e);
+  const Vector3d& p_MA = mesh_M.vertex(triangle.vertex(0));
+  const Vector3d e1_M = mesh_M.vertex(triangle.vertex(1)) - p_MA;
+  const Vector3d e2_M = mesh_M.vertex(triangle.vertex(2)) - p_MA;
+  const Vector3d p_AO_M = rays_M.p_FO - p_MA;
+  const Vector3d q_M = p_AO_M.cross(e1_M);
+
+  const RayPacketDirections p_M = rays_M.dirs_F.colwise().cross(e2_M);
+  const RayPacketScalars det = (e1_M.transpose() * p_M).transpose().array();
+  const RayPacketScalars inv_det = det.inverse();
+  // The barycentric coordinates (u, v) of the hit point w.r.t. vertices 1 and
+  // 2, and the ray parameter t of the hit point.
+  const RayPacketScalars u =
+      (p_AO_M.transpose() * p_M).transpose().array() * inv_det;
+  const RayPacketScalars v =
+      (q_M.transpose() * rays_M.dirs_F).transpose().array() * inv_det;
+  const RayPacketScalars t = e2_M.dot(q_M) * inv_det;
+
+  const RayPacketMask hit = active && (det != 0.0) && (u >= 0.0) &&
+                            (v >= 0.0) && (u + v <= 1.0) &&
+                            (t >= rays_M.t_min) && (t < hits->t);
+  hits->t = hit.select(t, hits->t);
+  hits->element = hit.select(e, hits->element);
+  return hit;
+}
+
+void CastRayPacketAtNode(const MeshBvh::NodeType& node, const RayPacket& rays_M,
+                         const TriangleSurfaceMesh<double>& mesh_M,
+                         const RayPacketMask& active, RayPacketHits* hits,
+                         RayPacketMask* updated) {
+  // Note: the box test uses the hits found so far, so the rays that have
+  // already hit something in front of the box don't descend into it.
+  const RayPacketMask in_box =
+      IntersectRayPacketObb(rays_M, node.bv(), hits->t, active);
+  if (!in_box.any()) return;
+
+  if (node.is_leaf()) {
+    for (int i = 0; i < node.num_element_indices(); ++i) {
+      *updated = *updated || CastRayPacketTriangle(rays_M, mesh_M,
+                                                   node.element_index(i),
+                                                   in_box, hits);
+    }
+    return;
+  }
+  CastRayPacketAtNode(node.left(), rays_M, mesh_M, in_box, hits, updated);
+  CastRayPacketAtNode(node.right(), rays_M, mesh_M, in_box, hits, updated);
+}
+
+/* Returns the parameters of the points along the rays at which their
+ z-coordinate has the given value.  */
+RayPacketScalars CalcRayParametersAtZ(const RayPacket& rays, double z) {
+  return (z - rays.p_FO.z()) * rays.dirs_F.row(2).transpose().array().inverse();
+}
+
+/* Returns the squared distances from the z-axis of the points along the rays
+ with parameters `t`.  */
+RayPacketScalars CalcSquaredRadii(const RayPacket& rays,
+                                  const RayPacketScalars& t) {
+  const RayPacketScalars x =
+      rays.p_FO.x() + t * rays.dirs_F.row(0).transpose().array();
+  const RayPacketScalars y =
+      rays.p_FO.y() + t * rays.dirs_F.row(1).transpose().array();
+  return x * x + y * y;
+}
+
+/* Computes the ray parameters t0 ≤ t1 at which the rays
+ p_FO + t⋅dirs.col(i) cross the sphere of the given radius centered on the
+ origin. For rays that miss the sphere, the parameters are NaN.  */
+void CalcSphereCrossings(const Vector3d& p_FO, const RayPacketDirections& dirs,
+                         double radius, RayPacketScalars* t0,
+                         RayPacketScalars* t1) {
+  // The roots of a⋅t² + 2b⋅t + c = 0.
+  const RayPacketScalars a = dirs.colwise().squaredNorm().transpose().array();
+  const RayPacketScalars b = (p_FO.transpose() * dirs).transpose().array();
+  const double c = p_FO.squaredNorm() - radius * radius;
+  const RayPacketScalars root = (b * b - a * c).sqrt();
+  const RayPacketScalars inv_a = a.inverse();
+  *t0 = (-b - root) * inv_a;
+  *t1 = (-b + root) * inv_a;
+}
+
+/* Lowers `best` to the candidate parameters `t` of the `valid` rays that lie in
+ [t_min, best). NaN candidates are ignored.  */
+void KeepCloser(const RayPacketScalars& t, const RayPacketMask& valid,
+                const RayPacketScalars& t_min, RayPacketScalars* best) {
+  *best = (valid && (t >= t_min) && (t < *best)).select(t, *best);
+}
+
+void KeepCloser(const RayPacketScalars& t, const RayPacketScalars& t_min,
+                RayPacketScalars* best) {
+  KeepCloser(t, RayPacketMask::Constant(true), t_min, best);
+}
+
+/* Records the parameters `best` that are smaller than those already in `hits`
+ as the hits on a primitive.  */
+RayPacketMask RecordPrimitiveHits(const RayPacketScalars& best,
+                                  RayPacketHits* hits) {
+  const RayPacketMask hit = best < hits->t;
+  hits->t = hit.select(best, hits->t);
+  hits->element = hit.select(0, hits->element);
+  return hit;
+}
+
+}  // namespace
+
+std::shared_ptr<const RayCastMesh> GetRayCastMesh(const std::string& filename,
+                                                  double scale) {
+  // We're checking the input filename in case the user specified name has the
+  // desired extension but is a symlink to some arbitrarily named cached file.
+  const std::string extension = Mesh(filename).extension();
+  std::function<std::unique_ptr<RayCastMesh>()> make_mesh;
+  if (extension == ".obj") {
+    make_mesh = [&filename, scale]() {
+      return make_unique<RayCastMesh>(
+          ReadObjToTriangleSurfaceMesh(filename, scale));
+    };
+  } else if (extension == ".vtk") {
+    make_mesh = [&filename, scale]() {
+      return make_unique<RayCastMesh>(ConvertVolumeToSurfaceMesh(
+          MakeVolumeMeshFromVtk<double>(filename, scale)));
+    };
+  } else {
+    return nullptr;
+  }
+  return MeshAssetRegistry::GetInstance().GetOrCreate<RayCastMesh>(
+      fmt::format("RayCastMesh {} scale={:a}", extension, scale), filename,
+      make_mesh);
+}
+
+std::shared_ptr<const RayCastMesh> GetRayCastConvexHull(
+    const std::string& filename, double scale) {
+  const std::shared_ptr<const RayCastMesh> surface =
+      GetRayCastMesh(filename, scale);
+  if (surface == nullptr) {
+    return nullptr;
+  }
+  return MeshAssetRegistry::GetInstance().GetOrCreate<RayCastMesh>(
+      fmt::format("RayCastMesh hull {} scale={:a}",
+                  Mesh(filename).extension(), scale),
+      filename, [&surface]() {
+        return make_unique<RayCastMesh>(
+            MakeConvexHullSurface(surface->mesh_G.vertices()));
+      });
+}
+
+TriangleSurfaceMesh<double> MakeConvexHullSurface(
+    const std::vector<Vector3d>& vertices) {
+  std::vector<double> coordinates;
+  coordinates.reserve(3 * vertices.size());
+  for (const Vector3d& vertex : vertices) {
+    coordinates.insert(coordinates.end(), vertex.data(), vertex.data() + 3);
+  }
+  // The "Qt" option triangulates the facets of the hull.
+  orgQhull::Qhull qhull;
+  qhull.runQhull("", 3, static_cast<int>(vertices.size()), coordinates.data(),
+                 "Qt");
+  if (qhull.qhullStatus() != 0) {
+    throw std::runtime_error(
+        fmt::format("Qhull terminated with status {} and  message:\n{}",
+                    qhull.qhullStatus(), qhull.qhullMessage()));
+  }
+
+  // Qhull identifies the hull's vertices by their indices in `vertices`; the
+  // surface only keeps those, in the order in which they are first used.
+  std::unordered_map<int, int> surface_indices;
+  std::vector<Vector3d> surface_vertices;
+  auto surface_index = [&](const orgQhull::QhullVertex& vertex) {
+    const int index = vertex.point().id();
+    const auto [iter, is_new] = surface_indices.emplace(
+        index, static_cast<int>(surface_indices.size()));
+    if (is_new) surface_vertices.push_back(vertices[index]);
+    return iter->second;
+  };
+  std::vector<SurfaceTriangle> triangles;
+  triangles.reserve(qhull.facetCount());
+  for (const orgQhull::QhullFacet& facet : qhull.facetList()) {
+    std::vector<int> v;
+    for (const orgQhull::QhullVertex& vertex : facet.vertices()) {
+      v.push_back(surface_index(vertex));
+    }
+    DRAKE_DEMAND(v.size() == 3);
+    // Qhull doesn't order a facet's vertices; we order them so that the
+    // triangle's normal points along the facet's outward normal.
+    const Vector3d& p0 = surface_vertices[v[0]];
+    const Vector3d normal =
+        (surface_vertices[v[1]] - p0).cross(surface_vertices[v[2]] - p0);
+    if (normal.dot(Eigen::Map<const Vector3d>(
+            facet.hyperplane().coordinates())) < 0) {
+      std::swap(v[1], v[2]);
+    }
+    triangles.emplace_back(v[0], v[1], v[2]);
+  }
+  return TriangleSurfaceMesh<double>(std::move(triangles),
+                                     std::move(surface_vertices));
+}
+
+RayPacketMask IntersectRayPacketObb(const RayPacket& rays_H, const Obb& bv_H,
+                                    const RayPacketScalars& t_hit,
+                                    const RayPacketMask& active) {
+  // This is the "slab" test, performed in the box's canonical frame B: the
+  // ray passes through the box if the parameter intervals over which it lies
+  // between each pair of parallel faces overlap.
+  const RigidTransformd& X_HB = bv_H.pose();
+  const Vector3d p_BO = X_HB.inverse() * rays_H.p_FO;
+  const RayPacketDirections dirs_B =
+      X_HB.rotation().matrix().transpose() * rays_H.dirs_F;
+  const Vector3d& half_width = bv_H.half_width();
+
+  RayPacketScalars t_enter = rays_H.t_min;
+  RayPacketScalars t_exit = t_hit;
+  for (int k = 0; k < 3; ++k) {
+    // A zero direction component leads to infinite parameters, which
+    // correctly accept or reject the whole ray for this pair of faces.
+    const RayPacketScalars inv_dir = dirs_B.row(k).transpose().array().inverse();
+    const RayPacketScalars t0 = (-half_width(k) - p_BO(k)) * inv_dir;
+    const RayPacketScalars t1 = (half_width(k) - p_BO(k)) * inv_dir;
+    t_enter = t_enter.max(t0.min(t1));
+    t_exit = t_exit.min(t0.max(t1));
+  }
+  return active && (t_enter <= t_exit);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_M,
+                            const TriangleSurfaceMesh<double>& mesh_M,
+                            const MeshBvh& bvh_M, RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  RayPacketMask updated = RayPacketMask::Constant(false);
+  CastRayPacketAtNode(bvh_M.root_node(), rays_M, mesh_M,
+                      RayPacketMask::Constant(true), hits, &updated);
+  return updated;
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Box& box,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  // The slab test (see IntersectRayPacketObb()), without clamping the
+  // intervals to the rays' parameter ranges; the ray enters the box at t_enter
+  // and leaves it at t_exit.
+  const Vector3d half_size = box.size() / 2;
+  RayPacketScalars t_enter =
+      RayPacketScalars::Constant(-std::numeric_limits<double>::infinity());
+  RayPacketScalars t_exit =
+      RayPacketScalars::Constant(std::numeric_limits<double>::infinity());
+  for (int k = 0; k < 3; ++k) {
+    const RayPacketScalars inv_dir =
+        rays_G.dirs_F.row(k).transpose().array().inverse();
+    const RayPacketScalars t0 = (-half_size(k) - rays_G.p_FO(k)) * inv_dir;
+    const RayPacketScalars t1 = (half_size(k) - rays_G.p_FO(k)) * inv_dir;
+    t_enter = t_enter.max(t0.min(t1));
+    t_exit = t_exit.min(t0.max(t1));
+  }
+  const RayPacketMask crosses = t_enter <= t_exit;
+  RayPacketScalars best = hits->t;
+  KeepCloser(t_enter, crosses, rays_G.t_min, &best);
+  KeepCloser(t_exit, crosses, rays_G.t_min, &best);
+  return RecordPrimitiveHits(best, hits);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Capsule& capsule,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  const double half_length = capsule.length() / 2;
+  RayPacketScalars best = hits->t;
+  RayPacketScalars t0, t1;
+
+  // The cylindrical barrel; the crossings of its infinite extension are
+  // computed as crossings of a sphere by the rays projected onto the plane
+  // Gz = 0.
+  const Vector3d p_GO = rays_G.p_FO;
+  RayPacketDirections dirs_xy = rays_G.dirs_F;
+  dirs_xy.row(2).setZero();
+  CalcSphereCrossings(Vector3d(p_GO.x(), p_GO.y(), 0), dirs_xy,
+                      capsule.radius(), &t0, &t1);
+  const RayPacketScalars dir_z = rays_G.dirs_F.row(2).transpose().array();
+  KeepCloser(t0, (p_GO.z() + t0 * dir_z).abs() <= half_length, rays_G.t_min,
+             &best);
+  KeepCloser(t1, (p_GO.z() + t1 * dir_z).abs() <= half_length, rays_G.t_min,
+             &best);
+
+  // The hemispherical caps; only the crossings of the spheres beyond the
+  // barrel count.
+  for (const double sign : {1.0, -1.0}) {
+    const Vector3d p_CO = p_GO - Vector3d(0, 0, sign * half_length);
+    CalcSphereCrossings(p_CO, rays_G.dirs_F, capsule.radius(), &t0, &t1);
+    KeepCloser(t0, sign * (p_CO.z() + t0 * dir_z) >= 0, rays_G.t_min, &best);
+    KeepCloser(t1, sign * (p_CO.z() + t1 * dir_z) >= 0, rays_G.t_min, &best);
+  }
+  return RecordPrimitiveHits(best, hits);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Cylinder& cylinder,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  const double half_length = cylinder.length() / 2;
+  const double radius_squared = cylinder.radius() * cylinder.radius();
+  RayPacketScalars best = hits->t;
+
+  // The barrel; see the capsule.
+  const Vector3d p_GO = rays_G.p_FO;
+  RayPacketDirections dirs_xy = rays_G.dirs_F;
+  dirs_xy.row(2).setZero();
+  RayPacketScalars t0, t1;
+  CalcSphereCrossings(Vector3d(p_GO.x(), p_GO.y(), 0), dirs_xy,
+                      cylinder.radius(), &t0, &t1);
+  const RayPacketScalars dir_z = rays_G.dirs_F.row(2).transpose().array();
+  KeepCloser(t0, (p_GO.z() + t0 * dir_z).abs() <= half_length, rays_G.t_min,
+             &best);
+  KeepCloser(t1, (p_GO.z() + t1 * dir_z).abs() <= half_length, rays_G.t_min,
+             &best);
+
+  // The flat caps.
+  for (const double z : {half_length, -half_length}) {
+    const RayPacketScalars t = CalcRayParametersAtZ(rays_G, z);
+    KeepCloser(t, CalcSquaredRadii(rays_G, t) <= radius_squared, rays_G.t_min,
+               &best);
+  }
+  return RecordPrimitiveHits(best, hits);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Ellipsoid& ellipsoid,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  // Scaling the frame by the inverse of the radii maps the ellipsoid to the
+  // unit sphere and preserves the ray parameters.
+  const Vector3d inv_radii =
+      Vector3d(ellipsoid.a(), ellipsoid.b(), ellipsoid.c()).cwiseInverse();
+  RayPacketScalars t0, t1;
+  CalcSphereCrossings(rays_G.p_FO.cwiseProduct(inv_radii),
+                      inv_radii.asDiagonal() * rays_G.dirs_F, 1.0, &t0, &t1);
+  RayPacketScalars best = hits->t;
+  KeepCloser(t0, rays_G.t_min, &best);
+  KeepCloser(t1, rays_G.t_min, &best);
+  return RecordPrimitiveHits(best, hits);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const HalfSpace&,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  // Rays parallel to the boundary lead to infinite or NaN parameters; both
+  // are rejected.
+  RayPacketScalars best = hits->t;
+  KeepCloser(CalcRayParametersAtZ(rays_G, 0), rays_G.t_min, &best);
+  return RecordPrimitiveHits(best, hits);
+}
+
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Sphere& sphere,
+                            RayPacketHits* hits) {
+  DRAKE_DEMAND(hits != nullptr);
+  RayPacketScalars t0, t1;
+  CalcSphereCrossings(rays_G.p_FO, rays_G.dirs_F, sphere.radius(), &t0, &t1);
+  RayPacketScalars best = hits->t;
+  KeepCloser(t0, rays_G.t_min, &best);
+  KeepCloser(t1, rays_G.t_min, &best);
+  return RecordPrimitiveHits(best, hits);
+}
+
+Vector3d CalcRayHitNormal(const Box& box, const Vector3d& p_GQ) {
+  // The face whose plane Q is relatively closest to.
+  int axis{};
+  p_GQ.cwiseAbs().cwiseQuotient(box.size()).maxCoeff(&axis);
+  Vector3d nhat_G = Vector3d::Zero();
+  nhat_G(axis) = p_GQ(axis) >= 0 ? 1 : -1;
+  return nhat_G;
+}
+
+Vector3d CalcRayHitNormal(const Capsule& capsule, const Vector3d& p_GQ) {
+  // The direction from the closest point on the capsule's axis.
+  const double half_length = capsule.length() / 2;
+  const double z = std::clamp(p_GQ.z(), -half_length, half_length);
+  return (p_GQ - Vector3d(0, 0, z)).normalized();
+}
+
+Vector3d CalcRayHitNormal(const Cylinder& cylinder, const Vector3d& p_GQ) {
+  // Q lies on the barrel or a cap, whichever is closer.
+  const double radius = std::hypot(p_GQ.x(), p_GQ.y());
+  const double barrel_distance = std::abs(radius - cylinder.radius());
+  const double cap_distance = std::abs(std::abs(p_GQ.z()) -
+                                       cylinder.length() / 2);
+  if (barrel_distance < cap_distance && radius > 0) {
+    return Vector3d(p_GQ.x() / radius, p_GQ.y() / radius, 0);
+  }
+  return Vector3d(0, 0, p_GQ.z() >= 0 ? 1 : -1);
+}
+
+Vector3d CalcRayHitNormal(const Ellipsoid& ellipsoid, const Vector3d& p_GQ) {
+  // The gradient of (x/a)² + (y/b)² + (z/c)².
+  const Vector3d radii(ellipsoid.a(), ellipsoid.b(), ellipsoid.c());
+  return p_GQ.cwiseQuotient(radii.cwiseProduct(radii)).normalized();
+}
+
+Vector3d CalcRayHitNormal(const HalfSpace&, const Vector3d&) {
+  return Vector3d::UnitZ();
+}
+
+Vector3d CalcRayHitNormal(const Sphere&, const Vector3d& p_GQ) {
+  return p_GQ.normalized();
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
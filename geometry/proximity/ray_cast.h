@@ -0,0 +1,181 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obb.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The number of rays that are cast together in a RayPacket.  */
+constexpr int kRayPacketSize = 8;
+
+/* Per-ray quantities of a RayPacket. The fixed-size Eigen arrays let the
+ compiler evaluate an operation for all rays of a packet with SIMD
+ instructions.  */
+using RayPacketScalars = Eigen::Array<double, kRayPacketSize, 1>;
+using RayPacketMask = Eigen::Array<bool, kRayPacketSize, 1>;
+
+/* A bundle of kRayPacketSize rays that share a common origin O. The rays are
+ measured and expressed in some frame F. Ray i consists of the points
+
+     p_FO + t⋅dirs_F.col(i), t ∈ [t_min(i), ∞).
+
+ The directions need not be unit length; for a camera frame C whose directions
+ have unit z-component, the ray parameter t *is* the depth of the point.
+
+ Casting a packet traverses a bounding volume hierarchy once for all of its
+ rays: a node is visited if *any* of the packet's rays may hit it. Packets of
+ coherent rays (e.g., those of neighboring pixels) visit nearly the same nodes,
+ so the cost of the traversal is shared among the rays.  */
+struct RayPacket {
+  /* Returns this packet measured and expressed in frame G, given the pose of
+   this packet's frame F in G.  */
+  RayPacket Transform(const math::RigidTransformd& X_GF) const {
+    return RayPacket{.p_FO = X_GF * p_FO,
+                     .dirs_F = X_GF.rotation().matrix() * dirs_F,
+                     .t_min = t_min};
+  }
+
+  Vector3<double> p_FO;
+  Eigen::Matrix<double, 3, kRayPacketSize> dirs_F;
+  RayPacketScalars t_min;
+};
+
+/* The closest hits found so far for the rays of a RayPacket. For each ray i,
+ t(i) is the ray parameter of its closest hit (or an upper bound on the
+ parameter of any hit of interest, if nothing has been hit yet), and
+ element(i) is the index of the hit mesh element (or -1).  */
+struct RayPacketHits {
+  RayPacketScalars t;
+  Eigen::Array<int, kRayPacketSize, 1> element;
+};
+
+/* The surface of a geometry G, measured and expressed in G, along with its
+ bounding volume hierarchy, ready to have rays cast against it.  */
+struct RayCastMesh {
+  explicit RayCastMesh(TriangleSurfaceMesh<double> mesh_G_in)
+      : mesh_G(std::move(mesh_G_in)), bvh_G(mesh_G) {}
+
+  TriangleSurfaceMesh<double> mesh_G;
+  Bvh<Obb, TriangleSurfaceMesh<double>> bvh_G;
+};
+
+/* Returns the surface of the mesh in the named .obj or .vtk file (for a
+ volume mesh, its boundary), scaled by `scale`. All callers that name the same
+ file contents (and scale) share one instance; see MeshAssetRegistry.
+
+ @returns nullptr if `filename` names neither a .obj nor a .vtk file.
+ @throws std::exception if the file can't be read.  */
+std::shared_ptr<const RayCastMesh> GetRayCastMesh(const std::string& filename,
+                                                  double scale);
+
+/* Returns the convex hull of the surface that GetRayCastMesh() returns for the
+ same arguments; this is what rays are cast against for a Convex shape. All
+ callers that name the same file contents (and scale) share one instance.
+
+ @returns nullptr if `filename` names neither a .obj nor a .vtk file.
+ @throws std::exception if the file can't be read, or if its vertices don't
+         span three dimensions.  */
+std::shared_ptr<const RayCastMesh> GetRayCastConvexHull(
+    const std::string& filename, double scale);
+
+/* Returns the boundary of the convex hull of the given `vertices`,
+ triangulated, with outward-facing triangles. Only the vertices on the
+ boundary are kept.
+
+ @throws std::exception if the vertices don't span three dimensions.  */
+TriangleSurfaceMesh<double> MakeConvexHullSurface(
+    const std::vector<Eigen::Vector3d>& vertices);
+
+/* Reports which of the `active` rays of `rays_H` pass through the oriented box
+ `bv_H` with a ray parameter in [t_min(i), t_hit(i)]. The box and the rays are
+ measured and expressed in the same hierarchy frame H.
+
+ A ray parallel to a face of the box whose origin lies exactly on that face's
+ plane may be reported as missing the box.  */
+RayPacketMask IntersectRayPacketObb(const RayPacket& rays_H, const Obb& bv_H,
+                                    const RayPacketScalars& t_hit,
+                                    const RayPacketMask& active);
+
+/* Casts the rays of `rays_M` against the triangles of `mesh_M`, both measured
+ and expressed in frame M. Triangles are hit from either side. For each ray i
+ that hits a triangle with a ray parameter t ∈ [t_min(i), hits->t(i)), the
+ closest such hit is recorded in `hits`.
+
+ @param rays_M   The rays to cast.
+ @param mesh_M   The mesh to cast the rays against.
+ @param bvh_M    The bounding volume hierarchy of `mesh_M`.
+ @param hits     On input, the closest hits found so far; on output, updated
+                 with the closer hits against `mesh_M`.
+ @returns The rays whose hits were updated.
+ @pre hits != nullptr.  */
+RayPacketMask CastRayPacket(const RayPacket& rays_M,
+                            const TriangleSurfaceMesh<double>& mesh_M,
+                            const Bvh<Obb, TriangleSurfaceMesh<double>>& bvh_M,
+                            RayPacketHits* hits);
+
+/* @name Casting rays against primitive shapes
+
+ Casts the rays of `rays_G` against the surface of the given shape, both
+ measured and expressed in the shape's canonical frame G. The intersections
+ are computed analytically. The surface is hit from either side, i.e., a ray
+ that starts inside a closed shape hits the surface where it leaves the shape.
+ For each ray i that hits the surface with a ray parameter
+ t ∈ [t_min(i), hits->t(i)), hits->t(i) is set to the smallest such t and
+ hits->element(i) to zero.
+
+ The boundary of a half space is the plane Gz = 0.
+
+ @returns The rays whose hits were updated.
+ @pre hits != nullptr.  */
+//@{
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Box& box,
+                            RayPacketHits* hits);
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Capsule& capsule,
+                            RayPacketHits* hits);
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Cylinder& cylinder,
+                            RayPacketHits* hits);
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Ellipsoid& ellipsoid,
+                            RayPacketHits* hits);
+RayPacketMask CastRayPacket(const RayPacket& rays_G,
+                            const HalfSpace& half_space, RayPacketHits* hits);
+RayPacketMask CastRayPacket(const RayPacket& rays_G, const Sphere& sphere,
+                            RayPacketHits* hits);
+//@}
+
+/* @name Surface normals at ray hits
+
+ Returns the outward unit normal of the surface of the given shape at the point
+ Q, measured and expressed in the shape's canonical frame G. Q is assumed to
+ lie on the surface (e.g., it is the hit point of a ray cast with
+ CastRayPacket()); where the surface isn't smooth (e.g., at the edges of a
+ box), the normal of one of the adjacent faces is returned.  */
+//@{
+Vector3<double> CalcRayHitNormal(const Box& box, const Vector3<double>& p_GQ);
+Vector3<double> CalcRayHitNormal(const Capsule& capsule,
+                                 const Vector3<double>& p_GQ);
+Vector3<double> CalcRayHitNormal(const Cylinder& cylinder,
+                                 const Vector3<double>& p_GQ);
+Vector3<double> CalcRayHitNormal(const Ellipsoid& ellipsoid,
+                                 const Vector3<double>& p_GQ);
+Vector3<double> CalcRayHitNormal(const HalfSpace& half_space,
+                                 const Vector3<double>& p_GQ);
+Vector3<double> CalcRayHitNormal(const Sphere& sphere,
+                                 const Vector3<double>& p_GQ);
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
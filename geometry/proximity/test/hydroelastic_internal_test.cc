@@ -412,6 +412,25 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Copies of Geometries share the (immutable) representations.
+GTEST_TEST(Hydroelastic, CopySharesRepresentations) {
+  Geometries geometries;
+  const GeometryId rigid_id = GeometryId::get_new_id();
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(1.0, &rigid_properties);
+  geometries.MaybeAddGeometry(Sphere(0.5), rigid_id, rigid_properties);
+
+  const GeometryId soft_id = GeometryId::get_new_id();
+  ProximityProperties soft_properties;
+  AddCompliantHydroelasticProperties(1.0, 1e8, &soft_properties);
+  geometries.MaybeAddGeometry(Sphere(0.5), soft_id, soft_properties);
+
+  const Geometries copy{geometries};
+  EXPECT_EQ(&copy.rigid_geometry(rigid_id),
+            &geometries.rigid_geometry(rigid_id));
+  EXPECT_EQ(&copy.soft_geometry(soft_id), &geometries.soft_geometry(soft_id));
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
@@ -657,6 +676,31 @@ TEST_F(HydroelasticRigidGeometryTest, Mesh) {
   }
 }
 
+// Rigid representations of the same mesh file at the same scale share a single
+// surface mesh and Bvh; a different scale gets its own.
+TEST_F(HydroelasticRigidGeometryTest, MeshSharing) {
+  const std::string file =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const ProximityProperties props;
+  std::optional<RigidGeometry> first =
+      MakeRigidRepresentation(Mesh(file, 2.0), props);
+  std::optional<RigidGeometry> second =
+      MakeRigidRepresentation(Mesh(file, 2.0), props);
+  std::optional<RigidGeometry> other_scale =
+      MakeRigidRepresentation(Mesh(file, 3.0), props);
+  ASSERT_NE(first, std::nullopt);
+  ASSERT_NE(second, std::nullopt);
+  ASSERT_NE(other_scale, std::nullopt);
+  EXPECT_EQ(&first->mesh(), &second->mesh());
+  EXPECT_EQ(&first->bvh(), &second->bvh());
+  EXPECT_NE(&first->mesh(), &other_scale->mesh());
+
+  // Copies remain independent of the shared asset.
+  const RigidGeometry copy(*first);
+  EXPECT_NE(&copy.mesh(), &first->mesh());
+  EXPECT_TRUE(copy.mesh().Equal(first->mesh()));
+}
+
 // Confirm support for a rigid Convex. Tests that a hydroelastic representation
 // is made.
 TEST_F(HydroelasticRigidGeometryTest, Convex) {
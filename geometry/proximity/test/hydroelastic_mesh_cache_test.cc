@@ -0,0 +1,141 @@
+#include "drake/geometry/proximity/hydroelastic_mesh_cache.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/geometry/proximity/make_sphere_field.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/tessellation_strategy.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace hydroelastic {
+namespace {
+
+namespace fs = std::filesystem;
+
+using std::make_unique;
+
+SoftMesh MakeSoftSphere(double radius, double resolution_hint) {
+  const Sphere sphere(radius);
+  auto mesh = make_unique<VolumeMesh<double>>(MakeSphereVolumeMesh<double>(
+      sphere, resolution_hint, TessellationStrategy::kDenseInteriorVertices));
+  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+      MakeSpherePressureField(sphere, mesh.get(), 1e7));
+  return SoftMesh(std::move(mesh), std::move(pressure));
+}
+
+void ExpectSoftMeshesEqual(const SoftMesh& actual, const SoftMesh& expected) {
+  EXPECT_TRUE(actual.mesh().Equal(expected.mesh()));
+  // The pressure field must refer to its *own* mesh.
+  EXPECT_EQ(&actual.pressure().mesh(), &actual.mesh());
+  EXPECT_TRUE(actual.pressure().Equal(expected.pressure()));
+  // Bvh::Equal() is bit-for-bit; in particular, restoring the bounding boxes
+  // must not pad them a second time.
+  EXPECT_TRUE(actual.bvh().Equal(expected.bvh()));
+}
+
+GTEST_TEST(HydroelasticMeshCacheTest, SerializeRoundTrip) {
+  const SoftMesh original = MakeSoftSphere(0.5, 0.1);
+  const std::string data = SerializeSoftMesh(original);
+  const std::optional<SoftMesh> restored = DeserializeSoftMesh(data);
+  ASSERT_TRUE(restored.has_value());
+  ExpectSoftMeshesEqual(*restored, original);
+}
+
+GTEST_TEST(HydroelasticMeshCacheTest, DeserializeMalformed) {
+  const std::string data = SerializeSoftMesh(MakeSoftSphere(0.5, 0.25));
+
+  EXPECT_FALSE(DeserializeSoftMesh("").has_value());
+
+  // Truncated.
+  const std::string truncated = data.substr(0, data.size() - 1);
+  EXPECT_FALSE(DeserializeSoftMesh(truncated).has_value());
+
+  // Trailing garbage.
+  EXPECT_FALSE(DeserializeSoftMesh(data + "x").has_value());
+
+  // Wrong magic.
+  std::string bad_magic = data;
+  bad_magic[0] = 'X';
+  EXPECT_FALSE(DeserializeSoftMesh(bad_magic).has_value());
+
+  // A bounding box rotation that is not orthonormal. The nodes of the BVH
+  // are stored last, 128 bytes each, starting with the rotation of the root.
+  uint32_t num_bvh_nodes{};
+  std::memcpy(&num_bvh_nodes, data.data() + 16, sizeof(num_bvh_nodes));
+  std::string bad_rotation = data;
+  const double scale = 2.0;
+  std::memcpy(bad_rotation.data() + data.size() - num_bvh_nodes * 128, &scale,
+              sizeof(scale));
+  EXPECT_FALSE(DeserializeSoftMesh(bad_rotation).has_value());
+}
+
+GTEST_TEST(HydroelasticMeshCacheTest, ComputeKey) {
+  const std::string obj =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  const Sha256 base = ComputeSoftMeshCacheKey("foo");
+  EXPECT_EQ(ComputeSoftMeshCacheKey("foo"), base);
+  EXPECT_NE(ComputeSoftMeshCacheKey("bar"), base);
+
+  // The file contents participate in the key; identical contents give the
+  // same key, independent of the file name.
+  const Sha256 with_file = ComputeSoftMeshCacheKey("foo", obj);
+  EXPECT_NE(with_file, base);
+  const fs::path copy = fs::path(temp_directory()) / "copy_of_quad_cube.obj";
+  fs::copy_file(obj, copy, fs::copy_options::overwrite_existing);
+  EXPECT_EQ(ComputeSoftMeshCacheKey("foo", copy.string()), with_file);
+  {
+    std::ofstream append(copy, std::ios::app);
+    append << "# modified\n";
+  }
+  EXPECT_NE(ComputeSoftMeshCacheKey("foo", copy.string()), with_file);
+}
+
+GTEST_TEST(HydroelasticMeshCacheTest, LoadOrMake) {
+  const fs::path directory = fs::path(temp_directory()) / "hydro_cache";
+  fs::create_directory(directory);
+  const SoftMeshCache dut(directory);
+  const Sha256 key = ComputeSoftMeshCacheKey("sphere");
+
+  EXPECT_FALSE(dut.Load(key).has_value());
+
+  int num_makes = 0;
+  auto make = [&num_makes]() {
+    ++num_makes;
+    return MakeSoftSphere(0.5, 0.1);
+  };
+  const SoftMesh first = dut.LoadOrMake(key, make);
+  EXPECT_EQ(num_makes, 1);
+  EXPECT_TRUE(fs::exists(directory / key.to_string()));
+
+  const SoftMesh second = dut.LoadOrMake(key, make);
+  EXPECT_EQ(num_makes, 1);
+  ExpectSoftMeshesEqual(second, first);
+
+  // A corrupted entry is treated as a miss and gets replaced.
+  {
+    std::ofstream corrupt(directory / key.to_string(), std::ios::trunc);
+    corrupt << "garbage";
+  }
+  EXPECT_FALSE(dut.Load(key).has_value());
+  const SoftMesh third = dut.LoadOrMake(key, make);
+  EXPECT_EQ(num_makes, 2);
+  ASSERT_TRUE(dut.Load(key).has_value());
+  ExpectSoftMeshesEqual(*dut.Load(key), first);
+}
+
+}  // namespace
+}  // namespace hydroelastic
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,115 @@
+#include "drake/geometry/proximity/mesh_asset_registry.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+namespace fs = std::filesystem;
+
+using std::make_unique;
+
+struct FakeAsset {
+  int value{};
+};
+
+class MeshAssetRegistryTest : public ::testing::Test {
+ protected:
+  // Returns a factory that counts its invocations in num_makes_.
+  std::function<std::unique_ptr<FakeAsset>()> MakeFactory(int value) {
+    return [this, value]() {
+      ++num_makes_;
+      return make_unique<FakeAsset>(FakeAsset{value});
+    };
+  }
+
+  const std::string obj_ =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  MeshAssetRegistry dut_;
+  int num_makes_{0};
+};
+
+TEST_F(MeshAssetRegistryTest, SharesLiveAssets) {
+  auto first = dut_.GetOrCreate<FakeAsset>("a", obj_, MakeFactory(1));
+  auto second = dut_.GetOrCreate<FakeAsset>("a", obj_, MakeFactory(2));
+  EXPECT_EQ(num_makes_, 1);
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(second->value, 1);
+  EXPECT_EQ(dut_.num_live_assets(), 1);
+
+  // A different variant is a different asset.
+  auto other = dut_.GetOrCreate<FakeAsset>("b", obj_, MakeFactory(3));
+  EXPECT_EQ(num_makes_, 2);
+  EXPECT_NE(other.get(), first.get());
+  EXPECT_EQ(dut_.num_live_assets(), 2);
+
+  // A different asset type is a different asset.
+  auto typed = dut_.GetOrCreate<int>("a", obj_, []() {
+    return make_unique<int>(7);
+  });
+  EXPECT_EQ(*typed, 7);
+  EXPECT_EQ(dut_.num_live_assets(), 3);
+}
+
+TEST_F(MeshAssetRegistryTest, ReleasesUnusedAssets) {
+  auto first = dut_.GetOrCreate<FakeAsset>("a", obj_, MakeFactory(1));
+  EXPECT_EQ(dut_.num_live_assets(), 1);
+  first.reset();
+  EXPECT_EQ(dut_.num_live_assets(), 0);
+
+  // Once released, the asset must be created anew.
+  auto second = dut_.GetOrCreate<FakeAsset>("a", obj_, MakeFactory(2));
+  EXPECT_EQ(num_makes_, 2);
+  EXPECT_EQ(second->value, 2);
+}
+
+TEST_F(MeshAssetRegistryTest, KeyedByFileContents) {
+  const fs::path dir = temp_directory();
+  const fs::path copy1 = dir / "copy1.obj";
+  const fs::path copy2 = dir / "copy2.obj";
+  fs::copy_file(obj_, copy1, fs::copy_options::overwrite_existing);
+  fs::copy_file(obj_, copy2, fs::copy_options::overwrite_existing);
+
+  // Identical contents under different names share the asset.
+  auto from_copy1 =
+      dut_.GetOrCreate<FakeAsset>("a", copy1.string(), MakeFactory(1));
+  auto from_copy2 =
+      dut_.GetOrCreate<FakeAsset>("a", copy2.string(), MakeFactory(2));
+  EXPECT_EQ(num_makes_, 1);
+  EXPECT_EQ(from_copy1.get(), from_copy2.get());
+
+  // Changing the file's contents yields a new asset.
+  {
+    std::ofstream append(copy2, std::ios::app);
+    append << "# A change in contents.\n";
+  }
+  auto modified =
+      dut_.GetOrCreate<FakeAsset>("a", copy2.string(), MakeFactory(3));
+  EXPECT_EQ(num_makes_, 2);
+  EXPECT_NE(modified.get(), from_copy1.get());
+}
+
+TEST_F(MeshAssetRegistryTest, UnreadableFileIsNotRegistered) {
+  const std::string missing = "/no/such/file.obj";
+  auto first = dut_.GetOrCreate<FakeAsset>("a", missing, MakeFactory(1));
+  auto second = dut_.GetOrCreate<FakeAsset>("a", missing, MakeFactory(2));
+  EXPECT_EQ(num_makes_, 2);
+  EXPECT_NE(first.get(), second.get());
+  EXPECT_EQ(dut_.num_live_assets(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
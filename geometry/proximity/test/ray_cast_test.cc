@@ -0,0 +1,297 @@
+#include "drake/geometry/proximity/ray_cast.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/geometry/proximity/make_capsule_mesh.h"
+#include "drake/geometry/proximity/make_cylinder_mesh.h"
+#include "drake/geometry/proximity/make_ellipsoid_mesh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/shape_specification.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+/* Makes a packet of rays originating at p_FO, fanning out in the Fx direction
+ from the direction Fz; ray i has direction (x_i, 0, 1) with x_i evenly spaced
+ in [-spread, spread].  */
+RayPacket MakeFan(const Vector3d& p_FO, double spread) {
+  RayPacket rays{.p_FO = p_FO,
+                 .dirs_F = {},
+                 .t_min = RayPacketScalars::Zero()};
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    const double x = -spread + 2 * spread * i / (kRayPacketSize - 1);
+    rays.dirs_F.col(i) = Vector3d(x, 0, 1);
+  }
+  return rays;
+}
+
+RayPacketHits MakeNoHits(double t_max = kInf) {
+  return RayPacketHits{.t = RayPacketScalars::Constant(t_max),
+                       .element = Eigen::Array<int, kRayPacketSize, 1>::
+                           Constant(-1)};
+}
+
+// The box spans [-1, 1]³; the rays start at z = -5 and fan out so that the
+// outer two rays on either side miss the box.
+GTEST_TEST(RayCastTest, IntersectObb) {
+  const Obb box(RigidTransformd::Identity(), Vector3d(1, 1, 1));
+  const RayPacket rays = MakeFan(Vector3d(0, 0, -5), 0.7);
+  const RayPacketMask all = RayPacketMask::Constant(true);
+
+  const RayPacketMask hit =
+      IntersectRayPacketObb(rays, box, RayPacketScalars::Constant(kInf), all);
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    const double x = rays.dirs_F(0, i);
+    // The ray crosses the plane of the near face (z = -1, t = 4) at 4x and
+    // only gets farther from the box's axis beyond it.
+    EXPECT_EQ(hit(i), std::abs(4 * x) <= 1) << "ray " << i;
+  }
+
+  // Inactive rays are never reported.
+  RayPacketMask some = all;
+  some(3) = false;
+  EXPECT_FALSE(IntersectRayPacketObb(rays, box,
+                                     RayPacketScalars::Constant(kInf),
+                                     some)(3));
+
+  // A closer hit culls the box.
+  EXPECT_FALSE(IntersectRayPacketObb(rays, box, RayPacketScalars::Constant(3.5),
+                                     all)
+                   .any());
+
+  // Rays that start beyond the box miss it.
+  RayPacket far_rays = rays;
+  far_rays.t_min.setConstant(6.5);
+  EXPECT_FALSE(
+      IntersectRayPacketObb(far_rays, box, RayPacketScalars::Constant(kInf),
+                            all)
+          .any());
+
+  // The box test is frame-independent.
+  const RigidTransformd X_HF(RollPitchYawd(0.3, -0.4, 1.2),
+                             Vector3d(0.5, -1, 2));
+  const Obb box_H(X_HF * box.pose(), box.half_width());
+  EXPECT_TRUE((IntersectRayPacketObb(rays.Transform(X_HF), box_H,
+                                     RayPacketScalars::Constant(kInf), all) ==
+               hit)
+                  .all());
+}
+
+GTEST_TEST(RayCastTest, CastAgainstBox) {
+  const TriangleSurfaceMesh<double> mesh_M =
+      MakeBoxSurfaceMesh<double>(Box(2, 2, 2), 0.5);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_M(mesh_M);
+  // All rays hit the bottom face (z = -1) and then the top face (z = 1).
+  const RayPacket rays = MakeFan(Vector3d(0, 0, -5), 0.1);
+
+  RayPacketHits hits = MakeNoHits();
+  const RayPacketMask updated = CastRayPacket(rays, mesh_M, bvh_M, &hits);
+  EXPECT_TRUE(updated.all());
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    EXPECT_NEAR(hits.t(i), 4, 1e-14);
+    ASSERT_GE(hits.element(i), 0);
+    EXPECT_NEAR(std::abs(mesh_M.face_normal(hits.element(i)).z()), 1, 1e-14);
+  }
+
+  // Casting again doesn't find anything closer.
+  RayPacketHits again = hits;
+  EXPECT_FALSE(CastRayPacket(rays, mesh_M, bvh_M, &again).any());
+  EXPECT_TRUE((again.t == hits.t).all());
+
+  // Rays that start inside the box hit its top face from the inside.
+  RayPacket inside = rays;
+  inside.t_min.setConstant(4.5);
+  RayPacketHits inside_hits = MakeNoHits();
+  EXPECT_TRUE(CastRayPacket(inside, mesh_M, bvh_M, &inside_hits).all());
+  EXPECT_LT((inside_hits.t - 6).abs().maxCoeff(), 1e-14);
+
+  // A pre-existing closer hit is preserved.
+  RayPacketHits closer = MakeNoHits();
+  closer.t(2) = 3;
+  closer.element(2) = 17;
+  const RayPacketMask closer_updated =
+      CastRayPacket(rays, mesh_M, bvh_M, &closer);
+  EXPECT_FALSE(closer_updated(2));
+  EXPECT_EQ(closer.t(2), 3);
+  EXPECT_EQ(closer.element(2), 17);
+}
+
+// Compares the hits against a tessellated sphere with the analytical ones; the
+// vertices of the mesh lie on the sphere, so the mesh is hit no closer than
+// the sphere.
+GTEST_TEST(RayCastTest, CastAgainstSphere) {
+  const double radius = 1.0;
+  const TriangleSurfaceMesh<double> mesh_M =
+      MakeSphereSurfaceMesh<double>(Sphere(radius), 0.05);
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_M(mesh_M);
+  const Vector3d p_MO(0, 0, -5);
+  const RayPacket rays = MakeFan(p_MO, 0.3);
+
+  RayPacketHits hits = MakeNoHits();
+  CastRayPacket(rays, mesh_M, bvh_M, &hits);
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    const Vector3d d = rays.dirs_F.col(i);
+    // Solve |p_MO + t⋅d|² = r² for the smaller root.
+    const double a = d.squaredNorm();
+    const double b = 2 * p_MO.dot(d);
+    const double c = p_MO.squaredNorm() - radius * radius;
+    const double discriminant = b * b - 4 * a * c;
+    if (discriminant < 0) {
+      EXPECT_EQ(hits.element(i), -1);
+      EXPECT_EQ(hits.t(i), kInf);
+      continue;
+    }
+    const double t_expected = (-b - std::sqrt(discriminant)) / (2 * a);
+    EXPECT_GE(hits.t(i), t_expected - 1e-12);
+    EXPECT_NEAR(hits.t(i), t_expected, 5e-3);
+  }
+}
+
+GTEST_TEST(RayCastTest, CastAgainstHalfSpace) {
+  // The boundary plane is at z = 0; the origin is below it.
+  RayPacket rays = MakeFan(Vector3d(0, 0, -2), 1);
+  // One ray points away from the plane and one is parallel to it.
+  rays.dirs_F.col(0) = Vector3d(0, 0, -1);
+  rays.dirs_F.col(1) = Vector3d(1, 0, 0);
+
+  RayPacketHits hits = MakeNoHits(10);
+  const RayPacketMask updated = CastRayPacket(rays, HalfSpace(), &hits);
+  EXPECT_FALSE(updated(0));
+  EXPECT_FALSE(updated(1));
+  for (int i = 2; i < kRayPacketSize; ++i) {
+    EXPECT_TRUE(updated(i));
+    EXPECT_EQ(hits.t(i), 2);
+    EXPECT_EQ(hits.element(i), 0);
+  }
+  EXPECT_EQ(hits.t(0), 10);
+  EXPECT_EQ(hits.t(1), 10);
+  EXPECT_EQ(CalcRayHitNormal(HalfSpace(), Vector3d(1, 2, 0)),
+            Vector3d::UnitZ());
+}
+
+// Compares the analytical hits (and normals) on the primitives with the hits on
+// their fine tessellations. The packet comes from an arbitrary direction and
+// is aimed at the shape's origin.
+template <typename ShapeType>
+void CompareWithTessellation(const ShapeType& shape,
+                             const TriangleSurfaceMesh<double>& mesh_G,
+                             double tolerance) {
+  SCOPED_TRACE(ShapeName(shape).name());
+  const Bvh<Obb, TriangleSurfaceMesh<double>> bvh_G(mesh_G);
+  const RigidTransformd X_GF(RollPitchYawd(0.3, -0.8, 1.9), Vector3d::Zero());
+  const RayPacket rays_G = MakeFan(Vector3d(0, 0, -5), 0.25).Transform(X_GF);
+
+  RayPacketHits hits = MakeNoHits();
+  const RayPacketMask updated = CastRayPacket(rays_G, shape, &hits);
+  RayPacketHits mesh_hits = MakeNoHits();
+  const RayPacketMask mesh_updated =
+      CastRayPacket(rays_G, mesh_G, bvh_G, &mesh_hits);
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    // Rays that graze the shape may hit only one of the representations.
+    if (updated(i) != mesh_updated(i)) continue;
+    if (!updated(i)) continue;
+    EXPECT_EQ(hits.element(i), 0);
+    EXPECT_NEAR(hits.t(i), mesh_hits.t(i), tolerance) << "ray " << i;
+    const Vector3d p_GQ = rays_G.p_FO + hits.t(i) * rays_G.dirs_F.col(i);
+    const Vector3d nhat_G = CalcRayHitNormal(shape, p_GQ);
+    EXPECT_NEAR(nhat_G.norm(), 1, 1e-14);
+    EXPECT_GT(nhat_G.dot(mesh_G.face_normal(mesh_hits.element(i))),
+              1 - 20 * tolerance)
+        << "ray " << i;
+  }
+  // The fan is narrow enough that its central rays hit every shape.
+  EXPECT_TRUE(updated(3) && updated(4));
+}
+
+GTEST_TEST(RayCastTest, CastAgainstPrimitives) {
+  const Box box(1.5, 2, 0.5);
+  CompareWithTessellation(box, MakeBoxSurfaceMesh<double>(box, 0.5), 1e-12);
+  const Capsule capsule(0.5, 1.5);
+  CompareWithTessellation(capsule,
+                          MakeCapsuleSurfaceMesh<double>(capsule, 0.04), 2e-3);
+  const Cylinder cylinder(0.75, 1.25);
+  CompareWithTessellation(
+      cylinder, MakeCylinderSurfaceMesh<double>(cylinder, 0.04), 2e-3);
+  const Ellipsoid ellipsoid(0.5, 1.0, 0.75);
+  CompareWithTessellation(
+      ellipsoid, MakeEllipsoidSurfaceMesh<double>(ellipsoid, 0.04), 2e-3);
+  const Sphere sphere(0.75);
+  CompareWithTessellation(sphere, MakeSphereSurfaceMesh<double>(sphere, 0.04),
+                          2e-3);
+}
+
+// Rays that start inside a primitive hit its surface where they leave it.
+GTEST_TEST(RayCastTest, CastFromInsidePrimitives) {
+  // Ray i points along +Gx for even i and along +Gz for odd i.
+  RayPacket rays{.p_FO = Vector3d::Zero(),
+                 .dirs_F = {},
+                 .t_min = RayPacketScalars::Zero()};
+  for (int i = 0; i < kRayPacketSize; ++i) {
+    rays.dirs_F.col(i) = i % 2 == 0 ? Vector3d::UnitX() : Vector3d::UnitZ();
+  }
+  auto expect_hits = [&rays](const auto& shape, double t_x, double t_z) {
+    SCOPED_TRACE(ShapeName(shape).name());
+    RayPacketHits hits = MakeNoHits();
+    EXPECT_TRUE(CastRayPacket(rays, shape, &hits).all());
+    for (int i = 0; i < kRayPacketSize; ++i) {
+      const bool along_x = i % 2 == 0;
+      EXPECT_NEAR(hits.t(i), along_x ? t_x : t_z, 1e-14);
+      const Vector3d p_GQ = hits.t(i) * rays.dirs_F.col(i);
+      EXPECT_TRUE(CalcRayHitNormal(shape, p_GQ).isApprox(
+          along_x ? Vector3d::UnitX() : Vector3d::UnitZ()));
+    }
+  };
+  expect_hits(Box(1, 2, 3), 0.5, 1.5);
+  expect_hits(Capsule(0.5, 2), 0.5, 1.5);
+  expect_hits(Cylinder(0.5, 2), 0.5, 1);
+  expect_hits(Ellipsoid(0.5, 1, 2), 0.5, 2);
+  expect_hits(Sphere(0.5), 0.5, 0.5);
+
+  // Hits beyond hits->t are ignored.
+  RayPacketHits closer = MakeNoHits(0.25);
+  EXPECT_FALSE(CastRayPacket(rays, Sphere(0.5), &closer).any());
+  EXPECT_TRUE((closer.t == 0.25).all());
+}
+
+// The hull of a cube's corners and some of its interior points is the cube,
+// with outward triangles.
+GTEST_TEST(RayCastTest, ConvexHullSurface) {
+  std::vector<Vector3d> vertices{Vector3d::Zero(), Vector3d(0.5, 0.25, -0.5)};
+  for (double x : {-1.0, 1.0}) {
+    for (double y : {-1.0, 1.0}) {
+      for (double z : {-1.0, 1.0}) {
+        vertices.emplace_back(x, y, z);
+      }
+    }
+  }
+  const TriangleSurfaceMesh<double> hull = MakeConvexHullSurface(vertices);
+  EXPECT_EQ(hull.num_vertices(), 8);
+  EXPECT_EQ(hull.num_triangles(), 12);
+  EXPECT_NEAR(hull.total_area(), 24, 1e-14);
+  for (int t = 0; t < hull.num_triangles(); ++t) {
+    EXPECT_GT(hull.face_normal(t).dot(hull.element_centroid(t)), 0);
+  }
+
+  // Points that don't span three dimensions have no hull.
+  EXPECT_THROW(MakeConvexHullSurface({Vector3d::Zero(), Vector3d::UnitX(),
+                                      Vector3d::UnitY(), Vector3d(1, 1, 0)}),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,210 @@
+#include "drake/geometry/proximity/time_of_impact.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/proximity_utilities.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace time_of_impact {
+namespace {
+
+using Eigen::Vector3d;
+using fcl::CollisionObjectd;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Creates a collision object for the given shape, encoded with a new id.
+template <typename FclShape>
+CollisionObjectd MakeObject(const FclShape& shape) {
+  CollisionObjectd object(std::make_shared<FclShape>(shape));
+  EncodedData::encode_dynamic(GeometryId::get_new_id()).write_to(&object);
+  return object;
+}
+
+fcl::DistanceRequestd MakeRequest() {
+  fcl::DistanceRequestd request;
+  request.enable_signed_distance = true;
+  request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+  return request;
+}
+
+GTEST_TEST(LinearMotionTest, Interpolation) {
+  const RigidTransformd X_WG0(RotationMatrixd::MakeZRotation(0.0),
+                              Vector3d(1, 2, 3));
+  const RigidTransformd X_WG1(RotationMatrixd::MakeZRotation(M_PI / 2),
+                              Vector3d(3, 2, 1));
+  const double r = 0.5;
+  const LinearMotion dut(X_WG0, X_WG1, r);
+
+  EXPECT_TRUE(dut.pose(0).IsNearlyEqualTo(X_WG0, 1e-14));
+  EXPECT_TRUE(dut.pose(1).IsNearlyEqualTo(X_WG1, 1e-14));
+  const RigidTransformd X_WG_half(RotationMatrixd::MakeZRotation(M_PI / 4),
+                                  Vector3d(2, 2, 2));
+  EXPECT_TRUE(dut.pose(0.5).IsNearlyEqualTo(X_WG_half, 1e-14));
+
+  EXPECT_NEAR(dut.speed_bound(), std::sqrt(8.0) + M_PI / 2 * r, 1e-14);
+  EXPECT_TRUE(CompareMatrices(dut.swept_lower(), Vector3d(0.5, 1.5, 0.5)));
+  EXPECT_TRUE(CompareMatrices(dut.swept_upper(), Vector3d(3.5, 2.5, 3.5)));
+
+  // An unbounded geometry that doesn't rotate has a finite speed bound.
+  const LinearMotion translating(X_WG0, RigidTransformd(Vector3d(1, 2, 4)),
+                                 kInf);
+  EXPECT_EQ(translating.speed_bound(), 1.0);
+}
+
+GTEST_TEST(CalcBoundingRadiusTest, Shapes) {
+  // The radius bounds the geometry's local axis-aligned bounding box.
+  EXPECT_NEAR(CalcBoundingRadius(MakeObject(fcl::Sphered(0.5))),
+              std::sqrt(3 * 0.25), 1e-14);
+  EXPECT_NEAR(CalcBoundingRadius(MakeObject(fcl::Boxd(2, 4, 6))),
+              std::sqrt(1 + 4 + 9), 1e-14);
+  EXPECT_EQ(CalcBoundingRadius(
+                MakeObject(fcl::Halfspaced(Vector3d::UnitZ(), 0))),
+            kInf);
+}
+
+class ComputeTimeOfImpactTest : public ::testing::Test {
+ protected:
+  const CollisionObjectd sphere_ = MakeObject(fcl::Sphered(0.5));
+  const fcl::DistanceRequestd request_ = MakeRequest();
+  const double kTolerance = 1e-6;
+};
+
+// Two unit-diameter spheres, 4 m apart, approach one another head on; the
+// gap of 3 m closes at a (relative) speed of 6, so they touch at t = 0.5.
+TEST_F(ComputeTimeOfImpactTest, HeadOnCollision) {
+  const double r = CalcBoundingRadius(sphere_);
+  const LinearMotion motion_A(RigidTransformd(Vector3d(-2, 0, 0)),
+                              RigidTransformd(Vector3d(1, 0, 0)), r);
+  const LinearMotion motion_B(RigidTransformd(Vector3d(2, 0, 0)),
+                              RigidTransformd(Vector3d(-1, 0, 0)), r);
+  int num_queries = 0;
+  const std::optional<double> toi =
+      ComputeTimeOfImpact(sphere_, motion_A, sphere_, motion_B, 0, kTolerance,
+                          1.0, request_, &num_queries);
+  ASSERT_TRUE(toi.has_value());
+  // Conservative: never later than the true time of impact.
+  EXPECT_LE(*toi, 0.5);
+  EXPECT_NEAR(*toi, 0.5, kTolerance);
+  // For pure translation along the line of centers, the speed bound is exact
+  // and conservative advancement converges in a couple of steps.
+  EXPECT_LE(num_queries, 3);
+
+  // A positive distance threshold makes the impact earlier: the gap to close
+  // is 2 m rather than 3 m.
+  const std::optional<double> toi_threshold = ComputeTimeOfImpact(
+      sphere_, motion_A, sphere_, motion_B, 1.0, kTolerance, 1.0, request_);
+  ASSERT_TRUE(toi_threshold.has_value());
+  EXPECT_NEAR(*toi_threshold, 1.0 / 3.0, kTolerance);
+
+  // Impacts past max_time aren't reported.
+  EXPECT_FALSE(ComputeTimeOfImpact(sphere_, motion_A, sphere_, motion_B, 0,
+                                   kTolerance, 0.25, request_)
+                   .has_value());
+}
+
+// The spheres pass one another without touching.
+TEST_F(ComputeTimeOfImpactTest, NearMiss) {
+  const double r = CalcBoundingRadius(sphere_);
+  const LinearMotion motion_A(RigidTransformd(Vector3d(-2, 0, 0)),
+                              RigidTransformd(Vector3d(2, 0, 0)), r);
+  const LinearMotion motion_B(RigidTransformd(Vector3d(2, 1.5, 0)),
+                              RigidTransformd(Vector3d(-2, 1.5, 0)), r);
+  EXPECT_FALSE(ComputeTimeOfImpact(sphere_, motion_A, sphere_, motion_B, 0,
+                                   kTolerance, 1.0, request_)
+                   .has_value());
+
+  // Stationary, separated geometries never collide.
+  const LinearMotion still(RigidTransformd(Vector3d(3, 0, 0)),
+                           RigidTransformd(Vector3d(3, 0, 0)), r);
+  EXPECT_FALSE(ComputeTimeOfImpact(sphere_, still, sphere_, motion_B, 0,
+                                   kTolerance, 1.0, request_)
+                   .has_value());
+}
+
+// Geometries already in contact have an impact at t = 0.
+TEST_F(ComputeTimeOfImpactTest, InitiallyInContact) {
+  const double r = CalcBoundingRadius(sphere_);
+  const LinearMotion motion_A(RigidTransformd(Vector3d(0, 0, 0)),
+                              RigidTransformd(Vector3d(5, 0, 0)), r);
+  const LinearMotion motion_B(RigidTransformd(Vector3d(0.5, 0, 0)),
+                              RigidTransformd(Vector3d(0.5, 0, 0)), r);
+  const std::optional<double> toi = ComputeTimeOfImpact(
+      sphere_, motion_A, sphere_, motion_B, 0, kTolerance, 1.0, request_);
+  ASSERT_TRUE(toi.has_value());
+  EXPECT_EQ(*toi, 0.0);
+}
+
+// A box rotating a quarter turn sweeps into a sphere that it initially misses.
+TEST_F(ComputeTimeOfImpactTest, Rotation) {
+  const CollisionObjectd box = MakeObject(fcl::Boxd(4, 0.2, 0.2));
+  const LinearMotion motion_A(
+      RigidTransformd::Identity(),
+      RigidTransformd(RotationMatrixd::MakeZRotation(M_PI / 2)),
+      CalcBoundingRadius(box));
+  const LinearMotion motion_B(RigidTransformd(Vector3d(0, 1.5, 0)),
+                              RigidTransformd(Vector3d(0, 1.5, 0)),
+                              CalcBoundingRadius(sphere_));
+  const std::optional<double> toi = ComputeTimeOfImpact(
+      box, motion_A, sphere_, motion_B, 0, kTolerance, 1.0, request_);
+  ASSERT_TRUE(toi.has_value());
+  EXPECT_GT(*toi, 0.0);
+  EXPECT_LT(*toi, 1.0);
+
+  // The geometries are separated at the reported time (to within tolerance).
+  fcl::DistanceResultd result;
+  const double distance = fcl::distance(
+      box.collisionGeometry().get(), motion_A.pose(*toi).GetAsIsometry3(),
+      sphere_.collisionGeometry().get(), motion_B.pose(*toi).GetAsIsometry3(),
+      request_, result);
+  EXPECT_GT(distance, -kTolerance);
+  EXPECT_LE(distance, kTolerance);
+}
+
+GTEST_TEST(ComputeTimeOfImpactErrorTest, RotatingHalfSpace) {
+  const CollisionObjectd half_space =
+      MakeObject(fcl::Halfspaced(Vector3d::UnitZ(), 0));
+  const CollisionObjectd sphere = MakeObject(fcl::Sphered(0.5));
+  const LinearMotion motion_A(
+      RigidTransformd::Identity(),
+      RigidTransformd(RotationMatrixd::MakeXRotation(0.1)),
+      CalcBoundingRadius(half_space));
+  const LinearMotion motion_B(RigidTransformd(Vector3d(0, 0, 2)),
+                              RigidTransformd(Vector3d(0, 0, 2)),
+                              CalcBoundingRadius(sphere));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ComputeTimeOfImpact(half_space, motion_A, sphere, motion_B, 0, 1e-6, 1.0,
+                          MakeRequest()),
+      ".*unbounded extent.*");
+}
+
+GTEST_TEST(ComputeTimeOfImpactErrorTest, UnsupportedPair) {
+  const CollisionObjectd half_space =
+      MakeObject(fcl::Halfspaced(Vector3d::UnitZ(), 0));
+  const CollisionObjectd box = MakeObject(fcl::Boxd(1, 1, 1));
+  const LinearMotion still(RigidTransformd::Identity(),
+                           RigidTransformd::Identity(), kInf);
+  const LinearMotion falling(RigidTransformd(Vector3d(0, 0, 2)),
+                             RigidTransformd(Vector3d(0, 0, 0)),
+                             CalcBoundingRadius(box));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ComputeTimeOfImpact(half_space, still, box, falling, 0, 1e-6, 1.0,
+                          MakeRequest()),
+      ".*not supported.*");
+}
+
+}  // namespace
+}  // namespace time_of_impact
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,111 @@
+#include "drake/geometry/proximity/time_of_impact.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/geometry/proximity/distance_to_shape_callback.h"
+#include "drake/geometry/proximity/proximity_utilities.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace time_of_impact {
+
+using Eigen::Quaterniond;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Conservative advancement converges linearly when the geometries approach
+// each other tangentially. We cap the number of iterations and, if the cap is
+// reached, report the (conservative) time reached so far.
+constexpr int kMaxIterations = 1000;
+
+}  // namespace
+
+LinearMotion::LinearMotion(const RigidTransformd& X_WG_start,
+                           const RigidTransformd& X_WG_end,
+                           double bounding_radius)
+    : p_WGo_start_(X_WG_start.translation()),
+      p_WGo_end_(X_WG_end.translation()),
+      q_WG_start_(X_WG_start.rotation().ToQuaternion()),
+      q_WG_end_(X_WG_end.rotation().ToQuaternion()) {
+  DRAKE_DEMAND(bounding_radius >= 0);
+  // A point P of G, with |p_GoP| <= r, moves with velocity v_WGo + ω × p_GoP.
+  // With respect to normalized time, |v_WGo| is the distance travelled by Go,
+  // and |ω| is the rotation angle from start to end.
+  const double angle = q_WG_start_.angularDistance(q_WG_end_);
+  speed_bound_ = (p_WGo_end_ - p_WGo_start_).norm();
+  if (angle > 0) speed_bound_ += angle * bounding_radius;
+
+  // G stays within the bounding sphere swept along the path of Go.
+  const Vector3d r = Vector3d::Constant(bounding_radius);
+  swept_lower_ = p_WGo_start_.cwiseMin(p_WGo_end_) - r;
+  swept_upper_ = p_WGo_start_.cwiseMax(p_WGo_end_) + r;
+}
+
+RigidTransformd LinearMotion::pose(double t) const {
+  const Quaterniond q_WG = q_WG_start_.slerp(t, q_WG_end_);
+  return RigidTransformd(RotationMatrixd(q_WG),
+                         (1 - t) * p_WGo_start_ + t * p_WGo_end_);
+}
+
+double CalcBoundingRadius(const fcl::CollisionObjectd& object) {
+  const fcl::CollisionGeometryd& geometry = *object.collisionGeometry();
+  const Vector3d& lower = geometry.aabb_local.min_;
+  const Vector3d& upper = geometry.aabb_local.max_;
+  if (!lower.allFinite() || !upper.allFinite()) return kInf;
+  const double radius = lower.cwiseAbs().cwiseMax(upper.cwiseAbs()).norm();
+  return std::isfinite(radius) ? radius : kInf;
+}
+
+std::optional<double> ComputeTimeOfImpact(
+    const fcl::CollisionObjectd& a, const LinearMotion& motion_A,
+    const fcl::CollisionObjectd& b, const LinearMotion& motion_B,
+    double distance_threshold, double tolerance, double max_time,
+    const fcl::DistanceRequestd& request, int* num_distance_queries) {
+  DRAKE_DEMAND(distance_threshold >= 0);
+  DRAKE_DEMAND(tolerance > 0);
+  if (!shape_distance::ScalarSupport<double>::is_supported(
+          a.collisionGeometry()->getNodeType(),
+          b.collisionGeometry()->getNodeType())) {
+    throw std::logic_error(fmt::format(
+        "ComputeTimeOfImpact(): signed distance queries between shapes '{}' "
+        "and '{}' are not supported",
+        GetGeometryName(a), GetGeometryName(b)));
+  }
+  const double speed = motion_A.speed_bound() + motion_B.speed_bound();
+  if (!std::isfinite(speed)) {
+    throw std::logic_error(
+        "ComputeTimeOfImpact(): geometries of unbounded extent (e.g., half "
+        "spaces) are not allowed to rotate");
+  }
+
+  double t = 0;
+  for (int i = 0; i < kMaxIterations; ++i) {
+    SignedDistancePair<double> result;
+    shape_distance::ComputeNarrowPhaseDistance<double>(
+        a, motion_A.pose(t), b, motion_B.pose(t), request, &result);
+    if (num_distance_queries != nullptr) ++(*num_distance_queries);
+    const double gap = result.distance - distance_threshold;
+    if (gap <= tolerance) return t;
+    // If neither geometry moves, the gap stays as it is.
+    if (speed == 0) return std::nullopt;
+    t += gap / speed;
+    if (t > max_time) return std::nullopt;
+  }
+  return t;
+}
+
+}  // namespace time_of_impact
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <optional>
+
+#include <fcl/fcl.h>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_export.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace time_of_impact DRAKE_NO_EXPORT {
+
+/* The motion of a rigid geometry G over the normalized time interval [0, 1].
+ The pose of G is interpolated between its start pose X_WG(0) and its end pose
+ X_WG(1): its origin translates along a straight line and its orientation
+ rotates at a constant rate about a fixed axis (spherical linear
+ interpolation along the shortest arc).  */
+class LinearMotion {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(LinearMotion)
+
+  /* Constructs the motion.
+   @param X_WG_start       The pose of G at time 0.
+   @param X_WG_end         The pose of G at time 1.
+   @param bounding_radius  The radius of a sphere, centered on G's origin,
+                           that contains G. It may be infinite (e.g., for a
+                           half space).
+   @pre bounding_radius >= 0.  */
+  LinearMotion(const math::RigidTransformd& X_WG_start,
+               const math::RigidTransformd& X_WG_end, double bounding_radius);
+
+  /* Returns the pose of G at time `t`.  */
+  math::RigidTransformd pose(double t) const;
+
+  /* Returns an upper bound on the speed (with respect to normalized time) of
+   every point of G. It is infinite if G has an unbounded extent and rotates.
+   */
+  double speed_bound() const { return speed_bound_; }
+
+  /* The lower and upper corners of an axis-aligned box (in the world frame)
+   containing G for all times in [0, 1].  */
+  const Vector3<double>& swept_lower() const { return swept_lower_; }
+  const Vector3<double>& swept_upper() const { return swept_upper_; }
+
+ private:
+  Vector3<double> p_WGo_start_;
+  Vector3<double> p_WGo_end_;
+  Eigen::Quaterniond q_WG_start_;
+  Eigen::Quaterniond q_WG_end_;
+  double speed_bound_{};
+  Vector3<double> swept_lower_;
+  Vector3<double> swept_upper_;
+};
+
+/* Returns the radius of a sphere, centered on the origin of the given
+ object's geometry frame, that contains the geometry. It is infinite for
+ geometries of unbounded extent (i.e., half spaces).  */
+double CalcBoundingRadius(const fcl::CollisionObjectd& object);
+
+/* Computes the time of impact between geometries A and B, as they move
+ according to the given motions, with conservative advancement: starting at
+ t = 0, the distance d(t) between A and B is computed and, since no point of A
+ can approach any point of B faster than the sum of their speed bounds, time is
+ advanced by (d(t) - distance_threshold) / speed. The iteration terminates when
+ the geometries come within `distance_threshold + tolerance` of each other, or
+ when t passes `max_time`.
+
+ The distance is evaluated with the same narrowphase as the signed distance
+ queries (shape_distance::ComputeNarrowPhaseDistance()); in particular, Mesh and
+ Convex shapes are represented by their convex hulls.
+
+ The result is conservative: the geometries are separated by more than
+ `distance_threshold` at all times before the reported time.
+
+ @param a                   The collision object of A.
+ @param motion_A            The motion of A.
+ @param b                   The collision object of B.
+ @param motion_B            The motion of B.
+ @param distance_threshold  Geometries closer than this distance are
+                            considered to be in contact.
+ @param tolerance           Termination tolerance on the distance.
+ @param max_time            Times of impact beyond this time aren't reported.
+ @param request             The FCL distance request parameters.
+ @param[in,out] num_distance_queries  If not null, incremented by the number
+                            of narrowphase distance queries performed.
+ @returns The time of impact, or nullopt if the geometries don't come into
+          contact in the interval [0, max_time].
+ @throws std::exception if the speed bound of either motion is infinite or
+                        if signed distance isn't supported for the pair.
+ @pre distance_threshold >= 0, tolerance > 0.  */
+std::optional<double> ComputeTimeOfImpact(
+    const fcl::CollisionObjectd& a, const LinearMotion& motion_A,
+    const fcl::CollisionObjectd& b, const LinearMotion& motion_B,
+    double distance_threshold, double tolerance, double max_time,
+    const fcl::DistanceRequestd& request, int* num_distance_queries = nullptr);
+
+}  // namespace time_of_impact
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -1,13 +1,16 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <future>
 #include <limits>
 #include <string>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fcl/fcl.h>
@@ -25,8 +28,11 @@
 #include "drake/geometry/proximity/hydroelastic_callback.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
+#include "drake/geometry/proximity/mesh_asset_registry.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity/ray_cast.h"
+#include "drake/geometry/proximity/time_of_impact.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
 #include "drake/geometry/proximity/vtk_to_volume_mesh.h"
 #include "drake/geometry/read_obj.h"
@@ -61,6 +67,10 @@ class FclDynamicAABBTreeCollisionManager
 class MapGeometryIdToFclCollisionObject
     : public unordered_map<GeometryId, unique_ptr<CollisionObjectd>> {};
 
+// A node of the broadphase tree of a FclDynamicAABBTreeCollisionManager; the
+// data of a leaf is its CollisionObjectd.
+using FclTreeNode = fcl::detail::NodeBase<fcl::AABBd>;
+
 // Returns a copy of the given fcl collision geometry; throws an exception for
 // unsupported collision geometry types. This supplements the *missing* cloning
 // functionality in FCL. Issue has been submitted to FCL:
@@ -115,6 +125,46 @@ shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
   }
 }
 
+// The vertex and face data used to define an fcl::Convex. All geometries
+// declared with the same mesh file contents (and scale) share one instance of
+// this data; see GetFclConvexData().
+struct FclConvexData {
+  shared_ptr<const std::vector<Vector3d>> vertices;
+  shared_ptr<const std::vector<int>> faces;
+  int num_faces{};
+};
+
+// Returns the (shared) fcl::Convex data for the given .obj or .vtk file. For
+// .vtk files, only the vertices of the volume mesh's surface are provided (no
+// faces).
+// @pre extension is either ".obj" or ".vtk".
+shared_ptr<const FclConvexData> GetFclConvexData(const std::string& filename,
+                                                 const std::string& extension,
+                                                 double scale) {
+  DRAKE_DEMAND(extension == ".obj" || extension == ".vtk");
+  // Note: the .vtk branch (historically) does not apply the scale; it is
+  // omitted from the variant accordingly.
+  const std::string variant =
+      extension == ".obj" ? fmt::format("fcl .obj scale={:a}", scale)
+                          : std::string("fcl .vtk");
+  return MeshAssetRegistry::GetInstance().GetOrCreate<FclConvexData>(
+      variant, filename, [&]() {
+        auto data = make_unique<FclConvexData>();
+        if (extension == ".obj") {
+          // Don't bother triangulating; Convex supports polygons.
+          std::tie(data->vertices, data->faces, data->num_faces) =
+              ReadObjFile(filename, scale, false /* triangulate */);
+        } else {
+          auto surface_mesh =
+              ConvertVolumeToSurfaceMesh(ReadVtkToVolumeMesh(filename));
+          data->vertices =
+              make_shared<const std::vector<Vector3d>>(surface_mesh.vertices());
+          data->faces = make_shared<const std::vector<int>>();
+        }
+        return data;
+      });
+}
+
 // Helper function that creates a *deep* copy of the given collision object.
 unique_ptr<CollisionObjectd> CopyFclObjectOrThrow(
     const CollisionObjectd& object) {
@@ -162,12 +212,35 @@ void BuildTreeFromReference(
   target->update();
 }
 
+// The anchored collision objects and the broadphase tree built on them. The
+// engine stores them behind a shared pointer so that copies of the engine can
+// share them; see ProximityEngine::Impl::mutable_anchored().
+struct AnchoredGeometry {
+  AnchoredGeometry() = default;
+
+  // Creates a deep copy of `other`.
+  AnchoredGeometry(const AnchoredGeometry& other) {
+    std::unordered_map<const CollisionObjectd*, CollisionObjectd*> object_map;
+    CopyFclObjectsOrThrow(other.objects, &objects, &object_map);
+    BuildTreeFromReference(other.tree, object_map, &tree);
+  }
+
+  AnchoredGeometry& operator=(const AnchoredGeometry&) = delete;
+
+  // The tree containing all of the anchored geometry.
+  FclDynamicAABBTreeCollisionManager tree;
+
+  // All of the *anchored* collision elements (spanning *all* sources).
+  MapGeometryIdToFclCollisionObject objects;
+};
+
 // The data necessary for shape reification.
 struct ReifyData {
   unique_ptr<CollisionObjectd> fcl_object;
   const GeometryId id;
   const ProximityProperties& properties;
   const RigidTransformd X_WG;
+  const std::string& name;
 };
 
 // Helper functions to facilitate exercising FCL's broadphase code. FCL has
@@ -191,6 +264,11 @@ void FclDistance(const fcl::DynamicAABBTreeCollisionManager<double>& tree1,
                  data, callback);
 }
 
+// The representation of a geometry that rays are cast against (see
+// ProximityEngine::CastRays()); the primitives are cast against analytically.
+using RayCastShape = std::variant<Box, Capsule, Cylinder, Ellipsoid, HalfSpace,
+                                  Sphere, const RayCastMesh*>;
+
 // Compare function to use with ordering PenetrationAsPointPairs.
 template <typename T>
 bool OrderPointPair(const PenetrationAsPointPair<T>& p1,
@@ -223,21 +301,17 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
         other.geometries_for_deformable_contact_;
     dynamic_tree_.clear();
     dynamic_objects_.clear();
-    anchored_tree_.clear();
-    anchored_objects_.clear();
 
-    // Copy all of the geometry.
+    // Copy the dynamic geometry; the anchored geometry is shared until one of
+    // the engines modifies it.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*> object_map;
-    CopyFclObjectsOrThrow(other.anchored_objects_, &anchored_objects_,
-                          &object_map);
     CopyFclObjectsOrThrow(other.dynamic_objects_, &dynamic_objects_,
                           &object_map);
-
-    // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
-    BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
+    anchored_ = other.anchored_;
 
     collision_filter_ = other.collision_filter_;
+    ray_cast_meshes_ = other.ray_cast_meshes_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -255,21 +329,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // functions accordingly.
     // Copy all of the geometry.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*> object_map;
-    CopyFclObjectsOrThrow(anchored_objects_, &engine->anchored_objects_,
-                          &object_map);
     CopyFclObjectsOrThrow(dynamic_objects_, &engine->dynamic_objects_,
                           &object_map);
 
     engine->collision_filter_ = this->collision_filter_;
 
-    // Build new AABB trees from the input AABB trees.
+    // Build new AABB trees from the input AABB trees. The anchored geometry is
+    // stored as double, regardless of T; it can be shared.
     BuildTreeFromReference(dynamic_tree_, object_map, &engine->dynamic_tree_);
-    BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
+    engine->anchored_ = this->anchored_;
 
     engine->hydroelastic_geometries_ = this->hydroelastic_geometries_;
     engine->geometries_for_deformable_contact_ =
         this->geometries_for_deformable_contact_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->ray_cast_meshes_ = this->ray_cast_meshes_;
 
     return engine;
   }
@@ -277,15 +351,18 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   CollisionFilter& collision_filter() { return collision_filter_; }
 
   void AddDynamicGeometry(const Shape& shape, const RigidTransformd& X_WG,
-                          GeometryId id, const ProximityProperties& props) {
-    AddGeometry(shape, X_WG, id, props, true, &dynamic_tree_,
+                          GeometryId id, const ProximityProperties& props,
+                          const std::string& name) {
+    AddGeometry(shape, X_WG, id, props, name, true, &dynamic_tree_,
                 &dynamic_objects_);
   }
 
   void AddAnchoredGeometry(const Shape& shape, const RigidTransformd& X_WG,
-                           GeometryId id, const ProximityProperties& props) {
-    AddGeometry(shape, X_WG, id, props, false, &anchored_tree_,
-                &anchored_objects_);
+                           GeometryId id, const ProximityProperties& props,
+                           const std::string& name) {
+    AnchoredGeometry& anchored = mutable_anchored();
+    AddGeometry(shape, X_WG, id, props, name, false, &anchored.tree,
+                &anchored.objects);
   }
 
   void AddDeformableGeometry(const VolumeMesh<double>& mesh_W, GeometryId id) {
@@ -353,7 +430,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // "AddDynamicGeometry() or AddAnchoredGeometry()") and has not been since
   // removed (via "RemoveGeometry()").
   bool IsRegisteredAsRigid(GeometryId id) {
-    return dynamic_objects_.count(id) > 0 || anchored_objects_.count(id) > 0;
+    return dynamic_objects_.count(id) > 0 || anchored().objects.count(id) > 0;
   }
 
   // Removes a non-deformable geometry from this engine.
@@ -361,10 +438,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     if (is_dynamic) {
       RemoveGeometry(id, &dynamic_tree_, &dynamic_objects_);
     } else {
-      RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
+      AnchoredGeometry& anchored = mutable_anchored();
+      RemoveGeometry(id, &anchored.tree, &anchored.objects);
     }
     hydroelastic_geometries_.RemoveGeometry(id);
     geometries_for_deformable_contact_.RemoveGeometry(id);
+    ray_cast_meshes_.erase(id);
   }
 
   void RemoveDeformableGeometry(GeometryId id) {
@@ -383,7 +462,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   int num_dynamic() const { return static_cast<int>(dynamic_objects_.size()); }
 
   int num_anchored() const {
-    return static_cast<int>(anchored_objects_.size());
+    return static_cast<int>(anchored().objects.size());
   }
 
   void set_distance_tolerance(double tol) { distance_tolerance_ = tol; }
@@ -439,6 +518,34 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
         shape, data.id, data.properties, data.X_WG);
   }
 
+  // Reads the surface that rays are cast against for a Mesh geometry (the
+  // surface in its file) or a Convex geometry (the convex hull of that
+  // surface, as for the engine's other queries).
+  // @throws std::exception if the file is neither a .obj nor a .vtk file, or
+  //         if it can't be read; the message names the geometry.
+  void ProcessRayCastMesh(const std::string& filename, double scale,
+                          bool convex_hull, void* user_data) {
+    const ReifyData& data = *static_cast<ReifyData*>(user_data);
+    std::shared_ptr<const RayCastMesh> mesh;
+    try {
+      mesh = convex_hull ? GetRayCastConvexHull(filename, scale)
+                         : GetRayCastMesh(filename, scale);
+    } catch (const std::exception& e) {
+      throw std::runtime_error(fmt::format(
+          "ProximityEngine: rays can't be cast against the geometry '{}' ({}) "
+          "because its file ({}) can't be read: {}",
+          data.name, data.id, filename, e.what()));
+    }
+    if (mesh == nullptr) {
+      throw std::runtime_error(fmt::format(
+          "ProximityEngine: rays can only be cast against Mesh and Convex "
+          "shapes from .obj or .vtk files; the geometry '{}' ({}) got ({}) "
+          "instead.",
+          data.name, data.id, filename));
+    }
+    ray_cast_meshes_[data.id] = std::move(mesh);
+  }
+
   void ImplementGeometry(const Box& box, void* user_data) override {
     auto fcl_box = make_shared<fcl::Boxd>(box.size());
     TakeShapeOwnership(fcl_box, user_data);
@@ -459,37 +566,25 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // obj file or a tetrahedral mesh in vtk file, from which we extract its
   // surface.
   void ImplementGeometry(const Convex& convex, void* user_data) override {
-    shared_ptr<const std::vector<Vector3d>> shared_verts;
-    shared_ptr<std::vector<int>> shared_faces;
-    int num_faces{0};
-    if (convex.extension() == ".obj") {
-      // Don't bother triangulating; Convex supports polygons.
-      std::tie(shared_verts, shared_faces, num_faces) = ReadObjFile(
-          convex.filename(), convex.scale(), false /* triangulate */);
-    } else if (convex.extension() == ".vtk") {
-      auto surface_mesh =
-          ConvertVolumeToSurfaceMesh(ReadVtkToVolumeMesh(convex.filename()));
-      shared_verts =
-          make_shared<const std::vector<Vector3d>>(surface_mesh.vertices());
-      shared_faces = make_shared<std::vector<int>>();
-    } else {
+    if (convex.extension() != ".obj" && convex.extension() != ".vtk") {
       throw std::runtime_error(fmt::format(
           "ProximityEngine: Convex shapes only support .obj or .vtk files;"
           " got ({}) instead.",
           convex.filename()));
     }
+    // The vertices and faces are shared by all Convex shapes that use the same
+    // file, so we don't read the same file again and again.
+    const shared_ptr<const FclConvexData> data =
+        GetFclConvexData(convex.filename(), convex.extension(), convex.scale());
     // Create fcl::Convex.
-    auto fcl_convex =
-        make_shared<fcl::Convexd>(shared_verts, num_faces, shared_faces);
+    auto fcl_convex = make_shared<fcl::Convexd>(data->vertices,
+                                                data->num_faces, data->faces);
 
     TakeShapeOwnership(fcl_convex, user_data);
     ProcessHydroelastic(convex, user_data);
     ProcessGeometriesForDeformableContact(convex, user_data);
-
-    // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
-    // to own vertices and face by a map from filename.  This way we won't have
-    // to read the same file again and again when we create multiple Convex
-    // objects from the same file.
+    ProcessRayCastMesh(convex.filename(), convex.scale(), true /* hull */,
+                       user_data);
   }
 
   void ImplementGeometry(const Cylinder& cylinder, void* user_data) override {
@@ -538,15 +633,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       shared_verts = make_shared<const std::vector<Vector3d>>(
           hydroelastic_geometries_.rigid_geometry(data.id).mesh().vertices());
     } else {
-      if (mesh.extension() == ".vtk") {
+      if (mesh.extension() == ".vtk" || mesh.extension() == ".obj") {
         // TODO(rpoyner-tri): could take convex hull here.
-        shared_verts = make_shared<const std::vector<Vector3d>>(
-            ConvertVolumeToSurfaceMesh(ReadVtkToVolumeMesh(mesh.filename()))
-                .vertices());
-      } else if (mesh.extension() == ".obj") {
-        // Don't bother triangulating; we're ignoring the faces.
-        std::tie(shared_verts, std::ignore, std::ignore) =
-            ReadObjFile(mesh.filename(), mesh.scale(), false /* triangulate */);
+        // We're ignoring the faces; the vertices are shared with all other
+        // geometries declared with the same file.
+        shared_verts =
+            GetFclConvexData(mesh.filename(), mesh.extension(), mesh.scale())
+                ->vertices;
       } else {
         // TODO(SeanCurtis-TRI) Add a troubleshooting entry to give more
         //  helpful advice.
@@ -576,6 +669,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     //  (kHydroGroup, kRezHint). We should make exception for Mesh since it
     //  doesn't need resolution hint.
     ProcessGeometriesForDeformableContact(mesh, user_data);
+    ProcessRayCastMesh(mesh.filename(), mesh.scale(), false /* hull */,
+                       user_data);
   }
 
   void ImplementGeometry(const Sphere& sphere, void* user_data) override {
@@ -586,13 +681,15 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     ProcessGeometriesForDeformableContact(sphere, user_data);
   }
 
-  std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
+  void ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-      const double max_distance) const {
-    std::vector<SignedDistancePair<T>> witness_pairs;
+      const double max_distance,
+      std::vector<SignedDistancePair<T>>* witness_pairs) const {
+    DRAKE_DEMAND(witness_pairs != nullptr);
+    witness_pairs->clear();
     // All these quantities are aliased in the callback data.
     shape_distance::CallbackData<T> data{&collision_filter_, &X_WGs,
-                                         max_distance, &witness_pairs};
+                                         max_distance, witness_pairs};
     data.request.enable_nearest_points = true;
     data.request.enable_signed_distance = true;
     data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
@@ -603,9 +700,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
-    FclDistance(dynamic_tree_, anchored_tree_, &data,
+    FclDistance(dynamic_tree_, anchored().tree, &data,
                 shape_distance::Callback<T>);
-    return witness_pairs;
   }
 
   SignedDistancePair<T> ComputeSignedDistancePairClosestPoints(
@@ -624,8 +720,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     auto find_geometry = [this](GeometryId id) -> CollisionObjectd* {
       auto iter = dynamic_objects_.find(id);
       if (iter == dynamic_objects_.end()) {
-        iter = anchored_objects_.find(id);
-        if (iter == anchored_objects_.end()) {
+        iter = anchored().objects.find(id);
+        if (iter == anchored().objects.end()) {
           throw std::runtime_error(fmt::format(
               "The geometry given by id {} does not reference a "
               "geometry that can be used in a signed distance query",
@@ -667,28 +763,29 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     dynamic_tree_.distance(&query_point, &data, point_distance::Callback<T>);
 
     // Perform query of point vs anchored objects.
-    anchored_tree_.distance(&query_point, &data, point_distance::Callback<T>);
+    anchored().tree.distance(&query_point, &data,
+                             point_distance::Callback<T>);
 
     return distances;
   }
 
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-    std::vector<PenetrationAsPointPair<T>> contacts;
+  void ComputePointPairPenetration(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      std::vector<PenetrationAsPointPair<T>>* contacts) const {
+    DRAKE_DEMAND(contacts != nullptr);
+    contacts->clear();
     penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
-                                                 &contacts};
+                                                 contacts};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
+    FclCollide(dynamic_tree_, anchored().tree, &data,
                penetration_as_point_pair::Callback<T>);
 
-    std::sort(contacts.begin(), contacts.end(), OrderPointPair<T>);
-
-    return contacts;
+    std::sort(contacts->begin(), contacts->end(), OrderPointPair<T>);
   }
 
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const {
@@ -701,7 +798,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
+    FclCollide(dynamic_tree_, anchored().tree, &data,
                find_collision_candidates::Callback);
 
     std::sort(
@@ -723,32 +820,307 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data, has_collisions::Callback);
+    FclCollide(dynamic_tree_, anchored().tree, &data, has_collisions::Callback);
     return data.collisions_exist;
   }
 
+  std::optional<TimeOfImpact> ComputeTimeOfImpact(
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+      double distance_threshold, int* num_distance_queries) const {
+    using time_of_impact::CalcBoundingRadius;
+    using time_of_impact::LinearMotion;
+    DRAKE_THROW_UNLESS(distance_threshold >= 0);
+
+    struct Mover {
+      const CollisionObjectd* object{};
+      LinearMotion motion;
+    };
+    vector<Mover> movers;
+    movers.reserve(dynamic_objects_.size());
+    for (const auto& [id, object] : dynamic_objects_) {
+      const RigidTransformd X_WG_start = convert_to_double(X_WGs.at(id));
+      const auto iter = X_WGs_end.find(id);
+      const RigidTransformd& X_WG_end =
+          iter != X_WGs_end.end() ? iter->second : X_WG_start;
+      movers.push_back(
+          {object.get(), LinearMotion(X_WG_start, X_WG_end,
+                                      CalcBoundingRadius(*object))});
+    }
+
+    fcl::DistanceRequestd request;
+    request.enable_signed_distance = true;
+    request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
+    request.distance_tolerance = distance_tolerance_;
+
+    // Candidate pairs are resolved in order of discovery; each found impact
+    // lowers `max_time` for the remaining pairs, so pairs that can't beat the
+    // earliest impact found so far terminate quickly.
+    std::optional<TimeOfImpact> result;
+    auto consider = [&](const CollisionObjectd& a, const LinearMotion& motion_A,
+                        const CollisionObjectd& b,
+                        const LinearMotion& motion_B) {
+      GeometryId id_A = EncodedData(a).id();
+      GeometryId id_B = EncodedData(b).id();
+      if (!collision_filter_.CanCollideWith(id_A, id_B)) return;
+      const double max_time = result.has_value() ? result->time : 1.0;
+      const std::optional<double> time = time_of_impact::ComputeTimeOfImpact(
+          a, motion_A, b, motion_B, distance_threshold, distance_tolerance_,
+          max_time, request, num_distance_queries);
+      if (time.has_value() && (!result.has_value() || *time < result->time)) {
+        if (id_B < id_A) std::swap(id_A, id_B);
+        result = TimeOfImpact(id_A, id_B, *time);
+      }
+    };
+
+    // Dynamic vs dynamic: pairs whose swept boxes (inflated by the threshold)
+    // overlap.
+    for (size_t i = 0; i < movers.size(); ++i) {
+      const LinearMotion& motion_A = movers[i].motion;
+      const Vector3d lower_A =
+          motion_A.swept_lower().array() - distance_threshold;
+      const Vector3d upper_A =
+          motion_A.swept_upper().array() + distance_threshold;
+      for (size_t j = i + 1; j < movers.size(); ++j) {
+        const LinearMotion& motion_B = movers[j].motion;
+        if ((lower_A.array() > motion_B.swept_upper().array()).any() ||
+            (motion_B.swept_lower().array() > upper_A.array()).any()) {
+          continue;
+        }
+        consider(*movers[i].object, motion_A, *movers[j].object, motion_B);
+      }
+    }
+
+    // Dynamic vs anchored: the anchored tree's broadphase reports the anchored
+    // geometries that overlap each dynamic geometry's inflated swept box.
+    // Anchored geometries don't move.
+    struct SweptBoxData {
+      const CollisionObjectd* swept_box{};
+      vector<const CollisionObjectd*> overlapping;
+    };
+    auto collect = [](CollisionObjectd* o1, CollisionObjectd* o2,
+                      void* callback_data) {
+      auto& data = *static_cast<SweptBoxData*>(callback_data);
+      data.overlapping.push_back(o1 == data.swept_box ? o2 : o1);
+      return false;
+    };
+    for (const Mover& mover : movers) {
+      const Vector3d lower =
+          mover.motion.swept_lower().array() - distance_threshold;
+      const Vector3d upper =
+          mover.motion.swept_upper().array() + distance_threshold;
+      SweptBoxData data;
+      if (lower.allFinite() && upper.allFinite()) {
+        CollisionObjectd swept_box(make_shared<fcl::Boxd>(upper - lower));
+        swept_box.setTranslation((lower + upper) / 2);
+        swept_box.computeAABB();
+        data.swept_box = &swept_box;
+        anchored().tree.collide(&swept_box, &data, collect);
+      } else {
+        for (const auto& id_object_pair : anchored().objects) {
+          data.overlapping.push_back(id_object_pair.second.get());
+        }
+      }
+      for (const CollisionObjectd* anchored_object : data.overlapping) {
+        const RigidTransformd X_WG(anchored_object->getTransform());
+        const LinearMotion still(X_WG, X_WG,
+                                 CalcBoundingRadius(*anchored_object));
+        consider(*mover.object, mover.motion, *anchored_object, still);
+      }
+    }
+
+    return result;
+  }
+
+  void CastRays(const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W,
+                double max_distance, EigenPtr<Eigen::VectorXd> distances,
+                std::vector<GeometryId>* geometry_ids,
+                EigenPtr<Eigen::Matrix3Xd> normals_W,
+                Parallelism parallelism) const {
+    const int num_rays = dirs_W.cols();
+    DRAKE_THROW_UNLESS(p_WRs.cols() == 1 || p_WRs.cols() == num_rays);
+    DRAKE_THROW_UNLESS(max_distance >= 0);
+    DRAKE_THROW_UNLESS(distances != nullptr);
+    DRAKE_THROW_UNLESS(distances->size() == num_rays);
+    DRAKE_THROW_UNLESS(normals_W == nullptr || normals_W->cols() == num_rays);
+    if ((dirs_W.colwise().norm().array() == 0).any()) {
+      throw std::logic_error(
+          "ProximityEngine::CastRays(): ray directions must be non-zero");
+    }
+    if (geometry_ids != nullptr) geometry_ids->resize(num_rays);
+
+    // The geometries, gathered once per batch, and keyed by their FCL objects,
+    // which are the leaves of the broadphase trees.
+    struct Target {
+      GeometryId id;
+      RayCastShape shape;
+      RigidTransformd X_GW;
+    };
+    std::vector<Target> targets;
+    targets.reserve(num_geometries());
+    std::unordered_map<const CollisionObjectd*, int> target_indices;
+    auto add_targets =
+        [this, &targets, &target_indices](
+            const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>&
+                objects) {
+          for (const auto& [id, object] : objects) {
+            target_indices[object.get()] = static_cast<int>(targets.size());
+            targets.push_back(
+                {id, MakeRayCastShape(id, *object),
+                 RigidTransformd(object->getTransform()).inverse()});
+          }
+        };
+    add_targets(dynamic_objects_);
+    add_targets(anchored().objects);
+
+    // Casts the rays in [begin, end), which share the origin p_WO, as one
+    // packet; unused lanes repeat the last ray and don't accept any hits.
+    auto cast_packet = [&](int begin, int end, const Vector3d& p_WO) {
+      const int size = end - begin;
+      RayPacket rays_W{.p_FO = p_WO, .dirs_F = {}, .t_min = {}};
+      RayPacketHits hits;
+      for (int i = 0; i < kRayPacketSize; ++i) {
+        const int r = begin + std::min(i, size - 1);
+        rays_W.dirs_F.col(i) = dirs_W.col(r).normalized();
+        rays_W.t_min(i) = 0;
+        hits.t(i) = i < size ? max_distance : 0;
+        hits.element(i) = -1;
+      }
+      Eigen::Array<int, kRayPacketSize, 1> hit_target =
+          Eigen::Array<int, kRayPacketSize, 1>::Constant(-1);
+      // The geometries are culled with FCL's broadphase trees: a node is
+      // visited only if some ray of the packet passes through its box before
+      // that ray's closest hit so far. Unbounded boxes (i.e., those holding a
+      // half space) are always visited.
+      const RayPacketMask all = RayPacketMask::Constant(true);
+      std::vector<const FclTreeNode*> stack{dynamic_tree_.getTree().getRoot(),
+                                            anchored().tree.getTree().getRoot()};
+      while (!stack.empty()) {
+        const FclTreeNode* node = stack.back();
+        stack.pop_back();
+        if (node == nullptr) continue;
+        const fcl::AABBd& aabb = node->bv;
+        if (aabb.min_.allFinite() && aabb.max_.allFinite()) {
+          const Obb box_W(RigidTransformd(aabb.center()),
+                          (aabb.max_ - aabb.min_) / 2);
+          if (!IntersectRayPacketObb(rays_W, box_W, hits.t, all).any()) {
+            continue;
+          }
+        }
+        if (!node->isLeaf()) {
+          stack.push_back(node->children[0]);
+          stack.push_back(node->children[1]);
+          continue;
+        }
+        const int k = target_indices.at(
+            static_cast<const CollisionObjectd*>(node->data));
+        const Target& target = targets[k];
+        const RayPacket rays_G = rays_W.Transform(target.X_GW);
+        const RayPacketMask updated = std::visit(
+            [&rays_G, &hits](const auto& shape) {
+              if constexpr (std::is_same_v<std::decay_t<decltype(shape)>,
+                                           const RayCastMesh*>) {
+                return CastRayPacket(rays_G, shape->mesh_G, shape->bvh_G,
+                                     &hits);
+              } else {
+                return CastRayPacket(rays_G, shape, &hits);
+              }
+            },
+            target.shape);
+        hit_target = updated.select(k, hit_target);
+      }
+
+      for (int i = 0; i < size; ++i) {
+        const int r = begin + i;
+        if (hit_target(i) < 0) {
+          (*distances)(r) = std::numeric_limits<double>::infinity();
+          if (geometry_ids != nullptr) (*geometry_ids)[r] = GeometryId{};
+          if (normals_W != nullptr) normals_W->col(r).setZero();
+          continue;
+        }
+        const Target& target = targets[hit_target(i)];
+        (*distances)(r) = hits.t(i);
+        if (geometry_ids != nullptr) (*geometry_ids)[r] = target.id;
+        if (normals_W != nullptr) {
+          const Vector3d p_GQ = target.X_GW * (p_WO + hits.t(i) *
+                                                         rays_W.dirs_F.col(i));
+          const Vector3d nhat_G = std::visit(
+              [&p_GQ, &hits, i](const auto& shape) -> Vector3d {
+                if constexpr (std::is_same_v<std::decay_t<decltype(shape)>,
+                                             const RayCastMesh*>) {
+                  return shape->mesh_G.face_normal(hits.element(i));
+                } else {
+                  return CalcRayHitNormal(shape, p_GQ);
+                }
+              },
+              target.shape);
+          normals_W->col(r) = target.X_GW.rotation().inverse() * nhat_G;
+        }
+      }
+    };
+
+    // Consecutive rays that share their origin are cast as packets; the others
+    // are cast one at a time.
+    auto cast_chunk = [&](int chunk) {
+      const int begin = chunk * kRayPacketSize;
+      const int end = std::min(begin + kRayPacketSize, num_rays);
+      if (p_WRs.cols() == 1) {
+        cast_packet(begin, end, p_WRs.col(0));
+        return;
+      }
+      int packet_begin = begin;
+      for (int r = begin + 1; r <= end; ++r) {
+        if (r == end || p_WRs.col(r) != p_WRs.col(packet_begin)) {
+          cast_packet(packet_begin, r, p_WRs.col(packet_begin));
+          packet_begin = r;
+        }
+      }
+    };
+
+    // The worker threads and the calling thread claim chunks of rays one at a
+    // time.
+    const int num_chunks = (num_rays + kRayPacketSize - 1) / kRayPacketSize;
+    std::atomic<int> next_chunk{0};
+    auto cast_chunks = [&]() {
+      for (int c = next_chunk++; c < num_chunks; c = next_chunk++) {
+        cast_chunk(c);
+      }
+    };
+    const int num_threads = std::min(parallelism.num_threads(), num_chunks);
+    std::vector<std::future<void>> futures;
+    for (int i = 1; i < num_threads; ++i) {
+      futures.push_back(std::async(std::launch::async, cast_chunks));
+    }
+    cast_chunks();
+    // Propagate any exception thrown on a worker thread.
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+
   template <typename T1 = T>
-  typename std::enable_if_t<scalar_predicate<T1>::is_bool,
-                            std::vector<ContactSurface<T>>>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-    vector<ContactSurface<T>> surfaces;
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      vector<ContactSurface<T>>* surfaces) const {
+    DRAKE_DEMAND(surfaces != nullptr);
+    surfaces->clear();
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
                                        &hydroelastic_geometries_,
-                                       representation, &surfaces};
+                                       representation, surfaces};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
-    FclCollide(dynamic_tree_, anchored_tree_, &data, hydroelastic::Callback<T>);
-
-    std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
+    FclCollide(dynamic_tree_, anchored().tree, &data,
+               hydroelastic::Callback<T>);
 
-    return surfaces;
+    std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
   }
 
   template <typename T1 = T>
@@ -772,7 +1144,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // that we can support with the point-pair fallback. Do those first.
     dynamic_tree_.collide(&data, hydroelastic::CallbackWithFallback<T>);
 
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
+    FclCollide(dynamic_tree_, anchored().tree, &data,
                hydroelastic::CallbackWithFallback<T>);
 
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
@@ -829,8 +1201,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       if (!are_maps_deep_copy(this->dynamic_objects_, other.dynamic_objects_)) {
         return false;
       }
-      if (!are_maps_deep_copy(this->anchored_objects_,
-                              other.anchored_objects_)) {
+      if (!are_maps_deep_copy(this->anchored().objects,
+                              other.anchored().objects)) {
         return false;
       }
       if (this->collision_filter_ != other.collision_filter_) return false;
@@ -841,7 +1213,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   const RigidTransformd GetX_WG(GeometryId id, bool is_dynamic) const {
     const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>& objects =
-        is_dynamic ? dynamic_objects_ : anchored_objects_;
+        is_dynamic ? dynamic_objects_ : anchored().objects;
 
     return RigidTransformd(objects.at(id)->getTransform());
   }
@@ -857,8 +1229,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   bool IsFclConvexType(GeometryId id) const {
     auto iter = dynamic_objects_.find(id);
     if (iter == dynamic_objects_.end()) {
-      iter = anchored_objects_.find(id);
-      if (iter == anchored_objects_.end()) {
+      iter = anchored().objects.find(id);
+      if (iter == anchored().objects.end()) {
         throw std::logic_error(
             fmt::format("ProximityEngine::IsFclConvexType() cannot be "
                         "called for invalid geometry id {}.",
@@ -876,10 +1248,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   void AddGeometry(
       const Shape& shape, const RigidTransformd& X_WG, GeometryId id,
-      const ProximityProperties& props, bool is_dynamic,
-      fcl::DynamicAABBTreeCollisionManager<double>* tree,
+      const ProximityProperties& props, const std::string& name,
+      bool is_dynamic, fcl::DynamicAABBTreeCollisionManager<double>* tree,
       unordered_map<GeometryId, unique_ptr<CollisionObjectd>>* objects) {
-    ReifyData data{nullptr, id, props, X_WG};
+    ReifyData data{nullptr, id, props, X_WG, name};
     shape.Reify(this, &data);
 
     data.fcl_object->setTransform(X_WG.GetAsIsometry3());
@@ -914,6 +1286,53 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // transmogrify them. Otherwise, while the engine can't be transmogrified, the
   // results on an <AutoDiffXd> type will still be double.
 
+  // Returns the representation of the given geometry that rays are cast
+  // against.
+  RayCastShape MakeRayCastShape(
+      GeometryId id, const CollisionObjectd& object) const {
+    const fcl::CollisionGeometryd& geometry = *object.collisionGeometry();
+    switch (geometry.getNodeType()) {
+      case fcl::GEOM_BOX: {
+        const auto& box = dynamic_cast<const fcl::Boxd&>(geometry);
+        return Box(box.side);
+      }
+      case fcl::GEOM_CAPSULE: {
+        const auto& capsule = dynamic_cast<const fcl::Capsuled&>(geometry);
+        return Capsule(capsule.radius, capsule.lz);
+      }
+      case fcl::GEOM_CYLINDER: {
+        const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
+        return Cylinder(cylinder.radius, cylinder.lz);
+      }
+      case fcl::GEOM_ELLIPSOID: {
+        const auto& ellipsoid = dynamic_cast<const fcl::Ellipsoidd&>(geometry);
+        return Ellipsoid(ellipsoid.radii);
+      }
+      case fcl::GEOM_HALFSPACE:
+        return HalfSpace();
+      case fcl::GEOM_SPHERE: {
+        const auto& sphere = dynamic_cast<const fcl::Sphered&>(geometry);
+        return Sphere(sphere.radius);
+      }
+      case fcl::GEOM_CONVEX:
+        return ray_cast_meshes_.at(id).get();
+      default:
+        // Every shape that the engine reifies is handled above.
+        DRAKE_UNREACHABLE();
+    }
+  }
+
+  const AnchoredGeometry& anchored() const { return *anchored_; }
+
+  // Returns the anchored geometry for modification, first making a private
+  // copy of it if it is shared with other engines.
+  AnchoredGeometry& mutable_anchored() {
+    if (anchored_.use_count() > 1) {
+      anchored_ = std::make_shared<AnchoredGeometry>(*anchored_);
+    }
+    return *anchored_;
+  }
+
   // Helper method called by the various ImplementGeometry overrides to
   // facilitate the logistics of creating shapes from specifications. `data`
   // is a unique_ptr of an fcl CollisionObject that should be instantiated
@@ -932,11 +1351,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // All of the *dynamic* collision elements (spanning all sources).
   MapGeometryIdToFclCollisionObject dynamic_objects_;
 
-  // The tree containing all of the anchored geometry.
-  FclDynamicAABBTreeCollisionManager anchored_tree_;
-
-  // All of the *anchored* collision elements (spanning *all* sources).
-  MapGeometryIdToFclCollisionObject anchored_objects_;
+  // All of the anchored geometry. Anchored geometry never moves, so copies of
+  // this engine share it (copy on write); cloning an engine only copies its
+  // dynamic geometry. FCL's broadphase queries only read the tree (despite the
+  // const_cast in FclCollide() and FclDistance()), so copies can query it from
+  // several threads at once; see the ConcurrentQueriesOfSharedAnchoredGeometry
+  // test.
+  std::shared_ptr<AnchoredGeometry> anchored_{
+      std::make_shared<AnchoredGeometry>()};
 
   // The mechanism for dictating collision filtering.
   CollisionFilter collision_filter_;
@@ -955,6 +1377,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // The deformable geometries registered here are not included in
   // `dynamic_objects_` and `dynamic_tree_`.
   deformable::Geometries geometries_for_deformable_contact_;
+
+  // The surfaces of the Mesh and Convex geometries used by CastRays(), keyed
+  // by the geometries' ids. The surfaces are read when the geometries are
+  // added, and shared (via MeshAssetRegistry) by all geometries with the same
+  // file and scale, and by copies of this engine.
+  unordered_map<GeometryId, std::shared_ptr<const RayCastMesh>>
+      ray_cast_meshes_;
 };
 
 template <typename T>
@@ -1002,16 +1431,18 @@ template <typename T>
 void ProximityEngine<T>::AddDynamicGeometry(const Shape& shape,
                                             const RigidTransformd& X_WG,
                                             GeometryId id,
-                                            const ProximityProperties& props) {
-  impl_->AddDynamicGeometry(shape, X_WG, id, props);
+                                            const ProximityProperties& props,
+                                            const std::string& name) {
+  impl_->AddDynamicGeometry(shape, X_WG, id, props, name);
 }
 
 template <typename T>
 void ProximityEngine<T>::AddAnchoredGeometry(const Shape& shape,
                                              const RigidTransformd& X_WG,
                                              GeometryId id,
-                                             const ProximityProperties& props) {
-  impl_->AddAnchoredGeometry(shape, X_WG, id, props);
+                                             const ProximityProperties& props,
+                                             const std::string& name) {
+  impl_->AddAnchoredGeometry(shape, X_WG, id, props, name);
 }
 
 template <typename T>
@@ -1091,7 +1522,19 @@ std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     const double max_distance) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
+  std::vector<SignedDistancePair<T>> witness_pairs;
+  impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                                    &witness_pairs);
+  return witness_pairs;
+}
+
+template <typename T>
+void ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double max_distance,
+    std::vector<SignedDistancePair<T>>* witness_pairs) const {
+  impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                                    witness_pairs);
 }
 
 template <typename T>
@@ -1117,12 +1560,49 @@ bool ProximityEngine<T>::HasCollisions() const {
   return impl_->HasCollisions();
 }
 
+template <typename T>
+std::optional<TimeOfImpact> ProximityEngine<T>::ComputeTimeOfImpact(
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const std::unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+    double distance_threshold) const {
+  return impl_->ComputeTimeOfImpact(X_WGs, X_WGs_end, distance_threshold,
+                                    nullptr);
+}
+
+template <typename T>
+std::optional<TimeOfImpact> ProximityEngine<T>::ComputeTimeOfImpact(
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const std::unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+    double distance_threshold, int* num_distance_queries) const {
+  return impl_->ComputeTimeOfImpact(X_WGs, X_WGs_end, distance_threshold,
+                                    num_distance_queries);
+}
+
+template <typename T>
+void ProximityEngine<T>::CastRays(
+    const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+    const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W, double max_distance,
+    EigenPtr<Eigen::VectorXd> distances, std::vector<GeometryId>* geometry_ids,
+    EigenPtr<Eigen::Matrix3Xd> normals_W, Parallelism parallelism) const {
+  impl_->CastRays(p_WRs, dirs_W, max_distance, distances, geometry_ids,
+                  normals_W, parallelism);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration(
     const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
     const {
-  return impl_->ComputePointPairPenetration(X_WGs);
+  std::vector<PenetrationAsPointPair<T>> contacts;
+  impl_->ComputePointPairPenetration(X_WGs, &contacts);
+  return contacts;
+}
+
+template <typename T>
+void ProximityEngine<T>::ComputePointPairPenetration(
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    std::vector<PenetrationAsPointPair<T>>* contacts) const {
+  impl_->ComputePointPairPenetration(X_WGs, contacts);
 }
 
 template <typename T>
@@ -1132,7 +1612,19 @@ typename std::enable_if_t<scalar_predicate<T1>::is_bool,
 ProximityEngine<T>::ComputeContactSurfaces(
     HydroelasticContactRepresentation representation,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(representation, X_WGs);
+  std::vector<ContactSurface<T>> surfaces;
+  impl_->ComputeContactSurfaces(representation, X_WGs, &surfaces);
+  return surfaces;
+}
+
+template <typename T>
+template <typename T1>
+typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+ProximityEngine<T>::ComputeContactSurfaces(
+    HydroelasticContactRepresentation representation,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    std::vector<ContactSurface<T>>* surfaces) const {
+  impl_->ComputeContactSurfaces(representation, X_WGs, surfaces);
 }
 
 template <typename T>
@@ -1195,7 +1687,15 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
     (&ProximityEngine<T>::template ToScalarType<U>))
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
-    (&ProximityEngine<T>::template ComputeContactSurfaces<T>,
+    (static_cast<std::vector<ContactSurface<T>> (ProximityEngine<T>::*)(
+         HydroelasticContactRepresentation,
+         const std::unordered_map<GeometryId, RigidTransform<T>>&) const>(
+         &ProximityEngine<T>::template ComputeContactSurfaces<T>),
+     static_cast<void (ProximityEngine<T>::*)(
+         HydroelasticContactRepresentation,
+         const std::unordered_map<GeometryId, RigidTransform<T>>&,
+         std::vector<ContactSurface<T>>*) const>(
+         &ProximityEngine<T>::template ComputeContactSurfaces<T>),
      &ProximityEngine<T>::template ComputeContactSurfacesWithFallback<T>))
 
 template void ProximityEngine<double>::ComputeDeformableContact<double>(
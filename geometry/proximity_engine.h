@@ -3,12 +3,15 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -21,6 +24,7 @@
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
+#include "drake/geometry/query_results/time_of_impact.h"
 #include "drake/geometry/shape_specification.h"
 #include "drake/math/rigid_transform.h"
 
@@ -96,19 +100,27 @@ class ProximityEngine {
    @param X_WG    The pose of the shape in the world frame.
    @param id      The id of the geometry in SceneGraph to which this shape
                   belongs.
-   @param props   The proximity properties for the shape.  */
+   @param props   The proximity properties for the shape.
+   @param name    The name of the geometry, for error messages.
+   @throws std::exception if `shape` is a Mesh or Convex whose file can't be
+           read.  */
   void AddDynamicGeometry(const Shape& shape, const math::RigidTransformd& X_WG,
-                          GeometryId id, const ProximityProperties& props = {});
+                          GeometryId id, const ProximityProperties& props = {},
+                          const std::string& name = {});
 
   /* Adds the given `shape` to the engine's _anchored_ geometry.
    @param shape   The shape to add.
    @param X_WG    The pose of the shape in the world frame.
    @param id      The id of the geometry in SceneGraph to which this shape
                   belongs.
-   @param props   The proximity properties for the shape.  */
+   @param props   The proximity properties for the shape.
+   @param name    The name of the geometry, for error messages.
+   @throws std::exception if `shape` is a Mesh or Convex whose file can't be
+           read.  */
   void AddAnchoredGeometry(const Shape& shape,
                            const math::RigidTransformd& X_WG, GeometryId id,
-                           const ProximityProperties& props = {});
+                           const ProximityProperties& props = {},
+                           const std::string& name = {});
 
   /* Adds a new deformable geometry to the engine.
    @param mesh_W  The volume mesh representation of the deformable geometry
@@ -211,6 +223,16 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double max_distance) const;
 
+  /* Implementation of the output-parameter overload of
+   GeometryState::ComputeSignedDistancePairwiseClosestPoints(). The
+   `witness_pairs` vector is cleared before it is populated; its capacity is
+   retained.
+   @pre witness_pairs != nullptr.  */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double max_distance,
+      std::vector<SignedDistancePair<T>>* witness_pairs) const;
+
   /* Implementation of
    GeometryState::ComputeSignedDistancePairClosestPoints().
    This includes `X_WGs`, the current poses of all geometries in World in the
@@ -248,6 +270,14 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
       const;
 
+  /* Implementation of the output-parameter overload of
+   GeometryState::ComputePointPairPenetration(). The `contacts` vector is
+   cleared before it is populated; its capacity is retained.
+   @pre contacts != nullptr.  */
+  void ComputePointPairPenetration(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      std::vector<PenetrationAsPointPair<T>>* contacts) const;
+
   /* Implementation of GeometryState::ComputeContactSurfaces().
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
@@ -259,6 +289,17 @@ class ProximityEngine {
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
       const;
 
+  /* Implementation of the output-parameter overload of
+   GeometryState::ComputeContactSurfaces(). The `surfaces` vector is cleared
+   before it is populated; its capacity is retained.
+   @pre surfaces != nullptr.  */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(
+      HydroelasticContactRepresentation representation,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      std::vector<ContactSurface<T>>* surfaces) const;
+
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
    @param X_WGs the current poses of all geometries in World in the
                 current scalar type, keyed on each geometry's GeometryId.  */
@@ -283,6 +324,29 @@ class ProximityEngine {
   /* Implementation of GeometryState::HasCollisions().  */
   bool HasCollisions() const;
 
+  /* Implementation of GeometryState::ComputeTimeOfImpact().
+   @param X_WGs      the current poses of all geometries in World in the
+                     current scalar type, keyed on each geometry's GeometryId.
+                     These are the poses at the start of the motion.
+   @param X_WGs_end  the poses of the dynamic geometries at the end of the
+                     motion. Dynamic geometries that are not listed don't move.
+   @param distance_threshold  geometries closer than this are considered to be
+                     in contact.  */
+  std::optional<TimeOfImpact> ComputeTimeOfImpact(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::unordered_map<GeometryId, math::RigidTransformd>& X_WGs_end,
+      double distance_threshold) const;
+
+  /* Implementation of GeometryState::CastRays(). The rays are cast against all
+   rigid (non-deformable) geometries, at the poses of their most recent
+   update. See QueryObject::CastRays() for the semantics of the parameters.  */
+  void CastRays(const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W,
+                double max_distance, EigenPtr<Eigen::VectorXd> distances,
+                std::vector<GeometryId>* geometry_ids,
+                EigenPtr<Eigen::Matrix3Xd> normals_W,
+                Parallelism parallelism) const;
+
   //@}
 
   /* The representation of every geometry that was successfully requested for
@@ -306,6 +370,14 @@ class ProximityEngine {
   const math::RigidTransform<double> GetX_WG(GeometryId id,
                                              bool is_dynamic) const;
 
+  // ComputeTimeOfImpact(), which also adds the number of narrowphase distance
+  // queries that it performed to `num_distance_queries`; the count shows
+  // which pairs the broadphase culled.
+  std::optional<TimeOfImpact> ComputeTimeOfImpact(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::unordered_map<GeometryId, math::RigidTransformd>& X_WGs_end,
+      double distance_threshold, int* num_distance_queries) const;
+
   ////////////////////////////////////////////////////////////////////////////
 
   // TODO(SeanCurtis-TRI): Pimpl + template implementation has proven
@@ -104,6 +104,17 @@ QueryObject<T>::ComputePointPairPenetration() const {
   return state.ComputePointPairPenetration();
 }
 
+template <typename T>
+void QueryObject<T>::ComputePointPairPenetration(
+    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+  DRAKE_THROW_UNLESS(point_pairs != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputePointPairPenetration(point_pairs);
+}
+
 template <typename T>
 std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
     const {
@@ -123,6 +134,33 @@ bool QueryObject<T>::HasCollisions() const {
   return state.HasCollisions();
 }
 
+template <typename T>
+void QueryObject<T>::CastRays(const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+                              const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W,
+                              double max_distance,
+                              EigenPtr<Eigen::VectorXd> distances,
+                              std::vector<GeometryId>* geometry_ids,
+                              EigenPtr<Eigen::Matrix3Xd> normals_W,
+                              Parallelism parallelism) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.CastRays(p_WRs, dirs_W, max_distance, distances, geometry_ids,
+                 normals_W, parallelism);
+}
+
+template <typename T>
+std::optional<TimeOfImpact> QueryObject<T>::ComputeTimeOfImpact(
+    const std::unordered_map<FrameId, math::RigidTransformd>& X_WFs_end,
+    double distance_threshold) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeTimeOfImpact(X_WFs_end, distance_threshold);
+}
+
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<scalar_predicate<T1>::is_bool,
@@ -136,6 +174,20 @@ QueryObject<T>::ComputeContactSurfaces(
   return state.ComputeContactSurfaces(representation);
 }
 
+template <typename T>
+template <typename T1>
+typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+QueryObject<T>::ComputeContactSurfaces(
+    HydroelasticContactRepresentation representation,
+    std::vector<ContactSurface<T>>* surfaces) const {
+  DRAKE_THROW_UNLESS(surfaces != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputeContactSurfaces(representation, surfaces);
+}
+
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
@@ -179,6 +231,19 @@ QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
   return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
 }
 
+template <typename T>
+void QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
+    double max_distance,
+    std::vector<SignedDistancePair<T>>* signed_distances) const {
+  DRAKE_THROW_UNLESS(signed_distances != nullptr);
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.ComputeSignedDistancePairwiseClosestPoints(max_distance,
+                                                   signed_distances);
+}
+
 template <typename T>
 SignedDistancePair<T> QueryObject<T>::ComputeSignedDistancePairClosestPoints(
     GeometryId geometry_id_A, GeometryId geometry_id_B) const {
@@ -237,6 +302,16 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(
+    const std::vector<render::ImageRequest>& requests) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.RenderImages(requests);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
@@ -259,7 +334,13 @@ const GeometryState<T>& QueryObject<T>::geometry_state() const {
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
-    (&QueryObject<T>::template ComputeContactSurfaces<T>,
+    (static_cast<std::vector<ContactSurface<T>> (QueryObject<T>::*)(
+         HydroelasticContactRepresentation) const>(
+         &QueryObject<T>::template ComputeContactSurfaces<T>),
+     static_cast<void (QueryObject<T>::*)(HydroelasticContactRepresentation,
+                                          std::vector<ContactSurface<T>>*)
+                     const>(
+         &QueryObject<T>::template ComputeContactSurfaces<T>),
      &QueryObject<T>::template ComputeContactSurfacesWithFallback<T>))
 
 template void QueryObject<double>::ComputeDeformableContact<double>(
@@ -2,15 +2,20 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/deformable_contact.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
+#include "drake/geometry/query_results/time_of_impact.h"
 #include "drake/geometry/render/render_camera.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/scene_graph_inspector.h"
@@ -291,6 +296,21 @@ class QueryObject {
            `throws` in the support table above.  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
 
+  /** An overload of ComputePointPairPenetration() that writes its results
+   into a caller-owned vector instead of returning a new one. The vector is
+   cleared before it is populated, but its capacity is retained, so a caller
+   that reuses the same vector across time steps (e.g., a cache entry) doesn't
+   reallocate the result storage once it has grown large enough.
+
+   @param[out] point_pairs  The detected penetrations; the contents are
+                            identical to what ComputePointPairPenetration()
+                            would return.
+   @pre point_pairs != nullptr.
+   @throws std::exception under the same conditions as
+           ComputePointPairPenetration().  */
+  void ComputePointPairPenetration(
+      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+
   /** Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface for hydroelastic contact model. The
    computation is subject to collision filtering.
@@ -369,6 +389,28 @@ class QueryObject {
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation) const;
 
+  /** An overload of ComputeContactSurfaces() that writes its results into a
+   caller-owned vector instead of returning a new one. The vector is cleared
+   before it is populated, but its capacity is retained, so a caller that
+   reuses the same vector across time steps doesn't reallocate the result
+   storage once it has grown large enough. (Each ContactSurface still owns its
+   own mesh and field.)
+
+   @param representation  Controls the mesh representation of the contact
+                          surface. See
+                          @ref contact_surface_discrete_representation
+                          "contact surface representation" for more details.
+   @param[out] surfaces   The contact surfaces; the contents are identical to
+                          what ComputeContactSurfaces(representation) would
+                          return.
+   @pre surfaces != nullptr.
+   @throws std::exception under the same conditions as
+           ComputeContactSurfaces().  */
+  template <typename T1 = T>
+  typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         std::vector<ContactSurface<T>>* surfaces) const;
+
   /** Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface _where possible_ and as a
    PenetrationAsPointPair where not.
@@ -441,6 +483,44 @@ class QueryObject {
             *not* computationally efficient or particularly accurate.  */
   bool HasCollisions() const;
 
+  /** Continuous collision query: reports the earliest time at which any
+   unfiltered pair of geometries comes into contact as the frames move from
+   their current poses to the given end poses.
+
+   The motion of each frame F is parameterized by the normalized time
+   t ∈ [0, 1]: F's origin moves along the straight line from its current
+   position to its end position and F's orientation rotates at a constant rate
+   (spherical linear interpolation) from its current orientation to its end
+   orientation. Frames that are not listed in `X_WFs_end` don't move, so the
+   caller must list every frame that moves.
+
+   The time of impact is computed with conservative advancement: the distance
+   between each candidate pair is computed and time is advanced by the largest
+   step over which the geometries provably can't close that distance, given a
+   bound on the speed of their points. The query is conservative; the
+   geometries are known to be separated by more than `distance_threshold` for
+   all times before the reported time. Pairs are culled with a broadphase on
+   the boxes swept by the geometries, so the number of narrowphase distance
+   queries depends on how far the geometries are from contact rather than on
+   the length of the motion.
+
+   @warning For Mesh and Convex shapes, their convex hulls are used in this
+            query.
+
+   @param X_WFs_end           The end poses of the moving frames.
+   @param distance_threshold  Pairs closer than this distance are considered to
+                              be in contact (e.g., collision padding).
+   @returns The earliest time of impact (with the geometry pair), or nullopt if
+            no pair comes within `distance_threshold` during the motion.
+   @throws std::exception if any frame in `X_WFs_end` is not registered, if
+           `distance_threshold` is negative, if a geometry of unbounded extent
+           (i.e., a HalfSpace) rotates, or if the query involves a pair of
+           shapes for which signed distance isn't supported (see
+           ComputeSignedDistancePairwiseClosestPoints()).  */
+  std::optional<TimeOfImpact> ComputeTimeOfImpact(
+      const std::unordered_map<FrameId, math::RigidTransformd>& X_WFs_end,
+      double distance_threshold = 0) const;
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -649,6 +729,25 @@ class QueryObject {
       const double max_distance =
           std::numeric_limits<double>::infinity()) const;
 
+  /** An overload of ComputeSignedDistancePairwiseClosestPoints() that writes
+   its results into a caller-owned vector instead of returning a new one. The
+   vector is cleared before it is populated, but its capacity is retained, so
+   a caller that reuses the same vector across time steps doesn't reallocate
+   the result storage once it has grown large enough.
+
+   @param max_distance           The maximum distance at which distance data
+                                 is reported.
+   @param[out] signed_distances  The signed distance data; the contents are
+                                 identical to what
+                                 ComputeSignedDistancePairwiseClosestPoints()
+                                 would return.
+   @pre signed_distances != nullptr.
+   @throws std::exception under the same conditions as
+           ComputeSignedDistancePairwiseClosestPoints().  */
+  void ComputeSignedDistancePairwiseClosestPoints(
+      double max_distance,
+      std::vector<SignedDistancePair<T>>* signed_distances) const;
+
   /** A variant of ComputeSignedDistancePairwiseClosestPoints() which computes
    the signed distance (and witnesses) between a specific pair of geometries
    indicated by id. This function has the same restrictions on scalar report
@@ -773,6 +872,70 @@ class QueryObject {
       const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
+  //---------------------------------------------------------------------------
+  /**
+   @anchor ray_cast_queries
+   @name                Ray-casting Queries
+
+   These queries report where rays first hit the geometries with the proximity
+   role. They support the simulation of range sensors (e.g., lidar) without
+   rendering depth images.
+   */
+  //@{
+
+  /** Casts a batch of rays against all geometries with the proximity role
+   (except deformable geometries) and reports, for each ray, the closest hit.
+
+   Ray i consists of the points p_WR + t⋅d̂, t ∈ [0, max_distance], where R is
+   its origin (`p_WRs.col(i)`, or `p_WRs.col(0)` if all of the rays share one
+   origin) and d̂ is its normalized direction `dirs_W.col(i)`. Rays hit the
+   surfaces of the geometries from either side; a ray that starts inside a
+   geometry hits the surface where it leaves the geometry. Collision filters
+   don't apply.
+
+   The results are written into caller-owned arrays, so a sensor that casts the
+   same number of rays over and over doesn't allocate memory for them. Rays are
+   cast in packets of neighboring rays that share their origin; the rays of a
+   scanning sensor (i.e., consecutive rays in nearby directions) are cast the
+   most efficiently.
+
+   Primitive shapes are intersected analytically. Mesh shapes are represented
+   by the triangle surfaces in their .obj or .vtk files (not by their convex
+   hulls), and Convex shapes by the convex hulls of those surfaces, as in the
+   other queries. The surfaces are read when the geometries are assigned the
+   proximity role.
+
+   @note The query is computed with double-valued poses for all scalar types;
+         no derivatives are propagated through the results.
+
+   @param p_WRs         The origins of the rays, measured and expressed in the
+                        world frame. Either one column per ray or a single
+                        column shared by all rays.
+   @param dirs_W        The directions of the rays, expressed in the world
+                        frame. They need not be unit length.
+   @param max_distance  Surfaces farther than this distance are not reported.
+   @param[out] distances    The distance from each ray's origin to its closest
+                        hit, or infinity if the ray doesn't hit anything within
+                        `max_distance`. Must have one entry per ray.
+   @param[out] geometry_ids If not nullptr, the id of the geometry hit by each
+                        ray (an invalid id for rays that don't hit anything).
+                        It is resized to one entry per ray.
+   @param[out] normals_W    If not nullptr, the outward unit normal of each
+                        hit surface at the hit point, expressed in the world
+                        frame (zero for rays that don't hit anything). Must
+                        have one column per ray.
+   @param parallelism   The number of threads that cast the rays.
+   @throws std::exception if the sizes of the arrays don't match, if any
+           direction is zero, or if `max_distance` is negative.  */
+  void CastRays(const Eigen::Ref<const Eigen::Matrix3Xd>& p_WRs,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& dirs_W,
+                double max_distance, EigenPtr<Eigen::VectorXd> distances,
+                std::vector<GeometryId>* geometry_ids = nullptr,
+                EigenPtr<Eigen::Matrix3Xd> normals_W = nullptr,
+                Parallelism parallelism = Parallelism::None()) const;
+
+  //@}
+
   //---------------------------------------------------------------------------
   /**
    @anchor render_queries
@@ -827,6 +990,25 @@ class QueryObject {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Renders a batch of images (e.g., the color, depth, and label images of
+   several cameras) in one call. Compared to calling the Render*Image() methods
+   once per image, the poses are brought up to date only once, and each render
+   engine renders all of its images in a single
+   @ref render::RenderEngine::RenderImages() "RenderEngine::RenderImages()"
+   batch, sharing the work the images have in common.
+
+   Unlike the single-image methods, each request specifies the pose `X_WC` of
+   the camera's sensor frame C in the world frame. For a camera body B affixed
+   to a frame P at `X_PB`, that is
+   `GetPoseInWorld(P) * X_PB * camera.core().sensor_pose_in_camera_body()`.
+
+   @param requests  The images to render, each from its own camera. Requests
+                    from the same viewpoint should be adjacent.
+   @throws std::exception if a camera names a render engine that doesn't exist,
+                          or if any of the requested images is `nullptr` or
+                          doesn't match the size of its camera. */
+  void RenderImages(const std::vector<render::ImageRequest>& requests) const;
+
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
   const render::RenderEngine* GetRenderEngineByName(
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+
+namespace drake {
+namespace geometry {
+
+/** The result of a continuous collision query: the earliest (normalized) time
+ at which two geometries, A and B, come into contact as they move from their
+ start poses (at time 0) to their end poses (at time 1). See
+ QueryObject::ComputeTimeOfImpact(). */
+struct TimeOfImpact {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TimeOfImpact)
+  TimeOfImpact() = default;
+
+  /** Constructor
+   @param a       The id of the first geometry (A).
+   @param b       The id of the second geometry (B).
+   @param time_in The time of impact, in the range [0, 1]. */
+  TimeOfImpact(GeometryId a, GeometryId b, double time_in)
+      : id_A(a), id_B(b), time(time_in) {}
+
+  /** The id of the first geometry in the pair. */
+  GeometryId id_A;
+  /** The id of the second geometry in the pair. */
+  GeometryId id_B;
+  /** The normalized time of impact; 0 is the start of the motion, 1 its end.
+   The query is conservative: the geometries are known to be separated (by
+   more than the requested distance threshold) for all times before `time`.
+   */
+  double time{};
+};
+
+}  // namespace geometry
+}  // namespace drake
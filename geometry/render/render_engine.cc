@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "drake/common/nice_type_name.h"
+#include "drake/common/overloaded.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
@@ -162,6 +163,53 @@ void RenderEngine::DoRenderLabelImage(const ColorRenderCamera&,
                   NiceTypeName::Get(*this)));
 }
 
+void RenderEngine::RenderImages(const std::vector<ImageRequest>& requests) {
+  for (const ImageRequest& request : requests) {
+    std::visit(overloaded{[](const ColorImageRequest& color) {
+                            ThrowIfInvalid(color.camera.core().intrinsics(),
+                                           color.image, "color");
+                          },
+                          [](const DepthImageRequest& depth) {
+                            ThrowIfInvalid(depth.camera.core().intrinsics(),
+                                           depth.image, "depth");
+                          },
+                          [](const LabelImageRequest& label) {
+                            ThrowIfInvalid(label.camera.core().intrinsics(),
+                                           label.image, "label");
+                          }},
+               request);
+  }
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngine/images");
+  DoRenderImages(requests);
+}
+
+void RenderEngine::DoRenderImages(const std::vector<ImageRequest>& requests) {
+  const RigidTransformd* X_WC_current = nullptr;
+  for (const ImageRequest& request : requests) {
+    const RigidTransformd& X_WC = std::visit(
+        [](const auto& r) -> const RigidTransformd& {
+          return r.X_WC;
+        },
+        request);
+    // Consecutive requests from the same viewpoint share a single update.
+    if (X_WC_current == nullptr || !X_WC.IsExactlyEqualTo(*X_WC_current)) {
+      UpdateViewpoint(X_WC);
+      X_WC_current = &X_WC;
+    }
+    std::visit(overloaded{[this](const ColorImageRequest& color) {
+                            DoRenderColorImage(color.camera, color.image);
+                          },
+                          [this](const DepthImageRequest& depth) {
+                            DoRenderDepthImage(depth.camera, depth.image);
+                          },
+                          [this](const LabelImageRequest& label) {
+                            DoRenderLabelImage(label.camera, label.image);
+                          }},
+               request);
+  }
+}
+
 void RenderEngine::SetDefaultLightPosition(const Vector3<double>&) {}
 
 }  // namespace render
@@ -5,6 +5,8 @@
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 #include <vector>
 
 #include <Eigen/Dense>
@@ -17,6 +19,7 @@
 #include "drake/geometry/render/render_camera.h"
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/render/render_mesh.h"
+#include "drake/geometry/render/render_statistics.h"
 #include "drake/geometry/shape_specification.h"
 #include "drake/geometry/utilities.h"
 #include "drake/math/rigid_transform.h"
@@ -28,6 +31,38 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** A request to render a color image from the pose `X_WC` of the camera's
+ frame C in the world. Used with RenderEngine::RenderImages(). */
+struct ColorImageRequest {
+  ColorRenderCamera camera;
+  math::RigidTransformd X_WC;
+  /** The image to write; it must outlive the call to RenderImages(). */
+  systems::sensors::ImageRgba8U* image{};
+};
+
+/** A request to render a depth image from the pose `X_WC` of the camera's
+ frame C in the world. Used with RenderEngine::RenderImages(). */
+struct DepthImageRequest {
+  DepthRenderCamera camera;
+  math::RigidTransformd X_WC;
+  /** The image to write; it must outlive the call to RenderImages(). */
+  systems::sensors::ImageDepth32F* image{};
+};
+
+/** A request to render a label image from the pose `X_WC` of the camera's
+ frame C in the world. Used with RenderEngine::RenderImages(). */
+struct LabelImageRequest {
+  ColorRenderCamera camera;
+  math::RigidTransformd X_WC;
+  /** The image to write; it must outlive the call to RenderImages(). */
+  systems::sensors::ImageLabel16I* image{};
+};
+
+/** One of the requests that make up a batch for RenderEngine::RenderImages().
+ */
+using ImageRequest =
+    std::variant<ColorImageRequest, DepthImageRequest, LabelImageRequest>;
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -190,6 +225,8 @@ class RenderEngine : public ShapeReifier {
   template <typename T>
   void UpdatePoses(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs) {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngine/update_poses");
     for (const GeometryId& id : update_ids_) {
       const math::RigidTransformd X_WG =
           geometry::internal::convert_to_double(X_WGs.at(id));
@@ -249,6 +286,8 @@ class RenderEngine : public ShapeReifier {
   void RenderColorImage(const ColorRenderCamera& camera,
                         systems::sensors::ImageRgba8U* color_image_out) const {
     ThrowIfInvalid(camera.core().intrinsics(), color_image_out, "color");
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngine/color_image");
     DoRenderColorImage(camera, color_image_out);
   }
 
@@ -266,6 +305,8 @@ class RenderEngine : public ShapeReifier {
       const DepthRenderCamera& camera,
       systems::sensors::ImageDepth32F* depth_image_out) const {
     ThrowIfInvalid(camera.core().intrinsics(), depth_image_out, "depth");
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngine/depth_image");
     DoRenderDepthImage(camera, depth_image_out);
   }
 
@@ -284,15 +325,66 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const {
     ThrowIfInvalid(camera.core().intrinsics(), label_image_out, "label");
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngine/label_image");
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** Renders a batch of images, each from its own viewpoint, in a single call.
+   This is equivalent to calling UpdateViewpoint() and then the matching
+   Render*Image() method for each request in turn, but lets the engine share
+   the work that the images have in common: requests with the same viewpoint
+   (e.g., the color, depth, and label images of one RGB-D camera) are rendered
+   after a single viewpoint update, and derived engines may further amortize
+   per-render setup (e.g., acquiring a graphics context or culling the scene)
+   over the whole batch. The current poses of the geometries (see UpdatePoses())
+   are used for every image.
+
+   Upon return, the engine's viewpoint is that of the last request.
+
+   @throws std::exception if any of the requested images is `nullptr` or has a
+                          size that doesn't match its camera, in which case
+                          nothing is rendered.  */
+  void RenderImages(const std::vector<ImageRequest>& requests);
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
    use.  */
   RenderLabel default_render_label() const { return default_render_label_; }
 
+  /** Reports whether `this` engine supports concurrent rendering. If true,
+   multiple threads may call RenderImages() at the same time; each request is
+   rendered from its own `X_WC`. Afterwards, the engine's viewpoint is that of
+   the last request of whichever call returned last. UpdateViewpoint() and the
+   single-image Render*Image() methods, which share the engine's one
+   viewpoint, must not be called concurrently with any other method, nor must
+   the engine's other non-const methods (e.g., registering geometry or
+   updating poses).
+
+   If false, the engine must only be used by one thread at a time. (Distinct
+   engines, e.g., clones, may still be rendered concurrently if the derived
+   engine's documentation says so.)  */
+  bool SupportsConcurrentRendering() const {
+    return DoSupportsConcurrentRendering();
+  }
+
+  /** Sets the statistics that collect the time spent in each stage of this
+   engine's work (or, if null, stops collecting them). The statistics are
+   shared with any clones of this engine made afterwards (e.g., the copies
+   held in a SceneGraph's Context).
+
+   The base class times UpdatePoses() ("RenderEngine/update_poses"), each of
+   the Render*Image() methods ("RenderEngine/color_image", etc.), and
+   RenderImages() ("RenderEngine/images"); derived engines may time their own
+   stages within those (e.g., "RenderEngineVtk/readback").  */
+  void set_statistics(std::shared_ptr<RenderStatistics> statistics) {
+    statistics_ = std::move(statistics);
+  }
+
+  /** Returns the statistics set by set_statistics(), or null. */
+  RenderStatistics* statistics() const { return statistics_.get(); }
+
  protected:
   // Allow derived classes to implement Cloning via copy-construction.
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RenderEngine)
@@ -351,6 +443,12 @@ class RenderEngine : public ShapeReifier {
   /** The NVI-function for cloning this render engine.  */
   virtual std::unique_ptr<RenderEngine> DoClone() const = 0;
 
+  /** The NVI-function for SupportsConcurrentRendering(). The default
+   implementation returns false. Derived engines that return true must
+   override DoRenderImages() so that it renders each request from its own
+   `X_WC` without reading the viewpoint shared with other threads.  */
+  virtual bool DoSupportsConcurrentRendering() const { return false; }
+
   /** The NVI-function for rendering color with a fully-specified camera.
    When RenderColorImage calls this, it has already confirmed that
    `color_image_out` is not `nullptr` and its size is consistent with the
@@ -387,6 +485,16 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for RenderImages(). When RenderImages() calls this, it
+   has already validated every requested image.
+
+   The default implementation partitions the requests into runs of consecutive
+   requests with exactly the same viewpoint and, for each run, calls
+   UpdateViewpoint() once followed by the DoRender*Image() method of each of
+   its requests. Derived engines may override this to amortize more of the
+   work over the batch, but must honor the viewpoint of each request. */
+  virtual void DoRenderImages(const std::vector<ImageRequest>& requests);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -493,6 +601,9 @@ class RenderEngine : public ShapeReifier {
   // have their configurations updated. See UpdateDeformableConfigurations().
   std::unordered_map<GeometryId, std::vector<int>> deformable_mesh_dofs_;
 
+  // The statistics that time the stages of this engine's work (may be null).
+  std::shared_ptr<RenderStatistics> statistics_;
+
   // The default render label to apply to geometries that don't otherwise
   // provide one. Default constructor is RenderLabel::kUnspecified via the
   // RenderLabel default constructor.
@@ -0,0 +1,145 @@
+#include "drake/geometry/render/render_statistics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+RenderStatistics::ScopedTimer::ScopedTimer(RenderStatistics* statistics,
+                                           const char* stage)
+    : statistics_(statistics), stage_(stage) {
+  if (statistics_ != nullptr) start_ns_ = Now();
+}
+
+RenderStatistics::ScopedTimer::~ScopedTimer() {
+  if (statistics_ != nullptr) statistics_->Record(stage_, start_ns_, Now());
+}
+
+RenderStatistics::RenderStatistics(int max_trace_events)
+    : max_trace_events_(max_trace_events), origin_ns_(Now()) {
+  DRAKE_THROW_UNLESS(max_trace_events >= 0);
+}
+
+RenderStatistics::~RenderStatistics() = default;
+
+int64_t RenderStatistics::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void RenderStatistics::Record(const char* stage, int64_t start_ns,
+                              int64_t end_ns) {
+  const int64_t duration_ns = end_ns - start_ns;
+  const double duration = duration_ns * 1e-9;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = summaries_.find(std::string_view(stage));
+  if (iter == summaries_.end()) {
+    iter = summaries_.emplace(stage, StageSummary{.name = stage}).first;
+  }
+  StageSummary& summary = iter->second;
+  summary.min_time =
+      summary.count == 0 ? duration : std::min(summary.min_time, duration);
+  summary.max_time = std::max(summary.max_time, duration);
+  summary.total_time += duration;
+  ++summary.count;
+
+  if (static_cast<int>(trace_.size()) < max_trace_events_) {
+    const int thread =
+        thread_ids_
+            .emplace(std::this_thread::get_id(),
+                     static_cast<int>(thread_ids_.size()))
+            .first->second;
+    trace_.push_back(TraceEvent{.stage = stage,
+                                .thread = thread,
+                                .start_ns = start_ns,
+                                .duration_ns = duration_ns});
+  } else {
+    ++num_dropped_;
+  }
+}
+
+std::vector<RenderStatistics::StageSummary>
+RenderStatistics::GetStageSummaries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<StageSummary> result;
+  result.reserve(summaries_.size());
+  for (const auto& [_, summary] : summaries_) {
+    result.push_back(summary);
+  }
+  return result;
+}
+
+std::optional<RenderStatistics::StageSummary> RenderStatistics::GetStageSummary(
+    std::string_view stage) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = summaries_.find(stage);
+  if (iter == summaries_.end()) return std::nullopt;
+  return iter->second;
+}
+
+int RenderStatistics::num_trace_events() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(trace_.size());
+}
+
+int64_t RenderStatistics::num_dropped_trace_events() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_dropped_;
+}
+
+void RenderStatistics::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  summaries_.clear();
+  trace_.clear();
+  num_dropped_ = 0;
+}
+
+std::string RenderStatistics::ToChromeTrace() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::string result = "{\"traceEvents\":[";
+  bool first = true;
+  for (const TraceEvent& event : trace_) {
+    // The stage names are identifiers chosen by the instrumented code, so they
+    // need no escaping. The category is the component part of the name.
+    const std::string_view name(event.stage);
+    const std::string_view category = name.substr(0, name.find('/'));
+    result += fmt::format(
+        "{}{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},"
+        "\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+        first ? "" : ",", name, category,
+        (event.start_ns - origin_ns_) * 1e-3, event.duration_ns * 1e-3,
+        event.thread);
+    first = false;
+  }
+  result += "],\"displayTimeUnit\":\"ms\"}";
+  return result;
+}
+
+void RenderStatistics::WriteChromeTrace(
+    const std::filesystem::path& filename) const {
+  std::ofstream file(filename);
+  if (!file) {
+    throw std::runtime_error(
+        fmt::format("RenderStatistics: could not open '{}' for writing",
+                    filename.string()));
+  }
+  file << ToChromeTrace();
+  if (!file) {
+    throw std::runtime_error(fmt::format(
+        "RenderStatistics: could not write '{}'", filename.string()));
+  }
+}
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+
+/** Collects the time spent in each stage of a camera pipeline -- syncing
+ poses into a render engine, rendering, reading the pixels back, encoding
+ images for LCM, and so on -- so that the bottlenecks of a camera-heavy
+ simulation can be found without an external profiler.
+
+ An instance is shared (via `std::shared_ptr`) among the objects to be
+ instrumented; see, e.g., RenderEngine::set_statistics() and
+ systems::sensors::RgbdSensor::set_statistics(). Each of them times its
+ stages with a ScopedTimer. Objects without statistics skip the timing
+ entirely.
+
+ Stages are named "<component>/<stage>", e.g., "RenderEngineVtk/readback".
+ For each stage, the number of events and their total, minimum, and maximum
+ durations are reported by GetStageSummaries(). In addition, up to
+ `max_trace_events` individual events are kept, so that they can be written
+ in the Chrome trace event format (see ToChromeTrace()) and inspected as a
+ timeline, e.g., in chrome://tracing or https://ui.perfetto.dev. Nested stages
+ (e.g., a render engine's readback within a sensor's image calculation) appear
+ nested in the timeline.
+
+ All methods may be called concurrently (e.g., by sensors rendering on
+ background threads).  */
+class RenderStatistics {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderStatistics);
+
+  /** The summary of all events recorded for a stage. Times are in seconds. */
+  struct StageSummary {
+    std::string name;
+    int64_t count{};
+    double total_time{};
+    double min_time{};
+    double max_time{};
+
+    /** The mean duration of the stage's events, or zero if there are none. */
+    double mean_time() const { return count > 0 ? total_time / count : 0.0; }
+  };
+
+  /** Times a stage from construction to destruction, and records it with the
+   given `statistics`. If `statistics` is null, this does nothing (not even
+   read the clock).  */
+  class ScopedTimer {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedTimer);
+
+    /** Starts timing the given `stage`, which must be a string that outlives
+     this timer (typically a literal).  */
+    ScopedTimer(RenderStatistics* statistics, const char* stage);
+
+    /** Records the event (if timing).  */
+    ~ScopedTimer();
+
+   private:
+    RenderStatistics* const statistics_;
+    const char* const stage_;
+    int64_t start_ns_{};
+  };
+
+  /** Constructs an empty set of statistics.
+   @param max_trace_events  The maximum number of individual events kept for
+                            ToChromeTrace(); once reached, further events are
+                            only counted in the summaries. Zero disables the
+                            trace.
+   @throws std::exception if `max_trace_events` is negative. */
+  explicit RenderStatistics(int max_trace_events = 100'000);
+
+  ~RenderStatistics();
+
+  /** Returns the summaries of all stages recorded so far, ordered by name. */
+  std::vector<StageSummary> GetStageSummaries() const;
+
+  /** Returns the summary of the named stage, or nullopt if no event of that
+   stage has been recorded. */
+  std::optional<StageSummary> GetStageSummary(std::string_view stage) const;
+
+  /** Returns the number of events kept for the trace. */
+  int num_trace_events() const;
+
+  /** Returns the number of events that were not kept for the trace because
+   `max_trace_events` had been reached. */
+  int64_t num_dropped_trace_events() const;
+
+  /** Discards all of the recorded events and summaries. */
+  void Clear();
+
+  /** Returns the kept events as a JSON document in the Chrome trace event
+   format: one complete ("X") event per timed stage, with timestamps in
+   microseconds since this object was constructed, and one track per thread.
+   */
+  std::string ToChromeTrace() const;
+
+  /** Writes ToChromeTrace() to the given file.
+   @throws std::exception if the file can't be written. */
+  void WriteChromeTrace(const std::filesystem::path& filename) const;
+
+ private:
+  struct TraceEvent {
+    const char* stage{};
+    int thread{};
+    int64_t start_ns{};
+    int64_t duration_ns{};
+  };
+
+  // Returns the current time of the monotonic clock, in nanoseconds.
+  static int64_t Now();
+
+  // Records one event of `stage`.
+  void Record(const char* stage, int64_t start_ns, int64_t end_ns);
+
+  const int max_trace_events_;
+  const int64_t origin_ns_;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, StageSummary, std::less<>> summaries_;
+  std::vector<TraceEvent> trace_;
+  int64_t num_dropped_{};
+  // Small, stable ids for the threads that have recorded events.
+  std::unordered_map<std::thread::id, int> thread_ids_;
+};
+
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
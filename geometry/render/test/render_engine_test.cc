@@ -439,6 +439,12 @@ GTEST_TEST(RenderEngine, DefaultRenderLabel) {
   }
 }
 
+// By default, engines don't claim to support concurrent rendering.
+GTEST_TEST(RenderEngine, SupportsConcurrentRendering) {
+  const DummyRenderEngine engine;
+  EXPECT_FALSE(engine.SupportsConcurrentRendering());
+}
+
 // The render API with full intrinsics promises some validation before calling
 // the virtual DoRender*Image() API. Confirm that it happens.
 GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
@@ -493,6 +499,43 @@ GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
   });
 }
 
+// RenderImages() validates the whole batch before rendering any of it, and
+// shares one viewpoint update among consecutive requests from the same pose.
+GTEST_TEST(RenderEngine, RenderImages) {
+  DummyRenderEngine engine;
+  const CameraInfo intrinsics{2, 2, M_PI};
+  const ColorRenderCamera color_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  const RigidTransformd X_WC1(Vector3d(1, 2, 3));
+  const RigidTransformd X_WC2(Vector3d(-1, 0, 0));
+  ImageRgba8U color1(2, 2), color2(2, 2);
+  ImageDepth32F depth1(2, 2);
+  ImageLabel16I label1(2, 2);
+
+  ImageRgba8U bad_color(1, 2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({ColorImageRequest{color_camera, X_WC1, &color1},
+                           ColorImageRequest{color_camera, X_WC2, &bad_color}}),
+      "The color image to write has a size different.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({DepthImageRequest{depth_camera, X_WC1, nullptr}}),
+      "Can't render a depth image.*");
+  EXPECT_EQ(engine.num_color_renders(), 0);
+  EXPECT_EQ(engine.num_viewpoint_updates(), 0);
+
+  engine.RenderImages({ColorImageRequest{color_camera, X_WC1, &color1},
+                       DepthImageRequest{depth_camera, X_WC1, &depth1},
+                       LabelImageRequest{color_camera, X_WC1, &label1},
+                       ColorImageRequest{color_camera, X_WC2, &color2}});
+  EXPECT_EQ(engine.num_color_renders(), 2);
+  EXPECT_EQ(engine.num_depth_renders(), 1);
+  EXPECT_EQ(engine.num_label_renders(), 1);
+  EXPECT_EQ(engine.num_viewpoint_updates(), 2);
+  EXPECT_TRUE(engine.last_updated_X_WC().IsExactlyEqualTo(X_WC2));
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable
 // with both a copy constructor *and* a valid DoClone() implementation.
 class CloneableEngine : public MinimumEngine {
@@ -0,0 +1,110 @@
+#include "drake/geometry/render/render_statistics.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace render {
+namespace {
+
+using ScopedTimer = RenderStatistics::ScopedTimer;
+
+GTEST_TEST(RenderStatisticsTest, Summaries) {
+  RenderStatistics dut;
+  EXPECT_TRUE(dut.GetStageSummaries().empty());
+  EXPECT_FALSE(dut.GetStageSummary("Engine/render").has_value());
+
+  for (int i = 0; i < 3; ++i) {
+    const ScopedTimer outer(&dut, "Sensor/color_image");
+    const ScopedTimer inner(&dut, "Engine/render");
+  }
+  { const ScopedTimer timer(&dut, "Engine/readback"); }
+
+  const auto summaries = dut.GetStageSummaries();
+  ASSERT_EQ(summaries.size(), 3);
+  // The summaries are ordered by name.
+  EXPECT_EQ(summaries[0].name, "Engine/readback");
+  EXPECT_EQ(summaries[1].name, "Engine/render");
+  EXPECT_EQ(summaries[2].name, "Sensor/color_image");
+
+  const auto render = dut.GetStageSummary("Engine/render");
+  ASSERT_TRUE(render.has_value());
+  EXPECT_EQ(render->count, 3);
+  EXPECT_GE(render->min_time, 0.0);
+  EXPECT_LE(render->min_time, render->mean_time());
+  EXPECT_LE(render->mean_time(), render->max_time);
+  EXPECT_NEAR(render->total_time, 3 * render->mean_time(), 1e-15);
+  // The outer stage includes the inner one.
+  EXPECT_GE(dut.GetStageSummary("Sensor/color_image")->total_time,
+            render->total_time);
+  EXPECT_EQ(dut.num_trace_events(), 7);
+
+  dut.Clear();
+  EXPECT_TRUE(dut.GetStageSummaries().empty());
+  EXPECT_EQ(dut.num_trace_events(), 0);
+}
+
+GTEST_TEST(RenderStatisticsTest, NullStatistics) {
+  // A timer without statistics does nothing.
+  EXPECT_NO_THROW(ScopedTimer(nullptr, "Engine/render"));
+}
+
+GTEST_TEST(RenderStatisticsTest, MaxTraceEvents) {
+  RenderStatistics dut(2);
+  for (int i = 0; i < 5; ++i) {
+    const ScopedTimer timer(&dut, "Engine/render");
+  }
+  // All of the events are summarized, but only the first two are traced.
+  EXPECT_EQ(dut.GetStageSummary("Engine/render")->count, 5);
+  EXPECT_EQ(dut.num_trace_events(), 2);
+  EXPECT_EQ(dut.num_dropped_trace_events(), 3);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderStatistics(-1), ".*max_trace_events.*");
+}
+
+GTEST_TEST(RenderStatisticsTest, ChromeTrace) {
+  RenderStatistics dut;
+  EXPECT_EQ(dut.ToChromeTrace(),
+            R"({"traceEvents":[],"displayTimeUnit":"ms"})");
+
+  { const ScopedTimer timer(&dut, "Engine/render"); }
+  // Events on another thread get their own track.
+  std::thread([&dut]() {
+    const ScopedTimer timer(&dut, "Sensor/render");
+  }).join();
+
+  const std::string trace = dut.ToChromeTrace();
+  EXPECT_NE(trace.find(R"({"name":"Engine/render","cat":"Engine","ph":"X",)"),
+            std::string::npos);
+  EXPECT_NE(trace.find(R"("pid":0,"tid":0})"), std::string::npos);
+  EXPECT_NE(trace.find(R"({"name":"Sensor/render","cat":"Sensor","ph":"X",)"),
+            std::string::npos);
+  EXPECT_NE(trace.find(R"("pid":0,"tid":1})"), std::string::npos);
+
+  const std::filesystem::path filename =
+      std::filesystem::path(temp_directory()) / "trace.json";
+  dut.WriteChromeTrace(filename);
+  std::ifstream file(filename);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(contents.str(), trace);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.WriteChromeTrace(std::filesystem::path(temp_directory()) /
+                           "no_such_dir" / "trace.json"),
+      ".*could not open.*");
+}
+
+}  // namespace
+}  // namespace render
+}  // namespace geometry
+}  // namespace drake
@@ -94,6 +94,13 @@ struct OpenGlGeometry {
   // The number of vertices encoded in `vertex_buffer`.
   int v_count{};
 
+  // A sphere (in the geometry's frame, before any instance scale is applied)
+  // that bounds all of the vertices, used to cull instances that lie outside
+  // a camera's view. The default infinite radius is never culled; that is the
+  // right bound for geometries whose vertices change (i.e., deformables).
+  Vector3<double> bounds_center{0, 0, 0};
+  double bounds_radius{std::numeric_limits<double>::infinity()};
+
   /* The value of an object (array, buffer) that should be considered invalid.
    */
   static constexpr GLuint kInvalid = std::numeric_limits<GLuint>::max();
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <optional>
 #include <unordered_set>
 #include <utility>
@@ -10,6 +11,7 @@
 
 #include "drake/common/diagnostic_policy.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/overloaded.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/ssize.h"
@@ -29,12 +31,17 @@ using geometry::internal::RenderMaterial;
 using geometry::internal::RenderMesh;
 using geometry::internal::UvState;
 using math::RigidTransformd;
+using render::ColorImageRequest;
 using render::ColorRenderCamera;
+using render::DepthImageRequest;
 using render::DepthRenderCamera;
+using render::ImageRequest;
+using render::LabelImageRequest;
 using render::LightParameter;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderLabel;
+using render::RenderStatistics;
 using std::make_shared;
 using std::make_unique;
 using std::set;
@@ -1005,7 +1012,8 @@ unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
 }
 
 void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
-                              RenderType render_type) const {
+                              RenderType render_type,
+                              const ViewFrustum& frustum) const {
   const Eigen::Matrix4f& X_CW = X_CW_.GetAsMatrix4().matrix().cast<float>();
   // We rely on the calling method to clear all appropriate buffers; this method
   // may be called multiple times per image (based on the number of shaders
@@ -1020,6 +1028,14 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
         continue;
       }
       const OpenGlGeometry& geometry = geometries_[instance.geometry];
+      // Skip the draw call for instances that can't appear in the image.
+      const Vector3d p_WS =
+          instance.X_WG * instance.scale.cwiseProduct(geometry.bounds_center);
+      const double radius =
+          geometry.bounds_radius * instance.scale.cwiseAbs().maxCoeff();
+      if (!frustum.MayIntersect(p_WS, radius)) {
+        continue;
+      }
       glBindVertexArray(geometry.vertex_array);
 
       shader_program.SetInstanceParameters(instance.shader_data[render_type]);
@@ -1041,6 +1057,108 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
 void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
                                         ImageRgba8U* color_image_out) const {
   opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawColorImage(camera);
+  ReadColorImage(camera, render_target, color_image_out);
+}
+
+void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
+                                        ImageDepth32F* depth_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawDepthImage(camera);
+  ReadDepthImage(render_target, depth_image_out);
+}
+
+void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
+                                        ImageLabel16I* label_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawLabelImage(camera);
+  ReadLabelImage(camera, render_target, label_image_out);
+}
+
+void RenderEngineGl::DoRenderImages(const std::vector<ImageRequest>& requests) {
+  opengl_context_->MakeCurrent();
+
+  // Reading an image back waits for the GPU to finish drawing it. So, we issue
+  // the draw calls of as many images as we can before reading any of them
+  // back; the GPU then draws the later images while the earlier ones are read
+  // (and, for labels, converted). Each render target (one per image type and
+  // size) holds a single image, so the pending images must be read back before
+  // one of their targets is drawn into again.
+  std::vector<std::function<void()>> pending_reads;
+  std::unordered_set<GLuint> pending_frame_buffers;
+  auto read_pending = [&]() {
+    for (const auto& read : pending_reads) {
+      read();
+    }
+    pending_reads.clear();
+    pending_frame_buffers.clear();
+  };
+  auto read_later = [&](const RenderCameraCore& core, RenderType render_type,
+                        auto draw, auto read) {
+    const BufferDim dim{core.intrinsics().width(), core.intrinsics().height()};
+    const auto iter = frame_buffers_[render_type].find(dim);
+    if (iter != frame_buffers_[render_type].end() &&
+        pending_frame_buffers.contains(iter->second.frame_buffer)) {
+      read_pending();
+    }
+    const RenderTarget render_target = draw();
+    pending_frame_buffers.insert(render_target.frame_buffer);
+    pending_reads.push_back([read, render_target]() {
+      read(render_target);
+    });
+  };
+
+  const RigidTransformd* X_WC_current = nullptr;
+  for (const ImageRequest& request : requests) {
+    const RigidTransformd& X_WC = std::visit(
+        [](const auto& r) -> const RigidTransformd& {
+          return r.X_WC;
+        },
+        request);
+    // The draw calls use X_CW_, which the pending images no longer need.
+    if (X_WC_current == nullptr || !X_WC.IsExactlyEqualTo(*X_WC_current)) {
+      UpdateViewpoint(X_WC);
+      X_WC_current = &X_WC;
+    }
+    std::visit(
+        overloaded{
+            [&](const ColorImageRequest& color) {
+              read_later(
+                  color.camera.core(), RenderType::kColor,
+                  [&]() {
+                    return DrawColorImage(color.camera);
+                  },
+                  [this, &color](const RenderTarget& target) {
+                    ReadColorImage(color.camera, target, color.image);
+                  });
+            },
+            [&](const DepthImageRequest& depth) {
+              read_later(
+                  depth.camera.core(), RenderType::kDepth,
+                  [&]() {
+                    return DrawDepthImage(depth.camera);
+                  },
+                  [this, &depth](const RenderTarget& target) {
+                    ReadDepthImage(target, depth.image);
+                  });
+            },
+            [&](const LabelImageRequest& label) {
+              read_later(
+                  label.camera.core(), RenderType::kLabel,
+                  [&]() {
+                    return DrawLabelImage(label.camera);
+                  },
+                  [this, &label](const RenderTarget& target) {
+                    ReadLabelImage(label.camera, target, label.image);
+                  });
+            }},
+        request);
+  }
+  read_pending();
+}
+
+RenderTarget RenderEngineGl::DrawColorImage(
+    const ColorRenderCamera& camera) const {
   // TODO(SeanCurtis-TRI): For transparency to work properly, I need to
   //  segregate objects with transparency from those without. The transparent
   //  geometries then need to be sorted from farthest to nearest the camera and
@@ -1062,28 +1180,40 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
   // frame D.
   const Eigen::Matrix4f T_DC =
       camera.core().CalcProjectionMatrix().cast<float>();
-
-  for (const auto& [_, shader_program] : shader_programs_[RenderType::kColor]) {
-    shader_program->Use();
-    shader_program->SetProjectionMatrix(T_DC);
-    RenderAt(*shader_program, RenderType::kColor);
-    shader_program->Unuse();
+  const ViewFrustum frustum(camera.core(), X_CW_);
+
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineGl/render");
+    for (const auto& [_, shader_program] :
+         shader_programs_[RenderType::kColor]) {
+      shader_program->Use();
+      shader_program->SetProjectionMatrix(T_DC);
+      RenderAt(*shader_program, RenderType::kColor, frustum);
+      shader_program->Unuse();
+    }
   }
   glDisable(GL_BLEND);
+  return render_target;
+}
 
+void RenderEngineGl::ReadColorImage(const ColorRenderCamera& camera,
+                                    const RenderTarget& render_target,
+                                    ImageRgba8U* color_image_out) const {
   // Note: SetWindowVisibility must be called *after* the rendering; setting the
   // visibility is responsible for taking the target buffer and bringing it to
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
+  // N.B. Reading the pixels waits for the GPU to finish drawing them.
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineGl/readback");
   glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    color_image_out->size(), color_image_out->at(0, 0));
+                    color_image_out->size(), color_image_out->mutable_data());
 }
 
-void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
-                                        ImageDepth32F* depth_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawDepthImage(
+    const DepthRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kDepth);
 
@@ -1098,27 +1228,36 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
   // frame D.
   const Eigen::Matrix4f T_DC =
       camera.core().CalcProjectionMatrix().cast<float>();
+  const ViewFrustum frustum(camera.core(), X_CW_);
 
-  for (const auto& [_, shader_ptr] : shader_programs_[RenderType::kDepth]) {
-    const ShaderProgram& shader_program = *shader_ptr;
-    shader_program.Use();
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineGl/render");
+    for (const auto& [_, shader_ptr] : shader_programs_[RenderType::kDepth]) {
+      const ShaderProgram& shader_program = *shader_ptr;
+      shader_program.Use();
 
-    shader_program.SetProjectionMatrix(T_DC);
-    shader_program.SetDepthCameraParameters(camera);
-    RenderAt(shader_program, RenderType::kDepth);
+      shader_program.SetProjectionMatrix(T_DC);
+      shader_program.SetDepthCameraParameters(camera);
+      RenderAt(shader_program, RenderType::kDepth, frustum);
 
-    shader_program.Unuse();
+      shader_program.Unuse();
+    }
   }
+  return render_target;
+}
 
+void RenderEngineGl::ReadDepthImage(const RenderTarget& render_target,
+                                    ImageDepth32F* depth_image_out) const {
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineGl/readback");
   glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
                     depth_image_out->size() * sizeof(GLfloat),
-                    depth_image_out->at(0, 0));
+                    depth_image_out->mutable_data());
 }
 
-void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
-                                        ImageLabel16I* label_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawLabelImage(
+    const ColorRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kLabel);
   // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a member.
@@ -1135,17 +1274,27 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
   // frame D.
   const Eigen::Matrix4f T_DC =
       camera.core().CalcProjectionMatrix().cast<float>();
+  const ViewFrustum frustum(camera.core(), X_CW_);
 
-  for (const auto& [_, shader_ptr] : shader_programs_[RenderType::kLabel]) {
-    const ShaderProgram& shader_program = *shader_ptr;
-    shader_program.Use();
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineGl/render");
+    for (const auto& [_, shader_ptr] : shader_programs_[RenderType::kLabel]) {
+      const ShaderProgram& shader_program = *shader_ptr;
+      shader_program.Use();
 
-    shader_program.SetProjectionMatrix(T_DC);
-    RenderAt(shader_program, RenderType::kLabel);
+      shader_program.SetProjectionMatrix(T_DC);
+      RenderAt(shader_program, RenderType::kLabel, frustum);
 
-    shader_program.Unuse();
+      shader_program.Unuse();
+    }
   }
+  return render_target;
+}
 
+void RenderEngineGl::ReadLabelImage(const ColorRenderCamera& camera,
+                                    const RenderTarget& render_target,
+                                    ImageLabel16I* label_image_out) const {
   // Note: SetWindowVisibility must be called *after* the rendering; setting the
   // visibility is responsible for taking the target buffer and bringing it to
   // the front buffer; reversing the order means the image we've just rendered
@@ -1367,8 +1516,14 @@ RenderTarget RenderEngineGl::CreateRenderTarget(const RenderCameraCore& camera,
 void RenderEngineGl::GetLabelImage(ImageLabel16I* label_image_out,
                                    const RenderTarget& target) const {
   ImageRgba8U image(label_image_out->width(), label_image_out->height());
-  glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    image.size() * sizeof(GLubyte), image.at(0, 0));
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineGl/readback");
+    glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                      image.size() * sizeof(GLubyte), image.mutable_data());
+  }
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineGl/convert");
   ColorI color;
   for (int y = 0; y < image.height(); ++y) {
     for (int x = 0; x < image.width(); ++x) {
@@ -1453,6 +1608,18 @@ int RenderEngineGl::CreateGlGeometry(const RenderMesh& render_mesh,
   geometry.v_count = v_count;
   CreateVertexArray(&geometry);
 
+  if (!is_deformable && v_count > 0) {
+    // Bound the vertices with the sphere centered on their bounding box.
+    const Vector3<double> lower = render_mesh.positions.colwise().minCoeff();
+    const Vector3<double> upper = render_mesh.positions.colwise().maxCoeff();
+    geometry.bounds_center = (lower + upper) / 2;
+    geometry.bounds_radius =
+        (render_mesh.positions.rowwise() - geometry.bounds_center.transpose())
+            .rowwise()
+            .norm()
+            .maxCoeff();
+  }
+
   // Note: We won't need to call the corresponding glDeleteVertexArrays or
   // glDeleteBuffers. The meshes we store are "canonical" meshes. Even if a
   // particular GeometryId is removed, it was only referencing its corresponding
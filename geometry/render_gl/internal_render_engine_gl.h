@@ -23,6 +23,7 @@
 #include "drake/geometry/render_gl/internal_shader_program.h"
 #include "drake/geometry/render_gl/internal_shape_meshes.h"
 #include "drake/geometry/render_gl/internal_texture_library.h"
+#include "drake/geometry/render_gl/internal_view_frustum.h"
 #include "drake/geometry/render_gl/render_engine_gl_params.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/sensors/image.h"
@@ -191,6 +192,29 @@ class RenderEngineGl final : public render::RenderEngine {
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const final;
 
+  // @see RenderEngine::DoRenderImages(). Makes the OpenGl context current once
+  // for the whole batch, and draws as many of the images as possible before
+  // reading any of them back, so that the GPU keeps drawing while the CPU
+  // reads.
+  void DoRenderImages(const std::vector<render::ImageRequest>& requests) final;
+
+  // The steps of rendering each image type: Draw*Image() issues the draw calls
+  // into the render target for the camera (from the current viewpoint) and
+  // returns it; Read*Image() reads the image back from that target, waiting
+  // for the GPU to finish drawing it.
+  // @pre opengl_context_ has been bound.
+  RenderTarget DrawColorImage(const render::ColorRenderCamera& camera) const;
+  void ReadColorImage(const render::ColorRenderCamera& camera,
+                      const RenderTarget& render_target,
+                      systems::sensors::ImageRgba8U* color_image_out) const;
+  RenderTarget DrawDepthImage(const render::DepthRenderCamera& camera) const;
+  void ReadDepthImage(const RenderTarget& render_target,
+                      systems::sensors::ImageDepth32F* depth_image_out) const;
+  RenderTarget DrawLabelImage(const render::ColorRenderCamera& camera) const;
+  void ReadLabelImage(const render::ColorRenderCamera& camera,
+                      const RenderTarget& render_target,
+                      systems::sensors::ImageLabel16I* label_image_out) const;
+
   // Copy constructor used for cloning.
   // Do *not* call this copy constructor directly. The resulting RenderEngineGl
   // is not complete -- it will render nothing except the background color.
@@ -198,9 +222,9 @@ class RenderEngineGl final : public render::RenderEngine {
   RenderEngineGl(const RenderEngineGl& other) = default;
 
   // Renders all geometries which use the given shader program for the given
-  // render type.
-  void RenderAt(const ShaderProgram& shader_program,
-                RenderType render_type) const;
+  // render type, skipping those that lie outside of the camera's `frustum`.
+  void RenderAt(const ShaderProgram& shader_program, RenderType render_type,
+                const ViewFrustum& frustum) const;
 
   // Creates a geometry instance from the referenced geometry data, scale, and
   // user data (e.g., GeometryId, perception properties). The instance is added
@@ -0,0 +1,38 @@
+#include "drake/geometry/render_gl/internal_view_frustum.h"
+
+namespace drake {
+namespace geometry {
+namespace render_gl {
+namespace internal {
+
+ViewFrustum::ViewFrustum(const render::RenderCameraCore& core,
+                         const math::RigidTransformd& X_CW) {
+  // Our camera frame C wrt the OpenGL's camera frame Cgl.
+  // clang-format off
+  const Eigen::Matrix4d T_CglC =
+      (Eigen::Matrix4d() << 1,  0,  0, 0,
+                            0, -1,  0, 0,
+                            0,  0, -1, 0,
+                            0,  0,  0, 1)
+          .finished();
+  // clang-format on
+  // The matrix mapping a point from the world frame W to the clip space D. A
+  // point is in the frustum iff its clip coordinates (x, y, z, w) satisfy
+  // -w ≤ x, y, z ≤ w. Each of those six inequalities is a half space in W
+  // (Gribb & Hartmann, "Fast extraction of viewing frustum planes from the
+  // world-view-projection matrix", 2001).
+  const Eigen::Matrix4d T_DW =
+      core.CalcProjectionMatrix() * T_CglC * X_CW.GetAsMatrix4();
+  for (int i = 0; i < 3; ++i) {
+    planes_.row(2 * i) = T_DW.row(3) + T_DW.row(i);
+    planes_.row(2 * i + 1) = T_DW.row(3) - T_DW.row(i);
+  }
+  for (int i = 0; i < 6; ++i) {
+    planes_.row(i) /= planes_.row(i).head<3>().norm();
+  }
+}
+
+}  // namespace internal
+}  // namespace render_gl
+}  // namespace geometry
+}  // namespace drake
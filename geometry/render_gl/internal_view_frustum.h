@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/render_camera.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace render_gl {
+namespace internal {
+
+/* The view volume of a camera posed in the world, used to cull geometries
+ that can't possibly appear in a rendered image. The volume is the truncated
+ pyramid bounded by the image borders and the near and far clipping planes.  */
+class ViewFrustum {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ViewFrustum)
+
+  /* Constructs the view frustum of a camera with the given `core` properties
+   and the pose `X_CW` of the world frame in the camera frame C (X-right,
+   Y-down, Z-forward).  */
+  ViewFrustum(const render::RenderCameraCore& core,
+              const math::RigidTransformd& X_CW);
+
+  /* Reports false if the sphere with the given center `p_WS` (measured and
+   expressed in the world frame) and `radius` lies entirely outside of the
+   frustum. The test is conservative: it may report true for a sphere that lies
+   near a corner of the frustum without intersecting it. An infinite `radius`
+   always reports true.  */
+  bool MayIntersect(const Eigen::Vector3d& p_WS, double radius) const {
+    // The signed distances from the sphere's center to each plane, positive
+    // on the inside.
+    const Eigen::Matrix<double, 6, 1> distances =
+        planes_.leftCols<3>() * p_WS + planes_.col(3);
+    return (distances.array() >= -radius).all();
+  }
+
+ private:
+  // The six bounding planes in the world frame, one per row (n_W, d), with
+  // unit normal n_W pointing into the frustum: the plane holds the points P
+  // for which n_W⋅p_WP + d = 0.
+  Eigen::Matrix<double, 6, 4> planes_;
+};
+
+}  // namespace internal
+}  // namespace render_gl
+}  // namespace geometry
+}  // namespace drake
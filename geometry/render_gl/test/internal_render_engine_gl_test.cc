@@ -32,8 +32,12 @@ namespace geometry {
 namespace render_gl {
 namespace internal {
 
+using render::ColorImageRequest;
 using render::ColorRenderCamera;
+using render::DepthImageRequest;
 using render::DepthRenderCamera;
+using render::ImageRequest;
+using render::LabelImageRequest;
 using render::LightParameter;
 using render::RenderCameraCore;
 using render::RenderEngine;
@@ -1459,6 +1463,52 @@ TEST_F(RenderEngineGlTest, RemoveVisual) {
 
 // Tests that the cloned renderer produces the same images (i.e., passes the
 // same test).
+// A batch of images produces the same images as rendering them one at a time,
+// including when several images of the batch share a render target (i.e., have
+// the same type and size), so that they can't all be drawn before reading any
+// of them back.
+TEST_F(RenderEngineGlTest, RenderImages) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+  const ColorRenderCamera color_camera(depth_camera_.core(), FLAGS_show_window);
+  const RigidTransformd X_WR2 =
+      RigidTransformd(Vector3d(0.1, 0.2, 0)) * X_WR_;
+
+  struct Images {
+    ImageRgba8U color{kWidth, kHeight};
+    ImageDepth32F depth{kWidth, kHeight};
+    ImageLabel16I label{kWidth, kHeight};
+  };
+  std::vector<Images> expected(2);
+  for (int i = 0; i < 2; ++i) {
+    renderer_->UpdateViewpoint(i == 0 ? X_WR_ : X_WR2);
+    Render(renderer_.get(), &depth_camera_, &expected[i].color,
+           &expected[i].depth, &expected[i].label);
+  }
+
+  std::vector<Images> batched(2);
+  std::vector<ImageRequest> requests;
+  for (int i = 0; i < 2; ++i) {
+    const RigidTransformd& X_WC = i == 0 ? X_WR_ : X_WR2;
+    requests.push_back(
+        ColorImageRequest{color_camera, X_WC, &batched[i].color});
+    requests.push_back(
+        DepthImageRequest{depth_camera_, X_WC, &batched[i].depth});
+    requests.push_back(
+        LabelImageRequest{color_camera, X_WC, &batched[i].label});
+  }
+  renderer_->RenderImages(requests);
+
+  for (int i = 0; i < 2; ++i) {
+    SCOPED_TRACE(fmt::format("viewpoint {}", i));
+    EXPECT_EQ(batched[i].color, expected[i].color);
+    EXPECT_EQ(batched[i].depth, expected[i].depth);
+    EXPECT_EQ(batched[i].label, expected[i].label);
+  }
+  // The viewpoints differ enough to tell the images apart.
+  EXPECT_FALSE(expected[0].depth == expected[1].depth);
+}
+
 TEST_F(RenderEngineGlTest, SimpleClone) {
   Init(X_WR_, true);
   PopulateSphereTest(renderer_.get());
@@ -0,0 +1,75 @@
+#include "drake/geometry/render_gl/internal_view_frustum.h"
+
+#include <limits>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace render_gl {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using render::ClippingRange;
+using render::RenderCameraCore;
+using systems::sensors::CameraInfo;
+
+// A camera with a 90-degree field of view in both directions, posed at p_WC
+// and looking along the world's +x axis (with the image's "up" along +z).
+class ViewFrustumTest : public ::testing::Test {
+ protected:
+  ViewFrustumTest()
+      : core_("n/a", CameraInfo(100, 100, M_PI / 2), ClippingRange(0.5, 10),
+              RigidTransformd()),
+        X_WC_(RollPitchYawd(-M_PI / 2, 0, -M_PI / 2), Vector3d(1, 2, 3)),
+        frustum_(core_, X_WC_.inverse()) {}
+
+  // Returns the point with the given position in the camera frame C, expressed
+  // in the world frame.
+  Vector3d InWorld(double x, double y, double z) const {
+    return X_WC_ * Vector3d(x, y, z);
+  }
+
+  RenderCameraCore core_;
+  RigidTransformd X_WC_;
+  ViewFrustum frustum_;
+};
+
+TEST_F(ViewFrustumTest, Points) {
+  // Sanity check of the camera's pose: its optical axis points along Wx.
+  EXPECT_NEAR(InWorld(0, 0, 1).x(), 2, 1e-14);
+
+  EXPECT_TRUE(frustum_.MayIntersect(InWorld(0, 0, 5), 0));
+  EXPECT_TRUE(frustum_.MayIntersect(InWorld(1.9, -1.9, 2), 0));
+  // Behind the camera, before the near plane, and beyond the far plane.
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(0, 0, -1), 0));
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(0, 0, 0.4), 0));
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(0, 0, 10.1), 0));
+  // Beyond each of the four sides.
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(2.1, 0, 2), 0));
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(-2.1, 0, 2), 0));
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(0, 2.1, 2), 0));
+  EXPECT_FALSE(frustum_.MayIntersect(InWorld(0, -2.1, 2), 0));
+}
+
+TEST_F(ViewFrustumTest, Spheres) {
+  // The distance from (3, 0, 2) to the plane x = z is 1/√2. (The principal
+  // point is half a pixel off the image center, which tilts the actual plane
+  // slightly.)
+  const Vector3d p_WS = InWorld(3, 0, 2);
+  EXPECT_FALSE(frustum_.MayIntersect(p_WS, 0.68));
+  EXPECT_TRUE(frustum_.MayIntersect(p_WS, 0.73));
+  // A sphere beyond the far plane, but large enough to reach into it.
+  EXPECT_TRUE(frustum_.MayIntersect(InWorld(0, 0, 12), 2.5));
+  EXPECT_TRUE(frustum_.MayIntersect(InWorld(100, 100, -100),
+                                    std::numeric_limits<double>::infinity()));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_gl
+}  // namespace geometry
+}  // namespace drake
@@ -29,6 +29,7 @@ namespace fs = std::filesystem;
 
 using render::ColorRenderCamera;
 using render::DepthRenderCamera;
+using render::ImageRequest;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render_vtk::internal::ImageType;
@@ -386,6 +387,13 @@ void RenderEngineGltfClient::UpdateViewpoint(
 #endif
 }
 
+void RenderEngineGltfClient::DoRenderImages(
+    const std::vector<ImageRequest>& requests) {
+  // Skip RenderEngineVtk's batch, which would render locally; the default
+  // dispatches each request to the DoRender*Image() overrides below.
+  RenderEngine::DoRenderImages(requests);
+}
+
 void RenderEngineGltfClient::DoRenderColorImage(
     const ColorRenderCamera& camera, ImageRgba8U* color_image_out) const {
   const int64_t color_scene_id = GetNextSceneId();
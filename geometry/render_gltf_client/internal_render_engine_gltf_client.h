@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -71,6 +72,10 @@ class DRAKE_NO_EXPORT RenderEngineGltfClient
   // @see RenderEngine::DoClone().
   std::unique_ptr<render::RenderEngine> DoClone() const override;
 
+  // The client renders with RenderEngineVtk's own pipelines (and a single
+  // camera pose) only; it can't render concurrently.
+  bool DoSupportsConcurrentRendering() const override { return false; }
+
   // @see RenderEngine::DoRenderColorImage().
   void DoRenderColorImage(
       const render::ColorRenderCamera& camera,
@@ -86,6 +91,11 @@ class DRAKE_NO_EXPORT RenderEngineGltfClient
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages(). Renders each image on the server, one
+  // at a time, instead of with RenderEngineVtk's local batch.
+  void DoRenderImages(
+      const std::vector<render::ImageRequest>& requests) override;
+
   /* Exports the `RenderEngineVtk::pipelines_[image_type]` VTK scene to a
    glTF file given `export_path`. */
   void ExportScene(const std::string& export_path,
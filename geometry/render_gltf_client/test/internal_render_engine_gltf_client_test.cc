@@ -44,8 +44,11 @@ using math::RigidTransformd;
 using math::RollPitchYawd;
 using math::RotationMatrixd;
 using nlohmann::json;
+using render::ColorImageRequest;
 using render::ColorRenderCamera;
+using render::DepthImageRequest;
 using render::DepthRenderCamera;
+using render::LabelImageRequest;
 using render::RenderEngine;
 using render_vtk::internal::ImageType;
 using systems::sensors::ImageDepth32F;
@@ -334,6 +337,26 @@ TEST_F(RenderEngineGltfClientTest, DoRenderLabelImage) {
   }
 }
 
+// A batch of images is rendered by the server too, not locally by the VTK
+// pipelines that the client inherits.
+TEST_F(RenderEngineGltfClientTest, RenderImages) {
+  RenderEngineGltfClient engine;
+  engine.SetHttpService(std::make_unique<FakeServer>());
+
+  ImageRgba8U color_image{kTestImageWidth, kTestImageHeight};
+  ImageDepth32F depth_image{kTestImageWidth, kTestImageHeight};
+  ImageLabel16I label_image{kTestImageWidth, kTestImageHeight};
+  const RigidTransformd X_WC(Vector3d(1, 2, 3));
+  DRAKE_EXPECT_NO_THROW(engine.RenderImages(
+      {ColorImageRequest{color_camera_, X_WC, &color_image},
+       DepthImageRequest{depth_camera_, X_WC, &depth_image},
+       LabelImageRequest{color_camera_, X_WC, &label_image}}));
+
+  EXPECT_EQ(color_image, CreateTestColorImage(false));
+  EXPECT_EQ(depth_image, CreateTestDepthImage());
+  EXPECT_EQ(label_image, CreateTestLabelImage());
+}
+
 class RenderEngineGltfClientGltfTest : public ::testing::Test {
  public:
   RenderEngineGltfClientGltfTest()
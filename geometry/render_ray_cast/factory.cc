@@ -0,0 +1,15 @@
+#include "drake/geometry/render_ray_cast/factory.h"
+
+#include "drake/geometry/render_ray_cast/internal_render_engine_ray_cast.h"
+
+namespace drake {
+namespace geometry {
+
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRayCast(
+    const RenderEngineRayCastParams& params) {
+  return std::make_unique<render_ray_cast::internal::RenderEngineRayCast>(
+      params);
+}
+
+}  // namespace geometry
+}  // namespace drake
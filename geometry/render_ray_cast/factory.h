@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render_ray_cast/render_engine_ray_cast_params.h"
+
+namespace drake {
+namespace geometry {
+// We need to get clang-format to ignore the long table lines so they get
+// rendered properly in doxygen.
+// clang-format off
+
+/** Constructs a RenderEngine implementation which renders depth and label
+ images by casting rays on the CPU. It requires neither a display nor an
+ OpenGL driver, and its memory footprint and construction cost are small, so
+ it is well suited to headless processes whose sensors only need depth or label
+ images.
+
+ Each pixel's ray is cast through its center against the triangulated surfaces
+ of the registered geometries; for each geometry, the triangles are organized
+ in a bounding volume hierarchy, the same one used by SceneGraph's proximity
+ queries. The rays of neighboring pixels are cast together in small packets
+ whose per-ray arithmetic is vectorized, and the rows of an image are divided
+ among multiple threads (see RenderEngineRayCastParams::num_threads).
+
+ The engine cannot render color images; RenderColorImage() throws.
+
+ @anchor render_engine_ray_cast_properties
+ <h2>Geometry perception properties</h2>
+
+ This RenderEngine implementation looks for the following properties when
+ registering visual geometry, categorized by rendered image type.
+
+ <h3>Depth images</h3>
+
+ No specific properties required.
+
+ <h3>Label images</h3>
+
+ | Group name | Property Name |   Required    |  Property Type  | Property Description |
+ | :--------: | :-----------: | :-----------: | :-------------: | :------------------- |
+ |   label    | id            | no¹           |  RenderLabel    | The label to render into the image. |
+
+ ¹ When the label property is not set, %RenderEngineRayCast uses a default
+ render label of RenderLabel::kDontCare.
+
+ <h3>Geometries accepted by %RenderEngineRayCast</h3>
+
+ %RenderEngineRayCast accepts all geometries, except for Mesh and Convex shapes
+ whose files are neither .obj nor .vtk files; those are ignored (with a
+ one-time warning). Curved primitives are approximated by triangle meshes (see
+ RenderEngineRayCastParams::relative_resolution_hint). Triangles are visible
+ from both sides. Convex shapes are rendered as their meshes, not as their
+ convex hulls.
+
+ <h3>Concurrency</h3>
+
+ Multiple threads may render from a single %RenderEngineRayCast at the same time
+ (see RenderEngine::SupportsConcurrentRendering()). Clones share the
+ (immutable) meshes of the original engine, so cloning is cheap.
+ */
+std::unique_ptr<render::RenderEngine> MakeRenderEngineRayCast(
+    const RenderEngineRayCastParams& params = {});
+// clang-format on
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,389 @@
+#include "drake/geometry/render_ray_cast/internal_render_engine_ray_cast.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <limits>
+#include <utility>
+#include <variant>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/overloaded.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/geometry/proximity/make_capsule_mesh.h"
+#include "drake/geometry/proximity/make_cylinder_mesh.h"
+#include "drake/geometry/proximity/make_ellipsoid_mesh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/proximity/ray_cast.h"
+
+namespace drake {
+namespace geometry {
+namespace render_ray_cast {
+namespace internal {
+
+using Eigen::Vector3d;
+using geometry::internal::CastRayPacket;
+using geometry::internal::GetRayCastMesh;
+using geometry::internal::kRayPacketSize;
+using geometry::internal::RayPacket;
+using geometry::internal::RayPacketHits;
+using geometry::internal::RayPacketMask;
+using geometry::internal::RayCastMesh;
+using geometry::internal::RayPacketScalars;
+using math::RigidTransformd;
+using render::ColorRenderCamera;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using std::make_shared;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+namespace {
+
+// The rays of a packet are those of a tile of kTileWidth x kTileHeight pixels.
+constexpr int kTileWidth = 4;
+constexpr int kTileHeight = kRayPacketSize / kTileWidth;
+static_assert(kTileWidth * kTileHeight == kRayPacketSize);
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+}  // namespace
+
+RenderEngineRayCast::RenderEngineRayCast(
+    const RenderEngineRayCastParams& parameters)
+    : RenderEngine(RenderLabel::kDontCare),
+      parameters_(parameters),
+      num_threads_(parameters.num_threads.has_value()
+                       ? *parameters.num_threads
+                       : Parallelism::Max().num_threads()) {
+  DRAKE_THROW_UNLESS(num_threads_ >= 1);
+  DRAKE_THROW_UNLESS(parameters_.relative_resolution_hint > 0);
+}
+
+RenderEngineRayCast::~RenderEngineRayCast() = default;
+
+void RenderEngineRayCast::UpdateViewpoint(const RigidTransformd& X_WC) {
+  std::lock_guard<std::mutex> lock(viewpoint_mutex_);
+  X_WC_ = X_WC;
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Box& box, void* user_data) {
+  // The coarsest mesh (12 triangles) represents the box exactly.
+  AddPrimitiveVisual(
+      fmt::format("Box {:a} {:a} {:a}", box.width(), box.depth(),
+                  box.height()),
+      [&box]() {
+        return geometry::internal::MakeBoxSurfaceMesh<double>(
+            box, 1.1 * box.size().maxCoeff());
+      },
+      user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Capsule& capsule,
+                                            void* user_data) {
+  const double resolution_hint =
+      parameters_.relative_resolution_hint * capsule.radius();
+  AddPrimitiveVisual(
+      fmt::format("Capsule {:a} {:a} {:a}", capsule.radius(), capsule.length(),
+                  resolution_hint),
+      [&capsule, resolution_hint]() {
+        return geometry::internal::MakeCapsuleSurfaceMesh<double>(
+            capsule, resolution_hint);
+      },
+      user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Convex& convex,
+                                            void* user_data) {
+  AddMeshFileVisual(convex.filename(), convex.scale(), user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Cylinder& cylinder,
+                                            void* user_data) {
+  const double resolution_hint =
+      parameters_.relative_resolution_hint * cylinder.radius();
+  AddPrimitiveVisual(
+      fmt::format("Cylinder {:a} {:a} {:a}", cylinder.radius(),
+                  cylinder.length(), resolution_hint),
+      [&cylinder, resolution_hint]() {
+        return geometry::internal::MakeCylinderSurfaceMesh<double>(
+            cylinder, resolution_hint);
+      },
+      user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Ellipsoid& ellipsoid,
+                                            void* user_data) {
+  const double resolution_hint =
+      parameters_.relative_resolution_hint *
+      std::min({ellipsoid.a(), ellipsoid.b(), ellipsoid.c()});
+  AddPrimitiveVisual(
+      fmt::format("Ellipsoid {:a} {:a} {:a} {:a}", ellipsoid.a(),
+                  ellipsoid.b(), ellipsoid.c(), resolution_hint),
+      [&ellipsoid, resolution_hint]() {
+        return geometry::internal::MakeEllipsoidSurfaceMesh<double>(
+            ellipsoid, resolution_hint);
+      },
+      user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const HalfSpace&,
+                                            void* user_data) {
+  AddVisual(nullptr, user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Mesh& mesh,
+                                            void* user_data) {
+  AddMeshFileVisual(mesh.filename(), mesh.scale(), user_data);
+}
+
+void RenderEngineRayCast::ImplementGeometry(const Sphere& sphere,
+                                            void* user_data) {
+  const double resolution_hint =
+      parameters_.relative_resolution_hint * sphere.radius();
+  AddPrimitiveVisual(
+      fmt::format("Sphere {:a} {:a}", sphere.radius(), resolution_hint),
+      [&sphere, resolution_hint]() {
+        return geometry::internal::MakeSphereSurfaceMesh<double>(
+            sphere, resolution_hint);
+      },
+      user_data);
+}
+
+RenderEngineRayCast::RenderEngineRayCast(const RenderEngineRayCast& other)
+    : RenderEngine(other),
+      parameters_(other.parameters_),
+      num_threads_(other.num_threads_),
+      visuals_(other.visuals_),
+      primitive_meshes_(other.primitive_meshes_) {
+  X_WC_ = other.GetViewpoint();
+}
+
+bool RenderEngineRayCast::DoRegisterVisual(
+    GeometryId id, const Shape& shape, const PerceptionProperties& properties,
+    const RigidTransformd& X_WG) {
+  // Note: the user_data interface on reification requires a non-const pointer.
+  RegistrationData data{properties, X_WG, id};
+  shape.Reify(this, &data);
+  return data.accepted;
+}
+
+void RenderEngineRayCast::DoUpdateVisualPose(GeometryId id,
+                                             const RigidTransformd& X_WG) {
+  visuals_.at(id).X_WG = X_WG;
+}
+
+bool RenderEngineRayCast::DoRemoveGeometry(GeometryId id) {
+  return visuals_.erase(id) > 0;
+}
+
+std::unique_ptr<RenderEngine> RenderEngineRayCast::DoClone() const {
+  return std::unique_ptr<RenderEngineRayCast>(new RenderEngineRayCast(*this));
+}
+
+void RenderEngineRayCast::DoRenderDepthImage(
+    const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
+  RenderDepthImageFrom(GetViewpoint(), camera, depth_image_out);
+}
+
+void RenderEngineRayCast::DoRenderLabelImage(
+    const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
+  CastRays(GetViewpoint(), camera.core(), nullptr, label_image_out);
+}
+
+void RenderEngineRayCast::DoRenderImages(
+    const std::vector<render::ImageRequest>& requests) {
+  if (requests.empty()) return;
+  for (const render::ImageRequest& request : requests) {
+    std::visit(overloaded{[this](const render::ColorImageRequest& color) {
+                            // Throws; this engine doesn't render color.
+                            DoRenderColorImage(color.camera, color.image);
+                          },
+                          [this](const render::DepthImageRequest& depth) {
+                            RenderDepthImageFrom(depth.X_WC, depth.camera,
+                                                 depth.image);
+                          },
+                          [this](const render::LabelImageRequest& label) {
+                            CastRays(label.X_WC, label.camera.core(), nullptr,
+                                     label.image);
+                          }},
+               request);
+  }
+  // As documented by RenderImages(), the engine is left at the viewpoint of
+  // the last request.
+  UpdateViewpoint(std::visit(
+      [](const auto& r) -> const RigidTransformd& {
+        return r.X_WC;
+      },
+      requests.back()));
+}
+
+void RenderEngineRayCast::RenderDepthImageFrom(
+    const RigidTransformd& X_WC, const DepthRenderCamera& camera,
+    ImageDepth32F* depth_image_out) const {
+  CastRays(X_WC, camera.core(), depth_image_out, nullptr);
+
+  // Depths outside of the camera's depth range are reported as being too close
+  // or too far (no surface at all is also "too far").
+  const float min_depth = static_cast<float>(camera.depth_range().min_depth());
+  const float max_depth = static_cast<float>(camera.depth_range().max_depth());
+  float* depth = depth_image_out->mutable_data();
+  for (int i = 0; i < depth_image_out->size(); ++i) {
+    if (depth[i] < min_depth) {
+      depth[i] = ImageTraits<PixelType::kDepth32F>::kTooClose;
+    } else if (depth[i] > max_depth) {
+      depth[i] = ImageTraits<PixelType::kDepth32F>::kTooFar;
+    }
+  }
+}
+
+void RenderEngineRayCast::AddVisual(std::shared_ptr<const RayCastMesh> mesh,
+                                    void* user_data) {
+  const RegistrationData& data = *static_cast<RegistrationData*>(user_data);
+  visuals_.emplace(data.id,
+                   Visual{.mesh = std::move(mesh),
+                          .label = GetRenderLabelOrThrow(data.properties),
+                          .X_WG = data.X_WG});
+}
+
+void RenderEngineRayCast::AddPrimitiveVisual(
+    const std::string& key,
+    const std::function<TriangleSurfaceMesh<double>()>& make_mesh,
+    void* user_data) {
+  std::shared_ptr<const RayCastMesh> mesh = primitive_meshes_[key].lock();
+  if (mesh == nullptr) {
+    mesh = make_shared<const RayCastMesh>(make_mesh());
+    primitive_meshes_[key] = mesh;
+  }
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineRayCast::AddMeshFileVisual(const std::string& filename,
+                                            double scale, void* user_data) {
+  std::shared_ptr<const RayCastMesh> mesh = GetRayCastMesh(filename, scale);
+  if (mesh == nullptr) {
+    static const logging::Warn one_time(
+        "RenderEngineRayCast only supports Mesh/Convex specifications which "
+        "use .obj or .vtk files. Mesh specifications using other mesh types "
+        "(e.g., .gltf, .stl, .dae, etc.) will be ignored.");
+    static_cast<RegistrationData*>(user_data)->accepted = false;
+    return;
+  }
+  AddVisual(std::move(mesh), user_data);
+}
+
+void RenderEngineRayCast::CastRays(const RigidTransformd& X_WC,
+                                   const RenderCameraCore& core,
+                                   ImageDepth32F* depth_out,
+                                   ImageLabel16I* label_out) const {
+  const CameraInfo& intrinsics = core.intrinsics();
+  const int width = intrinsics.width();
+  const int height = intrinsics.height();
+  const double z_near = core.clipping().near();
+  const double z_far = core.clipping().far();
+
+  // The poses of the visuals in the camera frame C, gathered once per image.
+  struct PosedVisual {
+    RigidTransformd X_GC;
+    const Visual* visual;
+  };
+  const RigidTransformd X_CW = X_WC.inverse();
+  std::vector<PosedVisual> posed_visuals;
+  const HalfSpace half_space;
+  posed_visuals.reserve(visuals_.size());
+  for (const auto& [_, visual] : visuals_) {
+    posed_visuals.push_back({(X_CW * visual.X_WG).inverse(), &visual});
+  }
+
+  // Casts the rays of the pixels in the row of tiles `tile_row`. The ray of
+  // pixel (u, v) passes through the point ((u - cx) / fx, (v - cy) / fy, 1) in
+  // C, so its ray parameter *is* its depth.
+  auto cast_tile_row = [&](int tile_row) {
+    RayPacket rays_C{.p_FO = Vector3d::Zero(),
+                     .dirs_F = {},
+                     .t_min = RayPacketScalars::Constant(z_near)};
+    const int v0 = tile_row * kTileHeight;
+    for (int u0 = 0; u0 < width; u0 += kTileWidth) {
+      // Tiles at the image's right and bottom edges are padded by repeating
+      // the last column and row of pixels.
+      for (int i = 0; i < kRayPacketSize; ++i) {
+        const int u = std::min(u0 + i % kTileWidth, width - 1);
+        const int v = std::min(v0 + i / kTileWidth, height - 1);
+        rays_C.dirs_F.col(i) =
+            Vector3d((u - intrinsics.center_x()) / intrinsics.focal_x(),
+                     (v - intrinsics.center_y()) / intrinsics.focal_y(), 1.0);
+      }
+
+      RayPacketHits hits{
+          .t = RayPacketScalars::Constant(z_far),
+          .element = Eigen::Array<int, kRayPacketSize, 1>::Constant(-1)};
+      Eigen::Array<int, kRayPacketSize, 1> hit_visual =
+          Eigen::Array<int, kRayPacketSize, 1>::Constant(-1);
+      for (int k = 0; k < static_cast<int>(posed_visuals.size()); ++k) {
+        const PosedVisual& posed = posed_visuals[k];
+        const RayPacket rays_G = rays_C.Transform(posed.X_GC);
+        const RayPacketMask updated =
+            posed.visual->mesh != nullptr
+                ? CastRayPacket(rays_G, posed.visual->mesh->mesh_G,
+                                posed.visual->mesh->bvh_G, &hits)
+                : CastRayPacket(rays_G, half_space, &hits);
+        hit_visual = updated.select(k, hit_visual);
+      }
+
+      for (int i = 0; i < kRayPacketSize; ++i) {
+        const int u = u0 + i % kTileWidth;
+        const int v = v0 + i / kTileWidth;
+        if (u >= width || v >= height) continue;
+        const bool hit = hit_visual(i) >= 0;
+        if (depth_out != nullptr) {
+          *depth_out->at(u, v) = hit ? static_cast<float>(hits.t(i))
+                                     : static_cast<float>(kInf);
+        }
+        if (label_out != nullptr) {
+          *label_out->at(u, v) = static_cast<RenderLabel::ValueType>(
+              hit ? posed_visuals[hit_visual(i)].visual->label
+                  : RenderLabel::kEmpty);
+        }
+      }
+    }
+  };
+
+  // The worker threads and the calling thread claim rows of tiles one at a
+  // time.
+  const int num_tile_rows = (height + kTileHeight - 1) / kTileHeight;
+  std::atomic<int> next_tile_row{0};
+  auto cast_tile_rows = [&]() {
+    for (int r = next_tile_row++; r < num_tile_rows; r = next_tile_row++) {
+      cast_tile_row(r);
+    }
+  };
+  const int num_threads = std::min(num_threads_, num_tile_rows);
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i < num_threads; ++i) {
+    futures.push_back(std::async(std::launch::async, cast_tile_rows));
+  }
+  cast_tile_rows();
+  // Propagate any exception thrown on a worker thread.
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
+RigidTransformd RenderEngineRayCast::GetViewpoint() const {
+  std::lock_guard<std::mutex> lock(viewpoint_mutex_);
+  return X_WC_;
+}
+
+}  // namespace internal
+}  // namespace render_ray_cast
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/proximity/ray_cast.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_label.h"
+#include "drake/geometry/render_ray_cast/render_engine_ray_cast_params.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render_ray_cast {
+namespace internal {
+
+/* See documentation of MakeRenderEngineRayCast().  */
+class RenderEngineRayCast final : public render::RenderEngine {
+ public:
+  /* @name Does not allow public copy, move, or assignment  */
+  //@{
+  // Note: the copy constructor is private and used only for cloning.
+  RenderEngineRayCast& operator=(const RenderEngineRayCast&) = delete;
+  RenderEngineRayCast(RenderEngineRayCast&&) = delete;
+  RenderEngineRayCast& operator=(RenderEngineRayCast&&) = delete;
+  //@}
+
+  /* Constructs the engine from the given `parameters`.
+   @throws std::exception if parameters.num_threads is not positive or
+                          parameters.relative_resolution_hint is not
+                          positive.  */
+  explicit RenderEngineRayCast(
+      const RenderEngineRayCastParams& parameters = {});
+
+  ~RenderEngineRayCast() final;
+
+  /* @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
+
+  /* @name    Shape reification  */
+  //@{
+  using RenderEngine::ImplementGeometry;
+  void ImplementGeometry(const Box& box, void* user_data) final;
+  void ImplementGeometry(const Capsule& capsule, void* user_data) final;
+  void ImplementGeometry(const Convex& convex, void* user_data) final;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) final;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+  void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+  //@}
+
+  /* Returns the parameters this engine was constructed with.  */
+  const RenderEngineRayCastParams& parameters() const { return parameters_; }
+
+ private:
+  /* The registered representation of a visual geometry G.  */
+  struct Visual {
+    /* The surface of G; nullptr for a half space, which is cast against
+     analytically. Surfaces are shared among all visuals with the same shape
+     (in the case of meshes, among all engines; see MeshAssetRegistry) and
+     among clones of an engine.  */
+    std::shared_ptr<const geometry::internal::RayCastMesh> mesh;
+    render::RenderLabel label;
+    math::RigidTransformd X_WG;
+  };
+
+  /* The data passed through the ShapeReifier's `user_data`.  */
+  struct RegistrationData {
+    const PerceptionProperties& properties;
+    const math::RigidTransformd& X_WG;
+    const GeometryId id;
+    bool accepted{true};
+  };
+
+  /* Copy constructor for the purpose of cloning.  */
+  RenderEngineRayCast(const RenderEngineRayCast& other);
+
+  /* @see RenderEngine::DoRegisterVisual().  */
+  bool DoRegisterVisual(GeometryId id, const Shape& shape,
+                        const PerceptionProperties& properties,
+                        const math::RigidTransformd& X_WG) final;
+
+  /* @see RenderEngine::DoUpdateVisualPose().  */
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) final;
+
+  /* @see RenderEngine::DoRemoveGeometry().  */
+  bool DoRemoveGeometry(GeometryId id) final;
+
+  /* @see RenderEngine::DoClone().  */
+  std::unique_ptr<render::RenderEngine> DoClone() const final;
+
+  /* Rendering only reads the engine's state, so any number of threads may
+   render concurrently.  */
+  bool DoSupportsConcurrentRendering() const final { return true; }
+
+  /* @see RenderEngine::DoRenderImages(). Casts the rays of each request from
+   the request's own viewpoint.  */
+  void DoRenderImages(const std::vector<render::ImageRequest>& requests) final;
+
+  /* @see RenderEngine::DoRenderDepthImage().  */
+  void DoRenderDepthImage(
+      const render::DepthRenderCamera& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+  /* @see RenderEngine::DoRenderLabelImage().  */
+  void DoRenderLabelImage(
+      const render::ColorRenderCamera& camera,
+      systems::sensors::ImageLabel16I* label_image_out) const final;
+
+  /* Renders the depth image from the camera pose `X_WC`.  */
+  void RenderDepthImageFrom(
+      const math::RigidTransformd& X_WC,
+      const render::DepthRenderCamera& camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const;
+
+  /* Adds a visual with the given surface (nullptr for a half space) for the
+   geometry described by `user_data`.  */
+  void AddVisual(std::shared_ptr<const geometry::internal::RayCastMesh> mesh,
+                 void* user_data);
+
+  /* Adds a visual for the primitive described by `user_data`. Its surface is
+   the one cached under `key` or, if there is none, the one made by
+   `make_mesh`.  */
+  void AddPrimitiveVisual(
+      const std::string& key,
+      const std::function<geometry::TriangleSurfaceMesh<double>()>& make_mesh,
+      void* user_data);
+
+  /* Adds a visual for the geometry described by `user_data` whose surface is
+   read from the named .obj or .vtk file. Files of other types are ignored.  */
+  void AddMeshFileVisual(const std::string& filename, double scale,
+                         void* user_data);
+
+  /* Casts a ray through the center of each pixel of the image described by
+   `core`, from the camera pose `X_WC`. For each
+   pixel, the depth of the closest surface within the camera's clipping range
+   (or infinity, if there is none) is written to `depth_out` and that
+   surface's label (or RenderLabel::kEmpty) is written to `label_out`. Either
+   output may be nullptr.  */
+  void CastRays(const math::RigidTransformd& X_WC,
+                const render::RenderCameraCore& core,
+                systems::sensors::ImageDepth32F* depth_out,
+                systems::sensors::ImageLabel16I* label_out) const;
+
+  /* Returns the viewpoint most recently set by UpdateViewpoint().  */
+  math::RigidTransformd GetViewpoint() const;
+
+  RenderEngineRayCastParams parameters_;
+
+  // The number of threads used to render one image.
+  int num_threads_{};
+
+  std::unordered_map<GeometryId, Visual> visuals_;
+
+  // The surfaces of primitives, keyed by the shape's type and parameters, so
+  // that visuals with the same shape share a surface.
+  std::unordered_map<std::string,
+                     std::weak_ptr<const geometry::internal::RayCastMesh>>
+      primitive_meshes_;
+
+  // Guards the viewpoint below, which concurrent calls to RenderImages() leave
+  // at the viewpoint of their last request.
+  mutable std::mutex viewpoint_mutex_;
+
+  // The viewpoint most recently set by UpdateViewpoint(). Only the
+  // single-image Render*Image() methods use it.
+  math::RigidTransformd X_WC_;
+};
+
+}  // namespace internal
+}  // namespace render_ray_cast
+}  // namespace geometry
+}  // namespace drake
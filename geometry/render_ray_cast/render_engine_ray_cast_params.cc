@@ -0,0 +1 @@
+#include "drake/geometry/render_ray_cast/render_engine_ray_cast_params.h"
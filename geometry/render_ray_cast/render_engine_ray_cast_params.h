@@ -0,0 +1,36 @@
+#pragma once
+
+#include <optional>
+
+#include "drake/common/name_value.h"
+
+namespace drake {
+namespace geometry {
+
+/** Construction parameters for RenderEngineRayCast.  */
+struct RenderEngineRayCastParams {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(num_threads));
+    a->Visit(DRAKE_NVP(relative_resolution_hint));
+  }
+
+  /** The number of threads that cast the rays of a single image. If no value
+   is given, Parallelism::Max() threads are used. If a value is given, it must
+   be positive.  */
+  std::optional<int> num_threads;
+
+  /** Curved primitives (Sphere, Cylinder, Capsule, and Ellipsoid) are
+   approximated by triangle meshes whose vertices lie on the primitive's
+   surface. This is the target length of the triangle edges, as a fraction of
+   the primitive's smallest radius. The error in the rendered depth is roughly
+   proportional to the square of this value (for the default value, it is on
+   the order of half a percent of the radius). Smaller values increase the
+   memory footprint and the cost of registering geometry.  */
+  double relative_resolution_hint{0.2};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,354 @@
+#include "drake/geometry/render_ray_cast/internal_render_engine_ray_cast.h"
+
+#include <future>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/rotation_matrix.h"
+
+namespace drake {
+namespace geometry {
+namespace render_ray_cast {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+using render::ClippingRange;
+using render::ColorRenderCamera;
+using render::DepthRange;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+constexpr float kTooClose = ImageTraits<PixelType::kDepth32F>::kTooClose;
+constexpr float kTooFar = ImageTraits<PixelType::kDepth32F>::kTooFar;
+
+// The camera is 3 m above the ground, looking straight down, so the ground
+// plane is at depth 3 for every pixel. The odd image size exercises the
+// partially filled ray packets at the image's edges.
+constexpr double kCameraHeight = 3.0;
+constexpr int kWidth = 63;
+constexpr int kHeight = 47;
+
+const RenderLabel kGroundLabel(1);
+const RenderLabel kObjectLabel(2);
+
+class RenderEngineRayCastTest : public ::testing::Test {
+ protected:
+  RenderEngineRayCastTest()
+      : core_("ray_cast", CameraInfo(kWidth, kHeight, M_PI / 4),
+              ClippingRange(0.1, 10), RigidTransformd{}),
+        depth_camera_(core_, DepthRange(0.1, 5)),
+        color_camera_(core_, false),
+        depth_(kWidth, kHeight),
+        label_(kWidth, kHeight) {}
+
+  // The pose of a camera at height z above the origin, looking down.
+  static RigidTransformd CameraPose(double z) {
+    return RigidTransformd(RotationMatrixd::MakeFromOrthonormalColumns(
+                               Vector3d::UnitX(), -Vector3d::UnitY(),
+                               -Vector3d::UnitZ()),
+                           Vector3d(0, 0, z));
+  }
+
+  static PerceptionProperties MakeProperties(const RenderLabel& label) {
+    PerceptionProperties properties;
+    properties.AddProperty("label", "id", label);
+    return properties;
+  }
+
+  // Adds the ground and, at the origin, a box whose top is at height 0.5.
+  void PopulateScene(RenderEngine* engine) {
+    engine->RegisterVisual(ground_id_, HalfSpace(),
+                           MakeProperties(kGroundLabel), RigidTransformd{},
+                           false);
+    engine->RegisterVisual(object_id_, Box(1, 1, 1),
+                           MakeProperties(kObjectLabel), RigidTransformd{},
+                           true);
+    engine->UpdateViewpoint(CameraPose(kCameraHeight));
+  }
+
+  void Render(const RenderEngine& engine) {
+    engine.RenderDepthImage(depth_camera_, &depth_);
+    engine.RenderLabelImage(color_camera_, &label_);
+  }
+
+  // Confirms that the center pixel sees the object at the given depth and the
+  // corner pixels see the ground.
+  void ExpectObjectAndGround(float object_depth) {
+    EXPECT_NEAR(depth_.at(kWidth / 2, kHeight / 2)[0], object_depth, 1e-6);
+    EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kObjectLabel);
+    for (const auto& [u, v] : {std::pair{0, 0}, std::pair{kWidth - 1, 0},
+                               std::pair{0, kHeight - 1},
+                               std::pair{kWidth - 1, kHeight - 1}}) {
+      EXPECT_NEAR(depth_.at(u, v)[0], kCameraHeight, 1e-6);
+      EXPECT_EQ(label_.at(u, v)[0], kGroundLabel);
+    }
+  }
+
+  RenderCameraCore core_;
+  DepthRenderCamera depth_camera_;
+  ColorRenderCamera color_camera_;
+  ImageDepth32F depth_;
+  ImageLabel16I label_;
+  const GeometryId ground_id_{GeometryId::get_new_id()};
+  const GeometryId object_id_{GeometryId::get_new_id()};
+};
+
+// An empty scene is all "too far" and "empty".
+TEST_F(RenderEngineRayCastTest, EmptyScene) {
+  RenderEngineRayCast engine;
+  engine.UpdateViewpoint(CameraPose(kCameraHeight));
+  Render(engine);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      EXPECT_EQ(depth_.at(u, v)[0], kTooFar);
+      EXPECT_EQ(label_.at(u, v)[0], RenderLabel::kEmpty);
+    }
+  }
+}
+
+TEST_F(RenderEngineRayCastTest, BoxOnGround) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  Render(engine);
+  ExpectObjectAndGround(kCameraHeight - 0.5);
+
+  // Every pixel reports either the ground or the box's top face.
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      if (label_.at(u, v)[0] == kObjectLabel) {
+        EXPECT_NEAR(depth_.at(u, v)[0], kCameraHeight - 0.5, 1e-6);
+      } else {
+        EXPECT_EQ(label_.at(u, v)[0], kGroundLabel);
+        EXPECT_NEAR(depth_.at(u, v)[0], kCameraHeight, 1e-6);
+      }
+    }
+  }
+}
+
+// The depth of a sphere's tessellation is within the documented accuracy.
+TEST_F(RenderEngineRayCastTest, Sphere) {
+  RenderEngineRayCast engine;
+  const double radius = 0.5;
+  engine.RegisterVisual(object_id_, Sphere(radius),
+                        MakeProperties(kObjectLabel), RigidTransformd{});
+  engine.UpdateViewpoint(CameraPose(kCameraHeight));
+  Render(engine);
+  EXPECT_NEAR(depth_.at(kWidth / 2, kHeight / 2)[0], kCameraHeight - radius,
+              0.01 * radius);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kObjectLabel);
+  EXPECT_EQ(label_.at(0, 0)[0], RenderLabel::kEmpty);
+}
+
+// The box is also rendered as an .obj file (spanning [-1, 1]³).
+TEST_F(RenderEngineRayCastTest, MeshFile) {
+  RenderEngineRayCast engine;
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/render/test/meshes/box.obj");
+  EXPECT_TRUE(engine.RegisterVisual(object_id_, Mesh(filename, 0.25),
+                                    MakeProperties(kObjectLabel),
+                                    RigidTransformd{}));
+  const GeometryId convex_id = GeometryId::get_new_id();
+  EXPECT_TRUE(engine.RegisterVisual(convex_id, Convex(filename, 0.25),
+                                    MakeProperties(kObjectLabel),
+                                    RigidTransformd(Vector3d(0, 0, -1))));
+  engine.UpdateViewpoint(CameraPose(kCameraHeight));
+  Render(engine);
+  EXPECT_NEAR(depth_.at(kWidth / 2, kHeight / 2)[0], kCameraHeight - 0.25,
+              1e-6);
+
+  // Unsupported mesh types are ignored.
+  EXPECT_FALSE(engine.RegisterVisual(
+      GeometryId::get_new_id(),
+      Mesh(FindResourceOrThrow("drake/geometry/render/test/meshes/cube.gltf")),
+      MakeProperties(kObjectLabel), RigidTransformd{}));
+}
+
+TEST_F(RenderEngineRayCastTest, DepthRange) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+
+  // The box is closer than the minimum depth.
+  const DepthRenderCamera too_close(core_, DepthRange(2.75, 5));
+  engine.RenderDepthImage(too_close, &depth_);
+  EXPECT_EQ(depth_.at(kWidth / 2, kHeight / 2)[0], kTooClose);
+  EXPECT_NEAR(depth_.at(0, 0)[0], kCameraHeight, 1e-6);
+
+  // The ground is farther than the maximum depth.
+  const DepthRenderCamera too_far(core_, DepthRange(0.1, 2.75));
+  engine.RenderDepthImage(too_far, &depth_);
+  EXPECT_NEAR(depth_.at(kWidth / 2, kHeight / 2)[0], kCameraHeight - 0.5,
+              1e-6);
+  EXPECT_EQ(depth_.at(0, 0)[0], kTooFar);
+}
+
+// Surfaces outside of the clipping range are not rendered; the near plane
+// clips the top of the box, revealing the ground through it.
+TEST_F(RenderEngineRayCastTest, Clipping) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  const RenderCameraCore clipped_core(core_.renderer_name(),
+                                      core_.intrinsics(),
+                                      ClippingRange(2.75, 10),
+                                      RigidTransformd{});
+  engine.RenderLabelImage(ColorRenderCamera(clipped_core, false), &label_);
+  engine.RenderDepthImage(DepthRenderCamera(clipped_core, DepthRange(2.8, 5)),
+                          &depth_);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kGroundLabel);
+  EXPECT_NEAR(depth_.at(kWidth / 2, kHeight / 2)[0], kCameraHeight, 1e-6);
+
+  const RenderCameraCore short_core(core_.renderer_name(), core_.intrinsics(),
+                                    ClippingRange(0.1, 2.9),
+                                    RigidTransformd{});
+  engine.RenderLabelImage(ColorRenderCamera(short_core, false), &label_);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kObjectLabel);
+  EXPECT_EQ(label_.at(0, 0)[0], RenderLabel::kEmpty);
+}
+
+TEST_F(RenderEngineRayCastTest, UpdatePosesAndRemove) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+
+  // Raise the box by 1 m.
+  const std::unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {object_id_, RigidTransformd(Vector3d(0, 0, 1))}};
+  engine.UpdatePoses(X_WGs);
+  Render(engine);
+  ExpectObjectAndGround(kCameraHeight - 1.5);
+
+  EXPECT_TRUE(engine.RemoveGeometry(object_id_));
+  EXPECT_FALSE(engine.has_geometry(object_id_));
+  Render(engine);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kGroundLabel);
+}
+
+TEST_F(RenderEngineRayCastTest, Clone) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  std::unique_ptr<RenderEngine> clone = engine.Clone();
+  EXPECT_NE(dynamic_cast<RenderEngineRayCast*>(clone.get()), nullptr);
+  EXPECT_TRUE(clone->has_geometry(ground_id_));
+  EXPECT_TRUE(clone->has_geometry(object_id_));
+  Render(*clone);
+  ExpectObjectAndGround(kCameraHeight - 0.5);
+
+  // The clone's poses are independent of the original's.
+  clone->UpdatePoses(std::unordered_map<GeometryId, RigidTransformd>{
+      {object_id_, RigidTransformd(Vector3d(0, 0, 1))}});
+  Render(engine);
+  ExpectObjectAndGround(kCameraHeight - 0.5);
+}
+
+// Rendering on multiple threads produces the same images as rendering on one.
+TEST_F(RenderEngineRayCastTest, NumThreads) {
+  RenderEngineRayCast serial({.num_threads = 1});
+  PopulateScene(&serial);
+  Render(serial);
+  const ImageDepth32F expected_depth = depth_;
+  const ImageLabel16I expected_label = label_;
+
+  RenderEngineRayCast parallel({.num_threads = 4});
+  PopulateScene(&parallel);
+  Render(parallel);
+  EXPECT_EQ(depth_, expected_depth);
+  EXPECT_EQ(label_, expected_label);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineRayCast({.num_threads = 0}),
+                              ".*num_threads.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineRayCast({.relative_resolution_hint = 0}),
+      ".*relative_resolution_hint.*");
+}
+
+// A batch renders each request from its own viewpoint, and leaves the engine
+// at the viewpoint of the last one.
+TEST_F(RenderEngineRayCastTest, RenderImages) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  ImageDepth32F depth(kWidth, kHeight);
+  engine.RenderImages(
+      {render::LabelImageRequest{color_camera_, CameraPose(2.0), &label_},
+       render::DepthImageRequest{depth_camera_, CameraPose(4.0), &depth}});
+  EXPECT_NEAR(depth.at(kWidth / 2, kHeight / 2)[0], 3.5, 1e-6);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], kObjectLabel);
+  engine.RenderDepthImage(depth_camera_, &depth_);
+  EXPECT_EQ(depth_, depth);
+
+  ImageRgba8U color(kWidth, kHeight);
+  EXPECT_THROW(engine.RenderImages({render::ColorImageRequest{
+                   color_camera_, CameraPose(2.0), &color}}),
+               std::exception);
+}
+
+// Threads that render batches concurrently each use their requests' own
+// viewpoints.
+TEST_F(RenderEngineRayCastTest, ConcurrentRendering) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  ASSERT_TRUE(engine.SupportsConcurrentRendering());
+
+  // Renders the depth at the center pixel from two poses in one batch.
+  auto render_from = [&](double camera_height) {
+    ImageDepth32F near_depth(kWidth, kHeight);
+    ImageDepth32F far_depth(kWidth, kHeight);
+    for (int i = 0; i < 10; ++i) {
+      engine.RenderImages({render::DepthImageRequest{depth_camera_,
+                                                     CameraPose(camera_height),
+                                                     &near_depth},
+                           render::DepthImageRequest{
+                               depth_camera_, CameraPose(camera_height + 0.25),
+                               &far_depth}});
+    }
+    return std::pair{near_depth.at(kWidth / 2, kHeight / 2)[0],
+                     far_depth.at(kWidth / 2, kHeight / 2)[0]};
+  };
+  std::vector<std::future<std::pair<float, float>>> futures;
+  for (int t = 0; t < 4; ++t) {
+    futures.push_back(std::async(std::launch::async, render_from, 2.0 + t));
+  }
+  for (int t = 0; t < 4; ++t) {
+    const auto [near_depth, far_depth] = futures[t].get();
+    EXPECT_NEAR(near_depth, 2.0 + t - 0.5, 1e-6);
+    EXPECT_NEAR(far_depth, 2.25 + t - 0.5, 1e-6);
+  }
+}
+
+TEST_F(RenderEngineRayCastTest, NoColorImages) {
+  RenderEngineRayCast engine;
+  PopulateScene(&engine);
+  ImageRgba8U color(kWidth, kHeight);
+  EXPECT_THROW(engine.RenderColorImage(color_camera_, &color), std::exception);
+}
+
+TEST_F(RenderEngineRayCastTest, DefaultLabel) {
+  RenderEngineRayCast engine;
+  EXPECT_EQ(engine.default_render_label(), RenderLabel::kDontCare);
+  engine.RegisterVisual(object_id_, Box(1, 1, 1), PerceptionProperties(),
+                        RigidTransformd{});
+  engine.UpdateViewpoint(CameraPose(kCameraHeight));
+  Render(engine);
+  EXPECT_EQ(label_.at(kWidth / 2, kHeight / 2)[0], RenderLabel::kDontCare);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_ray_cast
+}  // namespace geometry
+}  // namespace drake
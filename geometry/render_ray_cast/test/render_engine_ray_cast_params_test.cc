@@ -0,0 +1,31 @@
+#include "drake/geometry/render_ray_cast/render_engine_ray_cast_params.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/yaml/yaml_io.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+// Test serialization/deserialization of the configuration.
+GTEST_TEST(RenderEngineRayCastParams, Serialization) {
+  using Params = RenderEngineRayCastParams;
+  const Params original{.num_threads = 3, .relative_resolution_hint = 0.125};
+  const std::string yaml = yaml::SaveYamlString<Params>(original);
+  const Params dut = yaml::LoadYamlString<Params>(yaml);
+  EXPECT_EQ(dut.num_threads, original.num_threads);
+  EXPECT_EQ(dut.relative_resolution_hint, original.relative_resolution_hint);
+}
+
+// The number of threads is optional.
+GTEST_TEST(RenderEngineRayCastParams, DefaultNumThreads) {
+  using Params = RenderEngineRayCastParams;
+  const Params dut = yaml::LoadYamlString<Params>("{}");
+  EXPECT_FALSE(dut.num_threads.has_value());
+  EXPECT_EQ(dut.relative_resolution_hint, Params{}.relative_resolution_hint);
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -4,9 +4,11 @@
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <utility>
+#include <variant>
 
 // To ease build system upkeep, we annotate VTK includes with their deps.
 #include <vtkActor.h>                    // vtkRenderingCore
@@ -18,6 +20,7 @@
 #include <vtkImageFlip.h>                // vtkImagingCore
 #include <vtkImageReader2.h>             // vtkIOImage
 #include <vtkImageReader2Factory.h>      // vtkIOImage
+#include <vtkMapper.h>                   // vtkRenderingCore
 #include <vtkOpenGLPolyDataMapper.h>     // vtkRenderingOpenGL2
 #include <vtkOpenGLRenderer.h>           // vtkRenderingOpenGL2
 #include <vtkOpenGLShaderProperty.h>     // vtkRenderingOpenGL2
@@ -32,6 +35,8 @@
 #include <vtkTransformPolyDataFilter.h>  // vtkFiltersGeneral
 
 #include "drake/common/diagnostic_policy.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/overloaded.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/render/render_mesh.h"
 #include "drake/geometry/render/shaders/depth_shaders.h"
@@ -61,6 +66,7 @@ using render::LightParameter;
 using render::RenderCameraCore;
 using render::RenderEngine;
 using render::RenderLabel;
+using render::RenderStatistics;
 using std::make_unique;
 using systems::sensors::CameraInfo;
 using systems::sensors::ColorD;
@@ -157,8 +163,6 @@ ShaderCallback::ShaderCallback()
       z_near_(0.01),
       z_far_(100.0) {}
 
-vtkNew<ShaderCallback> RenderEngineVtk::uniform_setting_callback_;
-
 RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
     : RenderEngine(RenderLabel::kDontCare),
       parameters_(parameters),
@@ -184,8 +188,14 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
 }
 
 void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
-  vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
+  std::lock_guard<std::mutex> lock(render_mutex_);
+  X_WC_ = X_WC;
 
+  // If another thread is rendering with our own pipelines, it is responsible
+  // for their cameras; the viewpoint recorded above is applied when the
+  // pipelines are next leased.
+  if (pipelines_in_use_) return;
+  vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
   for (const auto& pipeline : pipelines_) {
     auto camera = pipeline->renderer->GetActiveCamera();
     SetModelTransformMatrixToVtkCamera(camera, vtk_X_WC);
@@ -248,6 +258,9 @@ void RenderEngineVtk::ImplementGeometry(const Sphere& sphere, void* user_data) {
 bool RenderEngineVtk::DoRegisterVisual(GeometryId id, const Shape& shape,
                                        const PerceptionProperties& properties,
                                        const RigidTransformd& X_WG) {
+  // The auxiliary pipelines would no longer mirror props_; they get recreated
+  // on demand.
+  auxiliary_pipelines_.clear();
   // Note: the user_data interface on reification requires a non-const pointer.
   RegistrationData data{properties, X_WG, id};
   shape.Reify(this, &data);
@@ -259,20 +272,26 @@ void RenderEngineVtk::DoUpdateVisualPose(GeometryId id,
   vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(X_WG);
   // TODO(SeanCurtis-TRI): Perhaps provide the ability to specify which pipeline
   //  is being updated and only update the pose of the prop for that pipeline.
-  for (const auto& prop : props_.at(id)) {
-    for (const auto& part : prop.parts) {
-      if (part.T_GA != nullptr) {
-        // The goal is to update the actor's pose without allocating new
-        // transforms or matrices. Using part.actor->GetUserMatrix() as the
-        // result of the matrix product is unreliable. Instead, write to the
-        // matrix from the user transform.
-        vtkMatrix4x4* T_WA = part.actor->GetUserTransform()->GetMatrix();
-        vtkMatrix4x4::Multiply4x4(vtk_X_WG->GetMatrix(), part.T_GA, T_WA);
-        part.actor->Modified();
-      } else {
-        part.actor->SetUserTransform(vtk_X_WG);
+  auto update_props = [&vtk_X_WG](const PropArray& props) {
+    for (const auto& prop : props) {
+      for (const auto& part : prop.parts) {
+        if (part.T_GA != nullptr) {
+          // The goal is to update the actor's pose without allocating new
+          // transforms or matrices. Using part.actor->GetUserMatrix() as the
+          // result of the matrix product is unreliable. Instead, write to the
+          // matrix from the user transform.
+          vtkMatrix4x4* T_WA = part.actor->GetUserTransform()->GetMatrix();
+          vtkMatrix4x4::Multiply4x4(vtk_X_WG->GetMatrix(), part.T_GA, T_WA);
+          part.actor->Modified();
+        } else {
+          part.actor->SetUserTransform(vtk_X_WG);
+        }
       }
     }
+  };
+  update_props(props_.at(id));
+  for (const auto& auxiliary : auxiliary_pipelines_) {
+    update_props(auxiliary->props.at(id));
   }
 }
 
@@ -280,6 +299,7 @@ bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
   auto iter = props_.find(id);
 
   if (iter != props_.end()) {
+    auxiliary_pipelines_.clear();
     PropArray& pipe_props = iter->second;
     for (int i = 0; i < kNumPipelines; ++i) {
       for (const auto& part : pipe_props[i].parts) {
@@ -299,19 +319,89 @@ std::unique_ptr<RenderEngine> RenderEngineVtk::DoClone() const {
 
 void RenderEngineVtk::DoRenderColorImage(const ColorRenderCamera& camera,
                                          ImageRgba8U* color_image_out) const {
-  UpdateWindow(camera.core(), camera.show_window(),
-               *pipelines_[ImageType::kColor], "Color Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kColor]);
+  const PipelineLease lease(*this);
+  RenderColorImage(lease, camera, color_image_out);
+}
+
+void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera,
+                                         ImageDepth32F* depth_image_out) const {
+  const PipelineLease lease(*this);
+  RenderDepthImage(lease, camera, depth_image_out);
+}
+
+void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera,
+                                         ImageLabel16I* label_image_out) const {
+  const PipelineLease lease(*this);
+  RenderLabelImage(lease, camera, label_image_out);
+}
+
+void RenderEngineVtk::DoRenderImages(
+    const std::vector<render::ImageRequest>& requests) {
+  if (requests.empty()) return;
+  // Leasing the pipelines (and making their windows' contexts current) is done
+  // once for the whole batch; only the cameras are moved between viewpoints.
+  // VTK's renderer already culls the props outside of each camera's view.
+  // The leased cameras are posed from the requests alone, so concurrent calls
+  // don't depend on each other's viewpoints.
+  const RigidTransformd* X_WC_current = nullptr;
+  {
+    const PipelineLease lease(*this);
+    for (const render::ImageRequest& request : requests) {
+      const RigidTransformd& X_WC = std::visit(
+          [](const auto& r) -> const RigidTransformd& {
+            return r.X_WC;
+          },
+          request);
+      if (X_WC_current == nullptr || !X_WC.IsExactlyEqualTo(*X_WC_current)) {
+        lease.SetViewpoint(X_WC);
+        X_WC_current = &X_WC;
+      }
+      std::visit(
+          overloaded{[&](const render::ColorImageRequest& color) {
+                       RenderColorImage(lease, color.camera, color.image);
+                     },
+                     [&](const render::DepthImageRequest& depth) {
+                       RenderDepthImage(lease, depth.camera, depth.image);
+                     },
+                     [&](const render::LabelImageRequest& label) {
+                       RenderLabelImage(lease, label.camera, label.image);
+                     }},
+          request);
+    }
+  }
+  // As documented by RenderImages(), the engine is left at the viewpoint of
+  // the last request.
+  UpdateViewpoint(*X_WC_current);
+}
+
+void RenderEngineVtk::RenderColorImage(const PipelineLease& lease,
+                                       const ColorRenderCamera& camera,
+                                       ImageRgba8U* color_image_out) const {
+  const RenderingPipeline& pipeline = lease.pipeline(ImageType::kColor);
+  UpdateWindow(camera.core(), camera.show_window(), pipeline, "Color Image");
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineVtk/render");
+    PerformVtkUpdate(pipeline);
+  }
 
   // TODO(SeanCurtis-TRI): Determine if this copies memory (and find some way
   // around copying).
-  pipelines_[ImageType::kColor]->exporter->Export(color_image_out->at(0, 0));
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineVtk/readback");
+  pipeline.exporter->Export(color_image_out->mutable_data());
 }
 
-void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera,
-                                         ImageDepth32F* depth_image_out) const {
-  UpdateWindow(camera, *pipelines_[ImageType::kDepth]);
-  PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
+void RenderEngineVtk::RenderDepthImage(const PipelineLease& lease,
+                                       const DepthRenderCamera& camera,
+                                       ImageDepth32F* depth_image_out) const {
+  const RenderingPipeline& pipeline = lease.pipeline(ImageType::kDepth);
+  UpdateWindow(camera, pipeline, lease.uniform_setting_callback());
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineVtk/render");
+    PerformVtkUpdate(pipeline);
+  }
 
   const CameraInfo& intrinsics = camera.core().intrinsics();
   ImageRgba8U image(intrinsics.width(), intrinsics.height());
@@ -321,8 +411,14 @@ void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera,
   // pixels in a single pass.  The solution is to simply call
   // exporter->GetPointerToData() and process the pixels as they are read.
   // See the implementation in vtkImageExport::Export() for details.
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineVtk/readback");
+    pipeline.exporter->Export(image.mutable_data());
+  }
 
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineVtk/convert");
   const double min_depth = camera.depth_range().min_depth();
   const double max_depth = camera.depth_range().max_depth();
   for (int v = 0; v < intrinsics.height(); ++v) {
@@ -347,11 +443,16 @@ void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera,
   }
 }
 
-void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera,
-                                         ImageLabel16I* label_image_out) const {
-  UpdateWindow(camera.core(), camera.show_window(),
-               *pipelines_[ImageType::kLabel], "Label Image");
-  PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
+void RenderEngineVtk::RenderLabelImage(const PipelineLease& lease,
+                                       const ColorRenderCamera& camera,
+                                       ImageLabel16I* label_image_out) const {
+  const RenderingPipeline& pipeline = lease.pipeline(ImageType::kLabel);
+  UpdateWindow(camera.core(), camera.show_window(), pipeline, "Label Image");
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineVtk/render");
+    PerformVtkUpdate(pipeline);
+  }
 
   // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
   // would be much better to process the pixels directly. The solution is to
@@ -359,8 +460,14 @@ void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera,
   // See the implementation in vtkImageExport::Export() for details.
   const CameraInfo& intrinsics = camera.core().intrinsics();
   ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+  {
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "RenderEngineVtk/readback");
+    pipeline.exporter->Export(image.mutable_data());
+  }
 
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RenderEngineVtk/convert");
   ColorI color;
   for (int v = 0; v < intrinsics.height(); ++v) {
     for (int u = 0; u < intrinsics.width(); ++u) {
@@ -380,21 +487,20 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
                   make_unique<RenderingPipeline>()}},
       default_diffuse_{other.default_diffuse_},
       default_clear_color_{other.default_clear_color_},
-      fallback_lights_(other.fallback_lights_) {
+      fallback_lights_(other.fallback_lights_),
+      X_WC_(other.X_WC_) {
   InitializePipelines();
 
   for (const auto& [id, source_props] : other.props_) {
     PropArray target_props;
     for (int i = 0; i < kNumPipelines; ++i) {
       auto& renderer = *pipelines_.at(i)->renderer;
-      const Prop& source_prop = source_props[i];
-      Prop& target_prop = target_props[i];
-      for (const auto& source_part : source_prop.parts) {
-        vtkNew<vtkActor> target_actor;
-        target_actor->ShallowCopy(source_part.actor);
-        renderer.AddActor(target_actor);
-        target_prop.parts.push_back(
-            Part{.actor = std::move(target_actor), .T_GA = source_part.T_GA});
+      ShaderCallback* callback =
+          i == ImageType::kDepth ? uniform_setting_callback_.Get() : nullptr;
+      for (const auto& source_part : source_props[i].parts) {
+        Part target_part = CopyPart(source_part, callback);
+        renderer.AddActor(target_part.actor);
+        target_props[i].parts.push_back(std::move(target_part));
       }
     }
     props_.insert({id, std::move(target_props)});
@@ -621,11 +727,28 @@ vtkSmartPointer<vtkLight> MakeVtkLight(const LightParameter& light_param) {
 }  // namespace
 
 void RenderEngineVtk::InitializePipelines() {
+  ConfigurePipelines(&pipelines_);
+  if (parameters_.environment_map.has_value()) {
+    // Until we have a CubeMap, the zero-index represents the default value of
+    // "no texture specified". So, ConfigurePipelines() ignored it.
+    if (parameters_.environment_map->texture.index() == 0) {
+      log()->warn(
+          "RenderEngineVtk has been configured to use an environment map, but "
+          "no equirectangular texture has been provided.");
+      return;
+    }
+    // Setting an environment map should require all materials to be PBR.
+    SetPbrMaterials();
+  }
+}
+
+void RenderEngineVtk::ConfigurePipelines(PipelineArray* pipelines) const {
+  DRAKE_DEMAND(pipelines != nullptr);
   const vtkSmartPointer<vtkTransform> vtk_identity =
       ConvertToVtkTransform(RigidTransformd::Identity());
 
   // Generic configuration of pipelines.
-  for (auto& pipeline : pipelines_) {
+  for (auto& pipeline : *pipelines) {
     // When VTK experiences a warning, send it to drake::log()->warn().
     // When VTK experiences an error, throw it as an exception.
     vtkNew<VtkDiagnosticEventObserver> observer;
@@ -677,15 +800,15 @@ void RenderEngineVtk::InitializePipelines() {
 
   // Depth image background color is white -- the representation of the maximum
   // distance (e.g., infinity).
-  pipelines_[ImageType::kDepth]->renderer->SetBackground(1., 1., 1.);
+  (*pipelines)[ImageType::kDepth]->renderer->SetBackground(1., 1., 1.);
 
   const ColorD empty_color =
       RenderEngine::GetColorDFromLabel(RenderLabel::kEmpty);
-  pipelines_[ImageType::kLabel]->renderer->SetBackground(
+  (*pipelines)[ImageType::kLabel]->renderer->SetBackground(
       empty_color.r, empty_color.g, empty_color.b);
 
-  vtkOpenGLRenderer* renderer =
-      vtkOpenGLRenderer::SafeDownCast(pipelines_[ImageType::kColor]->renderer);
+  vtkOpenGLRenderer* renderer = vtkOpenGLRenderer::SafeDownCast(
+      (*pipelines)[ImageType::kColor]->renderer);
   renderer->SetUseDepthPeeling(1);
   renderer->UseFXAAOn();
   renderer->SetBackground(default_clear_color_.r, default_clear_color_.g,
@@ -697,15 +820,8 @@ void RenderEngineVtk::InitializePipelines() {
   for (const auto& light_param : active_lights()) {
     renderer->AddLight(MakeVtkLight(light_param));
   }
-  if (parameters_.environment_map.has_value()) {
-    // Until we have a CubeMap, the zero-index represents the default value of
-    // "no texture specified". So, we'll simply return.
-    if (parameters_.environment_map->texture.index() == 0) {
-      log()->warn(
-          "RenderEngineVtk has been configured to use an environment map, but "
-          "no equirectangular texture has been provided.");
-      return;
-    }
+  if (parameters_.environment_map.has_value() &&
+      parameters_.environment_map->texture.index() != 0) {
     const std::string& path =
         std::get<EquirectangularMap>(parameters_.environment_map->texture).path;
     EnvironmentTexture env_map = ReadEquirectangularFile(path);
@@ -727,8 +843,6 @@ void RenderEngineVtk::InitializePipelines() {
       skybox->SetGammaCorrect(!env_map.is_hdr);
       renderer->AddActor(skybox);
     }
-    // Setting an environment map should require all materials to be PBR.
-    SetPbrMaterials();
   }
 }
 
@@ -754,6 +868,9 @@ void RenderEngineVtk::ImplementPolyData(vtkPolyDataAlgorithm* source,
   for (auto& mapper : mappers) {
     mapper->SetInputConnection(source->GetOutputPort());
   }
+  // Copies of the actors (see CopyPart()) share the source's output rather
+  // than executing the source themselves; make sure that output exists.
+  source->Update();
 
   vtkSmartPointer<vtkTransform> vtk_X_WG = ConvertToVtkTransform(data.X_WG);
 
@@ -880,7 +997,14 @@ void RenderEngineVtk::SetPbrMaterials() {
   }
 }
 void RenderEngineVtk::PerformVtkUpdate(const RenderingPipeline& p) {
-  p.window->Render();
+  if (p.has_rendered) {
+    p.window->Render();
+  } else {
+    static never_destroyed<std::mutex> first_render_mutex;
+    std::lock_guard<std::mutex> lock(first_render_mutex.access());
+    p.window->Render();
+    p.has_rendered = true;
+  }
   p.filter->Modified();
   p.filter->Update();
 }
@@ -912,15 +1036,198 @@ void RenderEngineVtk::UpdateWindow(const RenderCameraCore& camera,
 
 void RenderEngineVtk::UpdateWindow(const DepthRenderCamera& camera,
                                    const RenderingPipeline& p) const {
-  uniform_setting_callback_->set_z_near(
+  UpdateWindow(camera, p, uniform_setting_callback_.Get());
+}
+
+void RenderEngineVtk::UpdateWindow(
+    const DepthRenderCamera& camera, const RenderingPipeline& p,
+    ShaderCallback* uniform_setting_callback) const {
+  uniform_setting_callback->set_z_near(
       static_cast<float>(camera.depth_range().min_depth()));
-  uniform_setting_callback_->set_z_far(
+  uniform_setting_callback->set_z_far(
       static_cast<float>(camera.depth_range().max_depth()));
   // Never show window for depth camera; it is a meaningless operation as the
   // raw depth rasterization is not human consummable.
   UpdateWindow(camera.core(), false, p, "");
 }
 
+RenderEngineVtk::PipelineLease::PipelineLease(const RenderEngineVtk& engine)
+    : engine_(engine) {
+  RigidTransformd X_WC;
+  bool need_auxiliary = false;
+  {
+    std::lock_guard<std::mutex> lock(engine_.render_mutex_);
+    X_WC = engine_.X_WC_;
+    if (!engine_.pipelines_in_use_) {
+      engine_.pipelines_in_use_ = true;
+    } else {
+      need_auxiliary = true;
+      for (const auto& auxiliary : engine_.auxiliary_pipelines_) {
+        if (!auxiliary->in_use) {
+          auxiliary->in_use = true;
+          auxiliary_ = auxiliary.get();
+          need_auxiliary = false;
+          break;
+        }
+      }
+    }
+  }
+  if (need_auxiliary) {
+    // Building the pipelines can be slow; we don't hold the lock meanwhile.
+    std::unique_ptr<AuxiliaryPipelines> auxiliary =
+        engine_.MakeAuxiliaryPipelines();
+    auxiliary->in_use = true;
+    auxiliary_ = auxiliary.get();
+    std::lock_guard<std::mutex> lock(engine_.render_mutex_);
+    engine_.auxiliary_pipelines_.push_back(std::move(auxiliary));
+  }
+
+  SetViewpoint(X_WC);
+}
+
+RenderEngineVtk::PipelineLease::~PipelineLease() {
+  // The next lessee may be on another thread; it can only make the windows'
+  // OpenGL contexts current if this thread has released them.
+  for (const auto& p : pipelines()) {
+    if (p->has_rendered) p->window->ReleaseCurrent();
+  }
+  std::lock_guard<std::mutex> lock(engine_.render_mutex_);
+  if (auxiliary_ == nullptr) {
+    engine_.pipelines_in_use_ = false;
+  } else {
+    auxiliary_->in_use = false;
+  }
+}
+
+void RenderEngineVtk::PipelineLease::SetViewpoint(
+    const RigidTransformd& X_WC) const {
+  const vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
+  for (const auto& p : pipelines()) {
+    SetModelTransformMatrixToVtkCamera(p->renderer->GetActiveCamera(),
+                                       vtk_X_WC);
+  }
+}
+
+const RenderEngineVtk::PipelineArray&
+RenderEngineVtk::PipelineLease::pipelines() const {
+  return auxiliary_ == nullptr ? engine_.pipelines_ : auxiliary_->pipelines;
+}
+
+const RenderEngineVtk::RenderingPipeline&
+RenderEngineVtk::PipelineLease::pipeline(ImageType image_type) const {
+  return *pipelines()[image_type];
+}
+
+ShaderCallback* RenderEngineVtk::PipelineLease::uniform_setting_callback()
+    const {
+  return auxiliary_ == nullptr ? engine_.uniform_setting_callback_.Get()
+                               : auxiliary_->uniform_setting_callback.Get();
+}
+
+std::unique_ptr<RenderEngineVtk::AuxiliaryPipelines>
+RenderEngineVtk::MakeAuxiliaryPipelines() const {
+  auto result = std::make_unique<AuxiliaryPipelines>();
+  for (auto& pipeline : result->pipelines) {
+    pipeline = make_unique<RenderingPipeline>();
+  }
+  ConfigurePipelines(&result->pipelines);
+
+  for (const auto& [id, source_props] : props_) {
+    PropArray& target_props = result->props[id];
+    for (int i = 0; i < kNumPipelines; ++i) {
+      auto& renderer = *result->pipelines[i]->renderer;
+      ShaderCallback* callback = i == ImageType::kDepth
+                                     ? result->uniform_setting_callback.Get()
+                                     : nullptr;
+      for (const auto& source_part : source_props[i].parts) {
+        Part target_part = CopyPart(source_part, callback);
+        renderer.AddActor(target_part.actor);
+        target_props[i].parts.push_back(std::move(target_part));
+      }
+    }
+  }
+  return result;
+}
+
+namespace {
+
+// Creates a texture object that shares the given texture's image data and
+// settings (but none of its OpenGL resources).
+vtkSmartPointer<vtkTexture> CopyTexture(vtkTexture* source) {
+  auto texture = vtkSmartPointer<vtkTexture>::Take(source->NewInstance());
+  texture->SetInputDataObject(source->GetInputDataObject(0, 0));
+  texture->SetColorMode(source->GetColorMode());
+  texture->SetLookupTable(source->GetLookupTable());
+  texture->SetRepeat(source->GetRepeat());
+  texture->SetEdgeClamp(source->GetEdgeClamp());
+  texture->SetInterpolate(source->GetInterpolate());
+  texture->SetMipmap(source->GetMipmap());
+  texture->SetMaximumAnisotropicFiltering(
+      source->GetMaximumAnisotropicFiltering());
+  texture->SetQuality(source->GetQuality());
+  texture->SetBlendingMode(source->GetBlendingMode());
+  texture->SetPremultipliedAlpha(source->GetPremultipliedAlpha());
+  texture->SetCubeMap(source->GetCubeMap());
+  texture->SetUseSRGBColorSpace(source->GetUseSRGBColorSpace());
+  return texture;
+}
+
+}  // namespace
+
+RenderEngineVtk::Part RenderEngineVtk::CopyPart(
+    const Part& source, ShaderCallback* uniform_setting_callback) {
+  vtkActor* source_actor = source.actor;
+  vtkNew<vtkActor> actor;
+  actor->ShallowCopy(source_actor);
+  actor->SetShaderProperty(source_actor->GetShaderProperty());
+
+  // The pose. See DoUpdateVisualPose() for how each kind of part is posed.
+  if (source.T_GA != nullptr) {
+    vtkNew<vtkMatrix4x4> T_WA;
+    T_WA->DeepCopy(source_actor->GetUserMatrix());
+    actor->SetUserMatrix(T_WA);
+  } else if (source_actor->GetUserTransform() != nullptr) {
+    vtkNew<vtkTransform> X_WG;
+    X_WG->SetMatrix(source_actor->GetUserTransform()->GetMatrix());
+    actor->SetUserTransform(X_WG);
+  }
+
+  // The mapper reads the source mapper's input data directly; it never
+  // executes the upstream algorithm (which may be in use by the source).
+  vtkMapper* source_mapper = source_actor->GetMapper();
+  auto mapper = vtkSmartPointer<vtkMapper>::Take(source_mapper->NewInstance());
+  mapper->ShallowCopy(source_mapper);
+  mapper->SetInputDataObject(source_mapper->GetInputDataObject(0, 0));
+  if (uniform_setting_callback != nullptr) {
+    mapper->AddObserver(vtkCommand::UpdateShaderEvent,
+                        uniform_setting_callback);
+  }
+  actor->SetMapper(mapper);
+
+  // The material. A texture referenced by both the actor and its property
+  // (see SetPbrMaterials()) remains a single texture in the copy.
+  std::map<vtkTexture*, vtkSmartPointer<vtkTexture>> texture_copies;
+  auto copy_texture = [&texture_copies](vtkTexture* texture) {
+    auto& copy = texture_copies[texture];
+    if (copy == nullptr) copy = CopyTexture(texture);
+    return copy.Get();
+  };
+  vtkProperty* source_property = source_actor->GetProperty();
+  auto property =
+      vtkSmartPointer<vtkProperty>::Take(source_property->NewInstance());
+  property->DeepCopy(source_property);
+  property->RemoveAllTextures();
+  for (const auto& [name, texture] : source_property->GetAllTextures()) {
+    property->SetTexture(name.c_str(), copy_texture(texture));
+  }
+  actor->SetProperty(property);
+  if (source_actor->GetTexture() != nullptr) {
+    actor->SetTexture(copy_texture(source_actor->GetTexture()));
+  }
+
+  return Part{.actor = std::move(actor), .T_GA = source.T_GA};
+}
+
 }  // namespace internal
 }  // namespace render_vtk
 }  // namespace geometry
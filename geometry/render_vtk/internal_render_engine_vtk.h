@@ -2,6 +2,7 @@
 
 #include <array>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -86,7 +87,27 @@ enum ImageType {
   kDepth = 2,
 };
 
-/* See documentation of MakeRenderEngineVtk().  */
+/* See documentation of MakeRenderEngineVtk().
+
+ <h2>Concurrency</h2>
+
+ This engine supports concurrent rendering (see
+ RenderEngine::SupportsConcurrentRendering()). A VTK render window (and its
+ OpenGL context) can only be used by one thread at a time, so each render call
+ leases a complete set of rendering pipelines for its duration. The engine's
+ own pipelines are used whenever they are free; if another thread holds them,
+ an auxiliary set is created on demand (and then retained for reuse). The
+ auxiliary pipelines have their own actors, mappers, and textures -- the
+ objects that own OpenGL resources -- but share the scene assets (the polygon
+ and texture image data) and geometry poses with the engine's own pipelines.
+ Registering or removing geometry discards the auxiliary pipelines.
+
+ Only RenderImages() may be called concurrently: each of its requests carries
+ its own viewpoint, with which the leased pipelines are posed. The single-image
+ Render*Image() methods render from the one viewpoint set by UpdateViewpoint().
+
+ Clones of this engine likewise share scene assets, but not OpenGL resources,
+ so distinct clones can also be rendered concurrently.  */
 class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
                                         private ModuleInitVtkRenderingOpenGL2 {
  public:
@@ -145,6 +166,9 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
     vtkNew<vtkRenderWindow> window;
     vtkNew<vtkWindowToImageFilter> filter;
     vtkNew<vtkImageExport> exporter;
+    // Whether the window has been rendered (and has, therefore, created its
+    // OpenGL context). See PerformVtkUpdate().
+    mutable bool has_rendered{false};
   };
 
   /* Configures the VTK model to reflect the given `camera`, this includes
@@ -158,9 +182,18 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
   void UpdateWindow(const render::DepthRenderCamera& camera,
                     const RenderingPipeline& p) const;
 
+  /* Variant of configuring the VTK model that configures the depth range via
+   the given shader callback (which must be the callback observed by the depth
+   mappers of the pipeline `p`). */
+  void UpdateWindow(const render::DepthRenderCamera& camera,
+                    const RenderingPipeline& p,
+                    ShaderCallback* uniform_setting_callback) const;
+
   /* Updates VTK rendering related objects including vtkRenderWindow,
    vtkWindowToImageFilter and vtkImageExporter, so that VTK reflects
-   vtkActors' pose update for rendering. */
+   vtkActors' pose update for rendering. The first render of a window creates
+   its OpenGL context; that step is serialized across all engines because
+   context creation touches process-wide state. */
   static void PerformVtkUpdate(const RenderingPipeline& p);
 
   /* Provides access to the private data member pipelines_ by returning a
@@ -192,6 +225,9 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
   // @see RenderEngine::DoClone().
   std::unique_ptr<RenderEngine> DoClone() const override;
 
+  // @see RenderEngine::DoSupportsConcurrentRendering().
+  bool DoSupportsConcurrentRendering() const override { return true; }
+
   // @see RenderEngine::DoRenderColorImage().
   void DoRenderColorImage(
       const render::ColorRenderCamera& camera,
@@ -207,6 +243,11 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages(). Renders the whole batch with a single
+  // lease of the pipelines.
+  void DoRenderImages(
+      const std::vector<render::ImageRequest>& requests) override;
+
   // Common interface for loading a mesh-type geometry (i.e., Mesh or Convex).
   // Examines the extension and delegates to the appropriate
   // ImplementExtension() variant to handle that file type, warning otherwise.
@@ -226,9 +267,21 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
  private:
   friend class RenderEngineVtkTester;
 
+  // Three pipelines: rgb, depth, and label.
+  static constexpr int kNumPipelines = 3;
+
+  using PipelineArray =
+      std::array<std::unique_ptr<RenderingPipeline>, kNumPipelines>;
+
   // Initializes the VTK pipelines.
   void InitializePipelines();
 
+  // Applies the engine's configuration (camera model, background colors,
+  // lights, environment map, etc.) to the given set of pipelines. This doesn't
+  // change any engine state; in particular, the caller is responsible for
+  // calling SetPbrMaterials() if an environment map is in use.
+  void ConfigurePipelines(PipelineArray* pipelines) const;
+
   // Performs the common setup for all shape types. Note, this can be called
   // multiple times for a single value of data.id. It will simply accumulate
   // multiple parts in the Prop associated with the geometry id.
@@ -275,12 +328,68 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
     std::vector<Part> parts;
   };
 
-  // Three pipelines: rgb, depth, and label.
-  static constexpr int kNumPipelines = 3;
-
   // Each geometry is represented by one "prop" per pipeline.
   using PropArray = std::array<Prop, kNumPipelines>;
 
+  // A set of pipelines used (in addition to the engine's own pipelines_) to
+  // render concurrently. Its actors mirror those in props_; see the class
+  // documentation.
+  struct AuxiliaryPipelines {
+    PipelineArray pipelines;
+    std::unordered_map<GeometryId, PropArray> props;
+    vtkNew<ShaderCallback> uniform_setting_callback;
+    bool in_use{false};
+  };
+
+  // Grants the calling thread exclusive use of one set of pipelines -- the
+  // engine's own or an auxiliary set -- for the lifetime of the lease, with
+  // the cameras posed at the viewpoint set by UpdateViewpoint().
+  class PipelineLease {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PipelineLease);
+
+    explicit PipelineLease(const RenderEngineVtk& engine);
+
+    ~PipelineLease();
+
+    // Poses the cameras of the leased pipelines at the given viewpoint.
+    void SetViewpoint(const math::RigidTransformd& X_WC) const;
+
+    const RenderingPipeline& pipeline(ImageType image_type) const;
+
+    ShaderCallback* uniform_setting_callback() const;
+
+   private:
+    const PipelineArray& pipelines() const;
+
+    const RenderEngineVtk& engine_;
+    // If null, the lease is for the engine's own pipelines.
+    AuxiliaryPipelines* auxiliary_{};
+  };
+
+  // The implementations of DoRender*Image() using the pipelines of the given
+  // `lease`.
+  void RenderColorImage(const PipelineLease& lease,
+                        const render::ColorRenderCamera& camera,
+                        systems::sensors::ImageRgba8U* color_image_out) const;
+  void RenderDepthImage(const PipelineLease& lease,
+                        const render::DepthRenderCamera& camera,
+                        systems::sensors::ImageDepth32F* depth_image_out) const;
+  void RenderLabelImage(const PipelineLease& lease,
+                        const render::ColorRenderCamera& camera,
+                        systems::sensors::ImageLabel16I* label_image_out) const;
+
+  // Creates a new auxiliary pipeline set, mirroring the current props_.
+  std::unique_ptr<AuxiliaryPipelines> MakeAuxiliaryPipelines() const;
+
+  // Creates a copy of the given `source` part for use in a different set of
+  // pipelines: the copy's actor has its own mapper, property, textures, and
+  // pose (the mapper and textures own the OpenGL resources) but shares the
+  // geometry and image data. If `uniform_setting_callback` is non-null, the
+  // copy's mapper observes it (for depth actors).
+  static Part CopyPart(const Part& source,
+                       ShaderCallback* uniform_setting_callback);
+
   // Handles the logic for using the lights defined in the construction
   // parameters vs the built-in fallback light. The implementation should only
   // access the lights via this method (and not via the parameters nor
@@ -300,23 +409,17 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
   // VTK error and/or warning messages end up here.
   drake::internal::DiagnosticPolicy diagnostic_;
 
-  std::array<std::unique_ptr<RenderingPipeline>, kNumPipelines> pipelines_;
-
-  // By design, all of the geometry is shared across clones of the render
-  // engine. This is predicated upon the idea that the geometry is *not*
-  // deformable and does *not* depend on the system's pose information.
-  // (If there is deformable geometry, it will have to be handled differently.)
-  // Having "shared geometry" means having shared vtkPolyDataAlgorithm and
-  // vtkOpenGLPolyDataMapper instances. The shader callback gets registered to
-  // the *mapper* instances, so they all, implicitly, share the same callback.
-  // Making this member static facilitates that but it does preclude the
-  // possibility of simultaneous renderings with different uniform parameters.
-  // Currently, this doesn't happen because drake isn't particularly thread safe
-  // (or executed in such a context). However, this renderer will need some
-  // formal thread safe mechanism so that it doesn't rely on that in the future.
-  // TODO(SeanCurtis-TRI): This is not threadsafe; investigate mechanisms to
-  // prevent undesirable behaviors if used in multi-threaded application.
-  static vtkNew<ShaderCallback> uniform_setting_callback_;
+  PipelineArray pipelines_;
+
+  // By design, the geometry data is shared across clones of the render engine
+  // (and across its auxiliary pipelines). This is predicated upon the idea that
+  // the geometry is *not* deformable and does *not* depend on the system's
+  // pose information. (If there is deformable geometry, it will have to be
+  // handled differently.) The mappers, however, are not shared: each one owns
+  // OpenGL resources tied to a single render window. The depth mappers of the
+  // pipelines_ observe this callback to get their depth range; each auxiliary
+  // pipeline set has its own callback.
+  vtkNew<ShaderCallback> uniform_setting_callback_;
 
   // Obnoxious bright orange.
   Rgba default_diffuse_{0.9, 0.45, 0.1, 1.0};
@@ -341,6 +444,19 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
   // If false, the behavior is undefined -- the interpolation model is left to
   // VTK's default value.
   bool use_pbr_materials_{false};
+
+  // Guards the members below, which support concurrent rendering.
+  mutable std::mutex render_mutex_;
+
+  // Whether the engine's own pipelines_ are currently leased.
+  mutable bool pipelines_in_use_{false};
+
+  // The auxiliary pipeline sets created so far.
+  mutable std::vector<std::unique_ptr<AuxiliaryPipelines>>
+      auxiliary_pipelines_;
+
+  // The viewpoint most recently set by UpdateViewpoint().
+  math::RigidTransformd X_WC_;
 };
 
 }  // namespace internal
@@ -1,6 +1,7 @@
 #include "drake/geometry/render_vtk/internal_render_engine_vtk.h"
 
 #include <cstring>
+#include <future>
 #include <limits>
 #include <optional>
 #include <string>
@@ -1428,6 +1429,74 @@ TEST_F(RenderEngineVtkTest, CloneIndependence) {
                          "Clone independence");
 }
 
+// Tests that multiple threads can render batches from a single engine
+// concurrently, each from its own viewpoint, with the same results as serial
+// rendering.
+TEST_F(RenderEngineVtkTest, ConcurrentRendering) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+  ASSERT_TRUE(renderer_->SupportsConcurrentRendering());
+
+  // Odd-numbered threads view the scene from one meter higher up.
+  const RigidTransformd X_WC_high(X_WC_.rotation(),
+                                  X_WC_.translation() + Vector3d(0, 0, 1));
+  const DepthRenderCamera& camera = depth_camera_;
+  const ColorRenderCamera color_camera(camera.core(), FLAGS_show_window);
+  const int w = camera.core().intrinsics().width();
+  const int h = camera.core().intrinsics().height();
+  struct Images {
+    Images(int width, int height)
+        : color(width, height), depth(width, height), label(width, height) {}
+    ImageRgba8U color;
+    ImageDepth32F depth;
+    ImageLabel16I label;
+  };
+  const int kNumThreads = 4;
+  const int kNumRenders = 5;
+  std::vector<Images> images(kNumThreads, Images(w, h));
+  std::vector<std::future<void>> futures;
+  for (int t = 0; t < kNumThreads; ++t) {
+    futures.push_back(std::async(std::launch::async, [&, t]() {
+      const RigidTransformd& X_WC = t % 2 == 0 ? X_WC_ : X_WC_high;
+      const std::vector<render::ImageRequest> requests{
+          render::DepthImageRequest{camera, X_WC, &images[t].depth},
+          render::LabelImageRequest{color_camera, X_WC, &images[t].label},
+          render::ColorImageRequest{color_camera, X_WC, &images[t].color}};
+      for (int i = 0; i < kNumRenders; ++i) {
+        renderer_->RenderImages(requests);
+      }
+    }));
+  }
+  for (auto& future : futures) {
+    ASSERT_NO_THROW(future.get());
+  }
+
+  const ScreenCoord inlier = GetInlier(camera.core().intrinsics());
+  for (int t = 0; t < kNumThreads; t += 2) {
+    VerifyCenterShapeTest(*renderer_, "Concurrent rendering", camera,
+                          images[t].color, images[t].depth, images[t].label);
+  }
+  for (int t = 1; t < kNumThreads; t += 2) {
+    EXPECT_TRUE(IsExpectedDepth(images[t].depth, inlier,
+                                expected_object_depth_ + 1, kDepthTolerance));
+    EXPECT_EQ(images[t].label.at(inlier.x, inlier.y)[0],
+              static_cast<int>(expected_label_));
+  }
+
+  // Rendering serially afterwards (when some of the renders above may have
+  // used auxiliary pipelines) is unaffected.
+  renderer_->UpdateViewpoint(X_WC_);
+  PerformCenterShapeTest(renderer_.get(), "Serial after concurrent");
+
+  // So is rendering after changing the scene.
+  renderer_->UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+      {geometry_id_, RigidTransformd{Vector3d{0, 0, 10}}}});
+  expected_color_ = expected_outlier_color_;
+  expected_object_depth_ = expected_outlier_depth_;
+  expected_label_ = expected_outlier_label_;
+  PerformCenterShapeTest(renderer_.get(), "Sphere moved out of view");
+}
+
 // Confirm that the renderer can be used for cameras with different properties.
 // I.e., the camera intrinsics are defined *outside* the renderer.
 TEST_F(RenderEngineVtkTest, DifferentCameras) {
@@ -436,8 +436,8 @@ template <typename T>
 void SceneGraph<T>::SetDefaultParameters(const Context<T>& context,
                                          Parameters<T>* parameters) const {
   LeafSystem<T>::SetDefaultParameters(context, parameters);
-  parameters->template get_mutable_abstract_parameter<GeometryState<T>>(
-      geometry_state_index_) = model_;
+  parameters->get_mutable_abstract_parameters().set_value(
+      geometry_state_index_, model_);
 }
 
 template <typename T>
@@ -497,7 +497,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context, int*) const {
 
   using std::to_string;
 
-  const GeometryState<T>& state = geometry_state(context);
+  const GeometryState<T>& state = unshared_geometry_state(context);
   // See KinematicsData class documentation for why this caching violation is
   // needed and is correct.
   internal::KinematicsData<T>& kinematics_data =
@@ -534,7 +534,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context, int*) const {
 template <typename T>
 void SceneGraph<T>::CalcConfigurationUpdate(const Context<T>& context,
                                             int*) const {
-  const GeometryState<T>& state = geometry_state(context);
+  const GeometryState<T>& state = unshared_geometry_state(context);
   // See KinematicsData class documentation for why this caching violation is
   // needed and is correct.
   internal::KinematicsData<T>& kinematics_data =
@@ -595,6 +595,15 @@ const GeometryState<T>& SceneGraph<T>::geometry_state(
       .template get_abstract_parameter<GeometryState<T>>(geometry_state_index_);
 }
 
+template <typename T>
+const GeometryState<T>& SceneGraph<T>::unshared_geometry_state(
+    const Context<T>& context) const {
+  return context.get_parameters()
+      .get_abstract_parameters()
+      .get_unshared_value(geometry_state_index_)
+      .template get_value<GeometryState<T>>();
+}
+
 }  // namespace geometry
 }  // namespace drake
 
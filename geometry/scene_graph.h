@@ -1110,6 +1110,14 @@ class SceneGraph final : public systems::LeafSystem<T> {
   const GeometryState<T>& geometry_state(
       const systems::Context<T>& context) const;
 
+  // Extracts a reference to the underlying abstract geometry state from the
+  // given context, for the pose and configuration updates that modify its
+  // kinematics data and engines through const access. If the context shares
+  // the state with a copy-on-write clone, the context first gets its own copy
+  // so that the update can't affect the other context.
+  const GeometryState<T>& unshared_geometry_state(
+      const systems::Context<T>& context) const;
+
   // A struct that stores the port indices for a given source.
   // TODO(SeanCurtis-TRI): Consider making these TypeSafeIndex values.
   struct SourcePorts {
@@ -4642,6 +4642,35 @@ TEST_F(GeometryStateRenderTest, RenderLabelImage) {
                std::exception);
 }
 
+// RenderImages() renders each engine's share of the requests in one batch.
+TEST_F(GeometryStateRenderTest, RenderImages) {
+  const auto& engine2 = dynamic_cast<const DummyRenderEngine&>(
+      *geometry_state_.GetRenderEngineByName("engine2"));
+  systems::sensors::ImageRgba8U color1(width(), height());
+  systems::sensors::ImageRgba8U color2(width(), height());
+  systems::sensors::ImageDepth32F depth(width(), height());
+  systems::sensors::ImageLabel16I label(width(), height());
+  const RigidTransformd X_WS2(Vector3d(1, 0, 0));
+
+  geometry_state_.RenderImages(
+      {render::ColorImageRequest{color_camera("engine1"), X_WS_, &color1},
+       render::ColorImageRequest{color_camera("engine2"), X_WS_, &color2},
+       render::DepthImageRequest{depth_camera("engine1"), X_WS_, &depth},
+       render::LabelImageRequest{color_camera("engine1"), X_WS2, &label}});
+  EXPECT_EQ(engine1_->num_color_renders(), 1);
+  EXPECT_EQ(engine1_->num_depth_renders(), 1);
+  EXPECT_EQ(engine1_->num_label_renders(), 1);
+  // The color and depth images of engine1 share a viewpoint.
+  EXPECT_EQ(engine1_->num_viewpoint_updates(), 2);
+  EXPECT_TRUE(engine1_->last_updated_X_WC().IsExactlyEqualTo(X_WS2));
+  EXPECT_EQ(engine2.num_color_renders(), 1);
+  EXPECT_EQ(engine2.num_viewpoint_updates(), 1);
+
+  EXPECT_THROW(geometry_state_.RenderImages({render::ColorImageRequest{
+                   color_camera("not_an_engine"), X_WS_, &color1}}),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
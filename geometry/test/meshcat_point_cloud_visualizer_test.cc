@@ -1,7 +1,12 @@
 #include "drake/geometry/meshcat_point_cloud_visualizer.h"
 
+#include <map>
+#include <string>
+#include <string_view>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <msgpack.hpp>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/analysis/simulator.h"
@@ -109,6 +114,61 @@ TEST_F(MeshcatPointCloudVisualizerTest, VisualizationParameters) {
   visualizer_->set_default_rgba(Rgba(0, 0, 1, 1));
 }
 
+// Returns the number of points in the quantized cloud published at `path`.
+int GetNumQuantizedPoints(const Meshcat& meshcat, std::string_view path) {
+  const std::string packed = meshcat.GetPackedObject(path);
+  msgpack::object_handle oh = msgpack::unpack(packed.data(), packed.size());
+  const auto data = oh.get().as<std::map<std::string, msgpack::object>>();
+  EXPECT_EQ(data.at("type").as<std::string>(), "set_point_cloud");
+  return static_cast<int>(data.at("positions").via.bin.size /
+                          (3 * sizeof(uint16_t)));
+}
+
+TEST_F(MeshcatPointCloudVisualizerTest, LevelOfDetail) {
+  systems::DiagramBuilder<double> builder;
+  visualizer_ = builder.AddSystem<MeshcatPointCloudVisualizer>(meshcat_,
+                                                               "cloud");
+  diagram_ = builder.Build();
+  context_ = diagram_->CreateDefaultContext();
+
+  // A dense 50 x 50 grid of points. We use powers of two for the spacing and
+  // the voxel sizes, so that the points lie exactly on the voxel boundaries.
+  const double kSpacing = 1.0 / 1024;
+  visualizer_->set_lod_voxel_size(2 * kSpacing);
+  perception::PointCloud cloud(2500);
+  for (int i = 0; i < 2500; ++i) {
+    cloud.mutable_xyz(i) << kSpacing * (i % 50), kSpacing * (i / 50), 0;
+  }
+  auto& visualizer_context = visualizer_->GetMyMutableContextFromRoot(
+      context_.get());
+  visualizer_->cloud_input_port().FixValue(&visualizer_context, cloud);
+
+  // Without a limit, all of the points are sent.
+  diagram_->ForcedPublish(*context_);
+  EXPECT_EQ(GetNumQuantizedPoints(*meshcat_, "cloud"), 2500);
+
+  // The finest level of detail has 25 x 25 points.
+  visualizer_->set_max_points(1000);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_EQ(GetNumQuantizedPoints(*meshcat_, "cloud"), 625);
+
+  // The next level, with twice the voxel size, has 13 x 13 points.
+  visualizer_->set_max_points(600);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_EQ(GetNumQuantizedPoints(*meshcat_, "cloud"), 169);
+
+  // Without quantization, the cloud is sent using SetObject.
+  visualizer_->set_quantize(false);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_THAT(meshcat_->GetPackedObject("cloud"),
+              testing::HasSubstr("BufferGeometry"));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(visualizer_->set_max_points(0),
+                              ".*max_points > 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(visualizer_->set_lod_voxel_size(0),
+                              ".*voxel_size > 0.*");
+}
+
 TEST_F(MeshcatPointCloudVisualizerTest, ScalarConversion) {
   SetUpDiagram(false);
 
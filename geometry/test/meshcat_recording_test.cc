@@ -0,0 +1,279 @@
+#include "drake/geometry/meshcat_recording.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <msgpack.hpp>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/meshcat.h"
+#include "drake/geometry/meshcat_types_internal.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+std::filesystem::path TempFile(const std::string& name) {
+  return std::filesystem::path(temp_directory()) / name;
+}
+
+// The pose of a body that moves steadily along a line while it rotates.
+RigidTransformd PoseAt(double time) {
+  return RigidTransformd(RollPitchYawd(0.1 * time, 0.2, time),
+                         Vector3d(time, -2 * time, 0.5));
+}
+
+GTEST_TEST(MeshcatRecordingTest, RoundTrip) {
+  const auto filename = TempFile("round_trip.bin");
+  MeshcatRecordingParams params;
+  params.chunk_duration = 1.0;
+  // We use a time step that is exact in binary floating point, so that each
+  // keyframe falls on exactly one frame of the animations below.
+  const double kTimeStep = 1.0 / 64;
+  const int kNumSteps = 192;
+  {
+    MeshcatRecordingWriter writer(filename, params);
+    for (int i = 0; i <= kNumSteps; ++i) {
+      const double time = i * kTimeStep;
+      writer.SetTransform(time, "body", PoseAt(time));
+      writer.SetProperty(time, "body", "visible", i < 96);
+      writer.SetProperty(time, "body", "opacity", 0.001 * i);
+      writer.SetProperty(time, "body", "color", std::vector<double>{1, 0, 0});
+    }
+    // The transform and opacity change at every step, the visible flag only
+    // changes once, and the color never changes. In addition, each of the
+    // three chunks after the first starts with the values of all four tracks.
+    EXPECT_EQ(writer.num_keyframes_written(),
+              2 * (kNumSteps + 1) + 2 + 1 + 3 * 4);
+    writer.Close();
+    EXPECT_TRUE(writer.is_closed());
+    EXPECT_EQ(writer.num_chunks_written(), 4);
+  }
+
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.num_chunks(), 4);
+  EXPECT_EQ(reader.start_time(), 0.0);
+  EXPECT_EQ(reader.end_time(), 3.0);
+
+  // Check the values at every frame of the animation of the second half,
+  // including those decoded from many successive deltas.
+  auto animation = reader.ToAnimation(1.5, 3.0, 1 / kTimeStep);
+  EXPECT_EQ(animation->start_time(), 1.5);
+  for (int frame = 0; frame <= 96; ++frame) {
+    SCOPED_TRACE(fmt::format("frame {}", frame));
+    const int i = 96 + frame;
+    const auto position =
+        animation->get_key_frame<std::vector<double>>(frame, "body",
+                                                      "position");
+    ASSERT_TRUE(position.has_value());
+    EXPECT_TRUE(CompareMatrices(Eigen::Map<const Vector3d>(position->data()),
+                                PoseAt(i * kTimeStep).translation(), 1e-6));
+    const auto opacity =
+        animation->get_key_frame<double>(frame, "body", "opacity");
+    ASSERT_TRUE(opacity.has_value());
+    EXPECT_NEAR(*opacity, 0.001 * i, 1e-6);
+  }
+  // The first frame holds all of the values at the start time.
+  EXPECT_EQ(animation->get_key_frame<bool>(0, "body", "visible"), false);
+  EXPECT_EQ(animation->get_key_frame<std::vector<double>>(0, "body", "color"),
+            std::vector<double>({1, 0, 0}));
+  // The unchanged properties are not repeated.
+  EXPECT_FALSE(animation->get_key_frame<bool>(1, "body", "visible"));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(reader.ToAnimation(2.0, 1.0),
+                              ".*end time 1 precedes the start time 2.*");
+}
+
+GTEST_TEST(MeshcatRecordingTest, DeltaEncodingIsCompact) {
+  const auto filename = TempFile("compact.bin");
+  const int kNumBodies = 100;
+  const int kNumSteps = 100;
+  {
+    MeshcatRecordingWriter writer(filename);
+    for (int i = 0; i < kNumSteps; ++i) {
+      for (int b = 0; b < kNumBodies; ++b) {
+        writer.SetTransform(i * 0.01, fmt::format("body_{}", b),
+                            PoseAt(i * 0.01 + b));
+      }
+    }
+  }
+  // Each delta keyframe is 13 bytes of header and 7 floats, versus 7 doubles
+  // for an absolute keyframe.
+  const double bytes_per_keyframe =
+      static_cast<double>(std::filesystem::file_size(filename)) /
+      (kNumBodies * kNumSteps);
+  EXPECT_LT(bytes_per_keyframe, 13 + 7 * 4 + 1);
+}
+
+GTEST_TEST(MeshcatRecordingTest, DecimationAndTolerance) {
+  const auto filename = TempFile("decimated.bin");
+  const double kTimeStep = 1.0 / 64;
+  MeshcatRecordingParams params;
+  params.min_period = 8 * kTimeStep;
+  params.tolerance = 1e-3;
+  {
+    MeshcatRecordingWriter writer(filename, params);
+    for (int i = 0; i <= 60; ++i) {
+      const double time = i * kTimeStep;
+      writer.SetTransform(time, "moving", PoseAt(time));
+      // Changes within the tolerance are not written.
+      writer.SetTransform(time, "still",
+                          RigidTransformd(Vector3d(0, 0, 1e-5 * i)));
+    }
+    // The moving body is written every eighth step and the still body only
+    // once. The final pose of the moving body is written when the chunk is
+    // completed.
+    EXPECT_EQ(writer.num_keyframes_written(), 8 + 1);
+    writer.Flush();
+    EXPECT_EQ(writer.num_keyframes_written(), 8 + 1 + 1);
+  }
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.end_time(), 60 * kTimeStep);
+  auto animation = reader.ToAnimation(0.0, 1.0, 1 / kTimeStep);
+  EXPECT_TRUE(animation->get_key_frame<std::vector<double>>(8, "moving",
+                                                            "position"));
+  EXPECT_FALSE(animation->get_key_frame<std::vector<double>>(12, "moving",
+                                                             "position"));
+  const auto final_position =
+      animation->get_key_frame<std::vector<double>>(60, "moving", "position");
+  ASSERT_TRUE(final_position.has_value());
+  EXPECT_TRUE(
+      CompareMatrices(Eigen::Map<const Vector3d>(final_position->data()),
+                      PoseAt(60 * kTimeStep).translation(), 1e-6));
+}
+
+GTEST_TEST(MeshcatRecordingTest, Seek) {
+  const auto filename = TempFile("seek.bin");
+  const double kTimeStep = 1.0 / 64;
+  MeshcatRecordingParams params;
+  params.chunk_duration = 0.25;
+  {
+    MeshcatRecordingWriter writer(filename, params);
+    for (int i = 0; i <= 64; ++i) {
+      const double time = i * kTimeStep;
+      writer.SetTransform(time, "body", PoseAt(time));
+      writer.SetProperty(time, "body", "visible", i >= 32);
+    }
+  }
+
+  Meshcat meshcat;
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.num_chunks(), 5);
+  // The latest keyframe at or before 0.62 is that of step 39.
+  reader.Seek(0.62, &meshcat);
+  std::string transform = meshcat.GetPackedTransform("body");
+  msgpack::object_handle oh =
+      msgpack::unpack(transform.data(), transform.size());
+  auto data = oh.get().as<internal::SetTransformData>();
+  EXPECT_TRUE(CompareMatrices(Eigen::Map<Eigen::Matrix4d>(data.matrix),
+                              PoseAt(39 * kTimeStep).GetAsMatrix4(), 1e-6));
+  std::string property = meshcat.GetPackedProperty("body", "visible");
+  oh = msgpack::unpack(property.data(), property.size());
+  EXPECT_EQ(oh.get().as<internal::SetPropertyData<bool>>().value, true);
+}
+
+GTEST_TEST(MeshcatRecordingTest, MeshcatStartRecordingToFile) {
+  const auto filename = TempFile("meshcat.bin");
+  Meshcat meshcat;
+  meshcat.StartRecordingToFile(filename);
+  meshcat.SetTransforms({"a", "b"}, {PoseAt(0.0), PoseAt(1.0)}, 0.0, 0.0);
+  meshcat.SetTransform("a", PoseAt(0.5), 0.5);
+  meshcat.SetProperty("a", "visible", false, 0.5);
+  meshcat.StopRecording();
+
+  MeshcatRecordingReader reader(filename);
+  EXPECT_EQ(reader.end_time(), 0.5);
+  auto animation = reader.ToAnimation(0.0, 0.5, 2.0);
+  EXPECT_TRUE(animation->get_key_frame<std::vector<double>>(0, "b",
+                                                            "position"));
+  EXPECT_TRUE(animation->get_key_frame<std::vector<double>>(1, "a",
+                                                            "position"));
+  EXPECT_EQ(animation->get_key_frame<bool>(1, "a", "visible"), false);
+}
+
+GTEST_TEST(MeshcatRecordingTest, Errors) {
+  const auto filename = TempFile("errors.bin");
+  MeshcatRecordingParams bad_params;
+  bad_params.chunk_duration = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(MeshcatRecordingWriter(filename, bad_params),
+                              ".*invalid parameters.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshcatRecordingWriter(TempFile("no_such_dir/file.bin")),
+      ".*could not open.*");
+
+  MeshcatRecordingParams params;
+  params.chunk_duration = 1.0;
+  {
+    MeshcatRecordingWriter writer(filename, params);
+    writer.SetProperty(0.5, "body", "visible", true);
+    DRAKE_EXPECT_THROWS_MESSAGE(writer.SetProperty(0.5, "body", "visible", 1.0),
+                                ".*recorded with a different type.*");
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        writer.SetProperty(0.25, "body", "visible", true),
+        ".*precedes the current chunk.*");
+    // Keyframes may go back in time within the current chunk (which now
+    // starts at 1.5), but not to a previous chunk.
+    writer.SetProperty(1.5, "body", "visible", false);
+    writer.SetProperty(2.0, "body", "visible", true);
+    writer.SetProperty(1.75, "body", "visible", false);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        writer.SetProperty(1.25, "body", "visible", true),
+        ".*precedes the current chunk.*");
+    writer.Close();
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        writer.SetProperty(3.0, "body", "visible", true),
+        ".*after the writer is closed.*");
+  }
+
+  // A truncated chunk at the end of the file is ignored.
+  const auto size = std::filesystem::file_size(filename);
+  std::filesystem::resize_file(filename, size - 1);
+  MeshcatRecordingReader truncated(filename);
+  EXPECT_EQ(truncated.num_chunks(), 1);
+
+  // A chunk whose counts exceed its size is reported as corrupt, rather than
+  // allocated.
+  const auto write_chunk = [&filename](const std::vector<uint32_t>& payload) {
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    const uint32_t version = 1;
+    const uint64_t payload_size = payload.size() * sizeof(uint32_t);
+    const double times[2] = {0.0, 1.0};
+    stream.write("DRKMCREC", 8);
+    stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    stream.write("CHNK", 4);
+    stream.write(reinterpret_cast<const char*>(&payload_size),
+                 sizeof(payload_size));
+    stream.write(reinterpret_cast<const char*>(times), sizeof(times));
+    stream.write(reinterpret_cast<const char*>(payload.data()), payload_size);
+  };
+  const char* const kCorrupt = ".*chunk 0 of .* is corrupt \\(invalid count\\)";
+  // No tracks, and 2³² - 1 keyframes.
+  write_chunk({0, 0xFFFFFFFF});
+  MeshcatRecordingReader huge_keyframes(filename);
+  ASSERT_EQ(huge_keyframes.num_chunks(), 1);
+  DRAKE_EXPECT_THROWS_MESSAGE(huge_keyframes.ToAnimation(0.0, 1.0), kCorrupt);
+  // 2³² - 1 tracks.
+  write_chunk({0xFFFFFFFF, 0});
+  MeshcatRecordingReader huge_tracks(filename);
+  DRAKE_EXPECT_THROWS_MESSAGE(huge_tracks.ToAnimation(0.0, 1.0), kCorrupt);
+
+  {
+    std::ofstream(TempFile("not_a_recording.bin")) << "hello";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MeshcatRecordingReader(TempFile("not_a_recording.bin")),
+      ".*not a Meshcat recording.*");
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
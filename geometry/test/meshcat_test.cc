@@ -1,7 +1,11 @@
 #include "drake/geometry/meshcat.h"
 
 #include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <limits>
+#include <map>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -372,6 +376,85 @@ GTEST_TEST(MeshcatTest, SetObjectWithPointCloud) {
   EXPECT_FALSE(meshcat.GetPackedObject("rgb_cloud").empty());
 }
 
+GTEST_TEST(MeshcatTest, SetQuantizedPointCloud) {
+  Meshcat meshcat;
+
+  perception::PointCloud cloud(
+      4, perception::pc_flags::kXYZs | perception::pc_flags::kRGBs);
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  // clang-format off
+  cloud.mutable_xyzs() <<
+    -1,  0.25,  kNaN, 3,
+     2,  2,     0,    2,
+     0, -0.125, 0,    0.5;
+  cloud.mutable_rgbs() <<
+    1, 4, 7, 10,
+    2, 5, 8, 11,
+    3, 6, 9, 12;
+  // clang-format on
+  meshcat.SetQuantizedPointCloud("cloud", cloud, 0.01, Rgba(1, 0, 0, 0.5));
+
+  const std::string packed = meshcat.GetPackedObject("cloud");
+  msgpack::object_handle oh = msgpack::unpack(packed.data(), packed.size());
+  const auto data = oh.get().as<std::map<std::string, msgpack::object>>();
+  EXPECT_EQ(data.at("type").as<std::string>(), "set_point_cloud");
+  EXPECT_EQ(data.at("path").as<std::string>(), "/drake/cloud");
+  EXPECT_EQ(data.at("point_size").as<double>(), 0.01);
+  EXPECT_EQ(data.at("opacity").as<double>(), 0.5);
+  const auto lower = data.at("lower").as<std::vector<float>>();
+  const auto scale = data.at("scale").as<std::vector<float>>();
+  EXPECT_THAT(lower, ElementsAre(-1, 2, -0.125));
+  // The extent along y is zero.
+  EXPECT_EQ(scale[1], 0.0f);
+
+  // The point with a NaN coordinate is dropped; the others are within half of
+  // a quantization step of their original positions.
+  const msgpack::object_bin positions = data.at("positions").via.bin;
+  ASSERT_EQ(positions.size, 3 * 3 * sizeof(uint16_t));
+  std::vector<uint16_t> quantized(9);
+  std::memcpy(quantized.data(), positions.ptr, positions.size);
+  const std::vector<int> kept{0, 1, 3};
+  for (int i = 0; i < 3; ++i) {
+    for (int k = 0; k < 3; ++k) {
+      const float decoded = lower[k] + quantized[3 * i + k] * scale[k];
+      EXPECT_NEAR(decoded, cloud.xyzs()(k, kept[i]), 0.5 * scale[k] + 1e-6);
+    }
+  }
+  const msgpack::object_bin colors = data.at("colors").via.bin;
+  ASSERT_EQ(colors.size, 9);
+  EXPECT_EQ(colors.ptr[3], 4);
+  EXPECT_EQ(colors.ptr[8], 12);
+
+  // Without colors, none are sent.
+  perception::PointCloud xyz_cloud(2);
+  xyz_cloud.mutable_xyzs().setZero();
+  meshcat.SetQuantizedPointCloud("xyz_cloud", xyz_cloud);
+  const std::string xyz_packed = meshcat.GetPackedObject("xyz_cloud");
+  oh = msgpack::unpack(xyz_packed.data(), xyz_packed.size());
+  const auto xyz_data = oh.get().as<std::map<std::string, msgpack::object>>();
+  EXPECT_EQ(xyz_data.at("positions").via.bin.size, 2 * 3 * sizeof(uint16_t));
+  EXPECT_EQ(xyz_data.at("colors").via.bin.size, 0);
+}
+
+GTEST_TEST(MeshcatTest, TransportStatistics) {
+  Meshcat meshcat;
+  const Meshcat::TransportStatistics initial =
+      meshcat.GetTransportStatistics();
+  EXPECT_EQ(initial.backpressure, 0);
+
+  perception::PointCloud cloud(1000);
+  cloud.mutable_xyzs().setRandom();
+  meshcat.SetQuantizedPointCloud("cloud", cloud);
+  // Wait for the websocket thread to publish the message.
+  meshcat.Flush();
+  const Meshcat::TransportStatistics after =
+      meshcat.GetTransportStatistics();
+  EXPECT_GE(after.bytes_published - initial.bytes_published,
+            1000 * 3 * sizeof(uint16_t));
+  // Without any connections, nothing is buffered.
+  EXPECT_EQ(after.backpressure, 0);
+}
+
 GTEST_TEST(MeshcatTest, SetObjectWithTriangleSurfaceMesh) {
   Meshcat meshcat;
 
@@ -499,6 +582,56 @@ GTEST_TEST(MeshcatTest, SetTransformWithMatrix) {
   EXPECT_TRUE(CompareMatrices(matrix, actual));
 }
 
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const auto get_transform = [&meshcat](std::string_view path) {
+    std::string transform = meshcat.GetPackedTransform(path);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    EXPECT_EQ(data.type, "set_transform");
+    return Eigen::Matrix4d(Eigen::Map<Eigen::Matrix4d>(data.matrix));
+  };
+
+  const std::vector<std::string> paths{"frame", "/other/frame"};
+  const RigidTransformd X_A{RollPitchYawd(0.5, 0.26, -3),
+                            Vector3d{0.9, -2.0, 0.12}};
+  const RigidTransformd X_B{Vector3d{1.0, 2.0, 3.0}};
+  meshcat.SetTransforms(paths, {X_A, X_B});
+  // The scene tree holds the same set_transform command for each path as
+  // SetTransform() would have stored.
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X_A.GetAsMatrix4()));
+  EXPECT_TRUE(
+      CompareMatrices(get_transform("/other/frame"), X_B.GetAsMatrix4()));
+
+  // Changes within the tolerance are not sent.
+  const RigidTransformd X_B_nudged{Vector3d{1.0, 2.0, 3.0 + 1e-6}};
+  meshcat.SetTransforms(paths, {X_A, X_B_nudged}, 1e-3);
+  EXPECT_TRUE(
+      CompareMatrices(get_transform("/other/frame"), X_B.GetAsMatrix4()));
+  // With the default (zero) tolerance, any change is sent.
+  meshcat.SetTransforms(paths, {X_A, X_B_nudged});
+  EXPECT_TRUE(CompareMatrices(get_transform("/other/frame"),
+                              X_B_nudged.GetAsMatrix4()));
+
+  // A transform set by SetTransform() is not overridden by a stale batch.
+  meshcat.SetTransform("frame", X_B);
+  meshcat.SetTransforms(paths, {X_A, X_B_nudged});
+  EXPECT_TRUE(CompareMatrices(get_transform("frame"), X_A.GetAsMatrix4()));
+
+  // Deleting a path forgets the transforms sent to it, so the next batch
+  // re-creates it even though its transform is unchanged.
+  meshcat.Delete("/other");
+  EXPECT_FALSE(meshcat.HasPath("/other/frame"));
+  meshcat.SetTransforms(paths, {X_A, X_B_nudged}, 1e-3);
+  EXPECT_TRUE(meshcat.HasPath("/other/frame"));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms(paths, {X_A}),
+                              ".*2 paths but 1 transforms.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms(paths, {X_A, X_B}, -1.0),
+                              ".*tolerance must be non-negative.*");
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
@@ -122,6 +122,24 @@ TEST_F(MeshcatVisualizerWithIiwaTest, PublishPeriod) {
   }
 }
 
+TEST_F(MeshcatVisualizerWithIiwaTest, TransformTolerance) {
+  MeshcatVisualizerParams params;
+  // A tolerance far larger than any motion of the arm in this test.
+  params.transform_tolerance = 10.0;
+  SetUpDiagram(params);
+  diagram_->ForcedPublish(*context_);
+  const std::string packed_X_W7 =
+      meshcat_->GetPackedTransform("visualizer/iiwa14/iiwa_link_7");
+  EXPECT_NE(packed_X_W7, "");
+
+  // The arm falls, but the poses it reaches are within the tolerance of the
+  // poses that were sent first, so they are not sent again.
+  systems::Simulator<double> simulator(*diagram_);
+  simulator.AdvanceTo(0.1);
+  EXPECT_EQ(meshcat_->GetPackedTransform("visualizer/iiwa14/iiwa_link_7"),
+            packed_X_W7);
+}
+
 // Confirms that all geometry registered to iiwa_link_7 in the urdf (in all
 // three allowed roles) gets properly added.
 TEST_F(MeshcatVisualizerWithIiwaTest, Roles) {
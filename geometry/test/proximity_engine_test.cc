@@ -3,6 +3,8 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -78,6 +80,20 @@ class ProximityEngineTester {
   get_deformable_contact_geometries(const ProximityEngine<T>& engine) {
     return engine.deformable_contact_geometries();
   }
+
+  // Returns the number of narrowphase distance queries performed by
+  // ComputeTimeOfImpact().
+  template <typename T>
+  static int CountTimeOfImpactQueries(
+      const ProximityEngine<T>& engine,
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const unordered_map<GeometryId, RigidTransformd>& X_WGs_end,
+      double distance_threshold) {
+    int num_distance_queries = 0;
+    engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, distance_threshold,
+                               &num_distance_queries);
+    return num_distance_queries;
+  }
 };
 
 namespace deformable {
@@ -841,6 +857,89 @@ GTEST_TEST(ProximityEngineTests, CopySemantics) {
   ProximityEngineTester::IsDeepCopy(copy_assign, ref_engine);
 }
 
+// Copies share the anchored geometry until one of them modifies it; the
+// modification must not be visible to the other engine.
+GTEST_TEST(ProximityEngineTests, CopyOnWriteAnchoredGeometry) {
+  ProximityEngine<double> ref_engine;
+  const Sphere sphere{0.5};
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  const GeometryId dynamic_id = GeometryId::get_new_id();
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {anchored_id, RigidTransformd::Identity()},
+      {dynamic_id, RigidTransformd::Identity()}};
+  ref_engine.AddAnchoredGeometry(sphere, X_WGs.at(anchored_id), anchored_id);
+  ref_engine.AddDynamicGeometry(sphere, X_WGs.at(dynamic_id), dynamic_id);
+  ref_engine.UpdateWorldPoses(X_WGs);
+
+  ProximityEngine<double> copy(ref_engine);
+  EXPECT_TRUE(ProximityEngineTester::IsDeepCopy(copy, ref_engine));
+  EXPECT_EQ(copy.ComputePointPairPenetration(X_WGs).size(), 1);
+
+  // Removing anchored geometry from the copy leaves the original intact.
+  copy.RemoveGeometry(anchored_id, false);
+  EXPECT_EQ(copy.num_anchored(), 0);
+  EXPECT_EQ(copy.ComputePointPairPenetration(X_WGs).size(), 0);
+  EXPECT_EQ(ref_engine.num_anchored(), 1);
+  EXPECT_EQ(ref_engine.ComputePointPairPenetration(X_WGs).size(), 1);
+
+  // Adding anchored geometry to the original leaves copies intact.
+  ProximityEngine<double> second_copy(ref_engine);
+  ref_engine.AddAnchoredGeometry(sphere, RigidTransformd::Identity(),
+                                 GeometryId::get_new_id());
+  EXPECT_EQ(ref_engine.num_anchored(), 2);
+  EXPECT_EQ(second_copy.num_anchored(), 1);
+  EXPECT_EQ(second_copy.ComputePointPairPenetration(X_WGs).size(), 1);
+}
+
+// Copies that share the anchored geometry can be queried from several threads
+// at once: the queries only read the shared broadphase tree, even though FCL
+// is handed it through a const_cast. (Run under TSan, this test also reports
+// any data race on the shared tree.)
+GTEST_TEST(ProximityEngineTests, ConcurrentQueriesOfSharedAnchoredGeometry) {
+  // A row of anchored spheres at x = 0, 2, 4, ...
+  constexpr int kNumCopies = 8;
+  const Sphere sphere{0.5};
+  ProximityEngine<double> ref_engine;
+  for (int i = 0; i < kNumCopies; ++i) {
+    ref_engine.AddAnchoredGeometry(sphere,
+                                   RigidTransformd(Vector3d(2 * i, 0, 0)),
+                                   GeometryId::get_new_id());
+  }
+  const GeometryId dynamic_id = GeometryId::get_new_id();
+  ref_engine.AddDynamicGeometry(sphere, RigidTransformd::Identity(),
+                                dynamic_id);
+
+  // Copy k places its dynamic sphere so that it overlaps anchored sphere k by
+  // 0.25, and is at least 0.25 away from all others.
+  std::vector<ProximityEngine<double>> copies(kNumCopies, ref_engine);
+  std::vector<unordered_map<GeometryId, RigidTransformd>> X_WGs(kNumCopies);
+  for (int k = 0; k < kNumCopies; ++k) {
+    X_WGs[k][dynamic_id] = RigidTransformd(Vector3d(2 * k + 0.75, 0, 0));
+    copies[k].UpdateWorldPoses(X_WGs[k]);
+  }
+
+  auto query = [&copies, &X_WGs](int k) {
+    for (int n = 0; n < 100; ++n) {
+      const auto pairs = copies[k].ComputePointPairPenetration(X_WGs[k]);
+      if (pairs.size() != 1 || std::abs(pairs[0].depth - 0.25) > 1e-14) {
+        return false;
+      }
+      const auto distances =
+          copies[k].ComputeSignedDistancePairwiseClosestPoints(X_WGs[k], 0.2);
+      if (distances.size() != 1) return false;
+      if (copies[k].FindCollisionCandidates().size() != 1) return false;
+    }
+    return true;
+  };
+  std::vector<std::future<bool>> results;
+  for (int k = 0; k < kNumCopies; ++k) {
+    results.push_back(std::async(std::launch::async, query, k));
+  }
+  for (int k = 0; k < kNumCopies; ++k) {
+    EXPECT_TRUE(results[k].get()) << "copy " << k;
+  }
+}
+
 // Tests the move semantics of the ProximityEngine -- the source is restored to
 // default state.
 GTEST_TEST(ProximityEngineTests, MoveSemantics) {
@@ -868,6 +967,302 @@ GTEST_TEST(ProximityEngineTests, MoveSemantics) {
   EXPECT_EQ(move_construct.num_dynamic(), 0);
 }
 
+// Tests the continuous collision query: a dynamic sphere sweeps past an
+// anchored sphere and a dynamic sphere (at rest), among anchored geometries it
+// never approaches.
+GTEST_TEST(ProximityEngineTests, ComputeTimeOfImpact) {
+  ProximityEngine<double> engine;
+  const Sphere sphere{0.5};
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+
+  // The moving sphere travels from x = 4 to x = -4.
+  const GeometryId moving_id = GeometryId::get_new_id();
+  X_WGs[moving_id] = RigidTransformd(Vector3d(4, 0, 0));
+  engine.AddDynamicGeometry(sphere, X_WGs[moving_id], moving_id);
+  const unordered_map<GeometryId, RigidTransformd> X_WGs_end{
+      {moving_id, RigidTransformd(Vector3d(-4, 0, 0))}};
+
+  // Distant anchored geometries, culled by the broadphase.
+  for (int i = 0; i < 10; ++i) {
+    engine.AddAnchoredGeometry(sphere, RigidTransformd(Vector3d(i, 10, 0)),
+                               GeometryId::get_new_id());
+  }
+  engine.UpdateWorldPoses(X_WGs);
+  EXPECT_FALSE(
+      engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, 0.0).has_value());
+  EXPECT_EQ(ProximityEngineTester::CountTimeOfImpactQueries(engine, X_WGs,
+                                                            X_WGs_end, 0.0),
+            0);
+
+  // An anchored sphere at the origin is reached when the gap of 3 m has closed
+  // (at a speed of 8 m per unit time).
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(sphere, RigidTransformd::Identity(), anchored_id);
+  std::optional<TimeOfImpact> toi =
+      engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, 0.0);
+  // Only the pair of the two spheres is advanced, which takes a few queries.
+  const int num_queries = ProximityEngineTester::CountTimeOfImpactQueries(
+      engine, X_WGs, X_WGs_end, 0.0);
+  EXPECT_GT(num_queries, 0);
+  EXPECT_LE(num_queries, 3);
+  // Unless the swept box reaches the distant geometries: a threshold of 10 m
+  // puts them all in range, and each is queried at least once.
+  EXPECT_GE(ProximityEngineTester::CountTimeOfImpactQueries(engine, X_WGs,
+                                                            X_WGs_end, 10.0),
+            1 + 10);
+  ASSERT_TRUE(toi.has_value());
+  EXPECT_EQ(SortedPair<GeometryId>(toi->id_A, toi->id_B),
+            SortedPair<GeometryId>(moving_id, anchored_id));
+  EXPECT_LE(toi->time, 3.0 / 8);
+  EXPECT_NEAR(toi->time, 3.0 / 8, 1e-6);
+
+  // The distance threshold is applied.
+  toi = engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, 1.0);
+  ASSERT_TRUE(toi.has_value());
+  EXPECT_NEAR(toi->time, 2.0 / 8, 1e-6);
+
+  // A dynamic sphere (at rest) in the path, before the anchored sphere, is hit
+  // first.
+  const GeometryId resting_id = GeometryId::get_new_id();
+  X_WGs[resting_id] = RigidTransformd(Vector3d(2, 0, 0));
+  engine.AddDynamicGeometry(sphere, X_WGs[resting_id], resting_id);
+  engine.UpdateWorldPoses(X_WGs);
+  toi = engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, 0.0);
+  ASSERT_TRUE(toi.has_value());
+  EXPECT_EQ(SortedPair<GeometryId>(toi->id_A, toi->id_B),
+            SortedPair<GeometryId>(moving_id, resting_id));
+  EXPECT_NEAR(toi->time, 1.0 / 8, 1e-6);
+  EXPECT_LT(toi->id_A, toi->id_B);
+
+  // Filtered pairs are ignored.
+  auto extract_ids = [&](const GeometrySet&, CollisionFilterScope) {
+    return std::unordered_set<GeometryId>{moving_id, resting_id, anchored_id};
+  };
+  engine.collision_filter().Apply(
+      CollisionFilterDeclaration().ExcludeWithin(
+          GeometrySet{moving_id, resting_id, anchored_id}),
+      extract_ids, false /* is_invariant */);
+  EXPECT_FALSE(
+      engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, 0.0).has_value());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.ComputeTimeOfImpact(X_WGs, X_WGs_end, -1.0),
+      ".*distance_threshold >= 0.*");
+}
+
+// Tests the batched ray-casting query against a scene with primitives, a mesh,
+// and a half space.
+GTEST_TEST(ProximityEngineTests, CastRays) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+
+  // The ground.
+  const GeometryId ground_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(HalfSpace(), RigidTransformd::Identity(),
+                             ground_id);
+  // A dynamic sphere above the origin.
+  const GeometryId sphere_id = GeometryId::get_new_id();
+  X_WGs[sphere_id] = RigidTransformd(Vector3d(0, 0, 2));
+  engine.AddDynamicGeometry(Sphere(0.5), X_WGs[sphere_id], sphere_id);
+  // A mesh of the cube [-1, 1]³, resting on the ground at x = 5.
+  const GeometryId cube_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(
+      Mesh(drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj")),
+      RigidTransformd(Vector3d(5, 0, 1)), cube_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  // All rays start at (0, 0, 5).
+  const Vector3d p_WR(0, 0, 5);
+  Eigen::Matrix3Xd dirs_W(3, 4);
+  dirs_W.col(0) = Vector3d(0, 0, -2);  // Hits the top of the sphere.
+  dirs_W.col(1) = Vector3d(1, 0, 0);   // Hits nothing.
+  dirs_W.col(2) = Vector3d(5, 0, -4);  // Hits the near side of the cube.
+  dirs_W.col(3) = Vector3d(0, 1, -1);  // Hits the ground.
+  Eigen::VectorXd distances(4);
+  std::vector<GeometryId> ids;
+  Eigen::Matrix3Xd normals_W(3, 4);
+  engine.CastRays(p_WR, dirs_W, kInf, &distances, &ids, &normals_W,
+                  Parallelism::None());
+  ASSERT_EQ(ids.size(), 4);
+
+  constexpr double kTolerance = 1e-14;
+  EXPECT_NEAR(distances(0), 2.5, kTolerance);
+  EXPECT_EQ(ids[0], sphere_id);
+  EXPECT_TRUE(CompareMatrices(normals_W.col(0), Vector3d::UnitZ(),
+                              kTolerance));
+
+  EXPECT_EQ(distances(1), kInf);
+  EXPECT_FALSE(ids[1].is_valid());
+  EXPECT_TRUE(CompareMatrices(normals_W.col(1), Vector3d::Zero()));
+
+  // The ray reaches the plane x = 4 at 0.8 of its direction vector.
+  EXPECT_NEAR(distances(2), 0.8 * std::sqrt(41.0), kTolerance);
+  EXPECT_EQ(ids[2], cube_id);
+  EXPECT_TRUE(CompareMatrices(normals_W.col(2), -Vector3d::UnitX(),
+                              kTolerance));
+
+  EXPECT_NEAR(distances(3), 5 * std::sqrt(2.0), kTolerance);
+  EXPECT_EQ(ids[3], ground_id);
+  EXPECT_TRUE(CompareMatrices(normals_W.col(3), Vector3d::UnitZ(),
+                              kTolerance));
+
+  // Many rays with per-ray origins, cast by several threads, get the same
+  // results (the origins differ, but the rays are the same).
+  const int kNumCopies = 100;
+  Eigen::Matrix3Xd p_WRs(3, 4 * kNumCopies);
+  Eigen::Matrix3Xd many_dirs_W(3, 4 * kNumCopies);
+  for (int i = 0; i < kNumCopies; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      // Moving the origin along the ray doesn't change the hit point.
+      p_WRs.col(4 * i + j) = p_WR - 0.01 * i * dirs_W.col(j).normalized();
+      many_dirs_W.col(4 * i + j) = dirs_W.col(j);
+    }
+  }
+  Eigen::VectorXd many_distances(4 * kNumCopies);
+  engine.CastRays(p_WRs, many_dirs_W, kInf, &many_distances, &ids, nullptr,
+                  Parallelism(4));
+  for (int i = 0; i < kNumCopies; ++i) {
+    EXPECT_EQ(many_distances(4 * i + 1), kInf);
+    for (int j : {0, 2, 3}) {
+      EXPECT_NEAR(many_distances(4 * i + j), distances(j) + 0.01 * i, 1e-12);
+    }
+  }
+
+  // Hits beyond the maximum distance aren't reported.
+  engine.CastRays(p_WR, dirs_W, 3.0, &distances, &ids, nullptr,
+                  Parallelism::None());
+  EXPECT_EQ(ids[0], sphere_id);
+  EXPECT_FALSE(ids[2].is_valid());
+  EXPECT_FALSE(ids[3].is_valid());
+
+  // Removed geometries aren't hit; copies keep their geometries.
+  const ProximityEngine<double> copy(engine);
+  engine.RemoveGeometry(cube_id, false /* is_dynamic */);
+  engine.CastRays(p_WR, dirs_W, kInf, &distances, &ids, nullptr,
+                  Parallelism::None());
+  EXPECT_EQ(ids[2], ground_id);
+  copy.CastRays(p_WR, dirs_W, kInf, &distances, &ids, nullptr,
+                Parallelism::None());
+  EXPECT_EQ(ids[2], cube_id);
+
+  // Bad inputs.
+  Eigen::VectorXd too_few(3);
+  EXPECT_THROW(engine.CastRays(p_WR, dirs_W, kInf, &too_few, nullptr, nullptr,
+                               Parallelism::None()),
+               std::exception);
+  Eigen::Matrix3Xd zero_dirs_W = dirs_W;
+  zero_dirs_W.col(1).setZero();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.CastRays(p_WR, zero_dirs_W, kInf, &distances, nullptr, nullptr,
+                      Parallelism::None()),
+      ".*must be non-zero.*");
+}
+
+// Rays are cast against a Mesh's surface, but against a Convex's hull, as for
+// the other queries.
+GTEST_TEST(ProximityEngineTests, CastRaysAgainstConvex) {
+  // The U-shaped extrusion spans [-2, 2] x [-1, 1] x [-2, 0.5], with a notch
+  // down to z = -0.5 for |x| < 1. We place a Mesh of it at the origin, and a
+  // Convex of it at y = 5.
+  const std::string filename =
+      drake::FindResourceOrThrow("drake/geometry/test/extruded_u.obj");
+  ProximityEngine<double> engine;
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(Mesh(filename), RigidTransformd::Identity(),
+                             mesh_id);
+  const GeometryId convex_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(Convex(filename),
+                             RigidTransformd(Vector3d(0, 5, 0)), convex_id);
+
+  // Both rays point down into the notch.
+  Eigen::Matrix3Xd p_WRs(3, 2);
+  p_WRs.col(0) = Vector3d(0, 0, 5);
+  p_WRs.col(1) = Vector3d(0, 5, 5);
+  const Eigen::Matrix3Xd dirs_W = -Vector3d::UnitZ().replicate(1, 2);
+  Eigen::VectorXd distances(2);
+  std::vector<GeometryId> ids;
+  Eigen::Matrix3Xd normals_W(3, 2);
+  engine.CastRays(p_WRs, dirs_W, kInf, &distances, &ids, &normals_W,
+                  Parallelism::None());
+  ASSERT_EQ(ids.size(), 2);
+  EXPECT_EQ(ids[0], mesh_id);
+  EXPECT_NEAR(distances(0), 5.5, 1e-14);
+  EXPECT_EQ(ids[1], convex_id);
+  EXPECT_NEAR(distances(1), 4.5, 1e-14);
+  EXPECT_TRUE(CompareMatrices(normals_W.col(1), Vector3d::UnitZ(), 1e-14));
+
+  // A flat Convex has no hull to cast rays against; adding it throws, naming
+  // the geometry.
+  const std::filesystem::path file =
+      std::filesystem::path(temp_directory()) / "flat.obj";
+  std::ofstream f(file.string());
+  f << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 3\n";
+  f.close();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.AddDynamicGeometry(Convex(file.string()), {},
+                                GeometryId::get_new_id(), {}, "flat_convex"),
+      ".*rays can't be cast against the geometry 'flat_convex'(.|\n)*");
+}
+
+// Rays are culled with the broadphase trees: with many geometries, each ray
+// still reports its closest hit, and moved dynamic geometries are found at
+// their new poses.
+GTEST_TEST(ProximityEngineTests, CastRaysThroughBroadphase) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+
+  // A row of spheres of radius 0.25 along the x-axis at x = 0, 1, ..., 39;
+  // the even ones are anchored, the odd ones are dynamic.
+  const int kNumSpheres = 40;
+  std::vector<GeometryId> sphere_ids;
+  for (int i = 0; i < kNumSpheres; ++i) {
+    const GeometryId id = GeometryId::get_new_id();
+    const RigidTransformd X_WG(Vector3d(i, 0, 0));
+    if (i % 2 == 0) {
+      engine.AddAnchoredGeometry(Sphere(0.25), X_WG, id);
+    } else {
+      X_WGs[id] = X_WG;
+      engine.AddDynamicGeometry(Sphere(0.25), X_WG, id);
+    }
+    sphere_ids.push_back(id);
+  }
+  engine.UpdateWorldPoses(X_WGs);
+
+  // A downward ray above each sphere, and one down the row from x = -1.
+  Eigen::Matrix3Xd p_WRs(3, kNumSpheres + 1);
+  Eigen::Matrix3Xd dirs_W(3, kNumSpheres + 1);
+  for (int i = 0; i < kNumSpheres; ++i) {
+    p_WRs.col(i) = Vector3d(i, 0, 1);
+    dirs_W.col(i) = -Vector3d::UnitZ();
+  }
+  p_WRs.col(kNumSpheres) = Vector3d(-1, 0, 0);
+  dirs_W.col(kNumSpheres) = Vector3d::UnitX();
+  Eigen::VectorXd distances(kNumSpheres + 1);
+  std::vector<GeometryId> ids;
+  engine.CastRays(p_WRs, dirs_W, kInf, &distances, &ids, nullptr,
+                  Parallelism::None());
+  constexpr double kTolerance = 1e-14;
+  for (int i = 0; i < kNumSpheres; ++i) {
+    EXPECT_NEAR(distances(i), 0.75, kTolerance);
+    EXPECT_EQ(ids[i], sphere_ids[i]);
+  }
+  EXPECT_NEAR(distances(kNumSpheres), 0.75, kTolerance);
+  EXPECT_EQ(ids[kNumSpheres], sphere_ids[0]);
+
+  // Lifting the dynamic spheres by 0.5 brings them closer to the rays above
+  // them.
+  for (auto& [id, X_WG] : X_WGs) {
+    X_WG.set_translation(X_WG.translation() + Vector3d(0, 0, 0.5));
+  }
+  engine.UpdateWorldPoses(X_WGs);
+  engine.CastRays(p_WRs, dirs_W, kInf, &distances, &ids, nullptr,
+                  Parallelism::None());
+  for (int i = 0; i < kNumSpheres; ++i) {
+    EXPECT_NEAR(distances(i), i % 2 == 0 ? 0.75 : 0.25, kTolerance);
+    EXPECT_EQ(ids[i], sphere_ids[i]);
+  }
+}
+
 // Signed distance tests -- testing data flow; not testing the value of the
 // query.
 
@@ -2029,6 +2424,58 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that the output-parameter overloads of the point-pair and
+// signed-distance queries match the value-returning queries, that they replace
+// (rather than append to) the previous contents, and that they retain the
+// output vector's capacity.
+GTEST_TEST(ProximityEngineTests, OutputParameterQueries) {
+  ProximityEngine<double> engine;
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 4);
+
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  engine.UpdateWorldPoses(poses);
+
+  const auto expected_pairs = engine.ComputePointPairPenetration(poses);
+  ASSERT_EQ(expected_pairs.size(), poses.size());
+  std::vector<PenetrationAsPointPair<double>> point_pairs;
+  // Queried twice: the second call must not accumulate, nor reallocate.
+  engine.ComputePointPairPenetration(poses, &point_pairs);
+  const auto* pairs_data = point_pairs.data();
+  engine.ComputePointPairPenetration(poses, &point_pairs);
+  EXPECT_EQ(point_pairs.data(), pairs_data);
+  ASSERT_EQ(point_pairs.size(), expected_pairs.size());
+  for (size_t i = 0; i < point_pairs.size(); ++i) {
+    EXPECT_EQ(point_pairs[i].id_A, expected_pairs[i].id_A);
+    EXPECT_EQ(point_pairs[i].id_B, expected_pairs[i].id_B);
+    EXPECT_EQ(point_pairs[i].depth, expected_pairs[i].depth);
+  }
+
+  const auto expected_distances =
+      engine.ComputeSignedDistancePairwiseClosestPoints(poses, kInf);
+  std::vector<SignedDistancePair<double>> distances;
+  engine.ComputeSignedDistancePairwiseClosestPoints(poses, kInf, &distances);
+  const auto* distances_data = distances.data();
+  engine.ComputeSignedDistancePairwiseClosestPoints(poses, kInf, &distances);
+  EXPECT_EQ(distances.data(), distances_data);
+  ASSERT_EQ(distances.size(), expected_distances.size());
+  for (size_t i = 0; i < distances.size(); ++i) {
+    EXPECT_EQ(distances[i].id_A, expected_distances[i].id_A);
+    EXPECT_EQ(distances[i].id_B, expected_distances[i].id_B);
+    EXPECT_EQ(distances[i].distance, expected_distances[i].distance);
+  }
+
+  // A query with fewer results shrinks the size, but not the capacity.
+  const size_t capacity = distances.capacity();
+  engine.ComputeSignedDistancePairwiseClosestPoints(poses, -kInf, &distances);
+  EXPECT_TRUE(distances.empty());
+  EXPECT_EQ(distances.capacity(), capacity);
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2114,6 +2561,26 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// The output-parameter overload reports the same surfaces, replacing the
+// previous contents while retaining the vector's storage.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesOutputParameter) {
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(
+      HydroelasticContactRepresentation::kTriangle, poses_);
+
+  std::vector<ContactSurface<double>> surfaces;
+  engine_.ComputeContactSurfaces(HydroelasticContactRepresentation::kTriangle,
+                                 poses_, &surfaces);
+  const auto* data = surfaces.data();
+  engine_.ComputeContactSurfaces(HydroelasticContactRepresentation::kTriangle,
+                                 poses_, &surfaces);
+  EXPECT_EQ(surfaces.data(), data);
+  ASSERT_EQ(surfaces.size(), expected.size());
+  for (size_t i = 0; i < surfaces.size(); ++i) {
+    EXPECT_TRUE(surfaces[i].Equal(expected[i]));
+  }
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
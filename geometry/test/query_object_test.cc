@@ -174,6 +174,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   EXPECT_DEFAULT_ERROR(default_object.ComputeContactSurfaces(representation));
   std::vector<ContactSurface<double>> surfaces;
   std::vector<PenetrationAsPointPair<double>> point_pairs;
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputePointPairPenetration(&point_pairs));
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputeContactSurfaces(representation, &surfaces));
   EXPECT_DEFAULT_ERROR(default_object.ComputeContactSurfacesWithFallback(
       representation, &surfaces, &point_pairs));
   internal::DeformableContact<double> deformable_contact;
@@ -183,6 +187,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   // Signed distance queries.
   EXPECT_DEFAULT_ERROR(
       default_object.ComputeSignedDistancePairwiseClosestPoints());
+  std::vector<SignedDistancePair<double>> signed_distances;
+  EXPECT_DEFAULT_ERROR(
+      default_object.ComputeSignedDistancePairwiseClosestPoints(
+          0.0, &signed_distances));
   EXPECT_DEFAULT_ERROR(default_object.ComputeSignedDistancePairClosestPoints(
       GeometryId::get_new_id(), GeometryId::get_new_id()));
   EXPECT_DEFAULT_ERROR(
@@ -190,6 +198,12 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
 
   EXPECT_DEFAULT_ERROR(default_object.FindCollisionCandidates());
   EXPECT_DEFAULT_ERROR(default_object.HasCollisions());
+  EXPECT_DEFAULT_ERROR(default_object.ComputeTimeOfImpact({}));
+
+  // Ray-casting queries.
+  Eigen::VectorXd distances(1);
+  EXPECT_DEFAULT_ERROR(default_object.CastRays(
+      Vector3d::Zero(), Vector3d::UnitX(), 1.0, &distances));
 
   // Render queries.
   const ColorRenderCamera color_camera{
@@ -207,6 +221,8 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   ImageLabel16I label;
   EXPECT_DEFAULT_ERROR(default_object.RenderLabelImage(
       color_camera, FrameId::get_new_id(), X_WC, &label));
+  EXPECT_DEFAULT_ERROR(default_object.RenderImages(
+      {render::ColorImageRequest{color_camera, X_WC, &color}}));
 
   EXPECT_DEFAULT_ERROR(default_object.GetRenderEngineByName("dummy"));
 
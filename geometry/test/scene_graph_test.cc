@@ -302,6 +302,38 @@ TEST_F(SceneGraphTest, FullPoseUpdateAnchoredOnly) {
       SceneGraphTester::FullPoseUpdate(scene_graph_, *context_));
 }
 
+// A copy-on-write clone of the context shares the geometry state with the
+// source context. The pose update of one must not change the poses reported by
+// the other, even though the other's poses are already up to date.
+TEST_F(SceneGraphTest, CopyOnWriteClonePoseUpdate) {
+  SourceId s_id = scene_graph_.RegisterSource();
+  FrameId f_id = scene_graph_.RegisterFrame(s_id, GeometryFrame("frame"));
+  scene_graph_.RegisterGeometry(s_id, f_id, make_sphere_instance());
+  CreateDefaultContext();
+
+  const RigidTransformd X_WF_source(Vector3<double>(1, 2, 3));
+  FramePoseVector<double> poses;
+  poses.set_value(f_id, X_WF_source);
+  scene_graph_.get_source_pose_port(s_id).FixValue(context_.get(), poses);
+  EXPECT_TRUE(CompareMatrices(
+      query_object().GetPoseInWorld(f_id).GetAsMatrix34(),
+      X_WF_source.GetAsMatrix34()));
+
+  unique_ptr<Context<double>> clone = context_->CloneCopyOnWrite();
+  const RigidTransformd X_WF_clone(Vector3<double>(-1, -2, -3));
+  poses.set_value(f_id, X_WF_clone);
+  scene_graph_.get_source_pose_port(s_id).FixValue(clone.get(), poses);
+  const auto& clone_query_object =
+      scene_graph_.get_query_output_port().Eval<QueryObject<double>>(*clone);
+  EXPECT_TRUE(CompareMatrices(
+      clone_query_object.GetPoseInWorld(f_id).GetAsMatrix34(),
+      X_WF_clone.GetAsMatrix34()));
+
+  EXPECT_TRUE(CompareMatrices(
+      query_object().GetPoseInWorld(f_id).GetAsMatrix34(),
+      X_WF_source.GetAsMatrix34()));
+}
+
 // Smoke test for registering a deformable geometry
 TEST_F(SceneGraphTest, RegisterDeformableGeometry) {
   SourceId s_id = scene_graph_.RegisterSource();
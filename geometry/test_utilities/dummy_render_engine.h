@@ -36,7 +36,7 @@ namespace internal {
     UpdateDeformableConfigurations() to validate which id values are updated
     and which aren't (and with what configurations).
  6. Records the camera pose provided to UpdateViewpoint() and report it with
-    last_updated_X_WC().  */
+    last_updated_X_WC(), and counts the calls with num_viewpoint_updates().  */
 class DummyRenderEngine : public render::RenderEngine {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(DummyRenderEngine);
@@ -55,6 +55,7 @@ class DummyRenderEngine : public render::RenderEngine {
   //@{
   void UpdateViewpoint(const math::RigidTransformd& X_WC) override {
     X_WC_ = X_WC;
+    ++viewpoint_count_;
   }
   using render::RenderEngine::RenderColorImage;
   using render::RenderEngine::RenderDepthImage;
@@ -153,6 +154,9 @@ class DummyRenderEngine : public render::RenderEngine {
 
   const math::RigidTransformd& last_updated_X_WC() const { return X_WC_; }
 
+  // Reports the number of times UpdateViewpoint() was called.
+  int num_viewpoint_updates() const { return viewpoint_count_; }
+
   // Promote these to be public to facilitate testing.
   using RenderEngine::GetColorDFromLabel;
   using RenderEngine::GetColorIFromLabel;
@@ -279,6 +283,7 @@ class DummyRenderEngine : public render::RenderEngine {
 
   // The last updated camera pose (defaults to identity).
   math::RigidTransformd X_WC_;
+  int viewpoint_count_{};
 
   // The counts of the times that the various render APIs were called.
   // This should *only* apply to the render API with *simple* camera intrinsics.
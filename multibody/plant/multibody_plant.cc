@@ -1860,7 +1860,8 @@ void MultibodyPlant<T>::CalcPointPairPenetrations(
   this->ValidateContext(context);
   if (num_collision_geometries() > 0) {
     const auto& query_object = EvalGeometryQueryInput(context, __func__);
-    *output = query_object.ComputePointPairPenetration();
+    // Writing into the cache entry's vector reuses its storage.
+    query_object.ComputePointPairPenetration(output);
   } else {
     output->clear();
   }
@@ -2515,8 +2516,9 @@ void MultibodyPlant<T>::CalcContactSurfaces(
 
   const auto& query_object = EvalGeometryQueryInput(context, __func__);
 
-  *contact_surfaces =
-      query_object.ComputeContactSurfaces(get_contact_surface_representation());
+  // Writing into the cache entry's vector reuses its storage.
+  query_object.ComputeContactSurfaces(get_contact_surface_representation(),
+                                      contact_surfaces);
 }
 
 template <>
@@ -0,0 +1,109 @@
+/* @file This file tests that a copy-on-write clone of a MultibodyPlant and
+ SceneGraph diagram's Context can be posed independently of its source, even
+ though the two share SceneGraph's geometry state when the clone is made. */
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using geometry::QueryObject;
+using geometry::SignedDistancePair;
+using geometry::Sphere;
+using math::RigidTransformd;
+using systems::Context;
+using systems::DiagramBuilder;
+
+constexpr double kRadius = 0.5;
+
+class CopyOnWriteCloneTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    std::tie(plant_, scene_graph_) = AddMultibodyPlantSceneGraph(&builder, 0.0);
+    plant_->set_contact_model(ContactModel::kPoint);
+    sphere1_ = &AddSphere("sphere1");
+    sphere2_ = &AddSphere("sphere2");
+    plant_->Finalize();
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+  }
+
+  const RigidBody<double>& AddSphere(const std::string& name) {
+    const RigidBody<double>& body = plant_->AddRigidBody(
+        name, SpatialInertia<double>::SolidSphereWithDensity(1000, kRadius));
+    plant_->RegisterCollisionGeometry(body, RigidTransformd(), Sphere(kRadius),
+                                      name, CoulombFriction<double>(0.5, 0.5));
+    return body;
+  }
+
+  // Places the second sphere at (x, 0, 0) with the first one at the origin.
+  void PoseSpheres(double x, Context<double>* diagram_context) const {
+    Context<double>& plant_context =
+        plant_->GetMyMutableContextFromRoot(diagram_context);
+    plant_->SetFreeBodyPose(&plant_context, *sphere1_, RigidTransformd());
+    plant_->SetFreeBodyPose(&plant_context, *sphere2_,
+                            RigidTransformd(Eigen::Vector3d(x, 0, 0)));
+  }
+
+  double CalcDistance(const Context<double>& diagram_context) const {
+    const auto& query_object =
+        plant_->get_geometry_query_input_port()
+            .Eval<QueryObject<double>>(
+                plant_->GetMyContextFromRoot(diagram_context));
+    const std::vector<SignedDistancePair<double>> pairs =
+        query_object.ComputeSignedDistancePairwiseClosestPoints();
+    EXPECT_EQ(pairs.size(), 1);
+    return pairs.at(0).distance;
+  }
+
+  int CountContacts(const Context<double>& diagram_context) const {
+    return plant_->get_contact_results_output_port()
+        .Eval<ContactResults<double>>(
+            plant_->GetMyContextFromRoot(diagram_context))
+        .num_point_pair_contacts();
+  }
+
+  MultibodyPlant<double>* plant_{};
+  geometry::SceneGraph<double>* scene_graph_{};
+  const RigidBody<double>* sphere1_{};
+  const RigidBody<double>* sphere2_{};
+  std::unique_ptr<systems::Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// The clone's pose update must not write into the geometry state that the
+// source context is still using: the source's poses are up to date when the
+// clone is made, so the source doesn't update them again.
+TEST_F(CopyOnWriteCloneTest, IndependentPoses) {
+  PoseSpheres(1.9 * kRadius, context_.get());
+  EXPECT_NEAR(CalcDistance(*context_), -0.1 * kRadius, 1e-12);
+
+  std::unique_ptr<Context<double>> clone = context_->CloneCopyOnWrite();
+  PoseSpheres(4 * kRadius, clone.get());
+  EXPECT_NEAR(CalcDistance(*clone), 2 * kRadius, 1e-12);
+  EXPECT_EQ(CountContacts(*clone), 0);
+
+  EXPECT_NEAR(CalcDistance(*context_), -0.1 * kRadius, 1e-12);
+  EXPECT_EQ(CountContacts(*context_), 1);
+
+  // And the other way around.
+  PoseSpheres(3 * kRadius, context_.get());
+  EXPECT_NEAR(CalcDistance(*context_), kRadius, 1e-12);
+  EXPECT_NEAR(CalcDistance(*clone), 2 * kRadius, 1e-12);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,142 @@
+#include "drake/perception/scanning_lidar.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/geometry/query_object.h"
+
+namespace drake {
+namespace perception {
+
+using Eigen::Matrix3Xd;
+using geometry::FrameId;
+using geometry::QueryObject;
+using math::RigidTransformd;
+using systems::Context;
+using systems::EventStatus;
+using systems::State;
+
+namespace {
+
+Matrix3Xd NormalizeDirections(const Eigen::Ref<const Matrix3Xd>& directions) {
+  if (directions.cols() == 0) {
+    throw std::logic_error("ScanningLidar: the sensor must have beams");
+  }
+  Matrix3Xd result(3, directions.cols());
+  for (int i = 0; i < directions.cols(); ++i) {
+    const double norm = directions.col(i).norm();
+    if (!(norm > 0) || !std::isfinite(norm)) {
+      throw std::logic_error(fmt::format(
+          "ScanningLidar: beam direction {} is not a finite, non-zero vector",
+          i));
+    }
+    result.col(i) = directions.col(i) / norm;
+  }
+  return result;
+}
+
+double CheckPositive(double value, const char* name) {
+  if (!(value > 0) || !std::isfinite(value)) {
+    throw std::logic_error(fmt::format(
+        "ScanningLidar: the {} must be positive and finite; given {}", name,
+        value));
+  }
+  return value;
+}
+
+}  // namespace
+
+ScanningLidar::ScanningLidar(FrameId parent_id, const RigidTransformd& X_PB,
+                             const Eigen::Ref<const Matrix3Xd>& directions_B,
+                             double scan_rate, double max_range,
+                             Parallelism parallelism)
+    : parent_id_(parent_id),
+      X_PB_(X_PB),
+      directions_B_(NormalizeDirections(directions_B)),
+      scan_period_(1.0 / CheckPositive(scan_rate, "scan rate")),
+      max_range_(CheckPositive(max_range, "maximum range")),
+      parallelism_(parallelism) {
+  query_object_input_port_ =
+      this->DeclareAbstractInputPort("geometry_query",
+                                     Value<QueryObject<double>>{})
+          .get_index();
+
+  // Until the first scan, no beam has hit.
+  const int num_beams = directions_B_.cols();
+  PointCloud model_cloud(num_beams);
+  model_cloud.mutable_xyzs().setConstant(
+      std::numeric_limits<float>::infinity());
+  point_cloud_state_index_ =
+      this->DeclareAbstractState(Value<PointCloud>(std::move(model_cloud)));
+  ranges_state_index_ = this->DeclareDiscreteState(
+      Eigen::VectorXd::Constant(num_beams, max_range_));
+
+  point_cloud_output_port_ =
+      this->DeclareStateOutputPort("point_cloud", point_cloud_state_index_)
+          .get_index();
+  ranges_output_port_ =
+      this->DeclareStateOutputPort("ranges", ranges_state_index_).get_index();
+
+  this->DeclarePeriodicUnrestrictedUpdateEvent(scan_period_, 0.0,
+                                               &ScanningLidar::Scan);
+}
+
+Matrix3Xd ScanningLidar::MakeSpinningBeamPattern(
+    int num_azimuths, const std::vector<double>& elevations,
+    double min_azimuth, double max_azimuth) {
+  if (num_azimuths <= 0 || elevations.empty() ||
+      !(min_azimuth < max_azimuth)) {
+    throw std::logic_error(fmt::format(
+        "ScanningLidar::MakeSpinningBeamPattern(): invalid pattern with {} "
+        "azimuths over [{}, {}) and {} elevations",
+        num_azimuths, min_azimuth, max_azimuth, elevations.size()));
+  }
+  const double azimuth_step = (max_azimuth - min_azimuth) / num_azimuths;
+  const int num_elevations = elevations.size();
+  Matrix3Xd directions(3, num_elevations * num_azimuths);
+  for (int i = 0; i < num_elevations; ++i) {
+    const double cos_elevation = std::cos(elevations[i]);
+    const double sin_elevation = std::sin(elevations[i]);
+    for (int j = 0; j < num_azimuths; ++j) {
+      const double azimuth = min_azimuth + j * azimuth_step;
+      directions.col(i * num_azimuths + j) << cos_elevation * std::cos(azimuth),
+          cos_elevation * std::sin(azimuth), sin_elevation;
+    }
+  }
+  return directions;
+}
+
+EventStatus ScanningLidar::Scan(const Context<double>& context,
+                                State<double>* state) const {
+  const auto& query_object =
+      query_object_input_port().Eval<QueryObject<double>>(context);
+  const RigidTransformd X_WB =
+      query_object.GetPoseInWorld(parent_id_) * X_PB_;
+  // All beams share the origin Bo, which lets them be cast in packets.
+  const Matrix3Xd directions_W = X_WB.rotation().matrix() * directions_B_;
+  auto ranges =
+      state->get_mutable_discrete_state(ranges_state_index_)
+          .get_mutable_value();
+  query_object.CastRays(X_WB.translation(), directions_W, max_range_, &ranges,
+                        nullptr, nullptr, parallelism_);
+
+  auto xyzs = state->get_mutable_abstract_state<PointCloud>(
+                       point_cloud_state_index_)
+                  .mutable_xyzs();
+  for (int i = 0; i < num_beams(); ++i) {
+    if (std::isinf(ranges[i])) {
+      xyzs.col(i).setConstant(std::numeric_limits<float>::infinity());
+      ranges[i] = max_range_;
+    } else {
+      xyzs.col(i) = (ranges[i] * directions_B_.col(i)).cast<float>();
+    }
+  }
+  return EventStatus::Succeeded();
+}
+
+}  // namespace perception
+}  // namespace drake
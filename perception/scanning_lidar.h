@@ -0,0 +1,152 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace perception {
+
+/// A scanning range sensor (e.g., a lidar) that measures the distance to the
+/// proximity geometry registered with SceneGraph along a fixed set of beams.
+///
+/// @system
+/// name: ScanningLidar
+/// input_ports:
+/// - geometry_query
+/// output_ports:
+/// - point_cloud
+/// - ranges
+/// @endsystem
+///
+/// The sensor is rigidly affixed to a parent frame P, with its own frame B
+/// posed at X_PB. Its beams all start at Bo and point along the directions
+/// given (as columns, expressed in B) to the constructor; see
+/// MakeSpinningBeamPattern() for the pattern of a typical spinning lidar.
+///
+/// The sensor scans periodically, at the given scan rate, starting at time
+/// zero. A scan is modeled as instantaneous: all beams are cast against the
+/// geometry at the configuration the `geometry_query` input reports at the
+/// scan's time (i.e., no motion blur or rolling shutter). Beams are cast with
+/// QueryObject::CastRays(), which intersects the beams against the proximity
+/// geometry's shapes (Mesh shapes are represented by the surfaces in their
+/// files, Convex shapes by their convex hulls) and, optionally, casts them in
+/// parallel. The results are held in the sensor's state until the next scan:
+///
+///  - `point_cloud` reports the points (expressed in B) at which the beams
+///    hit; the i-th point corresponds to the i-th beam. The points of beams
+///    that hit nothing within the maximum range are (+Inf, +Inf, +Inf),
+///    matching the convention used by the Point Cloud Library (PCL) and by
+///    DepthImageToPointCloud.
+///  - `ranges` reports the distance along each beam to its hit. Beams that hit
+///    nothing report the maximum range (the convention used by
+///    systems::sensors::BeamModel).
+///
+/// Until the first scan is performed, no beam has hit.
+///
+/// Beams are cast against every proximity geometry, including any geometry
+/// of the body the sensor is mounted on; Bo should therefore lie outside of
+/// the proximity geometry. Beam directions need not be unit vectors; they
+/// are normalized upon construction.
+///
+/// @ingroup perception_systems
+class ScanningLidar final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScanningLidar)
+
+  /// Constructs the sensor.
+  ///
+  /// @param parent_id    The id of the frame P the sensor is affixed to.
+  /// @param X_PB         The pose of the sensor frame B in P.
+  /// @param directions_B The directions of the beams, expressed in B.
+  /// @param scan_rate    The number of scans per second.
+  /// @param max_range    The maximum distance a beam can measure.
+  /// @param parallelism  Specifies the number of threads used to cast the
+  ///                     beams of a scan.
+  /// @throws std::exception if `directions_B` is empty or contains a zero
+  ///         vector, or if `scan_rate` or `max_range` is not positive and
+  ///         finite.
+  ScanningLidar(geometry::FrameId parent_id, const math::RigidTransformd& X_PB,
+                const Eigen::Ref<const Eigen::Matrix3Xd>& directions_B,
+                double scan_rate, double max_range,
+                Parallelism parallelism = Parallelism::None());
+
+  /// Returns the beam directions of a spinning multi-beam lidar, expressed in
+  /// the sensor frame B, whose x-axis points forward and whose z-axis points
+  /// up. Each of the given `elevations` (in radians, above the Bx-By plane)
+  /// is scanned at `num_azimuths` azimuths (measured about Bz from Bx) evenly
+  /// spaced over [min_azimuth, max_azimuth); the result has
+  /// `elevations.size() * num_azimuths` columns. Beams are ordered by
+  /// elevation and then by azimuth (i.e., beam `i * num_azimuths + j` has
+  /// elevation `i` and azimuth `j`), so that consecutive beams are adjacent
+  /// in the scan.
+  /// @throws std::exception if `num_azimuths` is not positive, `elevations`
+  ///         is empty, or `min_azimuth` is not less than `max_azimuth`.
+  static Eigen::Matrix3Xd MakeSpinningBeamPattern(
+      int num_azimuths, const std::vector<double>& elevations,
+      double min_azimuth = -M_PI, double max_azimuth = M_PI);
+
+  /// Returns the id of the parent frame P.
+  geometry::FrameId parent_frame_id() const { return parent_id_; }
+
+  /// Returns the pose of the sensor frame B in the parent frame P.
+  const math::RigidTransformd& X_PB() const { return X_PB_; }
+
+  /// Returns the (unit) beam directions, expressed in B.
+  const Eigen::Matrix3Xd& directions_B() const { return directions_B_; }
+
+  /// Returns the number of beams.
+  int num_beams() const { return directions_B_.cols(); }
+
+  /// Returns the period of the scans.
+  double scan_period() const { return scan_period_; }
+
+  /// Returns the maximum range.
+  double max_range() const { return max_range_; }
+
+  /// Returns the abstract-valued input port that expects a
+  /// geometry::QueryObject<double>.
+  const systems::InputPort<double>& query_object_input_port() const {
+    return this->get_input_port(query_object_input_port_);
+  }
+
+  /// Returns the abstract-valued output port that provides the PointCloud of
+  /// the most recent scan.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return this->get_output_port(point_cloud_output_port_);
+  }
+
+  /// Returns the vector-valued output port that provides the ranges of the
+  /// most recent scan.
+  const systems::OutputPort<double>& ranges_output_port() const {
+    return this->get_output_port(ranges_output_port_);
+  }
+
+ private:
+  // Casts all beams and records the results in `state`.
+  systems::EventStatus Scan(const systems::Context<double>& context,
+                            systems::State<double>* state) const;
+
+  const geometry::FrameId parent_id_;
+  const math::RigidTransformd X_PB_;
+  const Eigen::Matrix3Xd directions_B_;
+  const double scan_period_;
+  const double max_range_;
+  const Parallelism parallelism_;
+
+  systems::InputPortIndex query_object_input_port_{};
+  systems::OutputPortIndex point_cloud_output_port_{};
+  systems::OutputPortIndex ranges_output_port_{};
+  systems::AbstractStateIndex point_cloud_state_index_{};
+  systems::DiscreteStateIndex ranges_state_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,163 @@
+#include "drake/perception/scanning_lidar.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Matrix3Xd;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using Eigen::VectorXd;
+using geometry::Box;
+using geometry::GeometryInstance;
+using geometry::HalfSpace;
+using geometry::ProximityProperties;
+using geometry::SceneGraph;
+using geometry::SourceId;
+using math::RigidTransformd;
+using systems::DiagramBuilder;
+using systems::Simulator;
+
+GTEST_TEST(ScanningLidarTest, SpinningBeamPattern) {
+  const std::vector<double> elevations{0.0, -M_PI / 4};
+  const Matrix3Xd directions =
+      ScanningLidar::MakeSpinningBeamPattern(4, elevations);
+  ASSERT_EQ(directions.cols(), 8);
+  const double kTol = 1e-15;
+  // Ordered by elevation, then by azimuth in [-π, π).
+  EXPECT_TRUE(CompareMatrices(directions.col(0), Vector3d(-1, 0, 0), kTol));
+  EXPECT_TRUE(CompareMatrices(directions.col(1), Vector3d(0, -1, 0), kTol));
+  EXPECT_TRUE(CompareMatrices(directions.col(2), Vector3d(1, 0, 0), kTol));
+  EXPECT_TRUE(CompareMatrices(directions.col(3), Vector3d(0, 1, 0), kTol));
+  EXPECT_TRUE(CompareMatrices(directions.col(6),
+                              Vector3d(1, 0, -1).normalized(), kTol));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar::MakeSpinningBeamPattern(0, elevations),
+      ".*invalid pattern.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ScanningLidar::MakeSpinningBeamPattern(4, {}),
+                              ".*invalid pattern.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar::MakeSpinningBeamPattern(4, elevations, 1.0, 1.0),
+      ".*invalid pattern.*");
+}
+
+GTEST_TEST(ScanningLidarTest, Construction) {
+  const Matrix3Xd directions = 2 * Matrix3Xd::Identity(3, 3);
+  const ScanningLidar lidar(SceneGraph<double>::world_frame_id(),
+                            RigidTransformd(Vector3d(1, 2, 3)), directions,
+                            20.0, 5.0, Parallelism(2));
+  EXPECT_EQ(lidar.query_object_input_port().get_name(), "geometry_query");
+  EXPECT_EQ(lidar.point_cloud_output_port().get_name(), "point_cloud");
+  EXPECT_EQ(lidar.ranges_output_port().get_name(), "ranges");
+  EXPECT_EQ(lidar.num_beams(), 3);
+  EXPECT_EQ(lidar.scan_period(), 0.05);
+  EXPECT_EQ(lidar.max_range(), 5.0);
+  EXPECT_TRUE(
+      CompareMatrices(lidar.X_PB().translation(), Vector3d(1, 2, 3)));
+  // The directions are normalized.
+  EXPECT_TRUE(CompareMatrices(lidar.directions_B(), directions / 2));
+
+  // Before the first scan, no beam has hit.
+  auto context = lidar.CreateDefaultContext();
+  EXPECT_TRUE(CompareMatrices(lidar.ranges_output_port().Eval(*context),
+                              VectorXd::Constant(3, 5.0)));
+  const auto& cloud =
+      lidar.point_cloud_output_port().Eval<PointCloud>(*context);
+  ASSERT_EQ(cloud.size(), 3);
+  EXPECT_TRUE(cloud.xyzs().array().isInf().all());
+
+  const RigidTransformd X_PB;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar(SceneGraph<double>::world_frame_id(), X_PB,
+                    Matrix3Xd(3, 0), 10.0, 5.0),
+      ".*must have beams.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar(SceneGraph<double>::world_frame_id(), X_PB,
+                    Matrix3Xd::Zero(3, 2), 10.0, 5.0),
+      ".*beam direction 0 is not.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar(SceneGraph<double>::world_frame_id(), X_PB, directions,
+                    0.0, 5.0),
+      ".*scan rate must be positive.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ScanningLidar(SceneGraph<double>::world_frame_id(), X_PB, directions,
+                    10.0, std::numeric_limits<double>::infinity()),
+      ".*maximum range must be positive.*");
+}
+
+// Scans a scene of a ground plane and a box in front of the sensor.
+GTEST_TEST(ScanningLidarTest, Scan) {
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  const SourceId source_id = scene_graph->RegisterSource("scene");
+  const auto add_anchored = [&](std::unique_ptr<geometry::Shape> shape,
+                                const RigidTransformd& X_WG) {
+    const auto id = scene_graph->RegisterAnchoredGeometry(
+        source_id, std::make_unique<GeometryInstance>(X_WG, std::move(shape),
+                                                      "geometry"));
+    scene_graph->AssignRole(source_id, id, ProximityProperties());
+  };
+  add_anchored(std::make_unique<HalfSpace>(), RigidTransformd());
+  // The box's -x face is at x = 2.5.
+  add_anchored(std::make_unique<Box>(1.0, 4.0, 4.0),
+               RigidTransformd(Vector3d(3, 0, 1)));
+
+  // The sensor is one meter above the ground, and scans horizontally and 45°
+  // downwards, in four directions.
+  const double kMaxRange = 10.0;
+  auto* lidar = builder.AddSystem<ScanningLidar>(
+      SceneGraph<double>::world_frame_id(), RigidTransformd(Vector3d(0, 0, 1)),
+      ScanningLidar::MakeSpinningBeamPattern(4, {0.0, -M_PI / 4}), 10.0,
+      kMaxRange, Parallelism(2));
+  builder.Connect(scene_graph->get_query_output_port(),
+                  lidar->query_object_input_port());
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.AdvanceTo(0.01);
+  const auto& lidar_context =
+      lidar->GetMyContextFromRoot(simulator.get_context());
+
+  const double kTol = 1e-12;
+  VectorXd expected_ranges(8);
+  // Horizontally, only the beam pointing forward hits (the box).
+  expected_ranges.head<4>() << kMaxRange, kMaxRange, 2.5, kMaxRange;
+  // Downwards, all beams hit the ground.
+  expected_ranges.tail<4>().setConstant(std::sqrt(2.0));
+  EXPECT_TRUE(CompareMatrices(lidar->ranges_output_port().Eval(lidar_context),
+                              expected_ranges, kTol));
+
+  const auto& cloud =
+      lidar->point_cloud_output_port().Eval<PointCloud>(lidar_context);
+  ASSERT_EQ(cloud.size(), 8);
+  const float kInf = std::numeric_limits<float>::infinity();
+  std::vector<Vector3f> expected_points{
+      Vector3f::Constant(kInf), Vector3f::Constant(kInf),
+      Vector3f(2.5, 0, 0),      Vector3f::Constant(kInf),
+      Vector3f(-1, 0, -1),      Vector3f(0, -1, -1),
+      Vector3f(1, 0, -1),       Vector3f(0, 1, -1)};
+  for (int i = 0; i < 8; ++i) {
+    SCOPED_TRACE(fmt::format("beam {}", i));
+    EXPECT_TRUE(CompareMatrices(cloud.xyz(i), expected_points[i], 1e-6));
+  }
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -72,27 +72,34 @@ class LegacyDistanceAndInterpolationProvider final
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(LegacyDistanceAndInterpolationProvider);
 
+  // `interpolates_linearly` must be true iff `interpolation_function` is the
+  // default one (see MakeDefaultConfigurationInterpolationFunction()).
   LegacyDistanceAndInterpolationProvider(
       const ConfigurationDistanceFunction& distance_function,
-      const ConfigurationInterpolationFunction& interpolation_function)
+      const ConfigurationInterpolationFunction& interpolation_function,
+      bool interpolates_linearly)
       : distance_function_(distance_function),
-        interpolation_function_(interpolation_function) {
+        interpolation_function_(interpolation_function),
+        interpolates_linearly_(interpolates_linearly) {
     DRAKE_THROW_UNLESS(distance_function_ != nullptr);
     DRAKE_THROW_UNLESS(interpolation_function_ != nullptr);
   }
 
+  bool interpolates_linearly() const { return interpolates_linearly_; }
+
   std::shared_ptr<const LegacyDistanceAndInterpolationProvider>
   WithConfigurationDistanceFunction(
       const ConfigurationDistanceFunction& distance_function) const {
     return std::make_shared<LegacyDistanceAndInterpolationProvider>(
-        distance_function, interpolation_function_);
+        distance_function, interpolation_function_, interpolates_linearly_);
   }
 
   std::shared_ptr<const LegacyDistanceAndInterpolationProvider>
   WithConfigurationInterpolationFunction(
-      const ConfigurationInterpolationFunction& interpolation_function) const {
+      const ConfigurationInterpolationFunction& interpolation_function,
+      bool interpolates_linearly) const {
     return std::make_shared<LegacyDistanceAndInterpolationProvider>(
-        distance_function_, interpolation_function);
+        distance_function_, interpolation_function, interpolates_linearly);
   }
 
  private:
@@ -110,6 +117,7 @@ class LegacyDistanceAndInterpolationProvider final
  private:
   const ConfigurationDistanceFunction distance_function_;
   const ConfigurationInterpolationFunction interpolation_function_;
+  const bool interpolates_linearly_;
 };
 
 // Default interpolator; it uses SLERP for quaternion-valued groups of dofs and
@@ -636,15 +644,18 @@ void CollisionChecker::SetConfigurationInterpolationFunction(
         "has already been set.");
   }
   if (interpolation_function == nullptr) {
-    SetConfigurationInterpolationFunction(
-        MakeDefaultConfigurationInterpolationFunction(
-            GetQuaternionDofStartIndices(plant())));
+    distance_and_interpolation_provider_ =
+        legacy->WithConfigurationInterpolationFunction(
+            MakeDefaultConfigurationInterpolationFunction(
+                GetQuaternionDofStartIndices(plant())),
+            true /* interpolates_linearly */);
     return;
   }
   SanityCheckConfigurationInterpolationFunction(interpolation_function,
                                                 GetDefaultConfiguration());
   distance_and_interpolation_provider_ =
-      legacy->WithConfigurationInterpolationFunction(interpolation_function);
+      legacy->WithConfigurationInterpolationFunction(
+          interpolation_function, false /* interpolates_linearly */);
 }
 
 ConfigurationInterpolationFunction
@@ -679,6 +690,23 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
     return false;
   }
 
+  return DoCheckContextEdgeCollisionFree(model_context, q1, q2);
+}
+
+bool CollisionChecker::InterpolatesLinearly() const {
+  const auto* legacy =
+      dynamic_cast<const LegacyDistanceAndInterpolationProvider*>(
+          distance_and_interpolation_provider_.get());
+  if (legacy != nullptr) {
+    return legacy->interpolates_linearly();
+  }
+  return dynamic_cast<const LinearDistanceAndInterpolationProvider*>(
+             distance_and_interpolation_provider_.get()) != nullptr;
+}
+
+bool CollisionChecker::DoCheckContextEdgeCollisionFree(
+    CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
+    const Eigen::VectorXd& q2) const {
   const double distance = ComputeConfigurationDistance(q1, q2);
   const int num_steps =
       static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
@@ -982,7 +1010,8 @@ CollisionChecker::CollisionChecker(CollisionCheckerParams params,
             GetQuaternionDofStartIndices(plant()));
     distance_and_interpolation_provider_ =
         std::make_unique<LegacyDistanceAndInterpolationProvider>(
-            params.configuration_distance_function, default_interpolation_fn);
+            params.configuration_distance_function, default_interpolation_fn,
+            true /* interpolates_linearly */);
   } else {
     SetDistanceAndInterpolationProvider(
         std::make_unique<LinearDistanceAndInterpolationProvider>(plant()));
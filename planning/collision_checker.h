@@ -1185,6 +1185,25 @@ class CollisionChecker {
   virtual bool DoCheckContextConfigCollisionFree(
       const CollisionCheckerContext& model_context) const = 0;
 
+  /** Derived collision checkers can override the strategy used to check an
+   edge for collision in CheckContextEdgeCollisionFree() (and thus in
+   CheckEdgeCollisionFree() and CheckEdgesCollisionFree()). CollisionChecker
+   guarantees that `model_context` is not nullptr and that `q2` has already
+   been found to be collision free. The default implementation checks the
+   configurations interpolated between `q1` (inclusive) and `q2` (exclusive)
+   at intervals no larger than edge_step_size(). An override must not report
+   an edge as collision free if any of those configurations is in collision.
+   */
+  virtual bool DoCheckContextEdgeCollisionFree(
+      CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
+      const Eigen::VectorXd& q2) const;
+
+  /** Returns true iff configurations are interpolated linearly, with slerp for
+   quaternion DoF, as by LinearDistanceAndInterpolationProvider; i.e., neither
+   a custom ConfigurationInterpolationFunction nor a custom
+   DistanceAndInterpolationProvider is in use. */
+  bool InterpolatesLinearly() const;
+
   /** Does the work of adding a shape to be rigidly affixed to the body. Derived
    checkers can choose to ignore the request, but must return `nullopt` if they
    do so. */
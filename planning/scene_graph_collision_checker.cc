@@ -1,15 +1,28 @@
 #include "drake/planning/scene_graph_collision_checker.h"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/fmt_eigen.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_instance.h"
+#include "drake/geometry/read_obj.h"
 #include "drake/geometry/scene_graph.h"
+#include "drake/geometry/shape_specification.h"
 #include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
 #include "drake/planning/robot_diagram.h"
 
 namespace drake {
@@ -28,6 +41,7 @@ using geometry::SceneGraphInspector;
 using geometry::Shape;
 using geometry::SignedDistancePair;
 using math::RigidTransform;
+using math::RigidTransformd;
 using multibody::BodyIndex;
 using multibody::Frame;
 using multibody::JacobianWrtVariable;
@@ -35,6 +49,84 @@ using multibody::MultibodyPlant;
 using multibody::RigidBody;
 using systems::Context;
 
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// Computes the radius of a sphere, centered on the origin of a shape's frame,
+// that contains the shape. The radius is infinite if the shape's extent can't
+// be bounded.
+class BoundingRadiusCalculator final : public geometry::ShapeReifier {
+ public:
+  // The radii of the meshes read so far, keyed by file name and scale, which
+  // is retained across calculations so that each file is read only once.
+  using MeshRadii = std::map<std::pair<std::string, double>, double>;
+
+  explicit BoundingRadiusCalculator(MeshRadii* mesh_radii)
+      : mesh_radii_(mesh_radii) {
+    DRAKE_DEMAND(mesh_radii != nullptr);
+  }
+
+  double Calc(const Shape& shape) {
+    radius_ = kInf;
+    shape.Reify(this);
+    return radius_;
+  }
+
+ private:
+  using ShapeReifier::ImplementGeometry;
+
+  void ImplementGeometry(const geometry::Box& box, void*) final {
+    radius_ = box.size().norm() / 2;
+  }
+  void ImplementGeometry(const geometry::Capsule& capsule, void*) final {
+    radius_ = capsule.radius() + capsule.length() / 2;
+  }
+  void ImplementGeometry(const geometry::Convex& convex, void*) final {
+    radius_ = CalcMeshRadius(convex.filename(), convex.extension(),
+                             convex.scale());
+  }
+  void ImplementGeometry(const geometry::Cylinder& cylinder, void*) final {
+    radius_ = std::hypot(cylinder.radius(), cylinder.length() / 2);
+  }
+  void ImplementGeometry(const geometry::Ellipsoid& ellipsoid, void*) final {
+    radius_ = std::max({ellipsoid.a(), ellipsoid.b(), ellipsoid.c()});
+  }
+  void ImplementGeometry(const geometry::HalfSpace&, void*) final {
+    radius_ = kInf;
+  }
+  void ImplementGeometry(const geometry::Mesh& mesh, void*) final {
+    radius_ = CalcMeshRadius(mesh.filename(), mesh.extension(), mesh.scale());
+  }
+  void ImplementGeometry(const geometry::MeshcatCone& cone, void*) final {
+    radius_ = std::hypot(cone.height(), std::max(cone.a(), cone.b()));
+  }
+  void ImplementGeometry(const geometry::Sphere& sphere, void*) final {
+    radius_ = sphere.radius();
+  }
+
+  // Only OBJ files are read; the extent of other meshes isn't bounded.
+  double CalcMeshRadius(const std::string& filename,
+                        const std::string& extension, double scale) {
+    if (extension != ".obj") return kInf;
+    const auto [iter, inserted] =
+        mesh_radii_->emplace(std::make_pair(filename, scale), 0.0);
+    if (inserted) {
+      const std::shared_ptr<std::vector<Vector3d>> vertices = std::get<0>(
+          geometry::internal::ReadObjFile(filename, scale, false));
+      for (const Vector3d& p_GV : *vertices) {
+        iter->second = std::max(iter->second, p_GV.norm());
+      }
+    }
+    return iter->second;
+  }
+
+  MeshRadii* const mesh_radii_;
+  double radius_{kInf};
+};
+
+}  // namespace
+
 SceneGraphCollisionChecker::SceneGraphCollisionChecker(
     CollisionCheckerParams params)
     : CollisionChecker(std::move(params), true /* supports parallel */) {
@@ -43,6 +135,8 @@ SceneGraphCollisionChecker::SceneGraphCollisionChecker(
   // SceneGraph, as CollisionChecker introduces additional filters that may not
   // already be present in SceneGraph (e.g. environment-environment body pairs).
   ApplyCollisionFiltersToSceneGraph();
+  UpdateBodyRadii();
+  UpdateInboardJoints();
 }
 
 SceneGraphCollisionChecker::SceneGraphCollisionChecker(
@@ -91,6 +185,7 @@ std::optional<GeometryId> SceneGraphCollisionChecker::DoAddCollisionShapeToBody(
   // Ensure that filters in SceneGraph cover the new geometry, including the
   // within-body filter for the new geometry.
   ApplyCollisionFiltersToSceneGraph();
+  UpdateBodyRadii();
 
   return geometry_template.id();
 }
@@ -111,6 +206,7 @@ void SceneGraphCollisionChecker::RemoveAddedGeometries(
   };
 
   PerformOperationAgainstAllModelContexts(operation);
+  UpdateBodyRadii();
 }
 
 void SceneGraphCollisionChecker::UpdateCollisionFilters() {
@@ -163,6 +259,246 @@ bool SceneGraphCollisionChecker::DoCheckContextConfigCollisionFree(
   return true;
 }
 
+bool SceneGraphCollisionChecker::DoCheckContextEdgeCollisionFree(
+    CollisionCheckerContext* model_context, const Eigen::VectorXd& q1,
+    const Eigen::VectorXd& q2) const {
+  // Bounding the bodies' motion (see CalcMotionBounds()) relies on the joint
+  // positions being interpolated linearly.
+  if (!use_continuous_edge_checking_ || !InterpolatesLinearly()) {
+    return CollisionChecker::DoCheckContextEdgeCollisionFree(model_context, q1,
+                                                             q2);
+  }
+
+  // The ratio along the edge of the configuration held by the context.
+  double context_ratio{};
+  const auto q_at = [&](double ratio) {
+    return InterpolateBetweenConfigurations(q1, q2, ratio);
+  };
+  const auto check_config = [&](double ratio) {
+    context_ratio = ratio;
+    return CheckContextConfigCollisionFree(model_context, q_at(ratio));
+  };
+
+  // The caller has checked q2; we check q1. Thereafter, we maintain the
+  // invariant that the configurations at both ends of every segment on the
+  // stack are known to be collision free.
+  if (!check_config(0.0)) {
+    return false;
+  }
+
+  // The moving bodies: all bodies with geometry, except the world body.
+  std::vector<BodyIndex> bodies;
+  std::vector<FrameId> frame_ids;
+  for (BodyIndex i(1); i < plant().num_bodies(); ++i) {
+    const std::optional<FrameId> frame_id = plant().GetBodyFrameIdIfExists(i);
+    if (!frame_id.has_value() || body_radii_.at(i) == 0) continue;
+    bodies.push_back(i);
+    frame_ids.push_back(*frame_id);
+  }
+
+  // Returns the poses of the moving bodies in the configuration held by the
+  // context. The poses at the ends of each segment are computed once, and
+  // shared with the halves of the segment.
+  using Poses = std::shared_ptr<const std::vector<RigidTransformd>>;
+  const auto calc_poses = [&]() {
+    const Context<double>& plant_context = model_context->plant_context();
+    auto X_WBs = std::make_shared<std::vector<RigidTransformd>>();
+    X_WBs->reserve(bodies.size());
+    for (const BodyIndex i : bodies) {
+      X_WBs->push_back(
+          plant().EvalBodyPoseInWorld(plant_context, plant().get_body(i)));
+    }
+    return Poses(std::move(X_WBs));
+  };
+
+  const double edge_length = ComputeConfigurationDistance(q1, q2);
+  const double padding = std::max(0.0, GetLargestPadding());
+  struct Segment {
+    double a{};
+    double b{};
+    Poses X_WBs_a;
+    Poses X_WBs_b;
+  };
+  const Poses X_WBs_1 = calc_poses();
+  UpdateContextPositions(model_context, q2);
+  context_ratio = 1.0;
+  std::vector<Segment> segments{{0.0, 1.0, X_WBs_1, calc_poses()}};
+  while (!segments.empty()) {
+    const Segment segment = std::move(segments.back());
+    segments.pop_back();
+    const double a = segment.a;
+    const double b = segment.b;
+    const Eigen::VectorXd q_a = q_at(a);
+    const Eigen::VectorXd q_b = q_at(b);
+
+    // The continuous query moves each body from its pose at q_a to its pose at
+    // q_b along a linearly interpolated pose, whereas the body actually
+    // follows the joints' linear interpolation. We bound the distance between
+    // the two positions of any point of any body over the whole segment: the
+    // difference vanishes at both ends, so it is at most an eighth of a bound
+    // on its second derivative (with respect to the segment's normalized
+    // length). With the joints' motion bounded by CalcMotionBounds(), the
+    // point's actual acceleration is at most 3 ⋅ rotation ⋅ travel, and along
+    // the linearly interpolated pose (a constant rate of rotation by `angle`)
+    // it is at most angle² ⋅ radius.
+    double deviation = 0;
+    std::unordered_map<FrameId, RigidTransformd> X_WFs_end;
+    for (size_t k = 0; k < bodies.size() && std::isfinite(deviation); ++k) {
+      const RigidTransformd& X_WB_a = (*segment.X_WBs_a)[k];
+      const RigidTransformd& X_WB_b = (*segment.X_WBs_b)[k];
+      const auto [rotation, travel] =
+          CalcMotionBounds(*model_context, bodies[k], q_a, q_b);
+      double acceleration = rotation > 0 ? 3 * rotation * travel : 0;
+      const double angle = X_WB_a.rotation().ToQuaternion().angularDistance(
+          X_WB_b.rotation().ToQuaternion());
+      if (angle > 0) {
+        acceleration += angle * angle * body_radii_.at(bodies[k]);
+      }
+      deviation = std::max(deviation, acceleration / 8);
+      X_WFs_end.emplace(frame_ids[k], X_WB_b);
+    }
+
+    if (!std::isfinite(deviation)) {
+      // The deviation can't be bounded; sample the segment instead.
+      const int num_steps = static_cast<int>(
+          std::max(1.0, std::ceil((b - a) * edge_length / edge_step_size())));
+      for (int step = 1; step < num_steps; ++step) {
+        if (!check_config(a + (b - a) * step / num_steps)) {
+          return false;
+        }
+      }
+      continue;
+    }
+
+    // N.B. The continuous query moves the bodies from the configuration held
+    // by the context.
+    if (context_ratio != a) {
+      UpdateContextPositions(model_context, q_a);
+      context_ratio = a;
+    }
+    const QueryObject<double>& query_object = model_context->GetQueryObject();
+    const std::optional<geometry::TimeOfImpact> impact =
+        query_object.ComputeTimeOfImpact(X_WFs_end, padding + 2 * deviation);
+    if (!impact.has_value()) continue;
+    // Check the configuration at the time of impact, hoping to find a
+    // collision sooner.
+    const double ratio = a + impact->time * (b - a);
+    if (ratio > a && !check_config(ratio)) {
+      return false;
+    }
+
+    // The segment may be in collision. We split it until it is no longer than
+    // the edge step size; past that, we conservatively report a collision.
+    if ((b - a) * edge_length <= edge_step_size()) {
+      return false;
+    }
+    const double m = (a + b) / 2;
+    if (!check_config(m)) {
+      return false;
+    }
+    const Poses X_WBs_m = calc_poses();
+    segments.push_back({m, b, X_WBs_m, segment.X_WBs_b});
+    segments.push_back({a, m, segment.X_WBs_a, X_WBs_m});
+  }
+  return true;
+}
+
+std::pair<double, double> SceneGraphCollisionChecker::CalcMotionBounds(
+    const CollisionCheckerContext& model_context, BodyIndex body_index,
+    const Eigen::VectorXd& q_a, const Eigen::VectorXd& q_b) const {
+  // We walk the joints from B to the world, maintaining `reach`, a bound on
+  // the distance from the current joint's origin to any point of B over the
+  // segment. A revolute joint that turns by Δθ moves any point of B along a
+  // path no longer than reach ⋅ |Δθ|, and a prismatic joint that slides by Δd
+  // moves it along a path no longer than |Δd|; the paths of all joints add up.
+  double reach = body_radii_.at(body_index);
+  double rotation = 0;
+  double travel = 0;
+  for (const InboardJoint& inboard : inboard_joints_.at(body_index)) {
+    reach += inboard.offset;
+    const multibody::Joint<double>& joint = plant().get_joint(inboard.joint);
+    const int start = joint.position_start();
+    const int size = joint.num_positions();
+    const double change =
+        (q_b.segment(start, size) - q_a.segment(start, size)).norm();
+    const std::string& type = joint.type_name();
+    if (type == multibody::RevoluteJoint<double>::kTypeName) {
+      if (change > 0) {
+        rotation += change;
+        travel += reach * change;
+      }
+    } else if (type == multibody::PrismaticJoint<double>::kTypeName) {
+      travel += change;
+      reach += std::max(std::abs(q_a[start]), std::abs(q_b[start]));
+    } else if (type == multibody::WeldJoint<double>::kTypeName) {
+      reach += dynamic_cast<const multibody::WeldJoint<double>&>(joint)
+                   .X_FM()
+                   .translation()
+                   .norm();
+    } else {
+      // We don't bound the motion of other kinds of joints. The pose of such
+      // a joint's child frame in its parent frame only depends on the joint's
+      // positions, which are the same for the whole segment when it doesn't
+      // move.
+      if (change > 0) {
+        return {kInf, kInf};
+      }
+      reach += plant()
+                   .CalcRelativeTransform(model_context.plant_context(),
+                                          joint.frame_on_parent(),
+                                          joint.frame_on_child())
+                   .translation()
+                   .norm();
+    }
+  }
+  return {rotation, travel};
+}
+
+void SceneGraphCollisionChecker::UpdateBodyRadii() {
+  const SceneGraphInspector<double>& inspector =
+      model_context(0).GetQueryObject().inspector();
+  BoundingRadiusCalculator calculator(&mesh_radii_);
+  body_radii_.assign(plant().num_bodies(), 0.0);
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    const std::optional<FrameId> frame_id = plant().GetBodyFrameIdIfExists(i);
+    if (!frame_id.has_value()) continue;
+    for (const GeometryId geometry_id :
+         inspector.GetGeometries(*frame_id, geometry::Role::kProximity)) {
+      const RigidTransformd& X_BG = inspector.GetPoseInFrame(geometry_id);
+      body_radii_[i] =
+          std::max(body_radii_[i], X_BG.translation().norm() +
+                                       calculator.Calc(inspector.GetShape(
+                                           geometry_id)));
+    }
+  }
+}
+
+void SceneGraphCollisionChecker::UpdateInboardJoints() {
+  // The inboard joint of each body, if any.
+  std::vector<std::optional<multibody::JointIndex>> inboard(
+      plant().num_bodies());
+  for (multibody::JointIndex j(0); j < plant().num_joints(); ++j) {
+    inboard[plant().get_joint(j).child_body().index()] = j;
+  }
+  inboard_joints_.assign(plant().num_bodies(), {});
+  for (BodyIndex i(1); i < plant().num_bodies(); ++i) {
+    // The point that the previous joint is attached to, in the current body.
+    Vector3d p_LP = Vector3d::Zero();
+    BodyIndex current = i;
+    while (current != multibody::world_index()) {
+      DRAKE_DEMAND(inboard[current].has_value());
+      const multibody::Joint<double>& joint =
+          plant().get_joint(*inboard[current]);
+      const Vector3d p_LMo =
+          joint.frame_on_child().GetFixedPoseInBodyFrame().translation();
+      inboard_joints_[i].push_back(
+          {.joint = joint.index(), .offset = (p_LMo - p_LP).norm()});
+      p_LP = joint.frame_on_parent().GetFixedPoseInBodyFrame().translation();
+      current = joint.parent_body().index();
+    }
+  }
+}
+
 RobotClearance SceneGraphCollisionChecker::DoCalcContextRobotClearance(
     const CollisionCheckerContext& model_context,
     const double influence_distance) const {
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "drake/planning/collision_checker.h"
@@ -15,6 +17,47 @@ namespace planning {
 collision checks. Its behavior and limitations are exactly those of SceneGraph,
 e.g., in terms of what kinds of geometries can be collided.
 
+@anchor sgcc_continuous_edge_checking
+<h3>Continuous edge checking</h3>
+
+By default, edges are checked like in any other CollisionChecker: by checking
+configurations sampled along the edge at intervals of edge_step_size(). With
+set_use_continuous_edge_checking(true), CheckEdgeCollisionFree() (and the
+other single-threaded edge checks built on it) instead uses SceneGraph's
+continuous collision query (geometry::QueryObject::ComputeTimeOfImpact()),
+which needs far fewer narrowphase queries per edge when the robot stays away
+from obstacles.
+
+The continuous query moves each body along a linearly interpolated pose,
+whereas the edge interpolates linearly in configuration space. The checker
+bounds the difference over each whole edge segment. The difference vanishes
+at the segment's ends, so it is bounded by the accelerations along both
+motions: along the edge, those follow from the angles turned by the revolute
+joints between each body and the world, the travel of its prismatic joints,
+and the distances from the joints' axes to the body's geometry; along the
+interpolated pose, from the body's rotation angle and its bounding radius.
+The bound shrinks quadratically with the segment's length. A segment is
+checked at once after inflating the collision padding by twice the largest
+such bound. A segment for which an impact is reported is split in half, its
+midpoint configuration is checked, and its halves are checked in turn. Once a
+segment no longer than edge_step_size() still reports an impact, the edge is
+conservatively reported to be in collision, even though the impact may only be
+due to the inflated padding. Thus, rather than possibly tunneling through thin
+obstacles between samples, edges that pass within the padding (plus a margin
+that shrinks with edge_step_size()) of an obstacle are rejected.
+
+Continuous edge checking applies to Mesh and Convex shapes via their convex
+hulls (as for all SceneGraph distance queries). Segments along which the bound
+can't be computed fall back to sampling at intervals of edge_step_size(): those
+in which a body whose geometry extent can't be bounded (e.g., a HalfSpace or a
+non-OBJ mesh) rotates, and those in which a joint other than a revolute,
+prismatic, or weld joint (e.g., a floating joint) moves. Whole edges fall back
+to sampling when a custom configuration interpolation function (or a
+DistanceAndInterpolationProvider other than
+LinearDistanceAndInterpolationProvider) is in use.
+CheckEdgeCollisionFreeParallel() and the edge measuring functions always use
+sampling.
+
 @ingroup planning_collision_checker
 */
 class SceneGraphCollisionChecker final : public CollisionChecker {
@@ -28,6 +71,18 @@ class SceneGraphCollisionChecker final : public CollisionChecker {
   /** Creates a new checker with the given params. */
   explicit SceneGraphCollisionChecker(CollisionCheckerParams params);
 
+  /** Reports whether edges are checked continuously.
+   See @ref sgcc_continuous_edge_checking "Continuous edge checking". */
+  bool use_continuous_edge_checking() const {
+    return use_continuous_edge_checking_;
+  }
+
+  /** Sets whether edges are checked continuously.
+   See @ref sgcc_continuous_edge_checking "Continuous edge checking". */
+  void set_use_continuous_edge_checking(bool use_continuous_edge_checking) {
+    use_continuous_edge_checking_ = use_continuous_edge_checking;
+  }
+
  private:
   // To support Clone(), allow copying (but not move nor assign).
   explicit SceneGraphCollisionChecker(const SceneGraphCollisionChecker&);
@@ -39,6 +94,10 @@ class SceneGraphCollisionChecker final : public CollisionChecker {
   bool DoCheckContextConfigCollisionFree(
       const CollisionCheckerContext& model_context) const final;
 
+  bool DoCheckContextEdgeCollisionFree(CollisionCheckerContext* model_context,
+                                       const Eigen::VectorXd& q1,
+                                       const Eigen::VectorXd& q2) const final;
+
   std::optional<geometry::GeometryId> DoAddCollisionShapeToBody(
       const std::string& group_name, const multibody::RigidBody<double>& bodyA,
       const geometry::Shape& shape,
@@ -65,6 +124,50 @@ class SceneGraphCollisionChecker final : public CollisionChecker {
   // geometry is added to SceneGraph, as any existing filters will not include
   // the new geometry.
   void ApplyCollisionFiltersToSceneGraph();
+
+  // Bounds the motion of the given body as the joint positions are
+  // interpolated linearly from `q_a` to `q_b`. Returns (rotation, travel):
+  // the sum of the angles turned by the revolute joints between the body and
+  // the world, which bounds the angle turned by the body (and by the axis of
+  // each of those joints), and a bound on the length of the path of any point
+  // of the body. Both are infinite when the motion of some joint (e.g., a
+  // floating joint) isn't bounded.
+  std::pair<double, double> CalcMotionBounds(
+      const CollisionCheckerContext& model_context,
+      multibody::BodyIndex body_index, const Eigen::VectorXd& q_a,
+      const Eigen::VectorXd& q_b) const;
+
+  // Updates body_radii_ from the geometries currently registered in SceneGraph.
+  // This must be called in the constructor and after any geometry is added to
+  // or removed from SceneGraph.
+  void UpdateBodyRadii();
+
+  // Updates inboard_joints_ from the plant. This must be called in the
+  // constructor.
+  void UpdateInboardJoints();
+
+  bool use_continuous_edge_checking_{false};
+
+  // For each body B (indexed by BodyIndex), the radius of a sphere, centered
+  // on Bo, that contains all of B's proximity geometries; zero if B has none,
+  // infinite if their extent can't be bounded.
+  std::vector<double> body_radii_;
+
+  // The bounding radii of the meshes read by UpdateBodyRadii(), keyed by file
+  // name and scale.
+  std::map<std::pair<std::string, double>, double> mesh_radii_;
+
+  // A joint on the path from a body B to the world, along with the distance
+  // from the origin of the joint's child frame to the origin of the previous
+  // joint's parent frame (or, for B's inboard joint, to Bo).
+  struct InboardJoint {
+    multibody::JointIndex joint;
+    double offset{};
+  };
+
+  // For each body (indexed by BodyIndex), the joints on its path to the world,
+  // starting with its inboard joint.
+  std::vector<std::vector<InboardJoint>> inboard_joints_;
 };
 
 }  // namespace planning
@@ -503,6 +503,101 @@ directives:
   }
 }
 
+// A one-link arm, rotating about the world's z axis, sweeps past a post. The
+// edge step size is coarse enough that sampling tunnels through the post;
+// continuous edge checking detects the collision.
+GTEST_TEST(SceneGraphCollisionCheckerTest, ContinuousEdgeChecking) {
+  RobotDiagramBuilder<double> builder;
+  const std::string model_data = R"""(
+<?xml version='1.0'?>
+<sdf xmlns:drake='http://drake.mit.edu' version='1.9'>
+<world name='default'>
+  <model name='robot'>
+    <link name='arm'>
+      <collision name='arm_collision'>
+        <pose>1 0 0 0 0 0</pose>
+        <geometry><box><size>2 0.1 0.1</size></box></geometry>
+      </collision>
+    </link>
+    <joint name='arm_joint' type='revolute'>
+      <parent>world</parent>
+      <child>arm</child>
+      <axis><xyz>0 0 1</xyz></axis>
+    </joint>
+  </model>
+  <model name='environment'>
+    <static>true</static>
+    <link name='post'>
+      <pose>0 1.5 0 0 0 0</pose>
+      <collision name='post_collision'>
+        <geometry><sphere><radius>0.1</radius></sphere></geometry>
+      </collision>
+    </link>
+  </model>
+</world>
+</sdf>
+)""";
+  builder.parser().AddModelsFromString(model_data, "sdf");
+
+  const auto& plant = builder.plant();
+  CollisionCheckerParams params;
+  params.model = builder.Build();
+  params.robot_model_instances.push_back(plant.GetModelInstanceByName("robot"));
+  params.configuration_distance_function = [](const VectorXd& q1,
+                                              const VectorXd& q2) {
+    return (q1 - q2).norm();
+  };
+  params.edge_step_size = 0.5;
+  SceneGraphCollisionChecker dut(std::move(params));
+  EXPECT_FALSE(dut.use_continuous_edge_checking());
+
+  // The arm sweeps through the post at q = π/2.
+  const VectorXd q_start = Vector1d(0.0);
+  const VectorXd q_through = Vector1d(M_PI);
+  const VectorXd q_away = Vector1d(-1.0);
+  ASSERT_TRUE(dut.CheckConfigCollisionFree(q_start));
+  ASSERT_TRUE(dut.CheckConfigCollisionFree(q_through));
+  ASSERT_FALSE(dut.CheckConfigCollisionFree(Vector1d(M_PI / 2)));
+
+  // Sampling tunnels through the post.
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q_start, q_through));
+
+  dut.set_use_continuous_edge_checking(true);
+  EXPECT_TRUE(dut.use_continuous_edge_checking());
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q_start, q_through));
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q_through, q_start));
+  EXPECT_TRUE(dut.CheckEdgeCollisionFree(q_start, q_away));
+  const std::vector<uint8_t> edge_results = dut.CheckEdgesCollisionFree(
+      {{q_start, q_through}, {q_start, q_away}}, Parallelism::None());
+  EXPECT_THAT(edge_results, ElementsAre(0, 1));
+
+  // Clones preserve the mode.
+  const std::unique_ptr<CollisionChecker> clone = dut.Clone();
+  EXPECT_FALSE(clone->CheckEdgeCollisionFree(q_start, q_through));
+
+  // The motion can't be bounded with a custom interpolation function, so
+  // the edges are sampled instead.
+  clone->SetConfigurationInterpolationFunction(
+      [](const VectorXd& q1, const VectorXd& q2, double ratio) {
+        return q1 + ratio * (q2 - q1);
+      });
+  EXPECT_TRUE(clone->CheckEdgeCollisionFree(q_start, q_through));
+  clone->SetConfigurationInterpolationFunction(nullptr);
+  EXPECT_FALSE(clone->CheckEdgeCollisionFree(q_start, q_through));
+
+  // Shapes added to the arm are accounted for: a sphere mounted ahead of the
+  // arm sweeps through the post even though the arm itself stops short of it.
+  const VectorXd q_short = Vector1d(M_PI / 2 - 0.3);
+  ASSERT_TRUE(dut.CheckEdgeCollisionFree(q_start, q_short));
+  const double angle = 0.6;
+  ASSERT_TRUE(dut.AddCollisionShapeToBody(
+      "extension", dut.plant().GetBodyByName("arm"), geometry::Sphere(0.1),
+      math::RigidTransformd(
+          Vector3d(1.5 * std::cos(angle), 1.5 * std::sin(angle), 0))));
+  ASSERT_TRUE(dut.CheckConfigCollisionFree(q_short));
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q_start, q_short));
+}
+
 }  // namespace test
 }  // namespace planning
 }  // namespace drake
@@ -0,0 +1,452 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/extract_double.h"
+#include "drake/systems/analysis/explicit_euler_integrator.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/witness_function.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+template <typename T>
+std::unique_ptr<IntegratorBase<T>> MakeFixedStepIntegrator(
+    const System<T>& system, const BatchSimulatorConfig& config,
+    Context<T>* context) {
+  const std::string& scheme = config.integration_scheme;
+  const T max_step_size(config.max_step_size);
+  if (scheme == "explicit_euler") {
+    return std::make_unique<ExplicitEulerIntegrator<T>>(
+        system, max_step_size, context);
+  }
+  if (scheme == "runge_kutta2") {
+    return std::make_unique<RungeKutta2Integrator<T>>(
+        system, max_step_size, context);
+  }
+  if (scheme == "runge_kutta3") {
+    auto integrator =
+        std::make_unique<RungeKutta3Integrator<T>>(system, context);
+    integrator->set_maximum_step_size(config.max_step_size);
+    integrator->set_fixed_step_mode(true);
+    return integrator;
+  }
+  throw std::logic_error(fmt::format(
+      "BatchSimulator: Unsupported integration scheme '{}'; the supported "
+      "schemes are 'explicit_euler', 'runge_kutta2', and 'runge_kutta3'.",
+      scheme));
+}
+
+}  // namespace
+
+template <typename T>
+BatchSimulator<T>::BatchSimulator(const System<T>& system, int batch_size,
+                                  const BatchSimulatorConfig& config,
+                                  Parallelism parallelism)
+    : system_(system),
+      num_threads_(parallelism.num_threads()),
+      static_event_timing_(system.has_static_event_timing()) {
+  DRAKE_THROW_UNLESS(batch_size > 0);
+  DRAKE_THROW_UNLESS(config.max_step_size > 0);
+
+  // The batch starts from copies of one default context.
+  contexts_.push_back(system_.CreateDefaultContext());
+  for (int i = 1; i < batch_size; ++i) {
+    contexts_.push_back(contexts_[0]->Clone());
+  }
+  for (int i = 0; i < batch_size; ++i) {
+    integrators_.push_back(
+        MakeFixedStepIntegrator(system_, config, contexts_[i].get()));
+    discrete_updates_.push_back(system_.AllocateDiscreteVariables());
+    unrestricted_updates_.push_back(contexts_[i]->CloneState());
+    per_step_events_.push_back(system_.AllocateCompositeEventCollection());
+    if (i == 0 || !static_event_timing_) {
+      timed_events_.push_back(system_.AllocateCompositeEventCollection());
+    }
+    end_of_step_events_.push_back(system_.AllocateCompositeEventCollection());
+    pending_events_.push_back(per_step_events_.back().get());
+  }
+  event_statuses_.resize(batch_size, EventStatus::DidNothing());
+  step_results_.resize(batch_size, IntegratorBase<T>::kTimeHasAdvanced);
+  next_event_times_.resize(timed_events_.size());
+}
+
+template <typename T>
+BatchSimulator<T>::~BatchSimulator() = default;
+
+template <typename T>
+const Context<T>& BatchSimulator<T>::get_context(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < batch_size());
+  return *contexts_[i];
+}
+
+template <typename T>
+Context<T>& BatchSimulator<T>::get_mutable_context(int i) {
+  DRAKE_THROW_UNLESS(i >= 0 && i < batch_size());
+  return *contexts_[i];
+}
+
+template <typename T>
+const IntegratorBase<T>& BatchSimulator<T>::get_integrator(int i) const {
+  DRAKE_THROW_UNLESS(i >= 0 && i < batch_size());
+  return *integrators_[i];
+}
+
+template <typename T>
+SimulatorStatus BatchSimulator<T>::Initialize() {
+  initialization_done_ = false;
+  ThrowUnlessTimesAgree("Initialize");
+  std::vector<const WitnessFunction<T>*> witness_functions;
+  system_.GetWitnessFunctions(*contexts_[0], &witness_functions);
+  if (!witness_functions.empty()) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator::Initialize(): System '{}' has witness functions, "
+        "which the BatchSimulator does not support.",
+        system_.GetSystemPathname()));
+  }
+
+  // *Don't* use a reference here; the time is perturbed below.
+  const T current_time = get_time();
+  SimulatorStatus initialize_status(ExtractDoubleOrThrow(current_time));
+  for (auto& integrator : integrators_) {
+    integrator->Initialize();
+  }
+  num_steps_taken_ = 0;
+
+  // Handle the initialization update events.
+  for (auto& events : timed_events_) {
+    events->Clear();
+  }
+  std::vector<std::unique_ptr<CompositeEventCollection<T>>> merged_events(
+      batch_size());
+  ForEachContext([this, &merged_events](int i) {
+    merged_events[i] = system_.AllocateCompositeEventCollection();
+    system_.GetInitializationEvents(*contexts_[i], merged_events[i].get());
+    event_statuses_[i] = HandleUpdates(i, *merged_events[i]);
+    per_step_events_[i]->Clear();
+    end_of_step_events_[i]->Clear();
+    pending_events_[i] = per_step_events_[i].get();
+  });
+
+  if (!ReachedTermination(&initialize_status)) {
+    // Collect the per-step events and the timed events that trigger now, as
+    // Simulator::Initialize() does, then handle the publish events that are
+    // due now.
+    auto calc_timed_events = [this, &current_time](int i) {
+      Context<T>& context = *contexts_[i];
+      context.PerturbTime(internal::GetPreviousNormalizedValue(current_time),
+                          current_time);
+      next_event_times_[i] =
+          system_.CalcNextUpdateTime(context, timed_events_[i].get());
+      context.SetTime(current_time);
+    };
+    if (static_event_timing_) calc_timed_events(0);
+    ForEachContext([&](int i) {
+      system_.GetPerStepEvents(*contexts_[i], per_step_events_[i].get());
+      if (!static_event_timing_) calc_timed_events(i);
+      end_of_step_events_[i]->AddToEnd(*per_step_events_[i]);
+      end_of_step_events_[i]->AddToEnd(timed_events(i));
+      if (next_event_time(i) == current_time) {
+        pending_events_[i] = end_of_step_events_[i].get();
+      }
+      merged_events[i]->AddToEnd(*pending_events_[i]);
+      event_statuses_[i] = HandlePublishes(i, *merged_events[i]);
+    });
+    ReachedTermination(&initialize_status);
+  }
+
+  last_known_simtime_ = ExtractDoubleOrThrow(current_time);
+  initialization_done_ = true;
+  return initialize_status;
+}
+
+template <typename T>
+SimulatorStatus BatchSimulator<T>::AdvanceTo(const T& boundary_time) {
+  if (!initialization_done_) {
+    const SimulatorStatus initialize_status = Initialize();
+    if (!initialize_status.succeeded()) return initialize_status;
+  }
+  ThrowUnlessTimesAgree("AdvanceTo");
+  if (last_known_simtime_ != get_time()) {
+    throw std::logic_error(
+        "BatchSimulator::AdvanceTo(): Simulation time has changed since last "
+        "Initialize() or AdvanceTo(). Resetting simulation time requires a "
+        "call to Initialize().");
+  }
+  DRAKE_THROW_UNLESS(boundary_time >= get_time());
+
+  // Assume success.
+  SimulatorStatus status(ExtractDoubleOrThrow(boundary_time));
+
+  while (true) {
+    // Handle the update events that start the step.
+    ForEachContext([this](int i) {
+      event_statuses_[i] = HandleUpdates(i, *pending_events_[i]);
+    });
+    if (ReachedTermination(&status)) break;
+
+    // Compute the event schedule: once, from the first Context, if the
+    // System's event timing is static, and otherwise for each Context. The
+    // events that were pending are no longer needed, so their collections may
+    // be rebuilt.
+    if (static_event_timing_) {
+      next_event_times_[0] =
+          system_.CalcNextUpdateTime(*contexts_[0], timed_events_[0].get());
+    }
+    ForEachContext([this](int i) {
+      if (!static_event_timing_) {
+        next_event_times_[i] =
+            system_.CalcNextUpdateTime(*contexts_[i], timed_events_[i].get());
+      }
+      end_of_step_events_[i]->Clear();
+      end_of_step_events_[i]->AddToEnd(*per_step_events_[i]);
+      end_of_step_events_[i]->AddToEnd(timed_events(i));
+    });
+
+    // The batch steps no further than the earliest timed events of any of its
+    // Contexts.
+    const T step_start_time = get_time();
+    T next_update_time = std::numeric_limits<double>::infinity();
+    T next_publish_time = std::numeric_limits<double>::infinity();
+    const int num_schedules = static_event_timing_ ? 1 : batch_size();
+    for (int i = 0; i < num_schedules; ++i) {
+      DRAKE_DEMAND(next_event_times_[i] >= step_start_time);
+      if (timed_events_[i]->HasDiscreteUpdateEvents() ||
+          timed_events_[i]->HasUnrestrictedUpdateEvents()) {
+        next_update_time = std::min(next_update_time, next_event_times_[i]);
+      }
+      if (timed_events_[i]->HasPublishEvents()) {
+        next_publish_time = std::min(next_publish_time, next_event_times_[i]);
+      }
+    }
+
+    // Integrate, then handle the publish events that end the step. A Context
+    // handles its timed events only if the step ended at their time; the
+    // integrators set the time to exactly that of the event they reached.
+    ForEachContext([&](int i) {
+      const typename IntegratorBase<T>::StepResult result =
+          integrators_[i]->IntegrateNoFurtherThanTime(
+              next_publish_time, next_update_time, boundary_time);
+      step_results_[i] = result;
+      const bool time_triggered =
+          (result == IntegratorBase<T>::kReachedUpdateTime ||
+           result == IntegratorBase<T>::kReachedPublishTime) &&
+          contexts_[i]->get_time() == next_event_time(i);
+      pending_events_[i] = time_triggered ? end_of_step_events_[i].get()
+                                          : per_step_events_[i].get();
+      event_statuses_[i] = HandlePublishes(i, *pending_events_[i]);
+    });
+    ++num_steps_taken_;
+
+    // The fixed-step integrators choose their steps from the times alone, so
+    // the batch remains in lock-step.
+    for (int i = 1; i < batch_size(); ++i) {
+      DRAKE_DEMAND(step_results_[i] == step_results_[0]);
+    }
+    DRAKE_DEMAND(step_results_[0] != IntegratorBase<T>::kReachedZeroCrossing &&
+                 step_results_[0] != IntegratorBase<T>::kReachedStepLimit);
+
+    if (ReachedTermination(&status) || get_time() >= boundary_time) break;
+  }
+
+  last_known_simtime_ = ExtractDoubleOrThrow(get_time());
+  return status;
+}
+
+template <typename T>
+MatrixX<T> BatchSimulator<T>::GetContinuousStates() const {
+  const int num_states = contexts_[0]->num_continuous_states();
+  MatrixX<T> x(num_states, batch_size());
+  for (int i = 0; i < batch_size(); ++i) {
+    x.col(i) = contexts_[i]->get_continuous_state_vector().CopyToVector();
+  }
+  return x;
+}
+
+template <typename T>
+void BatchSimulator<T>::SetContinuousStates(
+    const Eigen::Ref<const MatrixX<T>>& x) {
+  DRAKE_THROW_UNLESS(x.rows() == contexts_[0]->num_continuous_states());
+  DRAKE_THROW_UNLESS(x.cols() == batch_size());
+  for (int i = 0; i < batch_size(); ++i) {
+    contexts_[i]->SetContinuousState(x.col(i));
+  }
+}
+
+template <typename T>
+MatrixX<T> BatchSimulator<T>::GetDiscreteStates(int group_index) const {
+  DRAKE_THROW_UNLESS(group_index >= 0 &&
+                     group_index < contexts_[0]->num_discrete_state_groups());
+  const int group_size =
+      contexts_[0]->get_discrete_state(group_index).size();
+  MatrixX<T> xd(group_size, batch_size());
+  for (int i = 0; i < batch_size(); ++i) {
+    xd.col(i) = contexts_[i]->get_discrete_state(group_index).value();
+  }
+  return xd;
+}
+
+template <typename T>
+void BatchSimulator<T>::SetDiscreteStates(
+    const Eigen::Ref<const MatrixX<T>>& xd, int group_index) {
+  DRAKE_THROW_UNLESS(group_index >= 0 &&
+                     group_index < contexts_[0]->num_discrete_state_groups());
+  DRAKE_THROW_UNLESS(
+      xd.rows() == contexts_[0]->get_discrete_state(group_index).size());
+  DRAKE_THROW_UNLESS(xd.cols() == batch_size());
+  for (int i = 0; i < batch_size(); ++i) {
+    contexts_[i]->SetDiscreteState(group_index, xd.col(i));
+  }
+}
+
+template <typename T>
+MatrixX<T> BatchSimulator<T>::EvalVectorOutputs(
+    const OutputPort<T>& port) const {
+  if (&port.get_system() != &system_) {
+    throw std::logic_error(fmt::format(
+        "BatchSimulator::EvalVectorOutputs(): Output port '{}' does not "
+        "belong to System '{}'.",
+        port.GetFullDescription(), system_.GetSystemPathname()));
+  }
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  MatrixX<T> y(port.size(), batch_size());
+  ForEachContext([this, &port, &y](int i) {
+    y.col(i) = port.Eval(*contexts_[i]);
+  });
+  return y;
+}
+
+template <typename T>
+void BatchSimulator<T>::ForEachContext(
+    const std::function<void(int)>& work) const {
+  const int num_contexts = batch_size();
+  const int num_threads = std::min(num_threads_, num_contexts);
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_contexts; ++i) {
+      work(i);
+    }
+    return;
+  }
+
+  // Each thread claims the next unclaimed context until none remain.
+  std::atomic<int> next_index{0};
+  std::mutex mutex;
+  std::exception_ptr error;
+  auto run = [&]() {
+    for (int i = next_index++; i < num_contexts; i = next_index++) {
+      try {
+        work(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error == nullptr) error = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i < num_threads; ++i) {
+    futures.push_back(std::async(std::launch::async, run));
+  }
+  run();
+  for (auto& future : futures) {
+    future.get();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <typename T>
+EventStatus BatchSimulator<T>::HandleUpdates(
+    int i, const CompositeEventCollection<T>& events) {
+  Context<T>& context = *contexts_[i];
+
+  // Do unrestricted updates first.
+  EventStatus status = EventStatus::DidNothing();
+  const auto& unrestricted_events = events.get_unrestricted_update_events();
+  if (unrestricted_events.HasEvents()) {
+    State<T>* updates = unrestricted_updates_[i].get();
+    status = system_.CalcUnrestrictedUpdate(context, unrestricted_events,
+                                            updates);
+    if (status.failed()) return status;
+    if (!status.did_nothing()) {
+      system_.ApplyUnrestrictedUpdate(unrestricted_events, updates, &context);
+    }
+  }
+
+  // Do restricted (discrete variable) updates next.
+  const auto& discrete_events = events.get_discrete_update_events();
+  if (discrete_events.HasEvents()) {
+    DiscreteValues<T>* updates = discrete_updates_[i].get();
+    const EventStatus discrete_status =
+        system_.CalcDiscreteVariableUpdate(context, discrete_events, updates);
+    status.KeepMoreSevere(discrete_status);
+    if (discrete_status.failed()) return status;
+    if (!discrete_status.did_nothing()) {
+      system_.ApplyDiscreteVariableUpdate(discrete_events, updates, &context);
+    }
+  }
+  return status;
+}
+
+template <typename T>
+EventStatus BatchSimulator<T>::HandlePublishes(
+    int i, const CompositeEventCollection<T>& events) {
+  const auto& publish_events = events.get_publish_events();
+  if (!publish_events.HasEvents()) return EventStatus::DidNothing();
+  return system_.Publish(*contexts_[i], publish_events);
+}
+
+template <typename T>
+bool BatchSimulator<T>::ReachedTermination(SimulatorStatus* status) const {
+  const double time = ExtractDoubleOrThrow(get_time());
+  for (int i = 0; i < batch_size(); ++i) {
+    const EventStatus& event_status = event_statuses_[i];
+    if (event_status.failed()) {
+      status->SetEventHandlerFailed(
+          time, event_status.system(),
+          fmt::format("(batch index {}) {}", i, event_status.message()));
+      throw std::runtime_error(status->FormatMessage());
+    }
+  }
+  for (int i = 0; i < batch_size(); ++i) {
+    const EventStatus& event_status = event_statuses_[i];
+    if (event_status.reached_termination()) {
+      status->SetReachedTermination(
+          time, event_status.system(),
+          fmt::format("(batch index {}) {}", i, event_status.message()));
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+void BatchSimulator<T>::ThrowUnlessTimesAgree(const char* func) const {
+  for (int i = 1; i < batch_size(); ++i) {
+    if (contexts_[i]->get_time() != contexts_[0]->get_time()) {
+      throw std::logic_error(fmt::format(
+          "BatchSimulator::{}(): The time {} of the Context at batch index {} "
+          "differs from the time {} of the Context at batch index 0.",
+          func, ExtractDoubleOrThrow(contexts_[i]->get_time()), i,
+          ExtractDoubleOrThrow(contexts_[0]->get_time())));
+    }
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::BatchSimulator)
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
+#include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/simulator_status.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/// The configurable properties of a BatchSimulator.
+struct BatchSimulatorConfig {
+  /// Passes this object to an Archive.
+  /// Refer to @ref yaml_serialization "YAML Serialization" for background.
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(integration_scheme));
+    a->Visit(DRAKE_NVP(max_step_size));
+  }
+
+  /// The fixed-step integration scheme: one of "explicit_euler",
+  /// "runge_kutta2", or "runge_kutta3" (the latter in fixed-step mode).
+  std::string integration_scheme{"runge_kutta2"};
+  /// The fixed step size. Steps are shortened to land on event times.
+  double max_step_size{1.0e-3};
+};
+
+/// @ingroup simulation
+/// A BatchSimulator advances a batch of N Contexts of the same System in
+/// lock-step, that is, all N Contexts share the same time at the start and end
+/// of every step. It is intended for running many copies of one system that
+/// differ only in their states, parameters, or fixed inputs, as in a parameter
+/// sweep or a reinforcement learning rollout.
+///
+/// Each step is processed like a step of the Simulator (see its documentation
+/// for the ordering of the updates, integration, and publishes), with these
+/// differences:
+///
+/// - If the event timing of the System is static (every leaf system in it
+///   calls LeafSystem::DeclareStaticEventTiming()), its next timed events
+///   depend on the time alone. They are then computed once per step and
+///   shared by all of the Contexts.
+/// - Otherwise, each Context computes its own event schedule (the time and
+///   identity of its next timed events), and the batch steps to the earliest
+///   of the next event times of all of its Contexts. At the end of a step,
+///   only the Contexts whose next timed events are due then handle them; the
+///   other Contexts handle only their per-step events, and keep their timed
+///   events for a later step. The timed events may therefore depend on a
+///   Context's state, parameters, or inputs, although the steps of the whole
+///   batch are shortened to land on the events of any Context.
+/// - The continuous state (if any) is advanced using a fixed-step explicit
+///   integrator, chosen with BatchSimulatorConfig::integration_scheme. Each
+///   Context has its own integrator. When the timed events of all of the
+///   Contexts are identical (in particular, with static event timing), the
+///   results match those of a Simulator using the same integrator with the
+///   same fixed step size. Otherwise, a Context's steps may also be shortened
+///   to land on the events of other Contexts, which changes its integration
+///   error.
+/// - The per-Context work of each step (the updates, the integration, and the
+///   publishes) is split across up to Parallelism::num_threads() threads.
+///   Event handlers must therefore be safe to call concurrently for different
+///   Contexts.
+/// - Witness functions, monitors, realtime pacing, and forced publishes are
+///   not supported; use per-step publish events instead of the latter.
+///
+/// Event handler failures throw, as in the Simulator. If an event handler of
+/// any Context reports termination, the batch stops after that step's
+/// handling of the events, and AdvanceTo() returns the status of the first
+/// such Context.
+///
+/// The states and outputs of the batch can be accessed one Context at a time,
+/// or as a matrix with one column per Context. The latter is convenient for
+/// handing the batch to vectorized code such as a learned policy.
+///
+/// @tparam_default_scalar
+template <typename T>
+class BatchSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchSimulator)
+
+  /// Creates a simulator of `batch_size` Contexts of `system`, each a copy of
+  /// the default Context of `system`. The `system` is aliased, and must
+  /// outlive this simulator.
+  /// @throws std::exception if `batch_size` is not positive, if
+  /// `config.integration_scheme` is not one of the supported schemes, or if
+  /// `config.max_step_size` is not positive.
+  BatchSimulator(const System<T>& system, int batch_size,
+                 const BatchSimulatorConfig& config = {},
+                 Parallelism parallelism = false);
+
+  ~BatchSimulator();
+
+  /// Prepares the batch for simulation, as Simulator::Initialize() does for a
+  /// single Context: the initialization events are handled for every Context,
+  /// followed by the publish events that are due at the initial time.
+  /// This must be called again after changing the time of the Contexts.
+  /// @throws std::exception if the Contexts do not all have the same time, if
+  /// the System has witness functions, or if an event handler fails.
+  SimulatorStatus Initialize();
+
+  /// Advances all of the Contexts to `boundary_time`, calling Initialize()
+  /// first if it hasn't been called yet.
+  /// @throws std::exception if the time of the Contexts has changed since the
+  /// last call to Initialize() or AdvanceTo(), or if an event handler fails.
+  SimulatorStatus AdvanceTo(const T& boundary_time);
+
+  /// Returns the number of Contexts in the batch.
+  int batch_size() const { return static_cast<int>(contexts_.size()); }
+
+  /// Returns the System being simulated.
+  const System<T>& get_system() const { return system_; }
+
+  /// Returns the time shared by the Contexts of the batch.
+  const T& get_time() const { return contexts_[0]->get_time(); }
+
+  /// Returns the `i`th Context of the batch.
+  const Context<T>& get_context(int i) const;
+
+  /// Returns a mutable reference to the `i`th Context of the batch. Changing
+  /// the time of a Context requires a subsequent call to Initialize().
+  Context<T>& get_mutable_context(int i);
+
+  /// Returns the integrator of the `i`th Context of the batch.
+  const IntegratorBase<T>& get_integrator(int i) const;
+
+  /// Returns the number of steps taken by the batch since the last call to
+  /// Initialize().
+  int64_t get_num_steps_taken() const { return num_steps_taken_; }
+
+  /// @name                   Batch access
+  /// These methods gather or scatter a quantity of every Context of the batch
+  /// into or out of a matrix with one column per Context.
+  //@{
+
+  /// Returns the continuous states of the batch.
+  MatrixX<T> GetContinuousStates() const;
+
+  /// Sets the continuous states of the batch.
+  /// @throws std::exception if `x` is not of size
+  /// `num_continuous_states() × batch_size()`.
+  void SetContinuousStates(const Eigen::Ref<const MatrixX<T>>& x);
+
+  /// Returns the discrete state group `group_index` of the batch.
+  MatrixX<T> GetDiscreteStates(int group_index = 0) const;
+
+  /// Sets the discrete state group `group_index` of the batch.
+  /// @throws std::exception if `xd` is not of size
+  /// `group size × batch_size()`.
+  void SetDiscreteStates(const Eigen::Ref<const MatrixX<T>>& xd,
+                         int group_index = 0);
+
+  /// Evaluates the vector-valued output port `port` of the System for each
+  /// Context of the batch, using the same Parallelism as the steps.
+  /// @throws std::exception if `port` does not belong to the System or is not
+  /// vector-valued.
+  MatrixX<T> EvalVectorOutputs(const OutputPort<T>& port) const;
+  //@}
+
+ private:
+  // Calls `work(i)` for every Context index i of the batch, splitting the
+  // calls across up to num_threads_ threads. Rethrows the first exception.
+  void ForEachContext(const std::function<void(int)>& work) const;
+
+  // Handles the unrestricted and discrete update events of `events` for the
+  // `i`th Context, stopping at the first failure.
+  EventStatus HandleUpdates(int i, const CompositeEventCollection<T>& events);
+
+  // Handles the publish events of `events` for the `i`th Context.
+  EventStatus HandlePublishes(int i, const CompositeEventCollection<T>& events);
+
+  // Accumulates the statuses in event_statuses_ into `status`. Throws on
+  // failure, and returns true if any Context reported termination.
+  bool ReachedTermination(SimulatorStatus* status) const;
+
+  // Throws unless every Context of the batch has the same time.
+  void ThrowUnlessTimesAgree(const char* func) const;
+
+  // Returns the next timed events of the `i`th Context, and their time.
+  const CompositeEventCollection<T>& timed_events(int i) const {
+    return *timed_events_[static_event_timing_ ? 0 : i];
+  }
+  const T& next_event_time(int i) const {
+    return next_event_times_[static_event_timing_ ? 0 : i];
+  }
+
+  const System<T>& system_;
+  const int num_threads_;
+  // Whether the event schedule is shared by all of the Contexts; see
+  // System::has_static_event_timing().
+  const bool static_event_timing_;
+
+  std::vector<std::unique_ptr<Context<T>>> contexts_;
+  std::vector<std::unique_ptr<IntegratorBase<T>>> integrators_;
+
+  // Per-Context scratch values for computing updates, and the status of each
+  // Context's most recent event handling.
+  std::vector<std::unique_ptr<DiscreteValues<T>>> discrete_updates_;
+  std::vector<std::unique_ptr<State<T>>> unrestricted_updates_;
+  std::vector<EventStatus> event_statuses_;
+  std::vector<typename IntegratorBase<T>::StepResult> step_results_;
+
+  // The event schedule of each Context. next_event_times_ holds the time of
+  // the timed_events_, which have a single element when the timing is static
+  // (see timed_events()). end_of_step_events_ holds the per-step events merged
+  // with the timed events, for steps that end at the time of the timed
+  // events. pending_events_ points to the collection (one of the previous
+  // two) whose update events start the next step.
+  std::vector<std::unique_ptr<CompositeEventCollection<T>>> per_step_events_;
+  std::vector<std::unique_ptr<CompositeEventCollection<T>>> timed_events_;
+  std::vector<T> next_event_times_;
+  std::vector<std::unique_ptr<CompositeEventCollection<T>>>
+      end_of_step_events_;
+  std::vector<const CompositeEventCollection<T>*> pending_events_;
+
+  bool initialization_done_{false};
+  double last_known_simtime_{};
+  int64_t num_steps_taken_{0};
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::systems::BatchSimulator)
@@ -0,0 +1,312 @@
+#include "drake/systems/analysis/bounded_dense_output.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace systems {
+
+template <typename T>
+BoundedDenseOutput<T>::BoundedDenseOutput(int dimension)
+    : dimension_(dimension) {
+  DRAKE_THROW_UNLESS(dimension > 0);
+  scratch_.resize(record_size());
+}
+
+template <typename T>
+BoundedDenseOutput<T>::~BoundedDenseOutput() = default;
+
+template <typename T>
+void BoundedDenseOutput<T>::AppendCubicHermiteSegment(
+    const T& t0, const T& t1, const VectorX<T>& x0, const VectorX<T>& x1,
+    const VectorX<T>& xdot0, const VectorX<T>& xdot1) {
+  const double start = ExtractDoubleOrThrow(t0);
+  const double end = ExtractDoubleOrThrow(t1);
+  if (!(start < end)) {
+    throw std::logic_error(fmt::format(
+        "BoundedDenseOutput: the segment [{}, {}] is empty.", start, end));
+  }
+  for (const VectorX<T>* vector : {&x0, &x1, &xdot0, &xdot1}) {
+    if (vector->size() != dimension_) {
+      throw std::logic_error(fmt::format(
+          "BoundedDenseOutput: a segment vector has size {}, not {}.",
+          vector->size(), dimension_));
+    }
+  }
+  const int num_records = do_num_records();
+  if (num_records > 0 && start != do_get_record(num_records - 1)[1]) {
+    throw std::logic_error(fmt::format(
+        "BoundedDenseOutput: the segment [{}, {}] does not start at the end "
+        "time {} of the output.",
+        start, end, do_get_record(num_records - 1)[1]));
+  }
+  double* record = scratch_.data();
+  record[0] = start;
+  record[1] = end;
+  record += 2;
+  for (const VectorX<T>* vector : {&x0, &x1, &xdot0, &xdot1}) {
+    for (int i = 0; i < dimension_; ++i) {
+      record[i] = ExtractDoubleOrThrow((*vector)[i]);
+    }
+    record += dimension_;
+  }
+  DoAppendRecord(scratch_.data());
+  UpdateTimes();
+}
+
+template <typename T>
+void BoundedDenseOutput<T>::RemoveFinalSegment() {
+  if (do_num_records() == 0) {
+    throw std::logic_error("BoundedDenseOutput: the output is empty.");
+  }
+  DoRemoveFinalRecord();
+  UpdateTimes();
+}
+
+template <typename T>
+T BoundedDenseOutput<T>::final_segment_start_time() const {
+  if (do_num_records() == 0) {
+    throw std::logic_error("BoundedDenseOutput: the output is empty.");
+  }
+  return do_get_record(do_num_records() - 1)[0];
+}
+
+template <typename T>
+VectorX<T> BoundedDenseOutput<T>::DoEvaluate(const T& t) const {
+  const double time = ExtractDoubleOrThrow(t);
+  const double* record = FindRecord(time);
+  const double h = record[1] - record[0];
+  const double s = (time - record[0]) / h;
+  const double h00 = (1 + 2 * s) * (1 - s) * (1 - s);
+  const double h10 = s * (1 - s) * (1 - s) * h;
+  const double h01 = s * s * (3 - 2 * s);
+  const double h11 = s * s * (s - 1) * h;
+  const int n = dimension_;
+  using ConstMap = Eigen::Map<const VectorX<double>>;
+  const VectorX<double> value = h00 * ConstMap(record + 2, n) +
+                                h01 * ConstMap(record + 2 + n, n) +
+                                h10 * ConstMap(record + 2 + 2 * n, n) +
+                                h11 * ConstMap(record + 2 + 3 * n, n);
+  return value.template cast<T>();
+}
+
+template <typename T>
+T BoundedDenseOutput<T>::DoEvaluateNth(const T& t, int n) const {
+  const double time = ExtractDoubleOrThrow(t);
+  const double* record = FindRecord(time);
+  const double h = record[1] - record[0];
+  const double s = (time - record[0]) / h;
+  const double* values = record + 2 + n;
+  return (1 + 2 * s) * (1 - s) * (1 - s) * values[0] +
+         s * s * (3 - 2 * s) * values[dimension_] +
+         s * (1 - s) * (1 - s) * h * values[2 * dimension_] +
+         s * s * (s - 1) * h * values[3 * dimension_];
+}
+
+template <typename T>
+const double* BoundedDenseOutput<T>::FindRecord(double t) const {
+  // Finds the first segment that ends no earlier than `t`.
+  int low = 0;
+  int high = do_num_records() - 1;
+  while (low < high) {
+    const int middle = low + (high - low) / 2;
+    if (do_get_record(middle)[1] < t) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return do_get_record(low);
+}
+
+template <typename T>
+void BoundedDenseOutput<T>::UpdateTimes() {
+  const int num_records = do_num_records();
+  if (num_records == 0) {
+    start_time_ = end_time_ = std::numeric_limits<double>::quiet_NaN();
+  } else {
+    start_time_ = do_get_record(0)[0];
+    end_time_ = do_get_record(num_records - 1)[1];
+  }
+}
+
+template <typename T>
+RingBufferDenseOutput<T>::RingBufferDenseOutput(int dimension,
+                                                int max_segments,
+                                                double window)
+    : BoundedDenseOutput<T>(dimension),
+      max_segments_(max_segments),
+      window_(window) {
+  DRAKE_THROW_UNLESS(max_segments > 0);
+  DRAKE_THROW_UNLESS(window >= 0);
+}
+
+template <typename T>
+RingBufferDenseOutput<T>::~RingBufferDenseOutput() = default;
+
+template <typename T>
+void RingBufferDenseOutput<T>::DoAppendRecord(const double* record) {
+  const int record_size = this->record_size();
+
+  // Discards the segments that ended before the window, and then the oldest
+  // one if the buffer is at its maximum size.
+  const double window_start = record[0] - window_;
+  while (count_ > 0 && do_get_record(0)[1] < window_start) {
+    head_ = (head_ + 1) % capacity_;
+    --count_;
+  }
+  if (count_ == max_segments_) {
+    head_ = (head_ + 1) % capacity_;
+    --count_;
+  }
+
+  // Grows the buffer geometrically when it is full, placing the oldest record
+  // in the first slot.
+  if (count_ == capacity_) {
+    const int capacity = std::min(max_segments_, std::max(16, 2 * capacity_));
+    std::vector<double> new_buffer(static_cast<size_t>(capacity) *
+                                   record_size);
+    for (int i = 0; i < count_; ++i) {
+      std::copy(do_get_record(i), do_get_record(i) + record_size,
+                new_buffer.data() + static_cast<size_t>(i) * record_size);
+    }
+    buffer_ = std::move(new_buffer);
+    capacity_ = capacity;
+    head_ = 0;
+  }
+
+  const int slot = (head_ + count_) % capacity_;
+  std::copy(record, record + record_size,
+            buffer_.data() + static_cast<size_t>(slot) * record_size);
+  ++count_;
+}
+
+template <typename T>
+void RingBufferDenseOutput<T>::DoRemoveFinalRecord() {
+  --count_;
+}
+
+template <typename T>
+const double* RingBufferDenseOutput<T>::do_get_record(int i) const {
+  const int slot = (head_ + i) % capacity_;
+  return buffer_.data() + static_cast<size_t>(slot) * this->record_size();
+}
+
+template <typename T>
+MappedFileDenseOutput<T>::MappedFileDenseOutput(int dimension,
+                                                std::filesystem::path filename)
+    : BoundedDenseOutput<T>(dimension), filename_(std::move(filename)) {
+  fd_ = ::open(filename_.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC,
+               0644);
+  if (fd_ < 0) {
+    throw std::runtime_error(fmt::format(
+        "MappedFileDenseOutput: can't create the file '{}': {}",
+        filename_.string(), std::strerror(errno)));
+  }
+}
+
+template <typename T>
+MappedFileDenseOutput<T>::~MappedFileDenseOutput() {
+  if (mapped_ != nullptr) {
+    ::munmap(mapped_, capacity_ * this->record_size() * sizeof(double));
+  }
+  ::close(fd_);
+  std::error_code ignored;
+  std::filesystem::remove(filename_, ignored);
+}
+
+template <typename T>
+void MappedFileDenseOutput<T>::DoAppendRecord(const double* record) {
+  const int record_size = this->record_size();
+  if (count_ == capacity_) {
+    Reserve(std::max<int64_t>(256, 2 * capacity_));
+  }
+  std::copy(record, record + record_size,
+            mapped_ + static_cast<int64_t>(count_) * record_size);
+  ++count_;
+}
+
+template <typename T>
+void MappedFileDenseOutput<T>::DoRemoveFinalRecord() {
+  --count_;
+}
+
+template <typename T>
+const double* MappedFileDenseOutput<T>::do_get_record(int i) const {
+  return mapped_ + static_cast<int64_t>(i) * this->record_size();
+}
+
+template <typename T>
+void MappedFileDenseOutput<T>::Reserve(int64_t capacity) {
+  const size_t record_bytes = this->record_size() * sizeof(double);
+  const size_t size = capacity * record_bytes;
+  if (::ftruncate(fd_, size) != 0) {
+    throw std::runtime_error(fmt::format(
+        "MappedFileDenseOutput: can't grow the file '{}' to {} bytes: {}",
+        filename_.string(), size, std::strerror(errno)));
+  }
+  // The new mapping is made before the old one is released, so that a failure
+  // leaves this output unchanged.
+  void* const mapped =
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error(fmt::format(
+        "MappedFileDenseOutput: can't map the file '{}': {}",
+        filename_.string(), std::strerror(errno)));
+  }
+  if (mapped_ != nullptr) {
+    ::munmap(mapped_, capacity_ * record_bytes);
+  }
+  mapped_ = static_cast<double*>(mapped);
+  capacity_ = capacity;
+}
+
+template <typename T>
+std::unique_ptr<BoundedDenseOutput<T>> MakeBoundedDenseOutput(
+    const DenseOutputConfig& config, int dimension) {
+  if (config.storage == "ring_buffer") {
+    return std::make_unique<RingBufferDenseOutput<T>>(
+        dimension, config.max_segments, config.window);
+  }
+  if (config.storage == "mapped_file") {
+    if (config.filename.empty()) {
+      throw std::logic_error(
+          "MakeBoundedDenseOutput(): the mapped_file storage requires a "
+          "filename.");
+    }
+    return std::make_unique<MappedFileDenseOutput<T>>(dimension,
+                                                      config.filename);
+  }
+  throw std::logic_error(fmt::format(
+      "MakeBoundedDenseOutput(): unknown storage '{}'; the bounded storages "
+      "are 'ring_buffer' and 'mapped_file'.",
+      config.storage));
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS((
+    &MakeBoundedDenseOutput<T>
+))
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::systems::BoundedDenseOutput)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::systems::RingBufferDenseOutput)
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::systems::MappedFileDenseOutput)
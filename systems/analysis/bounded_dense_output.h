@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/analysis/dense_output.h"
+#include "drake/systems/analysis/dense_output_config.h"
+
+namespace drake {
+namespace systems {
+
+/// A DenseOutput made of cubic Hermite segments that an integrator appends in
+/// time order (see IntegratorBase::StartDenseIntegration(const
+/// DenseOutputConfig&)), and whose storage is left to subclasses so that the
+/// memory in use can stay bounded over arbitrarily long integrations.
+///
+/// Each segment is stored as one flat record of 4n + 2 doubles, for an output
+/// of size n: its start and end times t₀ and t₁, followed by the values 𝐱₀
+/// and 𝐱₁ and the time derivatives 𝐱̇₀ and 𝐱̇₁ at those times. A query
+/// locates its segment by binary search on the end times, in O(log m) for m
+/// stored segments, and evaluates the cubic Hermite polynomial that
+/// interpolates the segment's values and derivatives, as does
+/// trajectories::PiecewisePolynomial::CubicHermite().
+///
+/// @warning The segments are stored in `double`, so for T = AutoDiffXd the
+///          derivatives are discarded, and for T = symbolic::Expression only
+///          constant values can be stored.
+/// @tparam_default_scalar
+template <typename T>
+class BoundedDenseOutput : public DenseOutput<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BoundedDenseOutput)
+
+  ~BoundedDenseOutput() override;
+
+  /// Appends the segment over [@p t0, @p t1] that interpolates the values
+  /// @p x0 and @p x1 with the time derivatives @p xdot0 and @p xdot1.
+  /// @throws std::exception if @p t0 ≥ @p t1, if a vector does not have the
+  ///         size of this output, or if this output is not empty and @p t0
+  ///         differs from end_time().
+  void AppendCubicHermiteSegment(const T& t0, const T& t1,
+                                 const VectorX<T>& x0, const VectorX<T>& x1,
+                                 const VectorX<T>& xdot0,
+                                 const VectorX<T>& xdot1);
+
+  /// Removes the segment that was appended last, e.g., to undo an
+  /// integration step that is about to be retried.
+  /// @throws std::exception if this output is empty.
+  void RemoveFinalSegment();
+
+  /// Returns the number of segments that are currently stored.
+  int num_segments() const { return do_num_records(); }
+
+  /// Returns the start time of the final segment.
+  /// @throws std::exception if this output is empty.
+  T final_segment_start_time() const;
+
+ protected:
+  /// Constructs an empty output of the given size.
+  /// @throws std::exception if @p dimension is not positive.
+  explicit BoundedDenseOutput(int dimension);
+
+  /// Returns the number of doubles in each record, i.e., 4n + 2.
+  int record_size() const { return 4 * dimension_ + 2; }
+
+  /// Stores a copy of the record_size() doubles at @p record after the
+  /// stored records. The subclass may discard records from the front.
+  virtual void DoAppendRecord(const double* record) = 0;
+
+  /// Discards the record that was stored last.
+  /// @pre do_num_records() > 0.
+  virtual void DoRemoveFinalRecord() = 0;
+
+  /// Returns the number of stored records.
+  virtual int do_num_records() const = 0;
+
+  /// Returns the @p i-th stored record, oldest first.
+  /// @pre 0 ≤ @p i < do_num_records().
+  virtual const double* do_get_record(int i) const = 0;
+
+  VectorX<T> DoEvaluate(const T& t) const override;
+
+  T DoEvaluateNth(const T& t, int n) const override;
+
+  bool do_is_empty() const override { return do_num_records() == 0; }
+
+  int do_size() const override { return dimension_; }
+
+  const T& do_start_time() const override { return start_time_; }
+
+  const T& do_end_time() const override { return end_time_; }
+
+ private:
+  // Returns the record of the segment that contains `t`.
+  const double* FindRecord(double t) const;
+
+  // Updates the start and end times from the stored records.
+  void UpdateTimes();
+
+  const int dimension_;
+  // Scratch storage for the record being appended.
+  std::vector<double> scratch_;
+  T start_time_{std::numeric_limits<double>::quiet_NaN()};
+  T end_time_{std::numeric_limits<double>::quiet_NaN()};
+};
+
+/// A BoundedDenseOutput that keeps only its most recent segments, in a ring
+/// buffer that grows as needed up to a maximum number of segments (so that its
+/// memory is bounded by that maximum times the size of a record). Once the
+/// buffer holds the maximum number of segments, or once the oldest segment
+/// ended more than a given duration (the sliding time window) before the start
+/// of a new one, appending a segment discards the oldest ones, and
+/// start_time() advances accordingly.
+/// @tparam_default_scalar
+template <typename T>
+class RingBufferDenseOutput final : public BoundedDenseOutput<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RingBufferDenseOutput)
+
+  /// Constructs an empty output of size @p dimension that keeps at most
+  /// @p max_segments segments, none of which ended more than @p window
+  /// before the start of the latest one.
+  /// @throws std::exception if @p dimension or @p max_segments is not
+  ///         positive, or if @p window is negative or NaN.
+  RingBufferDenseOutput(
+      int dimension, int max_segments,
+      double window = std::numeric_limits<double>::infinity());
+
+  ~RingBufferDenseOutput() final;
+
+  /// Returns the maximum number of segments kept.
+  int max_segments() const { return max_segments_; }
+
+  /// Returns the duration of the sliding time window.
+  double window() const { return window_; }
+
+ private:
+  void DoAppendRecord(const double* record) final;
+  void DoRemoveFinalRecord() final;
+  int do_num_records() const final { return count_; }
+  const double* do_get_record(int i) const final;
+
+  const int max_segments_;
+  const double window_;
+  std::vector<double> buffer_;
+  // The number of records that the buffer holds, the slot of the oldest
+  // record, and the number of records.
+  int capacity_{0};
+  int head_{0};
+  int count_{0};
+};
+
+/// A BoundedDenseOutput that keeps all of its segments in a file, which is
+/// memory-mapped so that the operating system (rather than the process heap)
+/// holds the records: the pages of segments that are no longer being written
+/// can be written back and evicted, while queries still read them in place.
+/// The file holds the records back to back, with no header, and grows in
+/// geometrically larger chunks. It is scratch storage: it is replaced if it
+/// exists, and removed when this output is destroyed.
+/// @tparam_default_scalar
+template <typename T>
+class MappedFileDenseOutput final : public BoundedDenseOutput<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFileDenseOutput)
+
+  /// Constructs an empty output of size @p dimension stored in @p filename.
+  /// @throws std::exception if @p dimension is not positive, or if the file
+  ///         can't be created.
+  MappedFileDenseOutput(int dimension, std::filesystem::path filename);
+
+  ~MappedFileDenseOutput() final;
+
+  /// Returns the name of the file.
+  const std::filesystem::path& filename() const { return filename_; }
+
+ private:
+  void DoAppendRecord(const double* record) final;
+  void DoRemoveFinalRecord() final;
+  int do_num_records() const final { return count_; }
+  const double* do_get_record(int i) const final;
+
+  // Grows the file and its mapping to hold at least `capacity` records.
+  void Reserve(int64_t capacity);
+
+  const std::filesystem::path filename_;
+  int fd_{-1};
+  double* mapped_{nullptr};
+  // The number of records that the mapping holds, and that are stored.
+  int64_t capacity_{0};
+  int count_{0};
+};
+
+/// Returns a new BoundedDenseOutput of size @p dimension with the storage
+/// selected by @p config.
+/// @throws std::exception if `config.storage` is neither "ring_buffer" nor
+///         "mapped_file", or if the output can't be constructed.
+template <typename T>
+std::unique_ptr<BoundedDenseOutput<T>> MakeBoundedDenseOutput(
+    const DenseOutputConfig& config, int dimension);
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <limits>
+#include <string>
+
+#include "drake/common/name_value.h"
+
+namespace drake {
+namespace systems {
+
+/// Selects how an integrator stores the dense output that it builds during
+/// dense integration; see IntegratorBase::StartDenseIntegration(const
+/// DenseOutputConfig&). The default storage keeps every step, which for long
+/// simulations grows without bound; the other two bound the memory in use.
+struct DenseOutputConfig {
+  template <typename Archive>
+  /// Passes this object to an Archive.
+  /// Refer to @ref yaml_serialization "YAML Serialization" for background.
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(storage));
+    a->Visit(DRAKE_NVP(max_segments));
+    a->Visit(DRAKE_NVP(window));
+    a->Visit(DRAKE_NVP(filename));
+  }
+
+  /// One of:
+  /// - "unbounded": every step is kept in memory, as a
+  ///   trajectories::PiecewisePolynomial (IntegratorBase::get_dense_output()).
+  /// - "ring_buffer": only the most recent steps are kept in memory, as a
+  ///   RingBufferDenseOutput (IntegratorBase::get_bounded_dense_output()).
+  /// - "mapped_file": every step is kept in a memory-mapped file, as a
+  ///   MappedFileDenseOutput (IntegratorBase::get_bounded_dense_output()).
+  std::string storage{"unbounded"};
+
+  /// For "ring_buffer", the maximum number of steps kept.
+  int max_segments{10000};
+
+  /// For "ring_buffer", the duration of the sliding time window: steps that
+  /// ended more than this long before the start of the latest step are
+  /// discarded.
+  double window{std::numeric_limits<double>::infinity()};
+
+  /// For "mapped_file", the name of the file, which is replaced if it exists
+  /// and removed when the dense output is destroyed.
+  std::string filename;
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -1,13 +1,22 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <future>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/fmt_eigen.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/systems/framework/system_symbolic_inspector.h"
 
 namespace drake {
 namespace systems {
@@ -24,10 +33,294 @@ template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
   DoResetCachedJacobianRelatedMatrices();
+  jacobian_context_copies_.clear();
+  jacobian_context_copies_source_ = nullptr;
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
 }
 
+template <class T>
+void ImplicitIntegrator<T>::set_jacobian_sparsity_pattern(
+    std::optional<std::vector<std::pair<int, int>>> pattern) {
+  if (pattern.has_value()) {
+    for (const auto& [row, column] : *pattern) {
+      if (row < 0 || column < 0) {
+        throw std::logic_error(fmt::format(
+            "ImplicitIntegrator::set_jacobian_sparsity_pattern(): the entry "
+            "({}, {}) has a negative index.",
+            row, column));
+      }
+    }
+  }
+  jacobian_sparsity_pattern_ = std::move(pattern);
+  jacobian_coloring_.reset();
+  J_.resize(0, 0);
+  // Reset the Jacobian and any matrices cached by child integrators.
+  DoResetCachedJacobianRelatedMatrices();
+}
+
+template <class T>
+bool ImplicitIntegrator<T>::InferJacobianSparsityPattern() {
+  const std::unique_ptr<System<symbolic::Expression>> symbolic_system =
+      this->get_system().ToSymbolicMaybe();
+  if (symbolic_system == nullptr ||
+      SystemSymbolicInspector::IsAbstract(
+          *symbolic_system, *symbolic_system->CreateDefaultContext())) {
+    return false;
+  }
+  VectorX<symbolic::Expression> derivatives;
+  std::unordered_map<symbolic::Variable::Id, int> state_indices;
+  try {
+    const SystemSymbolicInspector inspector(*symbolic_system);
+    derivatives = inspector.derivatives();
+    const VectorX<symbolic::Variable>& state = inspector.continuous_state();
+    for (int j = 0; j < state.size(); ++j) {
+      state_indices.emplace(state[j].get_id(), j);
+    }
+  } catch (const std::exception&) {
+    // The time derivatives can't be computed symbolically, e.g., because they
+    // branch on the value of a state variable.
+    return false;
+  }
+
+  // The entry (i, j) is potentially nonzero iff the i-th time derivative
+  // depends on the j-th state variable.
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < derivatives.size(); ++i) {
+    std::vector<int> columns;
+    for (const symbolic::Variable& variable : derivatives[i].GetVariables()) {
+      const auto iter = state_indices.find(variable.get_id());
+      if (iter != state_indices.end()) {
+        columns.push_back(iter->second);
+      }
+    }
+    std::sort(columns.begin(), columns.end());
+    for (int j : columns) {
+      pattern.emplace_back(i, j);
+    }
+  }
+  set_jacobian_sparsity_pattern(std::move(pattern));
+  return true;
+}
+
+template <class T>
+typename ImplicitIntegrator<T>::JacobianColoring
+ImplicitIntegrator<T>::ColorJacobianColumns(
+    const std::vector<std::pair<int, int>>& pattern, int n) {
+  JacobianColoring coloring;
+  coloring.column_rows.resize(n);
+  std::vector<std::vector<int>> row_columns(n);
+  for (const auto& [row, column] : pattern) {
+    if (row < 0 || row >= n || column < 0 || column >= n) {
+      throw std::logic_error(fmt::format(
+          "ImplicitIntegrator: the Jacobian sparsity pattern has the entry "
+          "({}, {}), which is outside of the {}x{} Jacobian matrix.",
+          row, column, n, n));
+    }
+    coloring.column_rows[column].push_back(row);
+    row_columns[row].push_back(column);
+  }
+  for (std::vector<int>& rows : coloring.column_rows) {
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+  }
+
+  // Each column joins the first group that no column sharing one of its rows
+  // has joined. Columns without potential nonzeros join no group, as they
+  // need no evaluations.
+  coloring.column_groups.assign(n, -1);
+  // For each group, the last column that can't join it.
+  std::vector<int> excluding_column(n, -1);
+  for (int column = 0; column < n; ++column) {
+    if (coloring.column_rows[column].empty()) continue;
+    for (int row : coloring.column_rows[column]) {
+      for (int other : row_columns[row]) {
+        const int group = coloring.column_groups[other];
+        if (group >= 0) excluding_column[group] = column;
+      }
+    }
+    int group = 0;
+    while (group < static_cast<int>(coloring.groups.size()) &&
+           excluding_column[group] == column) {
+      ++group;
+    }
+    if (group == static_cast<int>(coloring.groups.size())) {
+      coloring.groups.emplace_back();
+    }
+    coloring.groups[group].push_back(column);
+    coloring.column_groups[column] = group;
+  }
+  return coloring;
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeColoredDiffJacobian(
+    const JacobianColoring& coloring,
+    const std::function<void(int, const VectorX<T>&, VectorX<T>*)>& g,
+    const VectorX<T>& x, bool central, int num_threads,
+    MatrixX<T>* J) const {
+  using std::abs;
+  const int n = x.size();
+  DRAKE_DEMAND(static_cast<int>(coloring.column_rows.size()) == n);
+
+  // Use the same increments as ComputeForwardDiffJacobian() and
+  // ComputeCentralDiffJacobian().
+  const double eps =
+      central ? std::pow(std::numeric_limits<double>::epsilon(), 5.0 / 12)
+              : std::sqrt(std::numeric_limits<double>::epsilon());
+
+  // Initialize the Jacobian, whose entries outside of the pattern stay zero.
+  J->setZero(n, n);
+
+  // Evaluate g(x), for forward differences.
+  VectorX<T> gx;
+  if (!central) g(0, x, &gx);
+
+  // Each thread claims the next unclaimed group until none remain. The groups
+  // have disjoint columns, so the threads set disjoint entries of J.
+  const int num_groups = coloring.groups.size();
+  num_threads = std::max(1, std::min(num_threads, num_groups));
+  std::atomic<int> next_group{0};
+  std::mutex mutex;
+  std::exception_ptr error;
+  auto run = [&](int thread) {
+    VectorX<T> x_prime = x;
+    VectorX<T> g_plus, g_minus;
+    std::vector<T> dx_plus, dx_minus;
+    for (int k = next_group++; k < num_groups; k = next_group++) {
+      try {
+        const std::vector<int>& columns = coloring.groups[k];
+        const int num_columns = columns.size();
+        dx_plus.resize(num_columns);
+        dx_minus.resize(num_columns);
+
+        // Perturb every column of the group, minimizing the effect of roundoff
+        // error by ensuring that x and dx differ by an exactly representable
+        // number, as in ComputeForwardDiffJacobian().
+        for (int j = 0; j < num_columns; ++j) {
+          const int i = columns[j];
+          const T abs_xi = abs(x(i));
+          const T dxi = (abs_xi <= 1) ? T(eps) : T(eps * abs_xi);
+          x_prime(i) = x(i) + dxi;
+          dx_plus[j] = x_prime(i) - x(i);
+          dx_minus[j] = dxi;
+        }
+        g(thread, x_prime, &g_plus);
+        if (central) {
+          for (int j = 0; j < num_columns; ++j) {
+            const int i = columns[j];
+            x_prime(i) = x(i) - dx_minus[j];
+            dx_minus[j] = x(i) - x_prime(i);
+          }
+          g(thread, x_prime, &g_minus);
+        }
+
+        // Set the potential nonzeros of each column, which no other column of
+        // the group shares.
+        for (int j = 0; j < num_columns; ++j) {
+          const int i = columns[j];
+          for (int row : coloring.column_rows[i]) {
+            (*J)(row, i) = central
+                               ? (g_plus(row) - g_minus(row)) /
+                                     (dx_plus[j] + dx_minus[j])
+                               : (g_plus(row) - gx(row)) / dx_plus[j];
+          }
+          x_prime(i) = x(i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (error == nullptr) error = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::future<void>> futures;
+  for (int thread = 1; thread < num_threads; ++thread) {
+    futures.push_back(std::async(std::launch::async, run, thread));
+  }
+  run(0);
+  for (auto& future : futures) {
+    future.get();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+template <class T>
+void ImplicitIntegrator<T>::UpdateJacobianColoring(int n) {
+  if (jacobian_sparsity_pattern_.has_value() &&
+      (!jacobian_coloring_.has_value() ||
+       static_cast<int>(jacobian_coloring_->column_rows.size()) != n)) {
+    jacobian_coloring_ = ColorJacobianColumns(*jacobian_sparsity_pattern_, n);
+  }
+}
+
+template <class T>
+void ImplicitIntegrator<T>::SetJacobianSparsity(
+    IterationMatrix* iteration_matrix) const {
+  iteration_matrix->set_jacobian_sparsity(
+      jacobian_sparsity_pattern_.has_value() ? &jacobian_coloring_->column_rows
+                                             : nullptr);
+}
+
+template <class T>
+void ImplicitIntegrator<T>::ComputeSparseDiffJacobian(
+    const System<T>& system, const T& t, const VectorX<T>& xt, bool central,
+    Context<T>* context, MatrixX<T>* J) {
+  DRAKE_DEMAND(jacobian_coloring_.has_value());
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator Compute Sparse {}-Jacobian t={} with {} groups",
+      xt.size(), t, jacobian_coloring_->groups.size());
+
+  // The first thread evaluates the time derivatives on the integrator's
+  // context, and each other thread on its own copy of it.
+  const int num_threads =
+      std::min(jacobian_parallelism_.num_threads(),
+               static_cast<int>(jacobian_coloring_->groups.size()));
+  context->SetTimeAndContinuousState(t, xt);
+  if (jacobian_context_copies_source_ != context) {
+    jacobian_context_copies_.clear();
+    jacobian_context_copies_source_ = context;
+  }
+  std::vector<Context<T>*> contexts{context};
+  for (int i = 1; i < num_threads; ++i) {
+    if (i > static_cast<int>(jacobian_context_copies_.size())) {
+      jacobian_context_copies_.push_back(context->Clone());
+    } else {
+      // Copy what may have changed since the copy was made (each thread sets
+      // the continuous state itself).
+      Context<T>& context_copy = *jacobian_context_copies_[i - 1];
+      context_copy.SetTimeStateAndParametersFrom(*context);
+      for (int port = 0; port < context->num_input_ports(); ++port) {
+        const FixedInputPortValue* value =
+            context->MaybeGetFixedInputPortValue(port);
+        if (value != nullptr) {
+          context_copy.FixInputPort(port, value->get_value());
+        }
+      }
+    }
+    contexts.push_back(jacobian_context_copies_[i - 1].get());
+  }
+
+  // The integrator counts the evaluations on its own context; the others are
+  // counted here and added once the threads are done.
+  std::atomic<int64_t> num_copy_evaluations{0};
+  const auto f = [this, &system, &contexts, &num_copy_evaluations](
+                     int thread, const VectorX<T>& x, VectorX<T>* xdot) {
+    Context<T>* thread_context = contexts[thread];
+    thread_context->SetContinuousState(x);
+    if (thread == 0) {
+      *xdot = this->EvalTimeDerivatives(*thread_context).CopyToVector();
+    } else {
+      *xdot = system.EvalTimeDerivatives(*thread_context).CopyToVector();
+      ++num_copy_evaluations;
+    }
+  };
+  ComputeColoredDiffJacobian(*jacobian_coloring_, f, xt, central, num_threads,
+                             J);
+  this->add_derivative_evaluations(num_copy_evaluations);
+}
+
 template <class T>
 void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
     const System<T>& system, const T& t, const VectorX<T>& xt,
@@ -37,8 +330,24 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
   // math::jacobian(), if possible.
 
   // Create AutoDiff versions of the state vector.
-  // Set the size of the derivatives and prepare for Jacobian calculation.
-  VectorX<AutoDiffXd> a_xt = math::InitializeAutoDiff(xt);
+  // Set the size of the derivatives and prepare for Jacobian calculation. With
+  // a sparsity pattern, each state variable is seeded with the derivative of
+  // its group of columns, so that there is one derivative per group.
+  VectorX<AutoDiffXd> a_xt;
+  int num_groups = 0;
+  if (jacobian_sparsity_pattern_.has_value()) {
+    DRAKE_DEMAND(jacobian_coloring_.has_value());
+    num_groups = jacobian_coloring_->groups.size();
+    a_xt.resize(xt.size());
+    for (int i = 0; i < xt.size(); ++i) {
+      const int group = jacobian_coloring_->column_groups[i];
+      a_xt(i).value() = xt(i);
+      a_xt(i).derivatives() = Eigen::VectorXd::Zero(num_groups);
+      if (group >= 0) a_xt(i).derivatives()(group) = 1;
+    }
+  } else {
+    a_xt = math::InitializeAutoDiff(xt);
+  }
 
   // Get the system and the context in AutoDiffable format. Inputs must also
   // be copied to the context used by the AutoDiff'd system (which is
@@ -61,6 +370,22 @@ void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
   const VectorX<AutoDiffXd> result =
       this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
 
+  if (jacobian_sparsity_pattern_.has_value()) {
+    // Recover each column from the derivative of its group, on its potential
+    // nonzeros (which no other column of the group shares).
+    const MatrixX<double> compressed =
+        math::ExtractGradient(result, num_groups);
+    J->setZero(xt.size(), xt.size());
+    for (int i = 0; i < xt.size(); ++i) {
+      const int group = jacobian_coloring_->column_groups[i];
+      if (group < 0) continue;
+      for (int row : jacobian_coloring_->column_rows[i]) {
+        (*J)(row, i) = compressed(row, group);
+      }
+    }
+    return;
+  }
+
   *J = math::ExtractGradient(result);
 
   // Sometimes the system's derivatives f(t, x) do not depend on its states, for
@@ -207,6 +532,44 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
+  sparse_LU_.reset();
+  if (jacobian_column_rows_ != nullptr && !jacobian_column_rows_->empty()) {
+    // Gather the potential nonzeros: the diagonal, and those of the Jacobian
+    // matrix in each of the n × n blocks.
+    const int n = jacobian_column_rows_->size();
+    const int size = iteration_matrix.rows();
+    DRAKE_DEMAND(size % n == 0);
+    const int num_blocks = size / n;
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(size);
+    for (int i = 0; i < size; ++i) {
+      triplets.emplace_back(i, i, iteration_matrix(i, i));
+    }
+    for (int block_column = 0; block_column < num_blocks; ++block_column) {
+      for (int column = 0; column < n; ++column) {
+        const int j = block_column * n + column;
+        for (int block_row = 0; block_row < num_blocks; ++block_row) {
+          for (int row : (*jacobian_column_rows_)[column]) {
+            const int i = block_row * n + row;
+            if (i != j) triplets.emplace_back(i, j, iteration_matrix(i, j));
+          }
+        }
+      }
+    }
+    Eigen::SparseMatrix<double> sparse_matrix(size, size);
+    sparse_matrix.setFromTriplets(triplets.begin(), triplets.end());
+
+    auto sparse_LU =
+        std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+    sparse_LU->compute(sparse_matrix);
+    if (sparse_LU->info() == Eigen::Success) {
+      sparse_LU_ = std::move(sparse_LU);
+      matrix_factored_ = true;
+      return;
+    }
+    // Otherwise the matrix is (structurally) singular, which the dense
+    // factorization below handles as it does any singular matrix.
+  }
   LU_.compute(iteration_matrix);
   matrix_factored_ = true;
 }
@@ -214,6 +577,9 @@ void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_LU_ != nullptr) {
+    return sparse_LU_->solve(b);
+  }
   return LU_.solve(b);
 }
 
@@ -297,15 +663,27 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
   // Get a the system.
   const System<T>& system = this->get_system();
 
+  // Group the columns of the sparsity pattern, if not already done.
+  const bool sparse = jacobian_sparsity_pattern_.has_value();
+  UpdateJacobianColoring(x.size());
+
   // TODO(edrumwri): Give the caller the option to provide their own Jacobian.
-  [this, context, &system, &t, &x]() {
+  [this, context, &system, &t, &x, sparse]() {
     switch (jacobian_scheme_) {
       case JacobianComputationScheme::kForwardDifference:
-        ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        if (sparse) {
+          ComputeSparseDiffJacobian(system, t, x, false, &*context, &J_);
+        } else {
+          ComputeForwardDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kCentralDifference:
-        ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        if (sparse) {
+          ComputeSparseDiffJacobian(system, t, x, true, &*context, &J_);
+        } else {
+          ComputeCentralDiffJacobian(system, t, x, &*context, &J_);
+        }
         break;
 
       case JacobianComputationScheme::kAutomatic:
@@ -342,6 +720,8 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
   if (!get_use_full_newton()) return;
 
   // Compute the initial Jacobian and iteration matrices and factor them.
+  UpdateJacobianColoring(xt.size());
+  SetJacobianSparsity(iteration_matrix);
   MatrixX<T>& J = get_mutable_jacobian();
   J = CalcJacobian(t, xt);
   ++num_iter_factorizations_;
@@ -357,6 +737,8 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
+  UpdateJacobianColoring(xt.size());
+  SetJacobianSparsity(iteration_matrix);
   MatrixX<T>& J = get_mutable_jacobian();
   if (!get_reuse() || J.rows() == 0 || IsBadJacobian(J)) {
     J = CalcJacobian(t, xt);
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/integrator_base.h"
 
 namespace drake {
@@ -125,6 +130,88 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   }
   /// @}
 
+  /// @name Methods for exploiting a sparse Jacobian.
+  ///
+  /// For systems with many state variables, each of whose time derivatives
+  /// depends on only a few of them (e.g., finite element or cable models),
+  /// forming the Jacobian matrix one column at a time and factoring the dense
+  /// iteration matrix dominate the cost of implicit integration. Given the
+  /// sparsity pattern of the Jacobian matrix, the integrator instead groups
+  /// its columns such that no two columns of a group have a potential nonzero
+  /// in the same row (a greedy coloring of the columns, after [Curtis 1974]).
+  /// Numerical differencing then perturbs all of the state variables of a
+  /// group at once, so that it takes one (forward differencing) or two
+  /// (central differencing) derivative evaluations per group rather than per
+  /// state variable, and the groups may be evaluated in parallel; automatic
+  /// differentiation likewise carries one derivative per group rather than
+  /// per state variable. For T = double, the iteration matrices are factored
+  /// with a sparse LU factorization.
+  ///
+  /// VelocityImplicitEulerIntegrator derives the sparsity pattern of its
+  /// velocity Jacobian from that of the Jacobian matrix, and evaluates its
+  /// groups sequentially (and, with automatic differentiation, densely).
+  ///
+  /// - [Curtis 1974] A. Curtis, M. Powell, and J. Reid. On the estimation of
+  ///                 sparse Jacobian matrices. IMA J. Appl. Math., 13:117-119,
+  ///                 1974.
+  /// @{
+
+  /// Sets the sparsity pattern of the Jacobian matrix ∂f/∂x of the time
+  /// derivatives f(t, x) of the system with respect to its continuous state
+  /// x: the (row, column) pairs of *all* of the entries that could be nonzero,
+  /// at any time and state. The other entries are taken to be zero, so an
+  /// incomplete pattern yields a wrong Jacobian matrix (which slows, or
+  /// prevents, the convergence of the Newton-Raphson process). If
+  /// `std::nullopt` (the default), every entry is regarded as potentially
+  /// nonzero. This function can be safely called at any time.
+  /// @note Discards any already-computed Jacobian matrices.
+  /// @throws std::exception if an index is negative. An index that is not
+  ///         less than the number of continuous states throws when the
+  ///         Jacobian matrix is next computed.
+  void set_jacobian_sparsity_pattern(
+      std::optional<std::vector<std::pair<int, int>>> pattern);
+
+  /// Gets the sparsity pattern of the Jacobian matrix.
+  /// @see set_jacobian_sparsity_pattern()
+  const std::optional<std::vector<std::pair<int, int>>>&
+  get_jacobian_sparsity_pattern() const {
+    return jacobian_sparsity_pattern_;
+  }
+
+  /// Infers the sparsity pattern of the Jacobian matrix from the symbolic
+  /// form of the time derivatives of the system (see SystemSymbolicInspector)
+  /// and sets it, as with set_jacobian_sparsity_pattern(). The symbolic form
+  /// is only available if the system supports scalar conversion to
+  /// symbolic::Expression, its Context is vector-valued, and its time
+  /// derivatives can be computed symbolically; otherwise, the sparsity
+  /// pattern is left unchanged.
+  /// @returns `true` if the sparsity pattern was inferred.
+  bool InferJacobianSparsityPattern();
+
+  /// Sets the parallelism with which the groups of Jacobian columns are
+  /// evaluated by numerical differencing, when a sparsity pattern is set
+  /// (default is none). Each thread evaluates the time derivatives on its own
+  /// copy of the integrator's Context.
+  void set_jacobian_parallelism(Parallelism parallelism) {
+    jacobian_parallelism_ = parallelism;
+  }
+
+  /// Gets the parallelism with which the groups of Jacobian columns are
+  /// evaluated.
+  /// @see set_jacobian_parallelism()
+  Parallelism get_jacobian_parallelism() const {
+    return jacobian_parallelism_;
+  }
+
+  /// Gets the number of groups into which the columns of the Jacobian matrix
+  /// were last partitioned, or zero if no sparsity pattern is in use.
+  int get_num_jacobian_column_groups() const {
+    return jacobian_coloring_
+               ? static_cast<int>(jacobian_coloring_->groups.size())
+               : 0;
+  }
+  /// @}
+
   /// @name Cumulative statistics functions.
   /// The functions return statistics specific to the implicit integration
   /// process.
@@ -219,7 +306,11 @@ class ImplicitIntegrator : public IntegratorBase<T> {
    public:
     /// Factors a dense matrix (the iteration matrix) using LU factorization,
     /// which should be faster than the QR factorization used in the specialized
-    /// template method for AutoDiffXd below.
+    /// template method for AutoDiffXd below. If a Jacobian sparsity is set, the
+    /// potential nonzeros of the matrix are factored using sparse LU
+    /// factorization instead (falling back to dense LU factorization if the
+    /// sparse one fails).
+    /// @see set_jacobian_sparsity()
     void SetAndFactorIterationMatrix(const MatrixX<T>& iteration_matrix);
 
     /// Solves a linear system Ax = b for x using the iteration matrix (A)
@@ -230,9 +321,30 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Sets the sparsity of the n × n Jacobian matrix J from which the next
+    /// iteration matrices are formed, as the rows of the potential nonzeros of
+    /// each column of J, or clears it with nullptr. The iteration matrices
+    /// are of the form I − A ⊗ J for an m × m matrix A, so their potential
+    /// nonzeros are their diagonal and those of J in each n × n block; only
+    /// these are gathered for the sparse LU factorization. This has no effect
+    /// for T = AutoDiffXd.
+    /// @warning @p column_rows must outlive its use by this object.
+    void set_jacobian_sparsity(
+        const std::vector<std::vector<int>>* column_rows) {
+      jacobian_column_rows_ = column_rows;
+    }
+
    private:
     bool matrix_factored_{false};
 
+    // The rows of the potential nonzeros of each column of the Jacobian
+    // matrix, if the iteration matrix is to be factored using sparse LU.
+    const std::vector<std::vector<int>>* jacobian_column_rows_{nullptr};
+
+    // The sparse LU factorization, if the iteration matrix was factored with
+    // it; Eigen's sparse solvers can't be copied or moved, hence the pointer.
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
+
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
     // comes naturally as h << 1. Keeping this data in the class definition
@@ -368,6 +480,43 @@ class ImplicitIntegrator : public IntegratorBase<T> {
       const VectorX<T>& xtplus, const VectorX<T>& dx, const T& dx_norm,
       const T& last_dx_norm) const;
 
+  /// The columns of an n × n Jacobian matrix with a given sparsity pattern,
+  /// grouped such that no two columns of a group have a potential nonzero in
+  /// the same row.
+  struct JacobianColoring {
+    /// For each column, the rows of its potential nonzeros.
+    std::vector<std::vector<int>> column_rows;
+    /// For each column, its group.
+    std::vector<int> column_groups;
+    /// For each group, its columns.
+    std::vector<std::vector<int>> groups;
+  };
+
+  /// Groups the columns of the n × n Jacobian matrix with the sparsity
+  /// pattern @p pattern greedily: each column in turn joins the first group
+  /// that has no potential nonzero in its rows.
+  /// @throws std::exception if an index of @p pattern is not in [0, n).
+  static JacobianColoring ColorJacobianColumns(
+      const std::vector<std::pair<int, int>>& pattern, int n);
+
+  /// Computes the Jacobian matrix J = ∂g/∂x of a function g: ℝⁿ → ℝⁿ around
+  /// @p x by numerical differencing, perturbing all of the columns of each
+  /// group of @p coloring at once. The entries outside of the sparsity pattern
+  /// of @p coloring are set to zero.
+  /// @param coloring the grouped columns of J.
+  /// @param g the function, which is called as g(thread, x, &g(x)).
+  /// @param x the point around which to compute J.
+  /// @param central whether to use central (rather than forward) differences.
+  /// @param num_threads the number of threads on which to evaluate the
+  ///        groups; calls to @p g on distinct threads are given distinct
+  ///        `thread` indices in [0, @p num_threads).
+  /// @param[out] J the Jacobian matrix.
+  void ComputeColoredDiffJacobian(
+      const JacobianColoring& coloring,
+      const std::function<void(int, const VectorX<T>&, VectorX<T>*)>& g,
+      const VectorX<T>& x, bool central, int num_threads,
+      MatrixX<T>* J) const;
+
   /// Resets any statistics particular to a specific implicit integrator. The
   /// default implementation of this function does nothing. If your integrator
   /// collects its own statistics, you should re-implement this method and
@@ -440,6 +589,30 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void ComputeCentralDiffJacobian(const System<T>& system, const T& t,
       const VectorX<T>& xt, Context<T>* context, MatrixX<T>* J);
 
+  // Computes the Jacobian of the ordinary differential equations around time
+  // and continuous state `(t, xt)` using numerical differencing with the
+  // grouped columns of the sparsity pattern, evaluating the groups on the
+  // threads of the Jacobian parallelism.
+  // @param system The dynamical system.
+  // @param t the time around which to compute the Jacobian matrix.
+  // @param xt the continuous state around which to compute the Jacobian matrix.
+  // @param central whether to use central (rather than forward) differences.
+  // @param context the Context of the system, at time and continuous state
+  //        unknown.
+  // @param[out] J the Jacobian matrix around time and state `(t, xt)`.
+  // @pre The sparsity pattern is set, and jacobian_coloring_ is up to date.
+  // @post The continuous state will be indeterminate on return.
+  void ComputeSparseDiffJacobian(const System<T>& system, const T& t,
+      const VectorX<T>& xt, bool central, Context<T>* context, MatrixX<T>* J);
+
+  // Groups the columns of the sparsity pattern, if one is set and its columns
+  // haven't been grouped for an n-dimensional continuous state yet.
+  void UpdateJacobianColoring(int n);
+
+  // Sets the sparsity of the Jacobian matrix on `iteration_matrix`, if a
+  // sparsity pattern is set, or clears it.
+  void SetJacobianSparsity(IterationMatrix* iteration_matrix) const;
+
   // Computes the Jacobian of the ordinary differential equations around time
   // and continuous state `(t, xt)` using automatic differentiation.
   // @param system The dynamical system.
@@ -500,6 +673,22 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // The sparsity pattern of the Jacobian matrix, if any, and its grouped
+  // columns, which are computed along with the first Jacobian matrix that
+  // uses them.
+  std::optional<std::vector<std::pair<int, int>>> jacobian_sparsity_pattern_;
+  std::optional<JacobianColoring> jacobian_coloring_;
+
+  // The parallelism with which the groups of Jacobian columns are evaluated.
+  Parallelism jacobian_parallelism_{Parallelism::None()};
+
+  // The copies of the context on which the threads other than the first
+  // evaluate the time derivatives, and the context they were cloned from;
+  // they are brought up to date with it for each Jacobian matrix instead of
+  // being cloned again.
+  std::vector<std::unique_ptr<Context<T>>> jacobian_context_copies_;
+  const Context<T>* jacobian_context_copies_source_{nullptr};
+
   // Indicates whether the Jacobian matrix is fresh. We say the Jacobian is
   // "fresh" if it was last computed at a state (t0, x0) from the beginning of
   // the current step. This indicates to MaybeFreshenMatrices that it should
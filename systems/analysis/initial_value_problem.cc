@@ -166,6 +166,12 @@ void InitialValueProblem<T>::ResetState() const {
 template <typename T>
 std::unique_ptr<DenseOutput<T>> InitialValueProblem<T>::DenseSolve(
     const T& t0, const T& tf) const {
+  return DenseSolve(t0, tf, DenseOutputConfig{});
+}
+
+template <typename T>
+std::unique_ptr<DenseOutput<T>> InitialValueProblem<T>::DenseSolve(
+    const T& t0, const T& tf, const DenseOutputConfig& config) const {
   DRAKE_THROW_UNLESS(tf >= t0);
   context_->SetTime(t0);
   ResetState();
@@ -174,11 +180,15 @@ std::unique_ptr<DenseOutput<T>> InitialValueProblem<T>::DenseSolve(
   integrator_->Initialize();
 
   // Starts dense integration to build a dense output.
-  integrator_->StartDenseIntegration();
+  integrator_->StartDenseIntegration(config);
 
   // Steps the integrator through the entire interval.
   integrator_->IntegrateWithMultipleStepsToTime(tf);
 
+  if (integrator_->get_bounded_dense_output() != nullptr) {
+    return integrator_->StopBoundedDenseIntegration();
+  }
+
   // Stops dense integration to prevent future updates to
   // the dense output just built and yields it to the caller.
   const std::unique_ptr<trajectories::PiecewisePolynomial<T>> traj =
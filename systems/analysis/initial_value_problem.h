@@ -9,6 +9,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/systems/analysis/dense_output.h"
+#include "drake/systems/analysis/dense_output_config.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/framework/context.h"
 
@@ -113,6 +114,17 @@ class InitialValueProblem {
   /// @throws std::exception if t0 > tf.
   std::unique_ptr<DenseOutput<T>> DenseSolve(const T& t0, const T& tf) const;
 
+  /// Solves and yields an approximation of the IVP solution x(t; 𝐤) as does
+  /// DenseSolve(const T&, const T&), with the dense output storage selected by
+  /// @p config (see IntegratorBase::StartDenseIntegration(const
+  /// DenseOutputConfig&)). For the "unbounded" storage the two are the same;
+  /// otherwise the result is a BoundedDenseOutput, e.g., a
+  /// RingBufferDenseOutput that is only defined over the most recent part of
+  /// [t₀, tf] that fits in its buffer and window.
+  /// @throws std::exception if t0 > tf, or if @p config is not valid.
+  std::unique_ptr<DenseOutput<T>> DenseSolve(
+      const T& t0, const T& tf, const DenseOutputConfig& config) const;
+
   /// Resets the internal integrator instance by in-place
   /// construction of the given integrator type.
   ///
@@ -94,6 +94,9 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& h_max) {
         // the last integration step.
         dense_output_->RemoveFinalSegment();
       }
+      if (get_bounded_dense_output()) {
+        bounded_dense_output_->RemoveFinalSegment();
+      }
     }
     step_size_to_attempt = adjusted_step_size;
 
@@ -133,6 +136,9 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& h_max) {
         // the last integration step.
         dense_output_->RemoveFinalSegment();
       }
+      if (get_bounded_dense_output()) {
+        bounded_dense_output_->RemoveFinalSegment();
+      }
     }
   } while (!step_succeeded);
   return static_cast<bool>(step_size_to_attempt == h_max);
@@ -13,6 +13,8 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
+#include "drake/systems/analysis/bounded_dense_output.h"
+#include "drake/systems/analysis/dense_output_config.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/vector_base.h"
@@ -859,6 +861,7 @@ class IntegratorBase {
 
     // Drops dense output, if any.
     dense_output_.reset();
+    bounded_dense_output_.reset();
 
     // Integrator no longer operates in fixed step mode.
     fixed_step_mode_ = false;
@@ -1224,7 +1227,10 @@ class IntegratorBase {
    also computes dense output) is consistent with this design choice.
 
    Once dense integration is started, and until it is stopped, all subsequent
-   integration steps taken will update the allocated dense output.
+   integration steps taken will update the allocated dense output. By default
+   the dense output keeps every step in memory; for long integrations,
+   StartDenseIntegration(const DenseOutputConfig&) selects a storage whose
+   memory stays bounded instead.
    */
 
   /**
@@ -1246,12 +1252,46 @@ class IntegratorBase {
       throw std::logic_error("System has no continuous state,"
                              " no dense output can be built.");
     }
-    if (get_dense_output()) {
+    if (get_dense_output() || get_bounded_dense_output()) {
       throw std::logic_error("Dense integration has been started already.");
     }
     dense_output_ = std::make_unique<trajectories::PiecewisePolynomial<T>>();
   }
 
+  /**
+   Starts dense integration with the dense output storage selected by
+   @p config. For the "unbounded" storage this is the same as
+   StartDenseIntegration(), and the dense output is a PiecewisePolynomial.
+   Otherwise, the dense output is a BoundedDenseOutput, whose memory stays
+   bounded however long the integration runs: it is accessed with
+   get_bounded_dense_output() and yielded by StopBoundedDenseIntegration().
+
+   @pre The integrator has been initialized.
+   @pre The system being integrated has continuous state.
+   @pre No dense integration is in progress (no dense output is held by the
+        integrator)
+   @throws std::exception if any of the preconditions is not met, or if
+           @p config is not valid (see MakeBoundedDenseOutput()).
+   */
+  void StartDenseIntegration(const DenseOutputConfig& config) {
+    if (config.storage == "unbounded") {
+      StartDenseIntegration();
+      return;
+    }
+    if (!is_initialized()) {
+      throw std::logic_error("Integrator was not initialized.");
+    }
+    const int num_states = get_context().num_continuous_states();
+    if (num_states == 0) {
+      throw std::logic_error("System has no continuous state,"
+                             " no dense output can be built.");
+    }
+    if (get_dense_output() || get_bounded_dense_output()) {
+      throw std::logic_error("Dense integration has been started already.");
+    }
+    bounded_dense_output_ = MakeBoundedDenseOutput<T>(config, num_states);
+  }
+
   /**
    Returns a const pointer to the integrator's current PiecewisePolynomial
    instance, holding a representation of the continuous state trajectory since
@@ -1285,6 +1325,31 @@ class IntegratorBase {
     }
     return std::move(dense_output_);
   }
+
+  /**
+   Returns a const pointer to the integrator's current BoundedDenseOutput
+   instance, if dense integration was started with a bounded storage by
+   StartDenseIntegration(const DenseOutputConfig&) (may be nullptr).
+   */
+  const BoundedDenseOutput<T>* get_bounded_dense_output() const {
+    return bounded_dense_output_.get();
+  }
+
+  /**
+   Stops dense integration that was started with a bounded storage, yielding
+   ownership of the current dense output to the caller.
+
+   @pre Dense integration is in progress with a bounded storage (a
+        BoundedDenseOutput is held by this integrator, after a call to
+        StartDenseIntegration(const DenseOutputConfig&)).
+   @throws std::exception if the precondition is not met.
+   */
+  std::unique_ptr<BoundedDenseOutput<T>> StopBoundedDenseIntegration() {
+    if (!bounded_dense_output_) {
+      throw std::logic_error("No bounded dense integration has been started.");
+    }
+    return std::move(bounded_dense_output_);
+  }
   // @}
 
   /**
@@ -1493,6 +1558,7 @@ class IntegratorBase {
 
     // Performs the integration step.
     if (!DoStep(h)) return false;
+    const ContinuousState<T>& derivatives = EvalTimeDerivatives(*context_);
 
     // Allow this update to *replace* the final segment if the start_time of
     // this step is earlier than the current end_time of the dense output and
@@ -1501,13 +1567,23 @@ class IntegratorBase {
     // isolation; it routinely back up the integration and try the same step
     // multiple times.  Note: we intentionally check for equality between
     // double values here.
+    if (bounded_dense_output_ != nullptr) {
+      if (bounded_dense_output_->num_segments() > 0 &&
+          start_time < bounded_dense_output_->end_time() &&
+          start_time == bounded_dense_output_->final_segment_start_time()) {
+        bounded_dense_output_->RemoveFinalSegment();
+      }
+      bounded_dense_output_->AppendCubicHermiteSegment(
+          start_time, context_->get_time(), start_state, state.CopyToVector(),
+          start_derivatives, derivatives.CopyToVector());
+      return true;
+    }
     if (dense_output_->get_segment_times().size() > 1 &&
         start_time < dense_output_->end_time() &&
         start_time == dense_output_->get_segment_times().end()[-2]) {
       dense_output_->RemoveFinalSegment();
     }
 
-    const ContinuousState<T>& derivatives = EvalTimeDerivatives(*context_);
     dense_output_->ConcatenateInTime(
         trajectories::PiecewisePolynomial<T>::CubicHermite(
             std::vector<T>({start_time, context_->get_time()}),
@@ -1595,7 +1671,7 @@ class IntegratorBase {
   // @sa DoStep()
   // @sa DoDenseStep()
   bool Step(const T& h) {
-    if (get_dense_output()) {
+    if (get_dense_output() || get_bounded_dense_output()) {
       return DoDenseStep(h);
     }
     return DoStep(h);
@@ -1609,6 +1685,8 @@ class IntegratorBase {
 
   // Current dense output.
   std::unique_ptr<trajectories::PiecewisePolynomial<T>> dense_output_{nullptr};
+  // Current dense output, when started with a bounded storage.
+  std::unique_ptr<BoundedDenseOutput<T>> bounded_dense_output_;
 
   // Runtime variables.
   // For variable step integrators, this is set at the end of each step to guide
@@ -1,8 +1,15 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <exception>
+#include <filesystem>
+#include <fstream>
 #include <future>
 #include <list>
 #include <mutex>
+#include <string>
 #include <thread>
 
 #include "drake/systems/analysis/simulator.h"
@@ -209,6 +216,175 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
                               generator, parallelism);
 }
 
+namespace {
+
+// Returns which of the `num_samples` samples are listed as complete in the
+// checkpoint file `filename`, if it exists. A final line without a newline is
+// the remnant of an interrupted write, and is ignored.
+std::vector<bool> ReadCheckpoint(const std::filesystem::path& filename,
+                                 int num_samples) {
+  std::vector<bool> completed(num_samples, false);
+  if (!std::filesystem::exists(filename)) {
+    return completed;
+  }
+  std::ifstream input(filename);
+  if (!input) {
+    throw std::runtime_error(fmt::format(
+        "MonteCarloSimulationReusingSimulators(): the checkpoint file '{}' "
+        "can't be read",
+        filename.string()));
+  }
+  std::string line;
+  while (std::getline(input, line) && !input.eof()) {
+    int sample{-1};
+    const auto [end, error] =
+        std::from_chars(line.data(), line.data() + line.size(), sample);
+    if (error != std::errc() || end != line.data() + line.size() ||
+        sample < 0 || sample >= num_samples) {
+      throw std::runtime_error(fmt::format(
+          "MonteCarloSimulationReusingSimulators(): the checkpoint file '{}' "
+          "has the line '{}', which is not a sample index in [0, {})",
+          filename.string(), line, num_samples));
+    }
+    completed[sample] = true;
+  }
+  return completed;
+}
+
+}  // namespace
+
+int MonteCarloSimulationReusingSimulators(
+    const SimulatorFactory& make_simulator,
+    const SimulatorResetFunction& reset_simulator,
+    const ScalarSystemFunction& output, const double final_time,
+    const int num_samples, const MonteCarloResultCallback& on_result,
+    RandomGenerator* generator, const Parallelism parallelism,
+    const std::optional<std::filesystem::path>& checkpoint_file) {
+  DRAKE_THROW_UNLESS(make_simulator != nullptr);
+  DRAKE_THROW_UNLESS(output != nullptr);
+  DRAKE_THROW_UNLESS(on_result != nullptr);
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+
+  // Create a generator if the user didn't provide one.
+  std::unique_ptr<RandomGenerator> owned_generator;
+  if (generator == nullptr) {
+    owned_generator = std::make_unique<RandomGenerator>();
+    generator = owned_generator.get();
+  }
+
+  // Draw the seed of every sample up front, so that each sample is the same
+  // no matter which worker simulates it, or whether it is skipped. Every
+  // worker makes its simulator from the same seed.
+  std::vector<RandomGenerator::result_type> sample_seeds(num_samples);
+  for (auto& seed : sample_seeds) {
+    seed = (*generator)();
+  }
+  const RandomGenerator::result_type factory_seed = (*generator)();
+
+  // Find the samples that remain, and rewrite the checkpoint file without any
+  // remnant of an interrupted write. The rewrite goes to a temporary file that
+  // then replaces the checkpoint, so that being interrupted while rewriting
+  // never loses the samples already recorded.
+  const std::vector<bool> completed =
+      checkpoint_file.has_value()
+          ? ReadCheckpoint(*checkpoint_file, num_samples)
+          : std::vector<bool>(num_samples, false);
+  std::vector<int> remaining;
+  for (int sample = 0; sample < num_samples; ++sample) {
+    if (!completed[sample]) {
+      remaining.push_back(sample);
+    }
+  }
+  std::ofstream checkpoint;
+  if (checkpoint_file.has_value()) {
+    auto throw_unwritable = [&checkpoint_file]() {
+      throw std::runtime_error(fmt::format(
+          "MonteCarloSimulationReusingSimulators(): the checkpoint file '{}' "
+          "can't be written",
+          checkpoint_file->string()));
+    };
+    std::filesystem::path temp_file = *checkpoint_file;
+    temp_file += ".tmp";
+    std::ofstream rewrite(temp_file, std::ios::trunc);
+    for (int sample = 0; sample < num_samples; ++sample) {
+      if (completed[sample]) {
+        rewrite << sample << "\n";
+      }
+    }
+    rewrite.close();
+    if (!rewrite) {
+      throw_unwritable();
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_file, *checkpoint_file, error);
+    if (error) {
+      throw_unwritable();
+    }
+    checkpoint.open(*checkpoint_file, std::ios::app);
+    if (!checkpoint) {
+      throw_unwritable();
+    }
+  }
+  const int num_remaining = static_cast<int>(remaining.size());
+  if (num_remaining == 0) {
+    return 0;
+  }
+
+  // Each worker makes a simulator and then claims the next unclaimed sample
+  // until none remain. After a failure, the workers stop claiming samples.
+  std::atomic<int> next_index{0};
+  std::mutex mutex;
+  std::exception_ptr error;
+  auto run = [&]() {
+    try {
+      RandomGenerator factory_generator(factory_seed);
+      std::unique_ptr<Simulator<double>> simulator =
+          make_simulator(&factory_generator);
+      const System<double>& system = simulator->get_system();
+      const double initial_time = simulator->get_context().get_time();
+      for (int i = next_index++; i < num_remaining; i = next_index++) {
+        const int sample = remaining[i];
+        RandomGenerator sample_generator(sample_seeds[sample]);
+        RandomSimulationResult result(sample_generator);
+        if (reset_simulator != nullptr) {
+          reset_simulator(simulator.get(), &sample_generator);
+        } else {
+          Context<double>& context = simulator->get_mutable_context();
+          context.SetTime(initial_time);
+          system.SetRandomContext(&context, &sample_generator);
+        }
+        simulator->Initialize();
+        simulator->AdvanceTo(final_time);
+        result.output = output(system, simulator->get_context());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        on_result(sample, result);
+        if (checkpoint.is_open()) {
+          checkpoint << sample << std::endl;
+        }
+        drake::log()->debug("Simulation {} completed", sample);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (error == nullptr) error = std::current_exception();
+      next_index = num_remaining;
+    }
+  };
+  const int num_threads = std::min(parallelism.num_threads(), num_remaining);
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i < num_threads; ++i) {
+    futures.push_back(std::async(std::launch::async, run));
+  }
+  run();
+  for (auto& future : futures) {
+    future.get();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+  return num_remaining;
+}
+
 }  // namespace analysis
 }  // namespace systems
 }  // namespace drake
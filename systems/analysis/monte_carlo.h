@@ -1,7 +1,9 @@
 #pragma once
 
+#include <filesystem>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -184,6 +186,124 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     double final_time, int num_samples, RandomGenerator* generator = nullptr,
     int num_parallel_executions = 1);
 
+/***
+ * Defines a function that prepares a reused Simulator for a new sample, using
+ * the supplied RandomGenerator as the only source of randomness. It is called
+ * before each sample with the simulator left by the previous one (or freshly
+ * made by the SimulatorFactory), and must reset everything that the sample
+ * depends on, typically:
+ * @code
+ *   Context<double>& context = simulator->get_mutable_context();
+ *   context.SetTime(0.0);
+ *   simulator->get_system().SetRandomContext(&context, generator);
+ * @endcode
+ * The simulator is initialized after the function returns.
+ */
+typedef std::function<void(Simulator<double>* simulator,
+                           RandomGenerator* generator)>
+    SimulatorResetFunction;
+
+/***
+ * Defines a function that receives the result of the sample with the given
+ * index, as soon as that sample is complete.
+ */
+typedef std::function<void(int sample, const RandomSimulationResult& result)>
+    MonteCarloResultCallback;
+
+/**
+ * Generates samples of a scalar random variable output like
+ * MonteCarloSimulation(), but builds only one Simulator per worker thread and
+ * reuses it for many samples. This is much faster when making the Simulator
+ * (e.g., building a Diagram) costs more than simulating a sample. The results
+ * are passed to @p on_result as the samples complete, instead of being
+ * returned.
+ *
+ * In pseudo-code, this algorithm implements:
+ * @code
+ *   for i=1:num_samples
+ *     seed(i) = generator()
+ *   in each worker:
+ *     simulator = make_simulator(worker_generator)
+ *     while samples remain:
+ *       i = next sample
+ *       sample_generator = RandomGenerator(seed(i))
+ *       result = RandomSimulationResult(sample_generator)
+ *       reset_simulator(simulator, sample_generator)
+ *       simulator.Initialize()
+ *       simulator.AdvanceTo(final_time)
+ *       result.output = output(simulator.get_context())
+ *       on_result(i, result)
+ * @endcode
+ *
+ * Because the System is made once per worker, only the Context may differ
+ * from sample to sample; randomness that the SimulatorFactory draws is shared
+ * by all of the samples simulated by the worker. The samples are handed out
+ * one at a time to whichever worker is free, so that a few long simulations
+ * don't leave the other workers idle. The result of each sample only depends
+ * on its own seed, not on the worker that simulates it nor on the order of
+ * the samples, provided that @p reset_simulator resets all of the Context.
+ * (With an error-controlled integrator, the step size that the integrator
+ * carries over from one sample to the next may still perturb the results
+ * within the integration accuracy.) A sample can be reproduced with:
+ * @code
+ *   RandomGenerator generator(result.generator_snapshot);
+ *   reset_simulator(simulator, &generator);
+ *   simulator->Initialize();
+ *   simulator->AdvanceTo(final_time);
+ * @endcode
+ *
+ * @see RandomSimulation() for details about @p make_simulator, @p output,
+ * and @p final_time; and MonteCarloSimulation() for @p num_samples and
+ * @p generator. Each call advances the @p generator the same way, regardless
+ * of the parallelism and of any resumed samples.
+ *
+ * @param reset_simulator Prepares a reused Simulator for a sample; see
+ * SimulatorResetFunction. If empty, the Context's time is set to its time
+ * when the Simulator was made, and then SetRandomContext() is called.
+ *
+ * @param on_result Receives the result of each sample as it completes. The
+ * samples complete in no particular order, and the calls are never
+ * concurrent.
+ *
+ * @param parallelism The number of worker threads to use. Each worker makes
+ * its own Simulator. With a single thread, all work happens in the calling
+ * thread.
+ *
+ * @param checkpoint_file If given, the index of each sample is appended to
+ * this text file once its @p on_result call has returned, and the samples
+ * whose indices are already in the file when this function starts are
+ * skipped. Calling this function again with the same arguments after an
+ * interruption therefore resumes where the previous call stopped. Before
+ * resuming, the file is compacted by writing a temporary file next to it (its
+ * name with ".tmp" appended) and renaming it over the original, so that an
+ * interruption at any point keeps the samples already recorded.
+ *
+ * @returns the number of samples simulated by this call, i.e., excluding the
+ * samples that were skipped.
+ *
+ * @throws std::exception if the checkpoint file exists but can't be read or
+ * names a sample outside [0, num_samples); or rethrows the first exception
+ * thrown by a sample, after the other workers have stopped. The samples that
+ * completed before then remain in the checkpoint file.
+ *
+ * Thread safety when parallel execution is specified:
+ * - @p make_simulator is called concurrently, once by each worker thread.
+ * - @p reset_simulator and @p output are called concurrently from worker
+ *   threads, each with the simulator that belongs to the calling thread.
+ * - @p on_result is called from worker threads, but one call at a time.
+ * - @p generator is only accessed from the calling thread.
+ *
+ * @ingroup analysis
+ */
+int MonteCarloSimulationReusingSimulators(
+    const SimulatorFactory& make_simulator,
+    const SimulatorResetFunction& reset_simulator,
+    const ScalarSystemFunction& output, double final_time, int num_samples,
+    const MonteCarloResultCallback& on_result,
+    RandomGenerator* generator = nullptr, Parallelism parallelism = false,
+    const std::optional<std::filesystem::path>& checkpoint_file =
+        std::nullopt);
+
 // The below functions are exposed for unit testing only.
 namespace internal {
 
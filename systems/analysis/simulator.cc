@@ -74,6 +74,12 @@ SimulatorStatus Simulator<T>::Initialize(const InitializeParams& params) {
 
   // Initialize the integrator.
   integrator_->Initialize();
+  if (dense_output_config_.has_value() &&
+      context_->num_continuous_states() > 0 &&
+      integrator_->get_dense_output() == nullptr &&
+      integrator_->get_bounded_dense_output() == nullptr) {
+    integrator_->StartDenseIntegration(*dense_output_config_);
+  }
 
   // Restore default values.
   ResetStatistics();
@@ -14,6 +14,7 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/extract_double.h"
 #include "drake/common/name_value.h"
+#include "drake/systems/analysis/dense_output_config.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/simulator_config.h"
 #include "drake/systems/analysis/simulator_status.h"
@@ -573,6 +574,26 @@ class Simulator {
   /// enabled. By default, returns false.
   bool get_publish_every_time_step() const { return publish_every_time_step_; }
 
+  /// Sets the dense output storage with which Initialize() starts dense
+  /// integration (see IntegratorBase::StartDenseIntegration(const
+  /// DenseOutputConfig&)), or with `std::nullopt` (the default) stops
+  /// Initialize() from starting it. The integrator then records every
+  /// subsequent step in its dense output, which is accessed with
+  /// `get_integrator().get_bounded_dense_output()` (or with
+  /// `get_integrator().get_dense_output()` for the "unbounded" storage).
+  /// Initialize() does not start dense integration if the system has no
+  /// continuous state, or if dense integration is already in progress. The
+  /// setting applies to any integrator, including one set later by
+  /// reset_integrator().
+  void set_dense_output_config(std::optional<DenseOutputConfig> config) {
+    dense_output_config_ = std::move(config);
+  }
+
+  /// Returns the dense output storage set by set_dense_output_config().
+  const std::optional<DenseOutputConfig>& get_dense_output_config() const {
+    return dense_output_config_;
+  }
+
   /// Returns a const reference to the internally-maintained Context holding the
   /// most recent step in the trajectory. This is suitable for publishing or
   /// extracting information about this trajectory step. Do not call this method
@@ -838,6 +859,8 @@ class Simulator {
 
   bool publish_at_initialization_{SimulatorConfig{}.publish_every_time_step};
 
+  std::optional<DenseOutputConfig> dense_output_config_;
+
   // These are recorded at initialization or statistics reset.
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "drake/common/name_value.h"
+#include "drake/systems/analysis/dense_output_config.h"
 
 namespace drake {
 namespace systems {
@@ -22,6 +24,7 @@ struct SimulatorConfig {
     a->Visit(DRAKE_NVP(use_error_control));
     a->Visit(DRAKE_NVP(target_realtime_rate));
     a->Visit(DRAKE_NVP(publish_every_time_step));
+    a->Visit(DRAKE_NVP(dense_output));
   }
 
   std::string integration_scheme{"runge_kutta3"};
@@ -33,6 +36,10 @@ struct SimulatorConfig {
   /// Simulator::set_publish_every_time_step() when applied by
   /// ApplySimulatorConfig().
   bool publish_every_time_step{false};
+  /// Sets Simulator::set_dense_output_config() when applied by
+  /// ApplySimulatorConfig(), so that the Simulator starts dense integration
+  /// with this storage when it is initialized.
+  std::optional<DenseOutputConfig> dense_output;
 };
 
 }  // namespace systems
@@ -194,6 +194,7 @@ void ApplySimulatorConfig(
   // true or both false. Otherwise we could miss the first publish at t = 0.
   simulator->set_publish_at_initialization(config.publish_every_time_step);
   simulator->set_publish_every_time_step(config.publish_every_time_step);
+  simulator->set_dense_output_config(config.dense_output);
 }
 
 template <typename T>
@@ -216,6 +217,7 @@ SimulatorConfig ExtractSimulatorConfig(const Simulator<T>& simulator) {
   result.target_realtime_rate =
       ExtractDoubleOrThrow(simulator.get_target_realtime_rate());
   result.publish_every_time_step = simulator.get_publish_every_time_step();
+  result.dense_output = simulator.get_dense_output_config();
   return result;
 }
 
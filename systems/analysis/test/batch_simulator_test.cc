@@ -0,0 +1,347 @@
+#include "drake/systems/analysis/batch_simulator.h"
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/explicit_euler_integrator.h"
+#include "drake/systems/analysis/runge_kutta2_integrator.h"
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A damped oscillator with a periodic counter, a per-step publish counter, and
+// an output of its position. The periodic update counts its calls in the
+// discrete state, and the publish counts its calls in a shared counter.
+class Oscillator final : public LeafSystem<double> {
+ public:
+  explicit Oscillator(std::atomic<int>* num_publishes = nullptr)
+      : num_publishes_(num_publishes) {
+    DeclareContinuousState(1, 1, 0);
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(0.025, 0.0, &Oscillator::Count);
+    DeclarePerStepPublishEvent(&Oscillator::CountPublish);
+    DeclareVectorOutputPort("position", 1, &Oscillator::CalcPosition,
+                            {all_state_ticket()});
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives)
+      const override {
+    const VectorX<double> x = context.get_continuous_state_vector()
+        .CopyToVector();
+    const double k = 1.0 + context.get_discrete_state(0)[0] * 0.01;
+    derivatives->get_mutable_vector().SetAtIndex(0, x[1]);
+    derivatives->get_mutable_vector().SetAtIndex(1, -k * x[0] - 0.1 * x[1]);
+  }
+
+  EventStatus Count(const Context<double>& context,
+                    DiscreteValues<double>* updates) const {
+    (*updates)[0] = context.get_discrete_state(0)[0] + 1;
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus CountPublish(const Context<double>&) const {
+    if (num_publishes_ != nullptr) ++(*num_publishes_);
+    return EventStatus::Succeeded();
+  }
+
+  void CalcPosition(const Context<double>& context,
+                    BasicVector<double>* output) const {
+    (*output)[0] = context.get_continuous_state_vector()[0];
+  }
+
+  std::atomic<int>* const num_publishes_;
+};
+
+// Simulates `system` from the continuous state `x0` with a Simulator using
+// the integrator named by `config`, returning the final context.
+std::unique_ptr<Context<double>> SimulateOne(
+    const System<double>& system, const BatchSimulatorConfig& config,
+    const VectorX<double>& x0, double final_time) {
+  Simulator<double> simulator(system);
+  const double h = config.max_step_size;
+  if (config.integration_scheme == "explicit_euler") {
+    simulator.reset_integrator<ExplicitEulerIntegrator<double>>(h);
+  } else if (config.integration_scheme == "runge_kutta2") {
+    simulator.reset_integrator<RungeKutta2Integrator<double>>(h);
+  } else {
+    auto& integrator =
+        simulator.reset_integrator<RungeKutta3Integrator<double>>();
+    integrator.set_maximum_step_size(h);
+    integrator.set_fixed_step_mode(true);
+  }
+  simulator.get_mutable_context().SetContinuousState(x0);
+  simulator.AdvanceTo(final_time);
+  return simulator.get_mutable_context().Clone();
+}
+
+class BatchSimulatorTest : public ::testing::TestWithParam<std::string> {};
+
+// The batch matches a Simulator for each of its contexts, in both its serial
+// and parallel implementations.
+TEST_P(BatchSimulatorTest, MatchesSimulator) {
+  const Oscillator system;
+  BatchSimulatorConfig config;
+  config.integration_scheme = GetParam();
+  config.max_step_size = 0.01;
+  const int kBatchSize = 5;
+  const double kFinalTime = 0.5;
+  MatrixX<double> x0(2, kBatchSize);
+  for (int i = 0; i < kBatchSize; ++i) {
+    x0.col(i) << 1.0 + i, -0.5 * i;
+  }
+
+  for (const Parallelism parallelism : {Parallelism(1), Parallelism(3)}) {
+    BatchSimulator<double> batch(system, kBatchSize, config, parallelism);
+    EXPECT_EQ(batch.batch_size(), kBatchSize);
+    EXPECT_EQ(&batch.get_system(), &system);
+    batch.SetContinuousStates(x0);
+    EXPECT_TRUE(batch.AdvanceTo(kFinalTime).succeeded());
+    EXPECT_EQ(batch.get_time(), kFinalTime);
+
+    const MatrixX<double> x = batch.GetContinuousStates();
+    const MatrixX<double> xd = batch.GetDiscreteStates();
+    const MatrixX<double> y =
+        batch.EvalVectorOutputs(system.get_output_port());
+    ASSERT_EQ(x.cols(), kBatchSize);
+    for (int i = 0; i < kBatchSize; ++i) {
+      const auto expected =
+          SimulateOne(system, config, x0.col(i), kFinalTime);
+      EXPECT_TRUE(CompareMatrices(
+          x.col(i), expected->get_continuous_state_vector().CopyToVector()));
+      EXPECT_EQ(xd(0, i), expected->get_discrete_state(0)[0]);
+      EXPECT_EQ(y(0, i), x(0, i));
+      EXPECT_TRUE(CompareMatrices(
+          batch.get_context(i).get_continuous_state_vector().CopyToVector(),
+          x.col(i)));
+      EXPECT_EQ(batch.get_context(i).get_time(), kFinalTime);
+    }
+    // The periodic update runs at 0, 0.025, ..., 0.475.
+    EXPECT_EQ(xd(0, 0), 20);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(Schemes, BatchSimulatorTest,
+                         ::testing::Values("explicit_euler", "runge_kutta2",
+                                           "runge_kutta3"));
+
+// A system with only discrete state: x[n+1] = x[n] / 2 + 1.
+class Halver final : public LeafSystem<double> {
+ public:
+  Halver() {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(0.1, 0.0, &Halver::Update);
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* updates) const {
+    (*updates)[0] = context.get_discrete_state(0)[0] / 2 + 1;
+    return EventStatus::Succeeded();
+  }
+};
+
+GTEST_TEST(BatchSimulatorDiscreteTest, DiscreteOnly) {
+  const Halver system;
+  BatchSimulator<double> batch(system, 3, {}, Parallelism(2));
+  batch.SetDiscreteStates(Eigen::RowVector3d(0.0, 2.0, 10.0));
+  batch.AdvanceTo(0.35);
+  // Updates at 0, 0.1, 0.2, and 0.3.
+  const Eigen::RowVector3d expected(1.875, 2.0, 2.5);
+  EXPECT_TRUE(CompareMatrices(batch.GetDiscreteStates(), expected, 1e-15));
+  EXPECT_EQ(batch.get_time(), 0.35);
+}
+
+// A Halver that declares static event timing, and counts how often its next
+// update time is computed. (Overriding DoCalcNextUpdateTime() breaks the
+// promise of DeclareStaticEventTiming() in general; this override only counts
+// the calls, and keeps the timing of the periodic events.)
+class StaticHalver final : public LeafSystem<double> {
+ public:
+  explicit StaticHalver(std::atomic<int>* num_schedules)
+      : num_schedules_(num_schedules) {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(0.1, 0.0, &StaticHalver::Update);
+    DeclareStaticEventTiming();
+  }
+
+ private:
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const final {
+    ++(*num_schedules_);
+    LeafSystem<double>::DoCalcNextUpdateTime(context, events, time);
+  }
+
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* updates) const {
+    (*updates)[0] = context.get_discrete_state(0)[0] / 2 + 1;
+    return EventStatus::Succeeded();
+  }
+
+  std::atomic<int>* const num_schedules_;
+};
+
+// With static event timing, the batch computes its event schedule once per
+// step, rather than once per Context, with the same results.
+GTEST_TEST(BatchSimulatorDiscreteTest, StaticEventTiming) {
+  std::atomic<int> num_schedules{0};
+  const StaticHalver system(&num_schedules);
+  ASSERT_TRUE(system.has_static_event_timing());
+  BatchSimulator<double> batch(system, 3, {}, Parallelism(2));
+  batch.SetDiscreteStates(Eigen::RowVector3d(0.0, 2.0, 10.0));
+  batch.Initialize();
+  EXPECT_EQ(num_schedules, 1);
+  batch.AdvanceTo(0.35);
+  EXPECT_EQ(batch.get_num_steps_taken(), 4);
+  EXPECT_EQ(num_schedules, 1 + 4);
+  const Eigen::RowVector3d expected(1.875, 2.0, 2.5);
+  EXPECT_TRUE(CompareMatrices(batch.GetDiscreteStates(), expected, 1e-15));
+}
+
+// A system that counts its ticks, whose period is a numeric parameter, so that
+// the time of its next timed event depends on the Context.
+class Ticker final : public LeafSystem<double> {
+ public:
+  Ticker() {
+    DeclareDiscreteState(1);
+    DeclareNumericParameter(BasicVector<double>(Vector1d(0.5)));
+  }
+
+ private:
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const final {
+    const double period = context.get_numeric_parameter(0)[0];
+    *time = (std::floor(context.get_time() / period) + 1) * period;
+    DiscreteUpdateEvent<double> event(
+        [](const System<double>&, const Context<double>& event_context,
+           const DiscreteUpdateEvent<double>&,
+           DiscreteValues<double>* updates) {
+          (*updates)[0] = event_context.get_discrete_state(0)[0] + 1;
+          return EventStatus::Succeeded();
+        });
+    event.AddToComposite(TriggerType::kTimed, events);
+  }
+};
+
+// Each context handles its own timed events, and the batch steps to the
+// earliest of them.
+GTEST_TEST(BatchSimulatorDiscreteTest, ContextDependentEventTimes) {
+  const Ticker system;
+  BatchSimulator<double> batch(system, 3, {}, Parallelism(2));
+  batch.get_mutable_context(0).get_mutable_numeric_parameter(0)[0] = 0.5;
+  batch.get_mutable_context(1).get_mutable_numeric_parameter(0)[0] = 0.25;
+  batch.get_mutable_context(2).get_mutable_numeric_parameter(0)[0] = 1.5;
+  batch.AdvanceTo(1.1);
+  // The steps end at 0.25, 0.5, 0.75, 1.0, and 1.1. Each context also ticks
+  // at the initial time, as for a periodic event.
+  EXPECT_EQ(batch.get_num_steps_taken(), 5);
+  EXPECT_TRUE(CompareMatrices(batch.GetDiscreteStates(),
+                              Eigen::RowVector3d(3.0, 5.0, 1.0)));
+  for (int i = 0; i < batch.batch_size(); ++i) {
+    Simulator<double> simulator(system);
+    simulator.get_mutable_context().SetTimeStateAndParametersFrom(
+        batch.get_context(i));
+    simulator.get_mutable_context().SetTime(0.0);
+    simulator.get_mutable_context().SetDiscreteState(Vector1d(0.0));
+    simulator.AdvanceTo(1.1);
+    EXPECT_EQ(simulator.get_context().get_discrete_state(0)[0],
+              batch.GetDiscreteStates()(0, i));
+  }
+}
+
+GTEST_TEST(BatchSimulatorMiscTest, PerStepPublishes) {
+  std::atomic<int> num_publishes{0};
+  const Oscillator system(&num_publishes);
+  BatchSimulatorConfig config;
+  config.max_step_size = 0.1;
+  BatchSimulator<double> batch(system, 4, config, Parallelism(2));
+  batch.Initialize();
+  EXPECT_EQ(num_publishes, 4);
+  batch.AdvanceTo(0.2);
+  // The steps end at 0.025, 0.05, ..., 0.2 to land on the periodic updates.
+  EXPECT_EQ(batch.get_num_steps_taken(), 8);
+  EXPECT_EQ(num_publishes, 4 * 9);
+}
+
+// A system that counts up once per second, terminating when its count reaches
+// three and failing when its count is negative.
+class Terminator final : public LeafSystem<double> {
+ public:
+  Terminator() {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(1.0, 0.0, &Terminator::Update);
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* updates) const {
+    const double x = context.get_discrete_state(0)[0];
+    if (x >= 3) return EventStatus::ReachedTermination(this, "done");
+    if (x < 0) return EventStatus::Failed(this, "negative");
+    (*updates)[0] = x + 1;
+    return EventStatus::Succeeded();
+  }
+};
+
+GTEST_TEST(BatchSimulatorMiscTest, Termination) {
+  const Terminator system;
+  BatchSimulator<double> batch(system, 3);
+  batch.SetDiscreteStates(Eigen::RowVector3d(0.0, 2.0, 0.0));
+  const SimulatorStatus status = batch.AdvanceTo(10.0);
+  EXPECT_EQ(status.reason(), SimulatorStatus::kReachedTerminationCondition);
+  EXPECT_EQ(status.return_time(), 1.0);
+  EXPECT_EQ(status.message(), "(batch index 1) done");
+  EXPECT_TRUE(CompareMatrices(batch.GetDiscreteStates(),
+                              Eigen::RowVector3d(2.0, 3.0, 2.0)));
+  EXPECT_EQ(batch.get_time(), 1.0);
+
+  BatchSimulator<double> failing(system, 2);
+  failing.get_mutable_context(1).SetDiscreteState(Vector1d(-1.0));
+  DRAKE_EXPECT_THROWS_MESSAGE(failing.AdvanceTo(1.0),
+                              ".*\\(batch index 1\\) negative.*");
+}
+
+GTEST_TEST(BatchSimulatorMiscTest, Errors) {
+  const Oscillator system;
+  BatchSimulatorConfig config;
+  config.integration_scheme = "radau3";
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchSimulator<double>(system, 2, config),
+                              ".*Unsupported integration scheme 'radau3'.*");
+  EXPECT_THROW(BatchSimulator<double>(system, 0), std::exception);
+
+  BatchSimulator<double> batch(system, 2);
+  EXPECT_THROW(batch.SetContinuousStates(MatrixX<double>::Zero(2, 3)),
+               std::exception);
+  EXPECT_THROW(batch.GetDiscreteStates(1), std::exception);
+  const Oscillator other;
+  DRAKE_EXPECT_THROWS_MESSAGE(batch.EvalVectorOutputs(other.get_output_port()),
+                              ".*does not belong.*");
+
+  batch.get_mutable_context(1).SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(batch.Initialize(),
+                              ".*time 1 of the Context at batch index 1.*");
+  batch.get_mutable_context(0).SetTime(1.0);
+  batch.Initialize();
+  batch.AdvanceTo(1.1);
+  batch.get_mutable_context(0).SetTime(2.0);
+  batch.get_mutable_context(1).SetTime(2.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(batch.AdvanceTo(3.0),
+                              ".*requires a call to Initialize.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
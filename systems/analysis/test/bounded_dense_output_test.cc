@@ -0,0 +1,230 @@
+#include "drake/systems/analysis/bounded_dense_output.h"
+
+#include <filesystem>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/initial_value_problem.h"
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The cubic x(t) = (t³, 1 - t²), which each cubic Hermite segment reproduces
+// exactly, and its time derivative.
+Eigen::Vector2d Cubic(double t) {
+  return Eigen::Vector2d(t * t * t, 1 - t * t);
+}
+
+Eigen::Vector2d CubicDerivative(double t) {
+  return Eigen::Vector2d(3 * t * t, -2 * t);
+}
+
+// Appends the segments of the cubic over [0, 0.25], [0.25, 0.5], ... up to
+// `end_time`.
+void AppendCubic(double end_time, BoundedDenseOutput<double>* output) {
+  double t0 = output->is_empty() ? 0.0 : output->end_time();
+  for (; t0 < end_time; t0 += 0.25) {
+    const double t1 = t0 + 0.25;
+    output->AppendCubicHermiteSegment(t0, t1, Cubic(t0), Cubic(t1),
+                                      CubicDerivative(t0),
+                                      CubicDerivative(t1));
+  }
+}
+
+// Expects `output` to reproduce the cubic over its domain.
+void ExpectCubic(const BoundedDenseOutput<double>& output) {
+  for (double t = output.start_time(); t <= output.end_time(); t += 0.0625) {
+    EXPECT_TRUE(CompareMatrices(output.Evaluate(t), Cubic(t), 1e-12));
+    EXPECT_NEAR(output.EvaluateNth(t, 1), Cubic(t)[1], 1e-12);
+  }
+}
+
+GTEST_TEST(RingBufferDenseOutputTest, KeepsTheLatestSegments) {
+  RingBufferDenseOutput<double> output(2, 4);
+  EXPECT_TRUE(output.is_empty());
+  AppendCubic(0.75, &output);
+  EXPECT_EQ(output.size(), 2);
+  EXPECT_EQ(output.num_segments(), 3);
+  EXPECT_EQ(output.start_time(), 0.0);
+  ExpectCubic(output);
+
+  // The buffer grows up to four segments, and then discards the oldest.
+  AppendCubic(2.5, &output);
+  EXPECT_EQ(output.num_segments(), 4);
+  EXPECT_EQ(output.start_time(), 1.5);
+  EXPECT_EQ(output.end_time(), 2.5);
+  EXPECT_EQ(output.final_segment_start_time(), 2.25);
+  ExpectCubic(output);
+  EXPECT_THROW(output.Evaluate(1.0), std::exception);
+
+  // Removing the final segment doesn't bring back the discarded ones.
+  output.RemoveFinalSegment();
+  EXPECT_EQ(output.num_segments(), 3);
+  EXPECT_EQ(output.end_time(), 2.25);
+  AppendCubic(3.0, &output);
+  EXPECT_EQ(output.start_time(), 2.0);
+  ExpectCubic(output);
+}
+
+GTEST_TEST(RingBufferDenseOutputTest, SlidingWindow) {
+  RingBufferDenseOutput<double> output(2, 100, 0.5);
+  AppendCubic(2.5, &output);
+  // The latest segment starts at 2.25, so the segments that ended before 1.75
+  // are discarded.
+  EXPECT_EQ(output.start_time(), 1.5);
+  EXPECT_EQ(output.num_segments(), 4);
+  ExpectCubic(output);
+}
+
+GTEST_TEST(MappedFileDenseOutputTest, KeepsEverySegment) {
+  const std::filesystem::path filename =
+      std::filesystem::path(temp_directory()) / "dense_output";
+  {
+    MappedFileDenseOutput<double> output(2, filename);
+    EXPECT_EQ(output.filename(), filename);
+    EXPECT_TRUE(std::filesystem::exists(filename));
+    // Enough segments to grow the file a few times.
+    AppendCubic(500.0, &output);
+    EXPECT_EQ(output.num_segments(), 2000);
+    EXPECT_EQ(output.start_time(), 0.0);
+    EXPECT_EQ(output.end_time(), 500.0);
+    for (double t : {0.0, 0.1, 63.3, 250.0, 499.99, 500.0}) {
+      EXPECT_TRUE(
+          CompareMatrices(output.Evaluate(t), Cubic(t), 1e-6 * t * t));
+    }
+    output.RemoveFinalSegment();
+    EXPECT_EQ(output.end_time(), 499.75);
+  }
+  EXPECT_FALSE(std::filesystem::exists(filename));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MappedFileDenseOutput<double>(2, filename / "missing_directory" / "x"),
+      ".*can't create the file.*");
+}
+
+GTEST_TEST(BoundedDenseOutputTest, Errors) {
+  RingBufferDenseOutput<double> output(2, 4);
+  DRAKE_EXPECT_THROWS_MESSAGE(output.RemoveFinalSegment(), ".*is empty.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(output.final_segment_start_time(),
+                              ".*is empty.*");
+  const Eigen::Vector2d x = Cubic(0.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      output.AppendCubicHermiteSegment(1.0, 1.0, x, x, x, x),
+      ".*segment \\[1, 1\\] is empty.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      output.AppendCubicHermiteSegment(0.0, 1.0, x, Eigen::Vector3d::Zero(), x,
+                                       x),
+      ".*has size 3, not 2.*");
+  output.AppendCubicHermiteSegment(0.0, 1.0, x, x, x, x);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      output.AppendCubicHermiteSegment(1.5, 2.0, x, x, x, x),
+      ".*does not start at the end time 1.*");
+
+  EXPECT_THROW(RingBufferDenseOutput<double>(0, 4), std::exception);
+  EXPECT_THROW(RingBufferDenseOutput<double>(2, 0), std::exception);
+  EXPECT_THROW(RingBufferDenseOutput<double>(2, 4, -1.0), std::exception);
+
+  DenseOutputConfig config;
+  EXPECT_THROW(MakeBoundedDenseOutput<double>(config, 2), std::exception);
+  config.storage = "mapped_file";
+  DRAKE_EXPECT_THROWS_MESSAGE(MakeBoundedDenseOutput<double>(config, 2),
+                              ".*requires a filename.*");
+  config.storage = "ring_buffer";
+  config.max_segments = 7;
+  auto ring = MakeBoundedDenseOutput<double>(config, 2);
+  EXPECT_EQ(
+      dynamic_cast<RingBufferDenseOutput<double>&>(*ring).max_segments(), 7);
+}
+
+// A damped oscillator.
+class Oscillator final : public LeafSystem<double> {
+ public:
+  Oscillator() { DeclareContinuousState(1, 1, 0); }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives)
+      const override {
+    const VectorX<double> x =
+        context.get_continuous_state_vector().CopyToVector();
+    derivatives->get_mutable_vector().SetFromVector(
+        Eigen::Vector2d(x[1], -x[0] - 0.1 * x[1]));
+  }
+};
+
+// The Simulator starts dense integration with the configured storage, whose
+// segments are those of the unbounded dense output.
+GTEST_TEST(BoundedDenseOutputTest, Simulator) {
+  const Oscillator system;
+  const auto simulate = [&system](const DenseOutputConfig& config) {
+    auto simulator = std::make_unique<Simulator<double>>(system);
+    SimulatorConfig simulator_config;
+    simulator_config.dense_output = config;
+    ApplySimulatorConfig(simulator_config, simulator.get());
+    EXPECT_EQ(ExtractSimulatorConfig(*simulator).dense_output->storage,
+              config.storage);
+    simulator->get_mutable_context().SetContinuousState(
+        Eigen::Vector2d(1.0, 0.0));
+    simulator->AdvanceTo(10.0);
+    return simulator;
+  };
+
+  const auto unbounded = simulate(DenseOutputConfig{});
+  const trajectories::PiecewisePolynomial<double>* expected =
+      unbounded->get_integrator().get_dense_output();
+  ASSERT_NE(expected, nullptr);
+  EXPECT_EQ(unbounded->get_integrator().get_bounded_dense_output(), nullptr);
+
+  DenseOutputConfig config;
+  config.storage = "ring_buffer";
+  config.max_segments = 10;
+  const auto ring = simulate(config);
+  const BoundedDenseOutput<double>* output =
+      ring->get_integrator().get_bounded_dense_output();
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->num_segments(), 10);
+  EXPECT_EQ(output->end_time(), 10.0);
+  EXPECT_EQ(output->start_time(), expected->get_segment_times().end()[-11]);
+  for (double t = output->start_time(); t <= 10.0; t += 0.01) {
+    EXPECT_TRUE(CompareMatrices(output->Evaluate(t), expected->value(t),
+                                1e-12));
+  }
+}
+
+// DenseSolve() with a bounded storage matches the default one.
+GTEST_TEST(BoundedDenseOutputTest, InitialValueProblem) {
+  const InitialValueProblem<double> ivp(
+      [](const double&, const VectorX<double>& x, const VectorX<double>&) {
+        return VectorX<double>(-x);
+      },
+      Eigen::Vector3d(1.0, 2.0, 3.0));
+  const std::unique_ptr<DenseOutput<double>> expected = ivp.DenseSolve(0, 5);
+
+  DenseOutputConfig config;
+  config.storage = "mapped_file";
+  config.filename =
+      (std::filesystem::path(temp_directory()) / "ivp_dense_output").string();
+  const std::unique_ptr<DenseOutput<double>> output =
+      ivp.DenseSolve(0, 5, config);
+  ASSERT_NE(dynamic_cast<MappedFileDenseOutput<double>*>(output.get()),
+            nullptr);
+  EXPECT_EQ(output->start_time(), 0.0);
+  EXPECT_EQ(output->end_time(), 5.0);
+  for (double t = 0; t <= 5.0; t += 0.01) {
+    EXPECT_TRUE(CompareMatrices(output->Evaluate(t), expected->Evaluate(t),
+                                1e-12));
+  }
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
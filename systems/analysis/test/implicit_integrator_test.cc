@@ -1,8 +1,20 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/implicit_euler_integrator.h"
+#include "drake/systems/analysis/radau_integrator.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
+#include "drake/systems/analysis/velocity_implicit_euler_integrator.h"
+#include "drake/systems/framework/leaf_system.h"
 
 using Eigen::VectorXd;
 
@@ -21,7 +33,10 @@ class DummyImplicitIntegrator final : public ImplicitIntegrator<double> {
   bool supports_error_estimation() const override { return false; }
   int get_error_estimate_order() const override { return 0; }
 
+  using ImplicitIntegrator<double>::CalcJacobian;
+  using ImplicitIntegrator<double>::ColorJacobianColumns;
   using ImplicitIntegrator<double>::IsUpdateZero;
+  using ImplicitIntegrator<double>::JacobianColoring;
 
   // Returns whether DoResetCachedMatrices() has been called.
   bool get_has_reset_cached_matrices() {
@@ -135,6 +150,263 @@ GTEST_TEST(ImplicitIntegratorTest, SetComputationSchemeResetsCachedMatrices) {
             ImplicitIntegrator<double>
             ::JacobianComputationScheme::kAutomatic);
 }
+
+// A chain of unit masses connected by linear springs, each also attached to
+// the ground by a hardening spring and a damper, whose Jacobian is sparse:
+//   q̇ᵢ = vᵢ,
+//   v̇ᵢ = k (qᵢ₋₁ − 2 qᵢ + qᵢ₊₁) − qᵢ³ − c vᵢ.
+template <typename T>
+class SpringChain final : public LeafSystem<T> {
+ public:
+  explicit SpringChain(int num_masses)
+      : LeafSystem<T>(SystemTypeTag<SpringChain>{}), num_masses_(num_masses) {
+    this->DeclareContinuousState(num_masses, num_masses, 0);
+  }
+
+  template <typename U>
+  explicit SpringChain(const SpringChain<U>& other)
+      : SpringChain(other.num_masses()) {}
+
+  int num_masses() const { return num_masses_; }
+
+  // Returns the sparsity pattern of the Jacobian matrix.
+  std::vector<std::pair<int, int>> CalcJacobianSparsityPattern() const {
+    const int n = num_masses_;
+    std::vector<std::pair<int, int>> pattern;
+    for (int i = 0; i < n; ++i) {
+      pattern.emplace_back(i, n + i);
+      for (int j = std::max(0, i - 1); j <= std::min(n - 1, i + 1); ++j) {
+        pattern.emplace_back(n + i, j);
+      }
+      pattern.emplace_back(n + i, n + i);
+    }
+    return pattern;
+  }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final {
+    const int n = num_masses_;
+    const VectorX<T> x = context.get_continuous_state_vector().CopyToVector();
+    const auto q = x.head(n);
+    const auto v = x.tail(n);
+    VectorX<T> xdot(2 * n);
+    for (int i = 0; i < n; ++i) {
+      const T left = (i > 0) ? T(q(i - 1) - q(i)) : T(-q(i));
+      const T right = (i < n - 1) ? T(q(i + 1) - q(i)) : T(-q(i));
+      xdot(i) = v(i);
+      xdot(n + i) =
+          kStiffness * (left + right) - q(i) * q(i) * q(i) - kDamping * v(i);
+    }
+    derivatives->SetFromVector(xdot);
+  }
+
+  static constexpr double kStiffness = 100.0;
+  static constexpr double kDamping = 0.5;
+  const int num_masses_;
+};
+
+// A system whose time derivatives can't be computed symbolically.
+class DoubleOnlySystem final : public LeafSystem<double> {
+ public:
+  DoubleOnlySystem() { this->DeclareContinuousState(1); }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>& context,
+                             ContinuousState<double>* derivatives) const final {
+    derivatives->SetFromVector(
+        -context.get_continuous_state_vector().CopyToVector());
+  }
+};
+
+// Returns a state of the chain of `num_masses` masses with distinct entries.
+VectorXd MakeChainState(int num_masses) {
+  VectorXd x(2 * num_masses);
+  for (int i = 0; i < x.size(); ++i) {
+    x(i) = std::sin(1.0 + 0.7 * i);
+  }
+  return x;
+}
+
+GTEST_TEST(ImplicitIntegratorTest, ColorJacobianColumns) {
+  // A tridiagonal 6x6 matrix needs three groups.
+  std::vector<std::pair<int, int>> pattern;
+  for (int i = 0; i < 6; ++i) {
+    for (int j = std::max(0, i - 1); j <= std::min(5, i + 1); ++j) {
+      pattern.emplace_back(i, j);
+    }
+  }
+  using JacobianColoring = DummyImplicitIntegrator::JacobianColoring;
+  const JacobianColoring coloring =
+      DummyImplicitIntegrator::ColorJacobianColumns(pattern, 6);
+  EXPECT_EQ(coloring.groups,
+            (std::vector<std::vector<int>>{{0, 3}, {1, 4}, {2, 5}}));
+  EXPECT_EQ(coloring.column_groups, (std::vector<int>{0, 1, 2, 0, 1, 2}));
+  EXPECT_EQ(coloring.column_rows[0], (std::vector<int>{0, 1}));
+
+  // A column without potential nonzeros joins no group.
+  const JacobianColoring sparse_coloring =
+      DummyImplicitIntegrator::ColorJacobianColumns({{0, 0}, {1, 0}}, 3);
+  EXPECT_EQ(sparse_coloring.groups, (std::vector<std::vector<int>>{{0}}));
+  EXPECT_EQ(sparse_coloring.column_groups, (std::vector<int>{0, -1, -1}));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      DummyImplicitIntegrator::ColorJacobianColumns({{0, 3}}, 3),
+      ".*entry \\(0, 3\\), which is outside of the 3x3 Jacobian.*");
+}
+
+// Numerical differencing (perturbing the columns of each group at once, with
+// or without threads) and automatic differentiation over the grouped columns
+// reproduce the dense Jacobian matrix, with one derivative evaluation (or two,
+// for central differences) per group.
+GTEST_TEST(ImplicitIntegratorTest, SparseJacobian) {
+  const int num_masses = 20;
+  const int n = 2 * num_masses;
+  const SpringChain<double> system(num_masses);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  DummyImplicitIntegrator integrator(system, context.get());
+  const VectorXd x = MakeChainState(num_masses);
+
+  using Scheme = ImplicitIntegrator<double>::JacobianComputationScheme;
+  for (Scheme scheme : {Scheme::kForwardDifference, Scheme::kCentralDifference,
+                        Scheme::kAutomatic}) {
+    SCOPED_TRACE(fmt::format("scheme {}", static_cast<int>(scheme)));
+    integrator.set_jacobian_computation_scheme(scheme);
+    integrator.set_jacobian_sparsity_pattern(std::nullopt);
+    integrator.set_jacobian_parallelism(Parallelism::None());
+    const MatrixX<double> dense = integrator.CalcJacobian(0.0, x);
+    EXPECT_EQ(integrator.get_num_jacobian_column_groups(), 0);
+
+    integrator.set_jacobian_sparsity_pattern(
+        system.CalcJacobianSparsityPattern());
+    integrator.ResetStatistics();
+    const MatrixX<double> sparse = integrator.CalcJacobian(0.0, x);
+    // The positions need three groups (each position's column shares rows
+    // with those of its neighbors and their neighbors), and the velocities a
+    // fourth.
+    EXPECT_EQ(integrator.get_num_jacobian_column_groups(), 4);
+    const double tolerance = (scheme == Scheme::kAutomatic) ? 1e-14 : 1e-6;
+    EXPECT_TRUE(CompareMatrices(sparse, dense, tolerance * dense.norm()));
+    if (scheme != Scheme::kAutomatic) {
+      const bool central = (scheme == Scheme::kCentralDifference);
+      const int num_evaluations = central ? 2 * 4 : 4 + 1;
+      EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(),
+                num_evaluations);
+
+      // Evaluating the groups on several threads gives the same result.
+      integrator.set_jacobian_parallelism(Parallelism(3));
+      integrator.ResetStatistics();
+      EXPECT_TRUE(CompareMatrices(integrator.CalcJacobian(0.0, x), sparse));
+      EXPECT_EQ(integrator.get_num_derivative_evaluations_for_jacobian(),
+                num_evaluations);
+
+      // The threads' copies of the context are reused at another time and
+      // state.
+      const VectorXd x2 = 2 * x;
+      integrator.set_jacobian_parallelism(Parallelism::None());
+      const MatrixX<double> sequential = integrator.CalcJacobian(1.0, x2);
+      integrator.set_jacobian_parallelism(Parallelism(3));
+      EXPECT_TRUE(
+          CompareMatrices(integrator.CalcJacobian(1.0, x2), sequential));
+    }
+  }
+
+  // The entries outside of the pattern are zero.
+  integrator.set_jacobian_computation_scheme(Scheme::kForwardDifference);
+  const MatrixX<double> sparse = integrator.CalcJacobian(0.0, x);
+  EXPECT_EQ(sparse(0, 0), 0.0);
+  EXPECT_EQ(sparse(n - 1, 0), 0.0);
+}
+
+GTEST_TEST(ImplicitIntegratorTest, InferJacobianSparsityPattern) {
+  const SpringChain<double> system(5);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  DummyImplicitIntegrator integrator(system, context.get());
+  EXPECT_FALSE(integrator.get_jacobian_sparsity_pattern().has_value());
+  EXPECT_FALSE(integrator.get_has_reset_cached_matrices());
+  EXPECT_TRUE(integrator.InferJacobianSparsityPattern());
+  EXPECT_TRUE(integrator.get_has_reset_cached_matrices());
+  std::vector<std::pair<int, int>> expected =
+      system.CalcJacobianSparsityPattern();
+  std::vector<std::pair<int, int>> inferred =
+      *integrator.get_jacobian_sparsity_pattern();
+  std::sort(expected.begin(), expected.end());
+  std::sort(inferred.begin(), inferred.end());
+  EXPECT_EQ(inferred, expected);
+
+  // Without a symbolic form, the pattern is left unchanged.
+  const DoubleOnlySystem double_only;
+  std::unique_ptr<Context<double>> double_only_context =
+      double_only.CreateDefaultContext();
+  DummyImplicitIntegrator double_only_integrator(double_only,
+                                                 double_only_context.get());
+  EXPECT_FALSE(double_only_integrator.InferJacobianSparsityPattern());
+  EXPECT_FALSE(
+      double_only_integrator.get_jacobian_sparsity_pattern().has_value());
+}
+
+GTEST_TEST(ImplicitIntegratorTest, SparsityPatternErrors) {
+  const SpringChain<double> system(2);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  DummyImplicitIntegrator integrator(system, context.get());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      integrator.set_jacobian_sparsity_pattern(
+          std::vector<std::pair<int, int>>{{0, -1}}),
+      ".*entry \\(0, -1\\) has a negative index.*");
+  integrator.set_jacobian_sparsity_pattern(
+      std::vector<std::pair<int, int>>{{0, 4}});
+  DRAKE_EXPECT_THROWS_MESSAGE(integrator.CalcJacobian(0.0, MakeChainState(2)),
+                              ".*outside of the 4x4 Jacobian matrix.*");
+}
+
+// Integrates the chain with an Integrator until t = 1, with or without the
+// sparsity pattern of its Jacobian matrix, and returns the final state and the
+// number of derivative evaluations for Jacobian matrices.
+template <class Integrator>
+std::pair<VectorXd, int64_t> IntegrateChain(bool sparse) {
+  const int num_masses = 30;
+  const SpringChain<double> system(num_masses);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  context->SetContinuousState(MakeChainState(num_masses));
+  Integrator integrator(system, context.get());
+  integrator.set_target_accuracy(1e-6);
+  integrator.set_maximum_step_size(0.1);
+  if (sparse) {
+    integrator.set_jacobian_sparsity_pattern(
+        system.CalcJacobianSparsityPattern());
+  }
+  integrator.Initialize();
+  integrator.IntegrateWithMultipleStepsToTime(1.0);
+  return {context->get_continuous_state_vector().CopyToVector(),
+          integrator.get_num_derivative_evaluations_for_jacobian()};
+}
+
+// With the sparsity pattern, the integrators (which then also factor their
+// iteration matrices with sparse LU) reach the same state, with many fewer
+// derivative evaluations for Jacobian matrices.
+template <class Integrator>
+void ExpectSparseIntegrationMatchesDense() {
+  const auto [dense_state, dense_evaluations] =
+      IntegrateChain<Integrator>(false);
+  const auto [sparse_state, sparse_evaluations] =
+      IntegrateChain<Integrator>(true);
+  EXPECT_TRUE(CompareMatrices(sparse_state, dense_state, 1e-5));
+  EXPECT_LT(4 * sparse_evaluations, dense_evaluations);
+}
+
+GTEST_TEST(ImplicitIntegratorTest, SparseImplicitEuler) {
+  ExpectSparseIntegrationMatchesDense<ImplicitEulerIntegrator<double>>();
+}
+
+GTEST_TEST(ImplicitIntegratorTest, SparseRadau) {
+  ExpectSparseIntegrationMatchesDense<RadauIntegrator<double>>();
+}
+
+GTEST_TEST(ImplicitIntegratorTest, SparseVelocityImplicitEuler) {
+  ExpectSparseIntegrationMatchesDense<
+      VelocityImplicitEulerIntegrator<double>>();
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
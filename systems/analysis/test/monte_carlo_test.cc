@@ -1,10 +1,17 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <atomic>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
 #include <thread>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/vector_system.h"
@@ -273,6 +280,138 @@ GTEST_TEST(MonteCarloSimulationExceptionTest, BasicTest) {
       std::exception);
 }
 
+// Runs MonteCarloSimulationReusingSimulators() on RandomContextSystem,
+// returning the outputs by sample index and counting the simulators made.
+std::map<int, double> RunReusingSimulators(
+    int num_samples, Parallelism parallelism, std::atomic<int>* num_made,
+    const std::optional<std::filesystem::path>& checkpoint_file = std::nullopt,
+    int max_results = -1) {
+  const SimulatorFactory make_simulator = [num_made](RandomGenerator*) {
+    ++(*num_made);
+    return std::make_unique<Simulator<double>>(
+        std::make_unique<RandomContextSystem>());
+  };
+  std::map<int, double> outputs;
+  const MonteCarloResultCallback on_result =
+      [&outputs, max_results](int sample,
+                              const RandomSimulationResult& result) {
+        if (static_cast<int>(outputs.size()) == max_results) {
+          throw std::runtime_error("interrupted");
+        }
+        EXPECT_EQ(outputs.count(sample), 0);
+        outputs[sample] = result.output;
+      };
+  RandomGenerator generator(1234);
+  MonteCarloSimulationReusingSimulators(
+      make_simulator, nullptr, &GetScalarOutput, 0.1, num_samples, on_result,
+      &generator, parallelism, checkpoint_file);
+  return outputs;
+}
+
+GTEST_TEST(MonteCarloSimulationReusingSimulatorsTest, BasicTest) {
+  const int num_samples = 50;
+  std::atomic<int> num_made{0};
+  const std::map<int, double> serial_outputs =
+      RunReusingSimulators(num_samples, Parallelism::None(), &num_made);
+  EXPECT_EQ(num_made, 1);
+  num_made = 0;
+  const std::map<int, double> parallel_outputs =
+      RunReusingSimulators(num_samples, Parallelism(3), &num_made);
+  EXPECT_LE(num_made, 3);
+
+  // The outputs are all different, and don't depend on the parallelism.
+  ASSERT_EQ(serial_outputs.size(), num_samples);
+  EXPECT_EQ(parallel_outputs, serial_outputs);
+  std::unordered_set<double> distinct_outputs;
+  for (const auto& [sample, output] : serial_outputs) {
+    distinct_outputs.insert(output);
+  }
+  EXPECT_EQ(distinct_outputs.size(), num_samples);
+
+  // Each sample can be reproduced from its snapshot, with a reused simulator.
+  Simulator<double> simulator(std::make_unique<RandomContextSystem>());
+  std::vector<RandomSimulationResult> results;
+  const SimulatorResetFunction reset = [](Simulator<double>* reused,
+                                          RandomGenerator* generator) {
+    Context<double>& context = reused->get_mutable_context();
+    context.SetTime(0.0);
+    reused->get_system().SetRandomContext(&context, generator);
+  };
+  RandomGenerator generator;
+  MonteCarloSimulationReusingSimulators(
+      [](RandomGenerator*) {
+        return std::make_unique<Simulator<double>>(
+            std::make_unique<RandomContextSystem>());
+      },
+      reset, &GetScalarOutput, 0.1, 5,
+      [&results](int sample, const RandomSimulationResult& result) {
+        results.push_back(result);
+      },
+      &generator);
+  ASSERT_EQ(results.size(), 5);
+  for (const RandomSimulationResult& result : results) {
+    RandomGenerator reproduction_generator(result.generator_snapshot);
+    reset(&simulator, &reproduction_generator);
+    simulator.Initialize();
+    simulator.AdvanceTo(0.1);
+    EXPECT_EQ(GetScalarOutput(simulator.get_system(), simulator.get_context()),
+              result.output);
+  }
+}
+
+GTEST_TEST(MonteCarloSimulationReusingSimulatorsTest, Checkpoint) {
+  const int num_samples = 20;
+  const std::filesystem::path checkpoint_file =
+      std::filesystem::path(temp_directory()) / "monte_carlo.checkpoint";
+  std::atomic<int> num_made{0};
+  const std::map<int, double> expected =
+      RunReusingSimulators(num_samples, Parallelism::None(), &num_made);
+
+  // Interrupt a run after 8 results, leaving the remnant of a partial write.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RunReusingSimulators(num_samples, Parallelism(2), &num_made,
+                           checkpoint_file, 8),
+      "interrupted");
+  std::ofstream(checkpoint_file, std::ios::app) << "1";
+  // A temporary file left behind by an interrupted rewrite of the checkpoint
+  // is ignored (and replaced).
+  std::filesystem::path temp_file = checkpoint_file;
+  temp_file += ".tmp";
+  std::ofstream(temp_file) << "garbage";
+
+  // Resuming only simulates the remaining samples, with the same outputs.
+  std::map<int, double> outputs = RunReusingSimulators(
+      num_samples, Parallelism(2), &num_made, checkpoint_file);
+  EXPECT_EQ(outputs.size(), num_samples - 8);
+  for (const auto& [sample, output] : outputs) {
+    EXPECT_EQ(output, expected.at(sample));
+  }
+  EXPECT_FALSE(std::filesystem::exists(temp_file));
+  EXPECT_TRUE(RunReusingSimulators(num_samples, Parallelism(2), &num_made,
+                                   checkpoint_file)
+                  .empty());
+
+  std::ofstream(checkpoint_file, std::ios::app) << "20\n";
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RunReusingSimulators(num_samples, Parallelism::None(), &num_made,
+                           checkpoint_file),
+      ".*line '20', which is not a sample index in \\[0, 20\\).*");
+}
+
+GTEST_TEST(MonteCarloSimulationReusingSimulatorsTest, Exception) {
+  const SimulatorFactory make_simulator = [](RandomGenerator*) {
+    return std::make_unique<Simulator<double>>(
+        std::make_unique<ThrowingRandomContextSystem>());
+  };
+  for (const Parallelism parallelism : {Parallelism(1), Parallelism(2)}) {
+    EXPECT_THROW(MonteCarloSimulationReusingSimulators(
+                     make_simulator, nullptr, &GetScalarOutput, 0.1, 10,
+                     [](int, const RandomSimulationResult&) {}, nullptr,
+                     parallelism),
+                 std::exception);
+  }
+}
+
 // Remove this on 2024-05-01 along with the other deprecations.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
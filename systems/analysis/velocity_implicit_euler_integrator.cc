@@ -4,6 +4,9 @@
 #include <limits>
 #include <stdexcept>
 #include <utility>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
@@ -92,10 +95,31 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
   int64_t existing_ODE_evals = this->get_num_derivative_evaluations();
 
   // Compute the Jacobian using the selected computation scheme.
-  if (this->get_jacobian_computation_scheme() ==
-      ImplicitIntegrator<T>::JacobianComputationScheme::kForwardDifference ||
-      this->get_jacobian_computation_scheme() ==
-      ImplicitIntegrator<T>::JacobianComputationScheme::kCentralDifference) {
+  using JacobianComputationScheme =
+      typename ImplicitIntegrator<T>::JacobianComputationScheme;
+  const bool central = this->get_jacobian_computation_scheme() ==
+                       JacobianComputationScheme::kCentralDifference;
+  const bool numerical_differencing =
+      central || this->get_jacobian_computation_scheme() ==
+                     JacobianComputationScheme::kForwardDifference;
+  if (numerical_differencing &&
+      this->get_jacobian_sparsity_pattern().has_value()) {
+    // Compute the Jacobian using numerical differencing over the grouped
+    // columns of its sparsity pattern.
+    DRAKE_ASSERT(qdot_ != nullptr);
+    if (!Jy_coloring_.has_value()) {
+      Jy_coloring_ = ColorVelocityJacobianColumns();
+    }
+    const std::function<void(int, const VectorX<T>&, VectorX<T>*)> l_of_y =
+        [&qk, &t, &qn, &h, this](int, const VectorX<T>& y_state,
+                                 VectorX<T>* l_result) {
+          *l_result =
+              this->ComputeLOfY(t, y_state, qk, qn, h, this->qdot_.get());
+        };
+    // ℓ(y) is evaluated on the integrator's context, so the groups are
+    // evaluated sequentially.
+    this->ComputeColoredDiffJacobian(*Jy_coloring_, l_of_y, y, central, 1, Jy);
+  } else if (numerical_differencing) {
     // Compute the Jacobian using numerical differencing.
     DRAKE_ASSERT(qdot_ != nullptr);
     // Define the lambda l_of_y to evaluate ℓ(y).
@@ -137,6 +161,60 @@ void VelocityImplicitEulerIntegrator<T>::CalcVelocityJacobian(const T& t,
       this->get_num_derivative_evaluations() - existing_ODE_evals);
 }
 
+template <class T>
+typename ImplicitIntegrator<T>::JacobianColoring
+VelocityImplicitEulerIntegrator<T>::ColorVelocityJacobianColumns() const {
+  const ContinuousState<T>& cstate = this->get_context().get_continuous_state();
+  const int n = cstate.size();
+  const int nq = cstate.num_q();
+  const std::vector<std::pair<int, int>>& pattern =
+      *this->get_jacobian_sparsity_pattern();
+  for (const auto& [row, column] : pattern) {
+    if (row >= n || column >= n) {
+      throw std::logic_error(fmt::format(
+          "VelocityImplicitEulerIntegrator: the Jacobian sparsity pattern has "
+          "the entry ({}, {}), which is outside of the {}x{} Jacobian matrix.",
+          row, column, n, n));
+    }
+  }
+
+  // For each position, the y variables on which its time derivative depends.
+  std::vector<std::vector<int>> position_dependencies(nq);
+  for (const auto& [row, column] : pattern) {
+    if (row < nq && column >= nq) {
+      position_dependencies[row].push_back(column - nq);
+    }
+  }
+
+  // ℓᵢ depends on yⱼ directly, or through a position q whose qⁿ + h N(qₖ) v
+  // depends on yⱼ.
+  std::vector<std::pair<int, int>> y_pattern;
+  for (const auto& [row, column] : pattern) {
+    if (row < nq) continue;
+    if (column >= nq) {
+      y_pattern.emplace_back(row - nq, column - nq);
+    } else {
+      for (int j : position_dependencies[column]) {
+        y_pattern.emplace_back(row - nq, j);
+      }
+    }
+  }
+  return this->ColorJacobianColumns(y_pattern, n - nq);
+}
+
+template <class T>
+void VelocityImplicitEulerIntegrator<T>::SetVelocityJacobianSparsity(
+    typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  if (!this->get_jacobian_sparsity_pattern().has_value()) {
+    iteration_matrix->set_jacobian_sparsity(nullptr);
+    return;
+  }
+  if (!Jy_coloring_.has_value()) {
+    Jy_coloring_ = ColorVelocityJacobianColumns();
+  }
+  iteration_matrix->set_jacobian_sparsity(&Jy_coloring_->column_rows);
+}
+
 template <class T>
 void VelocityImplicitEulerIntegrator<T>::ComputeAutoDiffVelocityJacobian(
     const T& t, const T& h, const VectorX<T>& y, const VectorX<T>& qk,
@@ -201,6 +279,7 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
   DRAKE_DEMAND(iteration_matrix != nullptr);
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
+  SetVelocityJacobianSparsity(iteration_matrix);
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
     CalcVelocityJacobian(t, h, y, qk, qn, Jy);
     this->increment_num_iter_factorizations();
@@ -278,6 +357,7 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
   if (!this->get_use_full_newton()) return;
 
   // Compute the initial Jacobian and iteration matrices and factor them.
+  SetVelocityJacobianSparsity(iteration_matrix);
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
   this->increment_num_iter_factorizations();
   compute_and_factor_iteration_matrix(*Jy, h, iteration_matrix);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <stdexcept>
 
 #include "drake/common/autodiff.h"
@@ -327,6 +328,7 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
 
   void DoResetCachedJacobianRelatedMatrices() final {
       Jy_vie_.resize(0, 0);
+      Jy_coloring_.reset();
       iteration_matrix_vie_ = {};
   }
 
@@ -414,7 +416,9 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // get_jacobian_computation_scheme(), which is either a first-order forward
   // difference, a second-order centered difference, or automatic
   // differentiation. See math::ComputeNumericalGradient() for more details on
-  // the first two methods.
+  // the first two methods. When a Jacobian sparsity pattern is set, the
+  // differences are taken over the grouped columns of
+  // ColorVelocityJacobianColumns() instead.
   // @param t refers to tⁿ⁺¹, the time used in the definition of ℓ(y)
   // @param h is the time-step size parameter, h, used in the definition of
   //        ℓ(y)
@@ -430,6 +434,21 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
                             const VectorX<T>& qk, const VectorX<T>& qn,
                             MatrixX<T>* Jy);
 
+  // Groups the columns of the Jacobian Jₗ(y), whose sparsity pattern follows
+  // from that of the Jacobian ∂f/∂x: the entry (i, j) is potentially nonzero
+  // if f_yᵢ depends on yⱼ, or on a position whose time derivative depends on
+  // yⱼ, per (7).
+  // @pre A Jacobian sparsity pattern is set.
+  // @throws std::exception if an index of the pattern is out of range.
+  typename ImplicitIntegrator<T>::JacobianColoring
+  ColorVelocityJacobianColumns() const;
+
+  // Sets the sparsity of the velocity+misc Jacobian matrix on
+  // `iteration_matrix`, grouping its columns if not already done, if a
+  // Jacobian sparsity pattern is set; otherwise clears it.
+  void SetVelocityJacobianSparsity(
+      typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix);
+
   // Uses automatic differentiation to compute the Jacobian, Jₗ(y), of the
   // function ℓ(y), used in this integrator's residual computation, with
   // respect to y, where y = (v,z). This Jacobian is then defined as:
@@ -640,6 +659,11 @@ class VelocityImplicitEulerIntegrator final : public ImplicitIntegrator<T> {
   // The last computed velocity+misc Jacobian matrix.
   MatrixX<T> Jy_vie_;
 
+  // The grouped columns of the velocity+misc Jacobian matrix, when a Jacobian
+  // sparsity pattern is set; computed along with the first Jacobian matrix
+  // that uses them.
+  std::optional<typename ImplicitIntegrator<T>::JacobianColoring> Jy_coloring_;
+
   // Various statistics.
   int64_t num_nr_iterations_{0};
 
@@ -0,0 +1,126 @@
+// @file
+// Benchmarks the cost of cloning the Context of the ManipulationStation, both
+// as a deep copy (Context::Clone()) and as a copy-on-write clone
+// (Context::CloneCopyOnWrite()). Each benchmark reports the time per clone
+// and, via the `rss_per_clone_KiB` counter, the approximate growth in resident
+// memory per clone. The copy-on-write clones are also measured through their
+// first evaluation of the station's geometry poses, which allocates the cache
+// values that evaluation needs.
+
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+
+#include "drake/examples/manipulation_station/manipulation_station.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using examples::manipulation_station::ManipulationStation;
+
+// Returns the resident set size of this process in bytes, or zero if it can't
+// be determined.
+double GetResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  long total_pages{};   // NOLINT(runtime/int)
+  long resident_pages{};  // NOLINT(runtime/int)
+  if (!(statm >> total_pages >> resident_pages)) return 0;
+  return static_cast<double>(resident_pages) * sysconf(_SC_PAGESIZE);
+}
+
+class ContextCloneBenchmark : public benchmark::Fixture {
+ public:
+  ContextCloneBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(const benchmark::State&) override {
+    station_ = std::make_unique<ManipulationStation<double>>();
+    station_->SetupManipulationClassStation();
+    station_->Finalize();
+    context_ = station_->CreateDefaultContext();
+    // Fill the source's cache, as in the middle of a simulation.
+    EvalPoses(*context_);
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(const benchmark::State&) override {
+    context_.reset();
+    station_.reset();
+  }
+
+ protected:
+  void EvalPoses(const Context<double>& context) const {
+    benchmark::DoNotOptimize(
+        station_->GetOutputPort("geometry_poses").EvalAbstract(context));
+  }
+
+  // Sets the `rss_per_clone_KiB` counter to the growth in resident memory
+  // while holding a batch of the clones made by `make_clone`.
+  void MeasureMemory(
+      const std::function<std::unique_ptr<Context<double>>()>& make_clone,
+      benchmark::State* state) const {
+    const int kNumClones = 16;
+    std::vector<std::unique_ptr<Context<double>>> clones;
+    const double before = GetResidentBytes();
+    for (int i = 0; i < kNumClones; ++i) {
+      clones.push_back(make_clone());
+    }
+    const double after = GetResidentBytes();
+    state->counters["rss_per_clone_KiB"] =
+        (after - before) / kNumClones / 1024;
+  }
+
+  std::unique_ptr<ManipulationStation<double>> station_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContextCloneBenchmark, Clone)(benchmark::State& state) {
+  MeasureMemory([this]() { return context_->Clone(); }, &state);
+  for (auto _ : state) {
+    auto clone = context_->Clone();
+    benchmark::DoNotOptimize(clone);
+  }
+}
+BENCHMARK_REGISTER_F(ContextCloneBenchmark, Clone)
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContextCloneBenchmark, CloneCopyOnWrite)
+(benchmark::State& state) {
+  MeasureMemory([this]() { return context_->CloneCopyOnWrite(); }, &state);
+  for (auto _ : state) {
+    auto clone = context_->CloneCopyOnWrite();
+    benchmark::DoNotOptimize(clone);
+  }
+}
+BENCHMARK_REGISTER_F(ContextCloneBenchmark, CloneCopyOnWrite)
+    ->Unit(benchmark::kMicrosecond);
+
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(ContextCloneBenchmark, CloneCopyOnWriteAndEval)
+(benchmark::State& state) {
+  MeasureMemory(
+      [this]() {
+        auto clone = context_->CloneCopyOnWrite();
+        EvalPoses(*clone);
+        return clone;
+      },
+      &state);
+  for (auto _ : state) {
+    auto clone = context_->CloneCopyOnWrite();
+    EvalPoses(*clone);
+  }
+}
+BENCHMARK_REGISTER_F(ContextCloneBenchmark, CloneCopyOnWriteAndEval)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/primitives/pass_through.h"
 #include "drake/tools/performance/fixture_common.h"
 
@@ -56,6 +57,43 @@ BENCHMARK_F(BasicFixture, PassThrough3)(benchmark::State& state) {
   }
 }
 
+// A system with a single periodic discrete update, which counts its calls.
+class PeriodicCounter final : public LeafSystem<double> {
+ public:
+  PeriodicCounter(double period, double offset) {
+    DeclareDiscreteState(1);
+    DeclarePeriodicDiscreteUpdateEvent(period, offset,
+                                       &PeriodicCounter::Update);
+    DeclareStaticEventTiming();
+  }
+
+ private:
+  EventStatus Update(const Context<double>& context,
+                     DiscreteValues<double>* updates) const {
+    (*updates)[0] = context.get_discrete_state(0)[0] + 1;
+    return EventStatus::Succeeded();
+  }
+};
+
+// Finds the next update times of a Diagram of many subsystems with periodic
+// events, in a handful of distinct timings, as a Simulator does at each step.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(BasicFixture, PeriodicEvents200)(benchmark::State& state) {
+  const int num_subsystems = 200;
+  for (int i = 0; i < num_subsystems; ++i) {
+    const double period = 1e-3 * (1 + i % 4);
+    const double offset = (i % 8 < 4) ? 0.0 : 5e-4;
+    builder_->AddSystem<PeriodicCounter>(period, offset);
+  }
+  Build();
+
+  auto events = diagram_->AllocateCompositeEventCollection();
+  for (auto _ : state) {
+    const double time = diagram_->CalcNextUpdateTime(*context_, events.get());
+    context_->SetTime(time);
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
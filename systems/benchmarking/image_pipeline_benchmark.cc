@@ -0,0 +1,115 @@
+/* @file
+Measures the cost of passing camera images through a chain of systems.
+Refer to the README.md for more information. */
+
+#include <memory>
+#include <vector>
+
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/image.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using sensors::ImageRgba8U;
+
+// One stage of a camera pipeline, which outputs (a copy of) its input image.
+// When `touch_output` is true, the stage also writes one pixel of its output,
+// as an annotating stage would. That forces the stage to copy the pixels, as
+// every stage did before images shared their pixels among copies.
+class ImageStage final : public LeafSystem<double> {
+ public:
+  explicit ImageStage(bool touch_output) : touch_output_(touch_output) {
+    DeclareAbstractInputPort("image", Value<ImageRgba8U>());
+    DeclareAbstractOutputPort("image", &ImageStage::CalcImage);
+  }
+
+ private:
+  void CalcImage(const Context<double>& context, ImageRgba8U* output) const {
+    *output = get_input_port().Eval<ImageRgba8U>(context);
+    if (touch_output_ && output->size() > 0) {
+      output->at(0, 0)[3] = 255;
+    }
+  }
+
+  const bool touch_output_;
+};
+
+class ImagePipeline : public benchmark::Fixture {
+ public:
+  ImagePipeline() {
+    tools::performance::AddMinMaxStatistics(this);
+    this->Unit(benchmark::kMicrosecond);
+  }
+
+  void SetUp(benchmark::State& state) {  // NOLINT(runtime/references)
+    // The image width; the image has a 4:3 aspect ratio.
+    const int width = state.range(0);
+    DRAKE_DEMAND(width >= 4);
+    // Whether each stage writes a pixel of its output.
+    const bool touch_output = state.range(1) != 0;
+
+    DiagramBuilder<double> builder;
+    stages_.clear();
+    for (int i = 0; i < kNumStages; ++i) {
+      stages_.push_back(builder.AddSystem<ImageStage>(touch_output));
+      if (i == 0) {
+        builder.ExportInput(stages_.back()->get_input_port());
+      } else {
+        builder.Connect(stages_[i - 1]->get_output_port(),
+                        stages_[i]->get_input_port());
+      }
+    }
+    builder.ExportOutput(stages_.back()->get_output_port());
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+    input_ = &diagram_->get_input_port().FixValue(
+        context_.get(), ImageRgba8U(width, width * 3 / 4, 128));
+  }
+
+  void TearDown(benchmark::State& state) {  // NOLINT(runtime/references)
+    // Report how many of the stages copied the pixels of their input.
+    int num_copies = 0;
+    for (const ImageStage* stage : stages_) {
+      const Context<double>& stage_context =
+          stage->GetMyContextFromRoot(*context_);
+      const auto& input =
+          stage->get_input_port().Eval<ImageRgba8U>(stage_context);
+      const auto& output =
+          stage->get_output_port().Eval<ImageRgba8U>(stage_context);
+      num_copies += !output.SharesPixelsWith(input);
+    }
+    state.counters["pixel_copies"] = num_copies;
+  }
+
+ protected:
+  static constexpr int kNumStages = 4;
+
+  std::vector<const ImageStage*> stages_;
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  FixedInputPortValue* input_{};
+};
+
+BENCHMARK_DEFINE_F(ImagePipeline, FourStages)(benchmark::State& state) {
+  const OutputPort<double>& output = diagram_->get_output_port();
+  for (auto _ : state) {
+    // Mimic a new frame from the camera, which invalidates every stage.
+    input_->GetMutableData();
+    output.Eval<ImageRgba8U>(*context_);
+  }
+}
+
+// The Args are { image width, touch_output }.
+BENCHMARK_REGISTER_F(ImagePipeline, FourStages)
+    ->Args({640, 0})
+    ->Args({640, 1})
+    ->Args({1280, 0})
+    ->Args({1280, 1});
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,228 @@
+/* @file
+Measures the evaluation of the dynamics of a SymbolicVectorSystem, whose
+expressions are compiled into a symbolic::ExpressionTape, against interpreting
+the same expressions with symbolic::Expression::Evaluate().
+Refer to the README.md for more information. */
+
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include "drake/common/symbolic/expression_tape.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/systems/primitives/symbolic_vector_system.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::VectorXd;
+using symbolic::Environment;
+using symbolic::Expression;
+using symbolic::ExpressionTape;
+using symbolic::Variable;
+
+// A chain of n pendula, each coupled to its neighbors by torsional springs:
+//   θ̇ᵢ = ωᵢ,
+//   ω̇ᵢ = −g sin θᵢ + k (sin(θᵢ₋₁ − θᵢ) + sin(θᵢ₊₁ − θᵢ)) − b ωᵢ,
+// with the parameters g, k, and b. The argument of each benchmark is the number
+// of pendula.
+class PendulumChain : public benchmark::Fixture {
+ public:
+  PendulumChain() {
+    tools::performance::AddMinMaxStatistics(this);
+    this->Unit(benchmark::kMicrosecond);
+  }
+
+  void SetUp(benchmark::State& state) {  // NOLINT(runtime/references)
+    const int n = state.range(0);
+    DRAKE_DEMAND(n >= 2);
+    VectorX<Variable> x(2 * n);
+    for (int i = 0; i < n; ++i) {
+      x[i] = Variable(fmt::format("theta{}", i));
+      x[n + i] = Variable(fmt::format("omega{}", i));
+    }
+    const Vector3<Variable> p(Variable("g"), Variable("k"), Variable("b"));
+    VectorX<Expression> dynamics(2 * n);
+    for (int i = 0; i < n; ++i) {
+      Expression spring = 0;
+      if (i > 0) {
+        spring += sin(x[i - 1] - x[i]);
+      }
+      if (i < n - 1) {
+        spring += sin(x[i + 1] - x[i]);
+      }
+      dynamics[i] = x[n + i];
+      dynamics[n + i] = -p[0] * sin(x[i]) + p[1] * spring - p[2] * x[n + i];
+    }
+    system_ = SymbolicVectorSystemBuilder()
+                  .state(x)
+                  .parameter(p)
+                  .dynamics(dynamics)
+                  .Build();
+    dynamics_ = dynamics;
+
+    // The variables in the order of the system's (and the tapes') parameters.
+    variables_.assign(x.data(), x.data() + x.size());
+    variables_.insert(variables_.end(), p.data(), p.data() + p.size());
+    jacobian_ = symbolic::Jacobian(dynamics_, variables_);
+    // The dynamics are followed by the rows of their Jacobian.
+    const int num_vars = jacobian_.cols();
+    VectorX<Expression> with_jacobian(dynamics_.size() + jacobian_.size());
+    with_jacobian.head(dynamics_.size()) = dynamics_;
+    for (int i = 0; i < jacobian_.rows(); ++i) {
+      with_jacobian.segment(dynamics_.size() + i * num_vars, num_vars) =
+          jacobian_.row(i).transpose();
+    }
+    tape_ = std::make_unique<ExpressionTape>(variables_, dynamics_);
+    jacobian_tape_ =
+        std::make_unique<ExpressionTape>(variables_, with_jacobian);
+
+    values_.resize(variables_.size());
+    for (int i = 0; i < values_.size(); ++i) {
+      values_[i] = 0.1 * (i + 1);
+    }
+    for (const Variable& v : variables_) {
+      env_.insert(v, 0.0);
+    }
+    result_.resize(dynamics_.size());
+    jacobian_result_.resize(with_jacobian.size());
+
+    context_ = system_->CreateDefaultContext();
+    context_->SetContinuousState(values_.head(2 * n));
+    context_->get_mutable_numeric_parameter(0).SetFromVector(values_.tail(3));
+    derivatives_ = system_->AllocateTimeDerivatives();
+
+    autodiff_system_ = system_->ToAutoDiffXd();
+    autodiff_context_ = autodiff_system_->CreateDefaultContext();
+    autodiff_context_->SetTimeStateAndParametersFrom(*context_);
+    autodiff_context_->SetContinuousState(
+        math::InitializeAutoDiff(values_.head(2 * n)));
+    autodiff_derivatives_ = autodiff_system_->AllocateTimeDerivatives();
+  }
+
+ protected:
+  // Sets the variables of an Environment from values_, as the interpreter
+  // requires.
+  Environment MakeEnvironment() const {
+    Environment env = env_;
+    for (int i = 0; i < values_.size(); ++i) {
+      env[variables_[i]] = values_[i];
+    }
+    return env;
+  }
+
+  std::unique_ptr<SymbolicVectorSystem<double>> system_;
+  VectorX<Expression> dynamics_;
+  MatrixX<Expression> jacobian_;
+  std::vector<Variable> variables_;
+  std::unique_ptr<ExpressionTape> tape_;
+  std::unique_ptr<ExpressionTape> jacobian_tape_;
+  VectorXd values_;
+  Environment env_;
+  VectorXd result_;
+  VectorXd jacobian_result_;
+
+  std::unique_ptr<Context<double>> context_;
+  std::unique_ptr<ContinuousState<double>> derivatives_;
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context_;
+  std::unique_ptr<ContinuousState<AutoDiffXd>> autodiff_derivatives_;
+};
+
+// The dynamics, interpreted.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, Interpreter)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    const Environment env = MakeEnvironment();
+    for (int i = 0; i < dynamics_.size(); ++i) {
+      result_[i] = dynamics_[i].Evaluate(env);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, Interpreter)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+// The dynamics, compiled.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, Tape)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    tape_->Evaluate(values_, &result_);
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, Tape)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+// The dynamics and their Jacobian, interpreted.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, InterpreterJacobian)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    const Environment env = MakeEnvironment();
+    for (int i = 0; i < dynamics_.size(); ++i) {
+      jacobian_result_[i] = dynamics_[i].Evaluate(env);
+      for (int j = 0; j < jacobian_.cols(); ++j) {
+        jacobian_result_[dynamics_.size() + i * jacobian_.cols() + j] =
+            jacobian_(i, j).Evaluate(env);
+      }
+    }
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, InterpreterJacobian)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+// The dynamics and their Jacobian, compiled together.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, TapeJacobian)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    jacobian_tape_->Evaluate(values_, &jacobian_result_);
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, TapeJacobian)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+// The time derivatives of the system, for T = double.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, TimeDerivatives)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    system_->CalcTimeDerivatives(*context_, derivatives_.get());
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, TimeDerivatives)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+// The time derivatives of the system, for T = AutoDiffXd with respect to the
+// state.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_DEFINE_F(PendulumChain, TimeDerivativesAutoDiff)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    autodiff_system_->CalcTimeDerivatives(*autodiff_context_,
+                                          autodiff_derivatives_.get());
+  }
+}
+BENCHMARK_REGISTER_F(PendulumChain, TimeDerivativesAutoDiff)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(64);
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
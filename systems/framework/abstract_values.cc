@@ -10,52 +10,133 @@ AbstractValues::~AbstractValues() {}
 AbstractValues::AbstractValues() {}
 
 AbstractValues::AbstractValues(
-    std::vector<std::unique_ptr<AbstractValue>>&& data)
-    : owned_data_(std::move(data)) {
-  for (auto& datum : owned_data_) {
+    std::vector<std::unique_ptr<AbstractValue>>&& data) {
+  for (auto& datum : data) {
     data_.push_back(datum.get());
+    owned_data_.push_back(std::move(datum));
   }
+  given_out_.resize(owned_data_.size());
 }
 
 AbstractValues::AbstractValues(const std::vector<AbstractValue*>& data)
     : data_(data) {}
 
+AbstractValues::AbstractValues(
+    const std::vector<AbstractValues*>& subvalues) {
+  for (AbstractValues* values : subvalues) {
+    DRAKE_DEMAND(values != nullptr);
+    for (int i = 0; i < values->size(); ++i) {
+      spanned_.emplace_back(values, i);
+    }
+  }
+}
+
+AbstractValues::AbstractValues(AbstractValues* values, int start, int count) {
+  DRAKE_DEMAND(values != nullptr);
+  DRAKE_DEMAND(start >= 0 && count >= 0 && start + count <= values->size());
+  for (int i = start; i < start + count; ++i) {
+    spanned_.emplace_back(values, i);
+  }
+}
+
 AbstractValues::AbstractValues(std::unique_ptr<AbstractValue> datum)
     : AbstractValues() {
   data_.push_back(datum.get());
   owned_data_.push_back(std::move(datum));
+  given_out_.push_back(false);
 }
 
-int AbstractValues::size() const { return static_cast<int>(data_.size()); }
+AbstractValues::AbstractValues(
+    std::vector<std::shared_ptr<AbstractValue>> data)
+    : owned_data_(std::move(data)), given_out_(owned_data_.size()) {
+  for (const auto& datum : owned_data_) {
+    data_.push_back(datum.get());
+  }
+}
+
+int AbstractValues::size() const {
+  return static_cast<int>(spanned_.empty() ? data_.size() : spanned_.size());
+}
 
 const AbstractValue& AbstractValues::get_value(int index) const {
   DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [values, i] = spanned_[index];
+    return values->get_value(i);
+  }
   DRAKE_ASSERT(data_[index] != nullptr);
   return *data_[index];
 }
 
 AbstractValue& AbstractValues::get_mutable_value(int index) {
   DRAKE_ASSERT(index >= 0 && index < size());
+  if (!spanned_.empty()) {
+    const auto& [values, i] = spanned_[index];
+    return values->get_mutable_value(i);
+  }
+  if (!owned_data_.empty()) given_out_[index] = true;
+  return GetUnsharedValue(index);
+}
+
+AbstractValue& AbstractValues::GetUnsharedValue(int index) {
+  if (!spanned_.empty()) {
+    const auto& [values, i] = spanned_[index];
+    return values->GetUnsharedValue(i);
+  }
   DRAKE_ASSERT(data_[index] != nullptr);
+  // Make a private copy of a value shared with a copy-on-write clone.
+  if (!owned_data_.empty() && owned_data_[index].use_count() > 1) {
+    owned_data_[index] = data_[index]->Clone();
+    data_[index] = owned_data_[index].get();
+  }
   return *data_[index];
 }
 
+const AbstractValue& AbstractValues::get_unshared_value(int index) const {
+  DRAKE_ASSERT(index >= 0 && index < size());
+  // Replacing a shared element with an equal copy doesn't change the logical
+  // contents of this AbstractValues.
+  return const_cast<AbstractValues*>(this)->GetUnsharedValue(index);
+}
+
 void AbstractValues::SetFrom(const AbstractValues& other) {
   DRAKE_ASSERT(size() == other.size());
   for (int i = 0; i < size(); i++) {
-    DRAKE_ASSERT(data_[i] != nullptr);
-    data_[i]->SetFrom(other.get_value(i));
+    if (&get_value(i) == &other.get_value(i)) continue;
+    GetUnsharedValue(i).SetFrom(other.get_value(i));
   }
 }
 
 std::unique_ptr<AbstractValues> AbstractValues::Clone() const {
   std::vector<std::unique_ptr<AbstractValue>> cloned_data;
-  cloned_data.reserve(data_.size());
-  for (const AbstractValue* datum : data_) {
-    cloned_data.push_back(datum->Clone());
+  cloned_data.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    cloned_data.push_back(get_value(i).Clone());
   }
   return std::make_unique<AbstractValues>(std::move(cloned_data));
 }
 
+std::unique_ptr<AbstractValues> AbstractValues::CloneCopyOnWrite() const {
+  std::vector<std::shared_ptr<AbstractValue>> shared_data;
+  shared_data.reserve(size());
+  for (int i = 0; i < size(); ++i) {
+    std::shared_ptr<AbstractValue> datum = GetShareableValue(i);
+    if (datum == nullptr) datum = get_value(i).Clone();
+    shared_data.push_back(std::move(datum));
+  }
+  return std::unique_ptr<AbstractValues>(
+      new AbstractValues(std::move(shared_data)));
+}
+
+std::shared_ptr<AbstractValue> AbstractValues::GetShareableValue(
+    int index) const {
+  if (!spanned_.empty()) {
+    const auto& [values, i] = spanned_[index];
+    return values->GetShareableValue(i);
+  }
+  if (owned_data_.empty() || given_out_[index]) return nullptr;
+  return owned_data_[index];
+}
+
 }  // namespace systems
 }  // namespace drake
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -14,6 +15,10 @@ namespace systems {
 /// AbstractValues is a container for non-numerical state and parameters.
 /// It may or may not own the underlying data, and therefore is suitable
 /// for both leaf Systems and diagrams.
+///
+/// The values owned by an %AbstractValues may be shared with its copy-on-write
+/// clones (see CloneCopyOnWrite()). Each of them obtains a copy of its own the
+/// first time that a shared value is accessed mutably.
 class AbstractValues {
  public:
   // AbstractState is not copyable or moveable.
@@ -32,6 +37,23 @@ class AbstractValues {
   /// Constructs an AbstractValues that does not own the underlying data.
   explicit AbstractValues(const std::vector<AbstractValue*>& data);
 
+  /// Constructs an AbstractValues that does not own the underlying data, and
+  /// spans all of the elements of each of the given @p subvalues, in order.
+  /// Unlike the constructor above, this one accesses each element through
+  /// the %AbstractValues that holds it, so a value that is shared with a
+  /// copy-on-write clone is copied before it is modified through this one.
+  ///
+  /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  explicit AbstractValues(const std::vector<AbstractValues*>& subvalues);
+
+  /// (Internal use only) Constructs an AbstractValues that does not own the
+  /// underlying data, and spans the @p count elements of @p values starting at
+  /// index @p start. As with the constructor above, each element is accessed
+  /// through @p values.
+  ///
+  /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  AbstractValues(AbstractValues* values, int start, int count);
+
   /// Constructs an AbstractValues that owns a single @p datum.
   ///
   /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
@@ -47,11 +69,37 @@ class AbstractValues {
   const AbstractValue& get_value(int index) const;
 
   /// Returns the element of AbstractValues at the given @p index, or aborts if
-  /// the index is out-of-bounds.
+  /// the index is out-of-bounds. If the element is shared with a copy-on-write
+  /// clone, it is first replaced by a copy, so references to it obtained
+  /// earlier no longer refer to an element of this %AbstractValues. Once
+  /// mutable access to an element has been given out, it is never shared with
+  /// a later copy-on-write clone.
   AbstractValue& get_mutable_value(int index);
 
+  /// (Internal use only) Returns the element at the given @p index, after
+  /// replacing it with a private copy if it is shared with a copy-on-write
+  /// clone. This is for a value that its System updates through const access,
+  /// as if it were cache memory (e.g., SceneGraph's GeometryState). The value
+  /// itself is unchanged, so this doesn't count as mutable access, and the
+  /// element may still be shared with a later copy-on-write clone.
+  ///
+  /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  const AbstractValue& get_unshared_value(int index) const;
+
+  /// Sets the element at the given @p index to @p value, or aborts if the index
+  /// is out-of-bounds.
+  /// Unlike get_mutable_value(), this doesn't give out mutable access, so the
+  /// element may still be shared with a later copy-on-write clone.
+  /// @throws std::exception if the element is not of type V.
+  template <typename V>
+  void set_value(int index, const V& value) {
+    DRAKE_ASSERT(index >= 0 && index < size());
+    GetUnsharedValue(index).set_value<V>(value);
+  }
+
   /// Copies all of the AbstractValues in @p other into this. Asserts if the
-  /// two are not equal in size.
+  /// two are not equal in size. Elements that @p other shares with this are
+  /// left alone.
   /// @throws std::exception if any of the elements are of incompatible type.
   void SetFrom(const AbstractValues& other);
 
@@ -60,14 +108,43 @@ class AbstractValues {
   /// cloned had ownership of its data or not.
   std::unique_ptr<AbstractValues> Clone() const;
 
+  /// (Internal use only) Returns a copy of this AbstractValues that shares
+  /// the values owned here (or by the spanned subvalues) with this one, until
+  /// either of the two accesses them mutably. Values that are not owned, and
+  /// values to which mutable access has already been given out by
+  /// get_mutable_value(), are deep copied instead. This is used by
+  /// ContextBase::CloneCopyOnWrite().
+  ///
+  /// @exclude_from_pydrake_mkdoc{Not bound in pydrake.}
+  std::unique_ptr<AbstractValues> CloneCopyOnWrite() const;
+
  private:
+  // Constructs an AbstractValues that owns the given (possibly shared) data.
+  explicit AbstractValues(std::vector<std::shared_ptr<AbstractValue>> data);
+
+  // Returns the element at `index` for modification, after replacing it with a
+  // private copy if it is shared with a copy-on-write clone. Unlike
+  // get_mutable_value(), this doesn't record that mutable access was given out.
+  AbstractValue& GetUnsharedValue(int index);
+
+  // Returns the owned pointer to the element at `index` if it is owned here
+  // or by the spanned subvalues and may be shared, or else nullptr.
+  std::shared_ptr<AbstractValue> GetShareableValue(int index) const;
+
   // Pointers to the data. If the data is owned, these pointers are equal to
-  // the pointers in owned_data_.
+  // the pointers in owned_data_. Unused when spanning subvalues.
   std::vector<AbstractValue*> data_;
-  // Owned pointers to the data. The only purpose of these pointers is to
-  // maintain ownership. They may be populated at construction time, and are
-  // never accessed thereafter.
-  std::vector<std::unique_ptr<AbstractValue>> owned_data_;
+  // Owned pointers to the data. They may be populated at construction time,
+  // and are otherwise accessed only to share the values with a copy-on-write
+  // clone, or to make a private copy of a shared value before mutable access.
+  std::vector<std::shared_ptr<AbstractValue>> owned_data_;
+  // Whether get_mutable_value() has given out the owned element at each index.
+  // References to such an element may still be in use, so it must not be
+  // shared with a copy-on-write clone.
+  std::vector<bool> given_out_;
+  // When spanning subvalues, the subvalues that hold each element and the
+  // index of the element there.
+  std::vector<std::pair<AbstractValues*, int>> spanned_;
 };
 
 }  // namespace systems
@@ -3,6 +3,7 @@
 #include <typeindex>
 #include <typeinfo>
 
+#include "drake/systems/framework/cache_profiler.h"
 #include "drake/systems/framework/dependency_tracker.h"
 
 namespace drake {
@@ -24,7 +25,8 @@ void CacheEntryValue::ThrowIfBadCacheEntryValue(
   if (owning_subcontext && owning_subcontext_ != owning_subcontext) {
     throw std::logic_error(FormatName(__func__) + "wrong owning subcontext.");
   }
-  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0) {
+  if ((flags_ & ~(kValueIsOutOfDate | kCacheEntryIsDisabled |
+                  kCacheEntryIsProfiled)) != 0) {
     throw std::logic_error(FormatName(__func__) +
                            "flags value is out of range.");
   }
@@ -57,6 +59,22 @@ void CacheEntryValue::ThrowIfBadOtherValue(
   }
 }
 
+Cache::Cache(const Cache& source, bool copy_on_write)
+    : store_(source.store_.size()),
+      dummy_(source.dummy_),
+      is_cache_frozen_(source.is_cache_frozen_) {
+  // A frozen cache can't recompute its values, so they are always copied.
+  const bool omit_values = copy_on_write && !is_cache_frozen_;
+  for (size_t i = 0; i < store_.size(); ++i) {
+    const CacheEntryValue* value = source.store_[i].get();
+    if (value == nullptr) continue;
+    // Can't use make_unique because the constructors are private.
+    store_[i] = std::unique_ptr<CacheEntryValue>(
+        omit_values ? new CacheEntryValue(*value, nullptr)
+                    : new CacheEntryValue(*value));
+  }
+}
+
 CacheEntryValue& Cache::CreateNewCacheEntryValue(
     CacheIndex index, DependencyTicket ticket,
     const std::string& description,
@@ -125,6 +143,14 @@ void Cache::SetAllEntriesOutOfDate() {
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::SetProfiler(CacheProfiler* profiler) {
+  for (auto& entry : store_) {
+    if (!entry) continue;
+    entry->set_profile(profiler != nullptr ? profiler->AddEntry(*entry)
+                                           : nullptr);
+  }
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -4,6 +4,7 @@
 Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <set>
@@ -21,8 +22,13 @@ values. */
 namespace drake {
 namespace systems {
 
+class CacheProfiler;
 class DependencyGraph;
 
+namespace internal {
+class CacheEntryProfile;
+}  // namespace internal
+
 //==============================================================================
 //                             CACHE ENTRY VALUE
 //==============================================================================
@@ -314,26 +320,31 @@ class CacheEntryValue {
 
   /** Returns `true` if the current value is out of date with respect to any of
   its prerequisites. This refers only to the `out_of_date` flag and is
-  independent of whether caching is enabled or disabled. Don't call this if
-  there is no value here; use has_value() if you aren't sure.
+  independent of whether caching is enabled or disabled. A value that has not
+  been allocated yet (see has_value()) is always out of date.
   @see needs_recomputation() */
   bool is_out_of_date() const {
-    DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
     return (flags_ & kValueIsOutOfDate) != 0;
   }
 
   /** Returns `true` if either (a) the value is out of date, or (b) caching
   is disabled for this entry. This is a _very_ fast inline method intended
   to be called every time a cache value is obtained with Eval(). This is
-  equivalent to `is_out_of_date() || is_entry_disabled()` but faster.  Don't
-  call this if there is no value here; use has_value() if you aren't sure.
+  equivalent to `is_out_of_date() || is_entry_disabled()` but faster.
   Note that if this returns true while the cache is frozen, any attempt to
   access the value will fail since recomputation is forbidden in that case.
   However, operation of _this_ method is unaffected by whether the cache
   is frozen. */
   bool needs_recomputation() const {
-    DRAKE_ASSERT_VOID(ThrowIfNoValuePresent(__func__));
-    return flags_ != kReadyToUse;
+    return (flags_ & (kValueIsOutOfDate | kCacheEntryIsDisabled)) != 0;
+  }
+
+  /** Returns `true` if Eval() may return the current value without doing
+  anything else, that is, if the value is up to date, caching is enabled, and
+  this entry is not being profiled. This is the single test performed on the
+  fast path of Eval(). */
+  bool is_ready_to_use() const {
+    return flags_ == kReadyToUse;
   }
 
   /** (Advanced) Marks the cache entry value as up to date with respect to
@@ -389,7 +400,10 @@ class CacheEntryValue {
 
   /** Returns `true` if this %CacheEntryValue currently contains a value object
   at all, regardless of whether it is up to date. There will be no value object
-  after default construction, prior to SetInitialValue(). */
+  after default construction, prior to SetInitialValue(). In a copy-on-write
+  clone of a Context (see ContextBase::CloneCopyOnWrite()) there is no value
+  object until CacheEntry::get_mutable_cache_entry_value() first allocates
+  one, and the value is out of date until then. */
   bool has_value() const { return value_ != nullptr; }
 
   /** Returns the CacheIndex used to locate this %CacheEntryValue within its
@@ -448,6 +462,12 @@ class CacheEntryValue {
   bool is_cache_entry_disabled() const {
     return (flags_ & kCacheEntryIsDisabled) != 0;
   }
+
+  /** (Internal use only) Returns the statistics being collected for this
+  cache entry value by a CacheProfiler, or nullptr if it is not being
+  profiled.
+  @see ContextBase::EnableCacheProfiling() */
+  internal::CacheEntryProfile* profile() const { return profile_; }
   //@}
 
  private:
@@ -489,12 +509,35 @@ class CacheEntryValue {
   // set_owning_subcontext().
   CacheEntryValue(const CacheEntryValue&) = default;
 
+  // Copies everything but the value, for a copy-on-write clone of a Context.
+  // The copy has no value object and is out of date. It also requires
+  // post-copy cleanup via set_owning_subcontext().
+  CacheEntryValue(const CacheEntryValue& source, std::nullptr_t)
+      : cache_index_(source.cache_index_),
+        ticket_(source.ticket_),
+        description_(source.description_),
+        flags_(source.flags_ | kValueIsOutOfDate) {}
+
   // This is the post-copy cleanup method.
+  // Profiling is not copied.
   void set_owning_subcontext(
       const internal::ContextMessageInterface* owning_subcontext) {
     DRAKE_DEMAND(owning_subcontext != nullptr);
     DRAKE_DEMAND(owning_subcontext_ == nullptr);
     owning_subcontext_ = owning_subcontext;
+    flags_ &= ~kCacheEntryIsProfiled;
+  }
+
+  // Starts (or, given nullptr, stops) sending statistics to `profile`. While
+  // profiled, the value is never ready to use so that Eval() takes its slow
+  // path, which records the statistics.
+  void set_profile(internal::CacheEntryProfile* profile) {
+    profile_ = profile;
+    if (profile != nullptr) {
+      flags_ |= kCacheEntryIsProfiled;
+    } else {
+      flags_ &= ~kCacheEntryIsProfiled;
+    }
   }
 
   // Fully-checked method with API name to use in error messages.
@@ -580,12 +623,14 @@ class CacheEntryValue {
   }
 
   // The sense of these flag bits is chosen so that Eval() can check in a single
-  // instruction whether it must recalculate. Only if flags==0 (kReadyToUse) can
-  // we reuse the existing value. See needs_recomputation() above.
+  // instruction whether it must do anything other than return the existing
+  // value. Only if flags==0 (kReadyToUse) can it do just that. See
+  // is_ready_to_use() above.
   enum Flags : int {
-    kReadyToUse           = 0b00,
-    kValueIsOutOfDate     = 0b01,
-    kCacheEntryIsDisabled = 0b10
+    kReadyToUse           = 0b000,
+    kValueIsOutOfDate     = 0b001,
+    kCacheEntryIsDisabled = 0b010,
+    kCacheEntryIsProfiled = 0b100
   };
 
   // The index for this CacheEntryValue within its containing subcontext.
@@ -610,6 +655,10 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // The statistics of this value, when it is being profiled. The profile
+  // belongs to the CacheProfiler of the root Context, so is not copied.
+  reset_on_copy<internal::CacheEntryProfile*> profile_;
 };
 
 //==============================================================================
@@ -714,6 +763,11 @@ class Cache {
   normal caching behavior resumes. */
   void SetAllEntriesOutOfDate();
 
+  /** (Internal use only) Starts profiling every entry in this %Cache with
+  `profiler`, or stops profiling them if `profiler` is null.
+  @see ContextBase::EnableCacheProfiling() for the user-facing API */
+  void SetProfiler(CacheProfiler* profiler);
+
   /** (Advanced) Sets the "is frozen" flag. Cache entry values should check this
   before permitting mutable access to values.
   @see ContextBase::FreezeCache() for the user-facing API */
@@ -745,7 +799,12 @@ class Cache {
   // must be set properly using RepairCachePointers() once the new subcontext is
   // available. This should only be invoked by ContextBase code as part of
   // copying an entire Context tree.
-  Cache(const Cache& source) = default;
+  Cache(const Cache& source) : Cache(source, false) {}
+
+  // The same, but for a copy-on-write clone of the Context (see
+  // ContextBase::CloneCopyOnWrite()) the cache entry values are copied without
+  // their values unless the cache is frozen; see CacheEntryValue::has_value().
+  Cache(const Cache& source, bool copy_on_write);
 
   // Assumes `this` %Cache is a recent copy that does not yet have its pointers
   // to the system name-providing service of the new owning Context, and sets
@@ -6,6 +6,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/systems/framework/cache_profiler.h"
 
 namespace drake {
 namespace systems {
@@ -51,6 +52,20 @@ void CacheEntry::Calc(const ContextBase& context,
   value_producer_.Calc(context, value);
 }
 
+void CacheEntry::UpdateOrProfileValue(const ContextBase& context) const {
+  const CacheEntryValue& cache_value = get_cache_entry_value(context);
+  internal::CacheEntryProfile* const profile = cache_value.profile();
+  if (profile == nullptr) {
+    UpdateValue(context);
+  } else if (!cache_value.needs_recomputation()) {
+    profile->RecordHit();
+  } else {
+    profile->RecordMiss([this, &context]() {
+      UpdateValue(context);
+    });
+  }
+}
+
 void CacheEntry::CheckValidAbstractValue(const ContextBase& context,
                                          const AbstractValue& proposed) const {
   const CacheEntryValue& cache_value = get_cache_entry_value(context);
@@ -149,7 +149,7 @@ class CacheEntry {
   // called *a lot*.
   const AbstractValue& EvalAbstract(const ContextBase& context) const {
     const CacheEntryValue& cache_value = get_cache_entry_value(context);
-    if (cache_value.needs_recomputation()) UpdateValue(context);
+    if (!cache_value.is_ready_to_use()) UpdateOrProfileValue(context);
     return cache_value.get_abstract_value();
   }
 
@@ -246,7 +246,8 @@ class CacheEntry {
   object contains the current value and tracks whether it is up to date with
   respect to its prerequisites. If you just need the value, use the Eval()
   method rather than this one. This method is constant time and _very_ fast in
-  all circumstances. */
+  all circumstances. In a copy-on-write clone of a Context, the returned
+  object may not hold a value yet; see CacheEntryValue::has_value(). */
   const CacheEntryValue& get_cache_entry_value(
       const ContextBase& context) const {
     DRAKE_ASSERT_VOID(owning_system_->ValidateContext(context));
@@ -257,12 +258,16 @@ class CacheEntry {
   corresponds to this %CacheEntry, from the supplied Context. Note that
   `context` is const; cache values are mutable. Don't call this method unless
   you know what you're doing. This method is constant time and _very_ fast in
-  all circumstances. */
+  all circumstances, except that in a copy-on-write clone of a Context (see
+  ContextBase::CloneCopyOnWrite()) the first call allocates the value. */
   CacheEntryValue& get_mutable_cache_entry_value(
       const ContextBase& context) const {
     DRAKE_ASSERT_VOID(owning_system_->ValidateContext(context));
-    return context.get_mutable_cache().get_mutable_cache_entry_value(
-        cache_index_);
+    CacheEntryValue& cache_value =
+        context.get_mutable_cache().get_mutable_cache_entry_value(
+            cache_index_);
+    if (!cache_value.has_value()) cache_value.SetInitialValue(Allocate());
+    return cache_value;
   }
 
   /** Returns the CacheIndex used to locate this %CacheEntry within the
@@ -307,6 +312,10 @@ class CacheEntry {
     mutable_cache_value.mark_up_to_date();
   }
 
+  // The slow path of EvalAbstract(): updates the value if it needs
+  // recomputation, and records the evaluation if the value is being profiled.
+  void UpdateOrProfileValue(const ContextBase& context) const;
+
   // The value was unexpectedly out of date. Issue a helpful message.
   void ThrowOutOfDate(const char* api) const {
     throw std::logic_error(FormatName(api) + "value out of date.");
@@ -0,0 +1,292 @@
+#include "drake/systems/framework/cache_profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/scope_exit.h"
+#include "drake/common/ssize.h"
+#include "drake/systems/framework/cache.h"
+#include "drake/systems/framework/dependency_tracker.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+namespace {
+
+// The total time spent by the profiled updates that were nested directly
+// within the profiled update now running on this thread (if any), so that the
+// latter's self time can exclude them.
+thread_local int64_t* nested_nanoseconds = nullptr;
+
+}  // namespace
+
+CacheEntryProfile::CacheEntryProfile(const CacheEntryValue* cache_value)
+    : cache_value_(cache_value) {
+  DRAKE_DEMAND(cache_value != nullptr);
+}
+
+void CacheEntryProfile::RecordMiss(const std::function<void()>& update) {
+  int64_t nested = 0;
+  int64_t* const enclosing = nested_nanoseconds;
+  nested_nanoseconds = &nested;
+  ScopeExit guard([enclosing]() {
+    nested_nanoseconds = enclosing;
+  });
+  const auto start = std::chrono::steady_clock::now();
+  update();
+  const int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+  if (enclosing != nullptr) *enclosing += elapsed;
+  num_misses_.fetch_add(1, std::memory_order_relaxed);
+  compute_nanoseconds_.fetch_add(elapsed, std::memory_order_relaxed);
+  self_nanoseconds_.fetch_add(elapsed - nested, std::memory_order_relaxed);
+}
+
+void CacheEntryProfile::RecordInvalidation(const DependencyTracker& source,
+                                           const DependencyTracker& upstream) {
+  ++num_invalidations_;
+  ++invalidations_by_source_[&source];
+  ++invalidations_by_upstream_[&upstream];
+}
+
+void CacheEntryProfile::Reset() {
+  num_hits_ = 0;
+  num_misses_ = 0;
+  compute_nanoseconds_ = 0;
+  self_nanoseconds_ = 0;
+  num_invalidations_ = 0;
+  invalidations_by_source_.clear();
+  invalidations_by_upstream_.clear();
+}
+
+}  // namespace internal
+
+namespace {
+
+using internal::CacheEntryProfile;
+
+// LeafSystem describes the cache entry of its output port n (named `name`) as
+// "output port n(name) cache".
+bool IsOutputPortDescription(const std::string& description) {
+  const std::string prefix = "output port ";
+  const std::string suffix = ") cache";
+  return description.size() > prefix.size() + suffix.size() &&
+         description.compare(0, prefix.size(), prefix) == 0 &&
+         description.compare(description.size() - suffix.size(),
+                             suffix.size(), suffix) == 0;
+}
+
+std::string EscapeForGraphviz(const std::string& text) {
+  std::string result;
+  for (const char c : text) {
+    if (c == '"' || c == '\\') result += '\\';
+    result += c;
+  }
+  return result;
+}
+
+}  // namespace
+
+CacheProfiler::CacheProfiler() = default;
+
+CacheProfiler::~CacheProfiler() = default;
+
+CacheEntryProfile* CacheProfiler::AddEntry(const CacheEntryValue& cache_value) {
+  entries_.push_back(std::make_unique<CacheEntryProfile>(&cache_value));
+  return entries_.back().get();
+}
+
+std::vector<CacheProfiler::EntryStatistics> CacheProfiler::GetStatistics()
+    const {
+  std::vector<EntryStatistics> result;
+  result.reserve(entries_.size());
+  for (const auto& entry : entries_) {
+    const CacheEntryValue& value = *entry->cache_value_;
+    EntryStatistics stats;
+    stats.description = value.description();
+    const std::string path = value.GetPathDescription();
+    stats.system_pathname =
+        path.substr(0, path.size() - stats.description.size() - 1);
+    stats.is_output_port = IsOutputPortDescription(stats.description);
+    stats.num_hits = entry->num_hits_;
+    stats.num_misses = entry->num_misses_;
+    stats.compute_time = 1e-9 * entry->compute_nanoseconds_;
+    stats.self_time = 1e-9 * entry->self_nanoseconds_;
+    stats.num_invalidations = entry->num_invalidations_;
+    for (const auto& [source, count] : entry->invalidations_by_source_) {
+      stats.invalidation_sources.emplace_back(source->GetPathDescription(),
+                                              count);
+    }
+    std::sort(stats.invalidation_sources.begin(),
+              stats.invalidation_sources.end(),
+              [](const auto& a, const auto& b) {
+                return std::tie(b.second, a.first) <
+                       std::tie(a.second, b.first);
+              });
+    result.push_back(std::move(stats));
+  }
+  std::stable_sort(result.begin(), result.end(),
+                   [](const EntryStatistics& a, const EntryStatistics& b) {
+                     return std::make_tuple(b.compute_time,
+                                            b.num_evaluations()) <
+                            std::make_tuple(a.compute_time,
+                                            a.num_evaluations());
+                   });
+  return result;
+}
+
+std::string CacheProfiler::GetReport(int max_entries) const {
+  const std::vector<EntryStatistics> statistics = GetStatistics();
+  int64_t num_hits = 0;
+  int64_t num_misses = 0;
+  double self_time = 0.0;
+  for (const EntryStatistics& stats : statistics) {
+    num_hits += stats.num_hits;
+    num_misses += stats.num_misses;
+    self_time += stats.self_time;
+  }
+  std::string result = fmt::format(
+      "Cache profile of {} entries: {} evaluations, {} hits, {} misses, "
+      "{:.3f} ms computing.\n",
+      statistics.size(), num_hits + num_misses, num_hits, num_misses,
+      1e3 * self_time);
+  result += fmt::format("{:>10} {:>10} {:>9} {:>9} {:>9} {:>9}  {}\n",
+                        "total ms", "self ms", "evals", "hits", "misses",
+                        "invalid", "cache entry");
+  int num_listed = 0;
+  int num_omitted = 0;
+  for (const EntryStatistics& stats : statistics) {
+    if (stats.num_evaluations() == 0 && stats.num_invalidations == 0) {
+      continue;
+    }
+    if (num_listed == max_entries) {
+      ++num_omitted;
+      continue;
+    }
+    ++num_listed;
+    result += fmt::format(
+        "{:>10.3f} {:>10.3f} {:>9} {:>9} {:>9} {:>9}  {}:{}{}\n",
+        1e3 * stats.compute_time, 1e3 * stats.self_time,
+        stats.num_evaluations(), stats.num_hits, stats.num_misses,
+        stats.num_invalidations, stats.system_pathname, stats.description,
+        stats.is_output_port ? " [output]" : "");
+    if (!stats.invalidation_sources.empty()) {
+      std::string sources;
+      for (const auto& [source, count] : stats.invalidation_sources) {
+        if (!sources.empty()) sources += ", ";
+        sources += fmt::format("{} ({})", source, count);
+      }
+      result += fmt::format("{:>63}invalidated by {}\n", "", sources);
+    }
+  }
+  if (num_omitted > 0) {
+    result += fmt::format("... and {} more entries.\n", num_omitted);
+  }
+  return result;
+}
+
+std::string CacheProfiler::GetGraphvizString(int max_edges) const {
+  // Find the profile of each cache entry tracker, to tell apart the edges from
+  // cache entries and those from sources.
+  std::map<const CacheEntryValue*, const CacheEntryProfile*> profiles;
+  for (const auto& entry : entries_) {
+    profiles.emplace(entry->cache_value_, entry.get());
+  }
+
+  // Collect the edges, hottest first.
+  struct Edge {
+    const DependencyTracker* upstream{};
+    const CacheEntryProfile* downstream{};
+    int64_t count{};
+  };
+  std::vector<Edge> edges;
+  for (const auto& entry : entries_) {
+    for (const auto& [upstream, count] : entry->invalidations_by_upstream_) {
+      edges.push_back(Edge{upstream, entry.get(), count});
+    }
+  }
+  std::stable_sort(edges.begin(), edges.end(),
+                   [](const Edge& a, const Edge& b) {
+                     return a.count > b.count;
+                   });
+  if (ssize(edges) > max_edges) edges.resize(std::max(max_edges, 0));
+  const double max_count = edges.empty() ? 1.0 : edges.front().count;
+
+  // Name the nodes in order of appearance.
+  std::map<const void*, std::string> node_names;
+  std::vector<const CacheEntryProfile*> entry_nodes;
+  std::vector<const DependencyTracker*> source_nodes;
+  auto name_entry = [&](const CacheEntryProfile* profile) {
+    auto [iter, inserted] = node_names.emplace(profile, "");
+    if (inserted) {
+      iter->second = fmt::format("e{}", entry_nodes.size());
+      entry_nodes.push_back(profile);
+    }
+    return iter->second;
+  };
+  auto name_upstream = [&](const DependencyTracker* tracker) {
+    const CacheEntryValue* value = tracker->cache_entry_value();
+    if (value != nullptr && profiles.contains(value)) {
+      return name_entry(profiles.at(value));
+    }
+    auto [iter, inserted] = node_names.emplace(tracker, "");
+    if (inserted) {
+      iter->second = fmt::format("s{}", source_nodes.size());
+      source_nodes.push_back(tracker);
+    }
+    return iter->second;
+  };
+  std::string edge_lines;
+  for (const Edge& edge : edges) {
+    const std::string from = name_upstream(edge.upstream);
+    const std::string to = name_entry(edge.downstream);
+    const double heat = edge.count / max_count;
+    edge_lines += fmt::format(
+        "  {} -> {} [label=\"{}\", penwidth={:.2f}, "
+        "color=\"0.000 {:.3f} 0.850\"];\n",
+        from, to, edge.count, 1.0 + 4.0 * heat, heat);
+  }
+
+  double max_self_nanoseconds = 1.0;
+  for (const CacheEntryProfile* profile : entry_nodes) {
+    max_self_nanoseconds = std::max<double>(max_self_nanoseconds,
+                                            profile->self_nanoseconds_);
+  }
+  std::string result =
+      "digraph CacheProfile {\n"
+      "  rankdir=LR;\n"
+      "  node [shape=box, style=filled, fillcolor=white];\n";
+  for (const CacheEntryProfile* profile : entry_nodes) {
+    const double self_time = 1e-9 * profile->self_nanoseconds_;
+    result += fmt::format(
+        "  {} [label=\"{}\\n{} misses, {:.3f} ms\", "
+        "fillcolor=\"0.000 {:.3f} 1.000\"];\n",
+        node_names.at(profile),
+        EscapeForGraphviz(profile->cache_value_->GetPathDescription()),
+        profile->num_misses_.load(), 1e3 * self_time,
+        profile->self_nanoseconds_ / max_self_nanoseconds);
+  }
+  for (const DependencyTracker* tracker : source_nodes) {
+    result += fmt::format("  {} [label=\"{}\", shape=ellipse];\n",
+                          node_names.at(tracker),
+                          EscapeForGraphviz(tracker->GetPathDescription()));
+  }
+  result += edge_lines;
+  result += "}\n";
+  return result;
+}
+
+void CacheProfiler::Reset() {
+  for (const auto& entry : entries_) {
+    entry->Reset();
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
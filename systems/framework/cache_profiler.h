@@ -0,0 +1,169 @@
+#pragma once
+
+/** @file
+Declares CacheProfiler, which collects statistics about the cache entries of a
+Context. */
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+class Cache;
+class CacheEntryValue;
+class CacheProfiler;
+class ContextBase;
+class DependencyTracker;
+
+namespace internal {
+
+/* The statistics that a CacheProfiler collects for one CacheEntryValue. The
+evaluation counters may be updated by several threads at once (for example,
+see Diagram::set_parallelism()); invalidations only happen while a Context is
+being modified, which is never concurrent. */
+class CacheEntryProfile {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CacheEntryProfile)
+
+  explicit CacheEntryProfile(const CacheEntryValue* cache_value);
+
+  // Records an Eval() that returned the current value.
+  void RecordHit() { num_hits_.fetch_add(1, std::memory_order_relaxed); }
+
+  // Records an Eval() that updated the value by invoking `update`, which is
+  // timed. Nothing is recorded if `update` throws.
+  void RecordMiss(const std::function<void()>& update);
+
+  // Records that the value was marked out of date by a change initiated by
+  // `source`, which reached it through the nearest `upstream` cache entry
+  // (or directly from the `source`).
+  void RecordInvalidation(const DependencyTracker& source,
+                          const DependencyTracker& upstream);
+
+ private:
+  friend class drake::systems::CacheProfiler;
+
+  // Zeroes all of the statistics.
+  void Reset();
+
+  const CacheEntryValue* const cache_value_;
+
+  std::atomic<int64_t> num_hits_{0};
+  std::atomic<int64_t> num_misses_{0};
+  std::atomic<int64_t> compute_nanoseconds_{0};
+  std::atomic<int64_t> self_nanoseconds_{0};
+
+  int64_t num_invalidations_{0};
+  std::map<const DependencyTracker*, int64_t> invalidations_by_source_;
+  std::map<const DependencyTracker*, int64_t> invalidations_by_upstream_;
+};
+
+}  // namespace internal
+
+/** (Debugging) Collects statistics about the cache entries of a Context, to
+find the ones that are recomputed too often or cost the most. A profiler is
+created by ContextBase::EnableCacheProfiling() and belongs to that Context.
+Profiling costs nothing while it is disabled (the default); while enabled, it
+adds some bookkeeping to every Eval() of every cache entry in the Context, so
+it is meant for performance studies rather than production use.
+
+For each cache entry (including those that hold the values of leaf system
+output ports, the time derivatives, etc.) the profiler records:
+- the number of evaluations (calls to Eval()), split into hits that returned
+  the cached value and misses that recomputed it,
+- the time spent recomputing the value, both in total and excluding the time
+  spent recomputing the other (profiled) cache entries that it evaluated, and
+- the number of invalidations, i.e., of times the entry was marked out of
+  date, and the sources that initiated them (e.g., time, a state variable, or
+  a fixed input port value).
+
+The statistics are available directly (GetStatistics()), as a text report
+(GetReport()), or as a Graphviz graph of the invalidations that flow between
+the cache entries (GetGraphvizString()). Only evaluations through Eval() are
+counted; unconditional CacheEntry::Calc() calls are not. */
+class CacheProfiler {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(CacheProfiler)
+
+  /** The statistics of one cache entry. */
+  struct EntryStatistics {
+    /** Returns the number of evaluations, i.e., of hits and misses. */
+    int64_t num_evaluations() const { return num_hits + num_misses; }
+
+    /** The full path name of the subsystem that owns the cache entry. */
+    std::string system_pathname;
+
+    /** The description of the cache entry. */
+    std::string description;
+
+    /** Whether the cache entry holds the value of a leaf system output port.
+    */
+    bool is_output_port{false};
+
+    /** The number of evaluations that returned the cached value. */
+    int64_t num_hits{0};
+
+    /** The number of evaluations that recomputed the value. */
+    int64_t num_misses{0};
+
+    /** The total time spent recomputing the value, in seconds. */
+    double compute_time{0.0};
+
+    /** The part of `compute_time` that was not spent recomputing other
+    profiled cache entries, in seconds. */
+    double self_time{0.0};
+
+    /** The number of times that the value was marked out of date. */
+    int64_t num_invalidations{0};
+
+    /** The path descriptions of the dependency trackers that initiated the
+    invalidations, with their counts, in decreasing order of count. */
+    std::vector<std::pair<std::string, int64_t>> invalidation_sources;
+  };
+
+  ~CacheProfiler();
+
+  /** Returns the statistics of every profiled cache entry, in decreasing
+  order of compute time, then of number of evaluations. */
+  std::vector<EntryStatistics> GetStatistics() const;
+
+  /** Returns a human-readable table of the statistics of (at most)
+  `max_entries` cache entries that were evaluated or invalidated, in the order
+  of GetStatistics(), along with the totals over all entries. */
+  std::string GetReport(int max_entries = 25) const;
+
+  /** Returns a Graphviz string of the (at most) `max_edges` most frequently
+  used invalidation paths. Each edge goes from a cache entry (or from the
+  source of a change, such as time) to a cache entry that it invalidated, and
+  is drawn thicker and redder the more invalidations it carried. The cache
+  entries are shaded by their self time and labeled with their number of
+  misses. */
+  std::string GetGraphvizString(int max_edges = 50) const;
+
+  /** Zeroes all of the statistics. */
+  void Reset();
+
+ private:
+  friend class Cache;
+  friend class ContextBase;
+
+  CacheProfiler();
+
+  // Starts collecting statistics for `cache_value`, which must stay alive for
+  // the lifetime of this profiler. Returns the profile to be updated.
+  internal::CacheEntryProfile* AddEntry(const CacheEntryValue& cache_value);
+
+  std::vector<std::unique_ptr<internal::CacheEntryProfile>> entries_;
+};
+
+}  // namespace systems
+}  // namespace drake
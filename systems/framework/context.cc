@@ -1,9 +1,26 @@
 #include "drake/systems/framework/context.h"
 
+#include <memory>
+
 #include "drake/common/pointer_cast.h"
 
 namespace drake {
 namespace systems {
+namespace {
+
+// Returns a copy of `source` for a copy-on-write clone of its Context.
+template <typename T>
+std::unique_ptr<Parameters<T>> CloneParametersCopyOnWrite(
+    const Parameters<T>& source) {
+  auto clone = std::make_unique<Parameters<T>>();
+  clone->set_numeric_parameters(source.get_numeric_parameters().Clone());
+  clone->set_abstract_parameters(
+      source.get_abstract_parameters().CloneCopyOnWrite());
+  clone->set_system_id(source.get_system_id());
+  return clone;
+}
+
+}  // namespace
 
 template <typename T>
 void Context<T>::SetTime(const T& time_sec) {
@@ -99,6 +116,12 @@ std::unique_ptr<Context<T>> Context<T>::Clone() const {
   return dynamic_pointer_cast_or_throw<Context<T>>(ContextBase::Clone());
 }
 
+template <typename T>
+std::unique_ptr<Context<T>> Context<T>::CloneCopyOnWrite() const {
+  return dynamic_pointer_cast_or_throw<Context<T>>(
+      ContextBase::CloneCopyOnWrite());
+}
+
 template <typename T>
 std::unique_ptr<State<T>> Context<T>::CloneState() const {
   auto result = DoCloneState();
@@ -122,7 +145,17 @@ template <typename T>
 Context<T>::Context() = default;
 
 template <typename T>
-Context<T>::Context(const Context<T>&) = default;
+Context<T>::Context(const Context<T>& source) : Context(source, false) {}
+
+template <typename T>
+Context<T>::Context(const Context<T>& source, bool copy_on_write)
+    : ContextBase(source, copy_on_write),
+      time_(source.time_),
+      true_time_(source.true_time_),
+      accuracy_(source.accuracy_),
+      parameters_(copy_on_write
+                      ? CloneParametersCopyOnWrite(*source.parameters_)
+                      : source.parameters_->Clone()) {}
 
 template <typename T>
 void Context<T>::PropagateTimeChange(
@@ -147,9 +180,9 @@ void Context<T>::PropagateAccuracyChange(
 
 template <typename T>
 std::unique_ptr<Context<T>> Context<T>::CloneWithoutPointers(
-    const Context<T>& source) {
+    const Context<T>& source, bool copy_on_write) {
   return dynamic_pointer_cast_or_throw<Context<T>>(
-      ContextBase::CloneWithoutPointers(source));
+      ContextBase::CloneWithoutPointers(source, copy_on_write));
 }
 
 template <typename T>
@@ -702,6 +702,13 @@ class Context : public ContextBase {
   // a more convenient type.
   std::unique_ptr<Context<T>> Clone() const;
 
+  /** Returns a copy-on-write copy of this Context; see
+  ContextBase::CloneCopyOnWrite() for details.
+  @throws std::exception if this is not the root context. */
+  // This is just an intentional shadowing of the base class method to return
+  // a more convenient type.
+  std::unique_ptr<Context<T>> CloneCopyOnWrite() const;
+
   /** Returns a deep copy of this Context's State. */
   std::unique_ptr<State<T>> CloneState() const;
 
@@ -739,7 +746,12 @@ class Context : public ContextBase {
   /** Copy constructor takes care of base class and `Context<T>` data members.
   Derived classes must implement copy constructors that delegate to this
   one for use in their DoCloneWithoutPointers() implementations. */
-  Context(const Context<T>&);
+  Context(const Context<T>& source);
+
+  /** (Internal use only) The same, but if `copy_on_write` is true, the cache
+  and the abstract parameters are copied for a copy-on-write clone; see
+  ContextBase::CloneCopyOnWrite(). */
+  Context(const Context<T>& source, bool copy_on_write);
 
   // Structuring these methods as statics permits a DiagramContext to invoke
   // the protected functionality on its children.
@@ -775,9 +787,10 @@ class Context : public ContextBase {
   // This is just an intentional shadowing of the base class method to return a
   // more convenient type.
   /** (Internal use only) Clones a context but without any of its internal
-  pointers. */
+  pointers. If `copy_on_write` is true, the clone is a copy-on-write clone;
+  see ContextBase::CloneCopyOnWrite(). */
   static std::unique_ptr<Context<T>> CloneWithoutPointers(
-      const Context<T>& source);
+      const Context<T>& source, bool copy_on_write = false);
 
   /** Returns a const reference to its concrete State object. */
   virtual const State<T>& do_access_state() const = 0;
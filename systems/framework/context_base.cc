@@ -9,13 +9,64 @@ namespace drake {
 namespace systems {
 
 std::unique_ptr<ContextBase> ContextBase::Clone() const {
+  return CloneImpl(__func__, false);
+}
+
+std::unique_ptr<ContextBase> ContextBase::CloneCopyOnWrite() const {
+  return CloneImpl(__func__, true);
+}
+
+ContextBase::ContextBase(const ContextBase& source, bool copy_on_write)
+    : internal::ContextMessageInterface(source),
+      input_port_tickets_(source.input_port_tickets_),
+      output_port_tickets_(source.output_port_tickets_),
+      discrete_state_tickets_(source.discrete_state_tickets_),
+      abstract_state_tickets_(source.abstract_state_tickets_),
+      numeric_parameter_tickets_(source.numeric_parameter_tickets_),
+      abstract_parameter_tickets_(source.abstract_parameter_tickets_),
+      input_port_values_(source.input_port_values_),
+      input_port_type_checkers_(source.input_port_type_checkers_),
+      cache_(source.cache_, copy_on_write),
+      current_change_event_(source.current_change_event_),
+      use_default_implementation_(source.use_default_implementation_),
+      graph_(source.graph_),
+      parent_(source.parent_),
+      system_name_(source.system_name_),
+      system_id_(source.system_id_),
+      is_context_base_initialized_(source.is_context_base_initialized_),
+      cache_profiler_(source.cache_profiler_) {}
+
+ContextBase::~ContextBase() {}
+
+CacheProfiler& ContextBase::EnableCacheProfiling() const {
+  if (!is_root_context()) {
+    throw std::logic_error(fmt::format(
+        "Context::EnableCacheProfiling(): Cannot profile a non-root Context; "
+        "this Context was created by '{}'.", system_name_));
+  }
+  if (cache_profiler_ == nullptr) {
+    cache_profiler_.reset(new CacheProfiler);
+    PropagateCacheProfiler(*this, cache_profiler_.get());
+  }
+  return *cache_profiler_;
+}
+
+void ContextBase::DisableCacheProfiling() const {
+  if (cache_profiler_ == nullptr) return;
+  PropagateCacheProfiler(*this, nullptr);
+  cache_profiler_.reset();
+}
+
+std::unique_ptr<ContextBase> ContextBase::CloneImpl(
+    const char* func_name, bool copy_on_write) const {
   if (!is_root_context()) {
       throw std::logic_error(fmt::format(
-          "Context::Clone(): Cannot clone a non-root Context; "
-          "this Context was created by '{}'.", system_name_));
+          "Context::{}(): Cannot clone a non-root Context; "
+          "this Context was created by '{}'.", func_name, system_name_));
   }
 
-  std::unique_ptr<ContextBase> clone_ptr(CloneWithoutPointers(*this));
+  std::unique_ptr<ContextBase> clone_ptr(
+      CloneWithoutPointers(*this, copy_on_write));
   ContextBase& clone = *clone_ptr;
 
   // Create a complete mapping of tracker pointers.
@@ -27,8 +78,6 @@ std::unique_ptr<ContextBase> ContextBase::Clone() const {
   return clone_ptr;
 }
 
-ContextBase::~ContextBase() {}
-
 std::string ContextBase::GetSystemPathname() const {
   const std::string parent_path = get_parent_base()
                                       ? get_parent_base()->GetSystemPathname()
@@ -324,8 +373,10 @@ void ContextBase::FixContextPointers(
   // First repair pointers local to this context.
   clone->graph_.RepairTrackerPointers(source.get_dependency_graph(),
                                       tracker_map, clone, &clone->cache_);
-  // Cache and FixedInputs only need their back pointers set to `this`.
+  // Cache and FixedInputs only need their back pointers set to `this`. The
+  // cache entry values of the clone are not profiled.
   clone->cache_.RepairCachePointers(clone);
+  clone->cache_profiler_.reset();
   for (auto& fixed_input : clone->input_port_values_) {
     if (fixed_input != nullptr) {
       internal::ContextBaseFixedInputAttorney::set_owning_subcontext(
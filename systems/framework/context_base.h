@@ -13,6 +13,7 @@
 #include "drake/common/unused.h"
 #include "drake/common/value.h"
 #include "drake/systems/framework/cache.h"
+#include "drake/systems/framework/cache_profiler.h"
 #include "drake/systems/framework/dependency_tracker.h"
 #include "drake/systems/framework/fixed_input_port_value.h"
 
@@ -52,6 +53,28 @@ class ContextBase : public internal::ContextMessageInterface {
   @throws std::exception if this is not the root context. */
   std::unique_ptr<ContextBase> Clone() const;
 
+  /** Creates a copy of the concrete context object that shares the values of
+  its abstract state and abstract parameters with this context until one of
+  the two modifies them, and that allocates each of its cache values only
+  when it is first needed. This can be much cheaper than Clone() when the
+  context holds large abstract values (e.g., the geometry state of a
+  SceneGraph) or many cache entries, and is otherwise equivalent to it.
+  Numeric state and parameters are always copied, and so are the abstract
+  values to which this context has already given out mutable access (e.g.,
+  through get_mutable_abstract_state()), since references to them may still be
+  in use. If the cache of this context is frozen, its values are copied as
+  well. Only the containers of the context tree are copied this way; each
+  value that is copied is copied with its own (deep) AbstractValue::Clone().
+  A System that updates an abstract value through const access, as SceneGraph
+  does with the poses in its geometry state, must first obtain its own copy
+  with AbstractValues::get_unshared_value().
+
+  This context and its copy-on-write clones may be used concurrently by
+  different threads. Contexts whose most-derived type is not LeafContext or
+  DiagramContext are deep copied, as by Clone().
+  @throws std::exception if this is not the root context. */
+  std::unique_ptr<ContextBase> CloneCopyOnWrite() const;
+
   ~ContextBase() override;
 
   /** (Debugging) Disables caching recursively for this context and all its
@@ -94,6 +117,26 @@ class ContextBase : public internal::ContextMessageInterface {
     PropagateCachingChange(*this, &Cache::SetAllEntriesOutOfDate);
   }
 
+  /** (Debugging) Starts profiling every cache entry of this context and all
+  its subcontexts, and returns the CacheProfiler that collects the statistics;
+  see there for details. If profiling is already enabled, returns the existing
+  profiler, whose statistics are kept (use CacheProfiler::Reset() to clear
+  them). The profiler belongs to this context and is not copied by Clone().
+  Profiling slows down every `Eval()`, but has no cost once disabled again.
+  @throws std::exception if this is not the root context. */
+  CacheProfiler& EnableCacheProfiling() const;
+
+  /** (Debugging) Stops profiling the cache entries of this context and its
+  subcontexts, and deletes the CacheProfiler (invalidating any references to
+  it). Does nothing if profiling is not enabled. */
+  void DisableCacheProfiling() const;
+
+  /** (Debugging) Returns the CacheProfiler created by EnableCacheProfiling(),
+  or nullptr if profiling is not enabled. */
+  const CacheProfiler* get_cache_profiler() const {
+    return cache_profiler_.get();
+  }
+
   /** (Advanced) Freezes the cache at its current contents, preventing any
   further cache updates. When frozen, accessing an out-of-date cache entry
   causes an exception to be throw. This is applied recursively to this
@@ -284,7 +327,11 @@ class ContextBase : public internal::ContextMessageInterface {
   delegate to this one for use in their DoCloneWithoutPointers()
   implementations. The cache and dependency graph are copied, but any pointers
   contained in the source are left null in the copy. */
-  ContextBase(const ContextBase&) = default;
+  ContextBase(const ContextBase& source) : ContextBase(source, false) {}
+
+  /** (Internal use only) The same, but if `copy_on_write` is true, the cache
+  is copied for a copy-on-write clone; see CloneCopyOnWrite(). */
+  ContextBase(const ContextBase& source, bool copy_on_write);
 
   /** @name      Add dependency tracking resources (Internal use only)
   Methods in this group are used by SystemBase and unit testing while creating
@@ -460,9 +507,13 @@ class ContextBase : public internal::ContextMessageInterface {
   internal pointers; the clone's pointers are set to null. */
   // Structuring this as a static method allows DiagramContext to invoke this
   // protected function on its children.
+  // If `copy_on_write` is true, the clone is a copy-on-write clone; see
+  // CloneCopyOnWrite().
   static std::unique_ptr<ContextBase> CloneWithoutPointers(
-      const ContextBase& source) {
-    std::unique_ptr<ContextBase> result = source.DoCloneWithoutPointers();
+      const ContextBase& source, bool copy_on_write = false) {
+    std::unique_ptr<ContextBase> result =
+        copy_on_write ? source.DoCloneCopyOnWriteWithoutPointers()
+                      : source.DoCloneWithoutPointers();
 
     // Verify that the most-derived Context didn't forget to override
     // DoCloneWithoutPointers().
@@ -505,6 +556,17 @@ class ContextBase : public internal::ContextMessageInterface {
     context.DoPropagateCachingChange(caching_change);
   }
 
+  /** (Internal use only) Starts profiling the cache entries of `context`
+  with `profiler` (or stops profiling them if `profiler` is null), and
+  propagates the change to subcontexts if `context` is a DiagramContext. */
+  // Structuring this as a static method allows DiagramContext to invoke this
+  // protected method on its children.
+  static void PropagateCacheProfiler(const ContextBase& context,
+                                     CacheProfiler* profiler) {
+    context.get_mutable_cache().SetProfiler(profiler);
+    context.DoPropagateCacheProfiler(profiler);
+  }
+
   /** (Internal use only) Applies the given bulk-change notification method
   to the given `context`, and propagates the notification to subcontexts if this
   is a DiagramContext. */
@@ -548,6 +610,16 @@ class ContextBase : public internal::ContextMessageInterface {
   `return std::unique_ptr<ContextBase>(new DerivedType(*this));`. */
   virtual std::unique_ptr<ContextBase> DoCloneWithoutPointers() const = 0;
 
+  /** Derived classes may implement this to perform the same copy as
+  DoCloneWithoutPointers() for a copy-on-write clone (see CloneCopyOnWrite()),
+  typically via a protected constructor that delegates to
+  `ContextBase(source, true)`. The default implementation makes a complete
+  copy using DoCloneWithoutPointers(). */
+  virtual std::unique_ptr<ContextBase> DoCloneCopyOnWriteWithoutPointers()
+      const {
+    return DoCloneWithoutPointers();
+  }
+
   /** DiagramContext must implement this to invoke BuildTrackerPointerMap() on
   each of its subcontexts. The default implementation does nothing which is
   fine for a LeafContext. */
@@ -573,6 +645,13 @@ class ContextBase : public internal::ContextMessageInterface {
     unused(caching_change);
   }
 
+  /** DiagramContext must implement this to invoke PropagateCacheProfiler() on
+  each of its subcontexts. The default implementation does nothing which is
+  fine for a LeafContext. */
+  virtual void DoPropagateCacheProfiler(CacheProfiler* profiler) const {
+    unused(profiler);
+  }
+
   /** DiagramContext must implement this to invoke PropagateBulkChange()
   on its subcontexts, passing along the indicated method that specifies the
   particular bulk change (e.g. whole state, all parameters, all discrete state
@@ -590,6 +669,10 @@ class ContextBase : public internal::ContextMessageInterface {
   // Returns the parent Context or `nullptr` if this is the root Context.
   const ContextBase* get_parent_base() const { return parent_; }
 
+  // Implements Clone() and CloneCopyOnWrite().
+  std::unique_ptr<ContextBase> CloneImpl(const char* func_name,
+                                         bool copy_on_write) const;
+
   // Records the name of the system whose context this is.
   void set_system_name(const std::string& name) { system_name_ = name; }
 
@@ -624,6 +707,8 @@ class ContextBase : public internal::ContextMessageInterface {
   // to every Context (and every System).
   void CreateBuiltInTrackers();
 
+  // Every member must also be copied by ContextBase(const ContextBase&, bool).
+
   // We record tickets so we can reconstruct the dependency graph when cloning
   // or transmogrifying a Context without a System present.
 
@@ -686,6 +771,11 @@ class ContextBase : public internal::ContextMessageInterface {
   // Used to validate that System-derived classes didn't forget to invoke the
   // SystemBase method that properly sets up the ContextBase.
   bool is_context_base_initialized_{false};
+
+  // The profiler of this (root) context's cache entries, if profiling is
+  // enabled. It is shared only so that the default copy constructor works;
+  // FixContextPointers() removes it from a clone.
+  mutable std::shared_ptr<CacheProfiler> cache_profiler_;
 };
 
 #ifndef DRAKE_DOXYGEN_CXX
@@ -0,0 +1,421 @@
+#include "drake/systems/framework/context_snapshot.h"
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "drake/common/hash.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/unused.h"
+#include "drake/systems/framework/diagram_continuous_state.h"
+#include "drake/systems/framework/framework_common.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The first bytes of a snapshot file, including a format version number.
+constexpr char kFileMagic[8] = {'D', 'R', 'K', 'S', 'N', 'A', 'P', '1'};
+
+struct AbstractTypeEntry {
+  // A hash of the type's name, which identifies it across processes.
+  int64_t name_hash{};
+  void (*write)(const AbstractValue&, std::vector<uint8_t>*){};
+  void (*read)(const uint8_t*, size_t, AbstractValue*){};
+};
+
+struct AbstractTypeRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::type_index, AbstractTypeEntry> entries;
+};
+
+AbstractTypeRegistry& GetRegistry() {
+  static never_destroyed<AbstractTypeRegistry> registry;
+  return registry.access();
+}
+
+// Returns the registration of the type held by `value`.
+AbstractTypeEntry FindAbstractType(const AbstractValue& value) {
+  static const bool registered_builtins = []() {
+    ContextSnapshot::RegisterAbstractType<bool>();
+    ContextSnapshot::RegisterAbstractType<int>();
+    ContextSnapshot::RegisterAbstractType<double>();
+    ContextSnapshot::RegisterAbstractType<std::string>();
+    return true;
+  }();
+  unused(registered_builtins);
+
+  AbstractTypeRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  const auto iter = registry.entries.find(value.static_type_info());
+  if (iter == registry.entries.end()) {
+    throw std::logic_error(fmt::format(
+        "ContextSnapshot: Abstract values of type {} can't be saved; "
+        "specialize ContextSnapshotTraits for the type and register it with "
+        "ContextSnapshot::RegisterAbstractType().",
+        value.GetNiceTypeName()));
+  }
+  return iter->second;
+}
+
+// Calls `visit` on each leaf vector of the continuous state `xc` (which may be
+// const), in order.
+template <typename ContinuousStateType, typename Visitor>
+void ForEachLeafVector(ContinuousStateType* xc, const Visitor& visit) {
+  constexpr bool is_const = std::is_const_v<ContinuousStateType>;
+  using DiagramType = std::conditional_t<is_const,
+      const DiagramContinuousState<double>, DiagramContinuousState<double>>;
+  if (auto* diagram_xc = dynamic_cast<DiagramType*>(xc)) {
+    for (int i = 0; i < diagram_xc->num_substates(); ++i) {
+      if constexpr (is_const) {
+        ForEachLeafVector(&diagram_xc->get_substate(i), visit);
+      } else {
+        ForEachLeafVector(&diagram_xc->get_mutable_substate(i), visit);
+      }
+    }
+  } else if constexpr (is_const) {
+    visit(xc->get_vector());
+  } else {
+    visit(xc->get_mutable_vector());
+  }
+}
+
+// Appends the layout of `context` (see ContextSnapshot::layout_) to `layout`.
+void AppendLayout(const Context<double>& context,
+                  std::vector<int64_t>* layout) {
+  const auto append_list = [layout](const auto& items, const auto& get_item) {
+    layout->push_back(static_cast<int64_t>(items.size()));
+    for (int i = 0; i < static_cast<int>(items.size()); ++i) {
+      layout->push_back(get_item(items, i));
+    }
+  };
+  const auto vector_size = [](const auto& vectors, int i) -> int64_t {
+    return vectors[i]->size();
+  };
+  const auto type_hash = [](const AbstractValues& values, int i) {
+    return FindAbstractType(values.get_value(i)).name_hash;
+  };
+
+  const State<double>& state = context.get_state();
+  const size_t count_index = layout->size();
+  layout->push_back(0);
+  ForEachLeafVector(&state.get_continuous_state(),
+                    [layout, count_index](const VectorBase<double>& vector) {
+                      layout->push_back(vector.size());
+                      ++(*layout)[count_index];
+                    });
+  append_list(state.get_discrete_state().get_data(), vector_size);
+  append_list(state.get_abstract_state(), type_hash);
+  const Parameters<double>& parameters = context.get_parameters();
+  append_list(parameters.get_numeric_parameters().get_data(), vector_size);
+  append_list(parameters.get_abstract_parameters(), type_hash);
+}
+
+// Appends the raw bytes of `count` objects at `data` to `buffer`.
+template <typename U>
+void AppendBytes(const U* data, int64_t count, std::vector<uint8_t>* buffer) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+  buffer->insert(buffer->end(), bytes, bytes + count * sizeof(U));
+}
+
+void AppendVector(const VectorBase<double>& vector,
+                  std::vector<uint8_t>* buffer) {
+  if (const auto* basic = dynamic_cast<const BasicVector<double>*>(&vector)) {
+    AppendBytes(basic->value().data(), basic->size(), buffer);
+    return;
+  }
+  for (int i = 0; i < vector.size(); ++i) {
+    AppendBytes(&vector[i], 1, buffer);
+  }
+}
+
+void AppendAbstractValues(const AbstractValues& values,
+                          std::vector<uint8_t>* buffer) {
+  for (int i = 0; i < values.size(); ++i) {
+    const AbstractValue& value = values.get_value(i);
+    // Reserve room for the size, then write the value and fill in its size.
+    const size_t size_offset = buffer->size();
+    buffer->resize(size_offset + sizeof(int64_t));
+    FindAbstractType(value).write(value, buffer);
+    const int64_t size = buffer->size() - size_offset - sizeof(int64_t);
+    std::memcpy(buffer->data() + size_offset, &size, sizeof(size));
+  }
+}
+
+// Reads the saved values in order.
+class Reader {
+ public:
+  explicit Reader(const std::vector<uint8_t>& data)
+      : next_(data.data()), end_(data.data() + data.size()) {}
+
+  double ReadDouble() {
+    double result{};
+    std::memcpy(&result, Advance(sizeof(result)), sizeof(result));
+    return result;
+  }
+
+  void ReadVector(VectorBase<double>* vector) {
+    const int size = vector->size();
+    const uint8_t* data = Advance(size * sizeof(double));
+    if (auto* basic = dynamic_cast<BasicVector<double>*>(vector)) {
+      std::memcpy(basic->get_mutable_value().data(), data,
+                  size * sizeof(double));
+      return;
+    }
+    for (int i = 0; i < size; ++i) {
+      std::memcpy(&(*vector)[i], data + i * sizeof(double), sizeof(double));
+    }
+  }
+
+  void SkipVector(const VectorBase<double>& vector) {
+    Advance(vector.size() * sizeof(double));
+  }
+
+  // Returns copies of `values` that are set to the saved values.
+  std::vector<std::unique_ptr<AbstractValue>> DecodeAbstractValues(
+      const AbstractValues& values) {
+    std::vector<std::unique_ptr<AbstractValue>> result;
+    result.reserve(values.size());
+    for (int i = 0; i < values.size(); ++i) {
+      const AbstractValue& value = values.get_value(i);
+      const int64_t size = ReadSize();
+      std::unique_ptr<AbstractValue> decoded = value.Clone();
+      FindAbstractType(value).read(Advance(size), size, decoded.get());
+      result.push_back(std::move(decoded));
+    }
+    return result;
+  }
+
+  void SkipAbstractValues(int count) {
+    for (int i = 0; i < count; ++i) {
+      Advance(ReadSize());
+    }
+  }
+
+  // Throws unless all of the saved values have been read.
+  void ExpectEnd() const {
+    if (next_ != end_) {
+      throw std::runtime_error("ContextSnapshot::Restore(): Corrupt snapshot.");
+    }
+  }
+
+ private:
+  int64_t ReadSize() {
+    int64_t size{};
+    std::memcpy(&size, Advance(sizeof(size)), sizeof(size));
+    return size;
+  }
+
+  const uint8_t* Advance(int64_t size) {
+    if (size < 0 || size > end_ - next_) {
+      throw std::runtime_error("ContextSnapshot::Restore(): Corrupt snapshot.");
+    }
+    const uint8_t* result = next_;
+    next_ += size;
+    return result;
+  }
+
+  const uint8_t* next_;
+  const uint8_t* const end_;
+};
+
+}  // namespace
+
+ContextSnapshot::ContextSnapshot() = default;
+
+ContextSnapshot::ContextSnapshot(const Context<double>& context) {
+  Save(context);
+}
+
+ContextSnapshot::~ContextSnapshot() = default;
+
+void ContextSnapshot::Save(const Context<double>& context) {
+  layout_.clear();
+  data_.clear();
+  AppendLayout(context, &layout_);
+
+  const double time = context.get_time();
+  const double accuracy = context.get_accuracy().value_or(
+      std::numeric_limits<double>::quiet_NaN());
+  AppendBytes(&time, 1, &data_);
+  AppendBytes(&accuracy, 1, &data_);
+  const State<double>& state = context.get_state();
+  ForEachLeafVector(&state.get_continuous_state(),
+                    [this](const VectorBase<double>& vector) {
+                      AppendVector(vector, &data_);
+                    });
+  for (const BasicVector<double>* group :
+       state.get_discrete_state().get_data()) {
+    AppendVector(*group, &data_);
+  }
+  AppendAbstractValues(state.get_abstract_state(), &data_);
+  const Parameters<double>& parameters = context.get_parameters();
+  for (const BasicVector<double>* group :
+       parameters.get_numeric_parameters().get_data()) {
+    AppendVector(*group, &data_);
+  }
+  AppendAbstractValues(parameters.get_abstract_parameters(), &data_);
+}
+
+void ContextSnapshot::Restore(Context<double>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  if (empty()) {
+    throw std::logic_error(
+        "ContextSnapshot::Restore(): The snapshot is empty.");
+  }
+  std::vector<int64_t> layout;
+  layout.reserve(layout_.size());
+  AppendLayout(*context, &layout);
+  if (layout != layout_) {
+    throw std::logic_error(
+        "ContextSnapshot::Restore(): The Context does not have the structure "
+        "of the Context that was saved.");
+  }
+
+  // Check the sizes of all of the saved values, and decode the abstract
+  // values into copies, before anything in the Context is changed. What
+  // follows can't fail, so a failed Restore() leaves the Context unchanged.
+  const State<double>& saved_state = context->get_state();
+  const Parameters<double>& saved_parameters = context->get_parameters();
+  Reader checker(data_);
+  checker.ReadDouble();
+  checker.ReadDouble();
+  ForEachLeafVector(&saved_state.get_continuous_state(),
+                    [&checker](const VectorBase<double>& vector) {
+                      checker.SkipVector(vector);
+                    });
+  for (const BasicVector<double>* group :
+       saved_state.get_discrete_state().get_data()) {
+    checker.SkipVector(*group);
+  }
+  const std::vector<std::unique_ptr<AbstractValue>> abstract_state =
+      checker.DecodeAbstractValues(saved_state.get_abstract_state());
+  for (const BasicVector<double>* group :
+       saved_parameters.get_numeric_parameters().get_data()) {
+    checker.SkipVector(*group);
+  }
+  const std::vector<std::unique_ptr<AbstractValue>> abstract_parameters =
+      checker.DecodeAbstractValues(saved_parameters.get_abstract_parameters());
+  checker.ExpectEnd();
+
+  const auto set_abstract_values =
+      [](const std::vector<std::unique_ptr<AbstractValue>>& decoded,
+         AbstractValues* values) {
+        // SetFrom() leaves the values shareable with copy-on-write clones.
+        values->SetFrom(AbstractValues(internal::Unpack(decoded)));
+      };
+  Reader reader(data_);
+  context->SetTime(reader.ReadDouble());
+  const double accuracy = reader.ReadDouble();
+  const std::optional<double> optional_accuracy =
+      std::isnan(accuracy) ? std::nullopt : std::optional<double>(accuracy);
+  if (context->get_accuracy() != optional_accuracy) {
+    context->SetAccuracy(optional_accuracy);
+  }
+  // Each of these notifies the dependents of all the values it covers once;
+  // the values are then written directly into each leaf's storage.
+  State<double>& state = context->get_mutable_state();
+  ForEachLeafVector(&state.get_mutable_continuous_state(),
+                    [&reader](VectorBase<double>& vector) {
+                      reader.ReadVector(&vector);
+                    });
+  for (BasicVector<double>* group :
+       state.get_mutable_discrete_state().get_data()) {
+    reader.ReadVector(group);
+  }
+  reader.SkipAbstractValues(static_cast<int>(abstract_state.size()));
+  set_abstract_values(abstract_state, &state.get_mutable_abstract_state());
+  Parameters<double>& parameters = context->get_mutable_parameters();
+  for (BasicVector<double>* group :
+       parameters.get_numeric_parameters().get_data()) {
+    reader.ReadVector(group);
+  }
+  set_abstract_values(abstract_parameters,
+                      &parameters.get_mutable_abstract_parameters());
+}
+
+void ContextSnapshot::SaveToFile(const std::filesystem::path& filename) const {
+  if (empty()) {
+    throw std::logic_error(
+        "ContextSnapshot::SaveToFile(): The snapshot is empty.");
+  }
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  const int64_t layout_size = layout_.size();
+  const int64_t data_size = data_.size();
+  file.write(kFileMagic, sizeof(kFileMagic));
+  file.write(reinterpret_cast<const char*>(&layout_size), sizeof(layout_size));
+  file.write(reinterpret_cast<const char*>(layout_.data()),
+             layout_size * sizeof(int64_t));
+  file.write(reinterpret_cast<const char*>(&data_size), sizeof(data_size));
+  file.write(reinterpret_cast<const char*>(data_.data()), data_size);
+  file.close();
+  if (file.fail()) {
+    throw std::runtime_error(fmt::format(
+        "ContextSnapshot::SaveToFile(): Could not write '{}'.",
+        filename.string()));
+  }
+}
+
+ContextSnapshot ContextSnapshot::LoadFromFile(
+    const std::filesystem::path& filename) {
+  std::ifstream file(filename, std::ios::binary);
+  const auto fail = [&filename](const char* reason) {
+    throw std::runtime_error(fmt::format(
+        "ContextSnapshot::LoadFromFile(): Could not read '{}': {}.",
+        filename.string(), reason));
+  };
+  if (!file) fail("the file can't be opened");
+  char magic[sizeof(kFileMagic)]{};
+  file.read(magic, sizeof(magic));
+  if (!file || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0) {
+    fail("the file is not a Context snapshot");
+  }
+  // Reads a size, checking it against the number of bytes that remain.
+  const auto read_size = [&file, &fail](int64_t element_size) {
+    int64_t size{};
+    file.read(reinterpret_cast<char*>(&size), sizeof(size));
+    const auto position = file.tellg();
+    file.seekg(0, std::ios::end);
+    const int64_t remaining = file.tellg() - position;
+    file.seekg(position);
+    if (!file || size < 0 || size > remaining / element_size) {
+      fail("the file is truncated");
+    }
+    return size;
+  };
+  ContextSnapshot result;
+  result.layout_.resize(read_size(sizeof(int64_t)));
+  file.read(reinterpret_cast<char*>(result.layout_.data()),
+            result.layout_.size() * sizeof(int64_t));
+  result.data_.resize(read_size(1));
+  file.read(reinterpret_cast<char*>(result.data_.data()), result.data_.size());
+  if (!file || result.empty()) fail("the file is truncated");
+  return result;
+}
+
+void ContextSnapshot::RegisterAbstractTypeImpl(const std::type_info& type,
+                                               WriteFunction write,
+                                               ReadFunction read) {
+  const std::string name = NiceTypeName::Get(type);
+  drake::internal::FNV1aHasher hasher;
+  hasher(name.data(), name.size());
+  AbstractTypeRegistry& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.entries.emplace(
+      type, AbstractTypeEntry{static_cast<int64_t>(size_t(hasher)), write,
+                              read});
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,192 @@
+#pragma once
+
+/** @file
+Declares ContextSnapshot, a flat binary image of the values of a Context, and
+the ContextSnapshotTraits with which abstract value types opt in to it. */
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/value.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** Describes how ContextSnapshot serializes an abstract value of type `V`.
+There is no generic implementation; a type opts in by specializing this
+template with two static functions, and then registering the type with
+ContextSnapshot::RegisterAbstractType<V>():
+@code
+template <>
+struct ContextSnapshotTraits<MyType> {
+  // Appends the bytes of `value` to `buffer`.
+  static void Write(const MyType& value, std::vector<uint8_t>* buffer);
+  // Sets `value` from the `size` bytes at `data`, which are exactly the bytes
+  // appended by a call to Write().
+  static void Read(const uint8_t* data, size_t size, MyType* value);
+};
+@endcode
+For trivially copyable types the traits may simply inherit from
+TriviallyCopyableSnapshotTraits<MyType>. The traits of `bool`, `int`,
+`double`, and `std::string` are built in and pre-registered. */
+template <typename V>
+struct ContextSnapshotTraits;
+
+/** Implements ContextSnapshotTraits for a trivially copyable type `V` by
+copying its bytes. */
+template <typename V>
+struct TriviallyCopyableSnapshotTraits {
+  static_assert(std::is_trivially_copyable_v<V>);
+
+  static void Write(const V& value, std::vector<uint8_t>* buffer) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer->insert(buffer->end(), bytes, bytes + sizeof(V));
+  }
+
+  static void Read(const uint8_t* data, size_t size, V* value) {
+    DRAKE_THROW_UNLESS(size == sizeof(V));
+    std::memcpy(value, data, sizeof(V));
+  }
+};
+
+#ifndef DRAKE_DOXYGEN_CXX
+template <>
+struct ContextSnapshotTraits<bool> : TriviallyCopyableSnapshotTraits<bool> {};
+template <>
+struct ContextSnapshotTraits<int> : TriviallyCopyableSnapshotTraits<int> {};
+template <>
+struct ContextSnapshotTraits<double>
+    : TriviallyCopyableSnapshotTraits<double> {};
+template <>
+struct ContextSnapshotTraits<std::string> {
+  static void Write(const std::string& value, std::vector<uint8_t>* buffer) {
+    buffer->insert(buffer->end(), value.begin(), value.end());
+  }
+  static void Read(const uint8_t* data, size_t size, std::string* value) {
+    value->assign(reinterpret_cast<const char*>(data), size);
+  }
+};
+#endif
+
+/** A ContextSnapshot holds the time, accuracy, state (continuous, discrete,
+and abstract), and parameters (numeric and abstract) of a Context<double> as a
+flat binary buffer. Saving into a snapshot and restoring from it is much
+faster than copying one Context into another with
+Context::SetTimeStateAndParametersFrom(), because the numeric values are
+copied in bulk from and to each leaf Context's storage. That makes snapshots
+suited to frequent rollback, e.g., for model predictive control or search:
+@code
+  ContextSnapshot snapshot(context);  // Sizes the buffer and saves.
+  for (...) {
+    simulator.AdvanceTo(t + horizon);
+    ...
+    snapshot.Restore(&context);
+    snapshot.Save(context);  // Reuses the buffer; no allocation.
+  }
+@endcode
+
+A snapshot may be restored into any Context of the same System (or of a
+System with the same structure, which allows a snapshot that was saved to a
+file with SaveToFile() to be restored by a later process). Restoring
+invalidates every computation that depends on the restored values, as any
+other change to the Context would. The input port values and the fixed input
+port values are not part of the snapshot.
+
+Abstract values are only supported for types that have opted in through
+ContextSnapshotTraits and RegisterAbstractType(); saving a Context with any
+other abstract state or abstract parameter throws.
+
+To resume a long Simulator run from a checkpoint, restore the snapshot into
+the Simulator's Context and reinitialize the Simulator without repeating the
+initialization events:
+@code
+  const ContextSnapshot checkpoint = ContextSnapshot::LoadFromFile(filename);
+  checkpoint.Restore(&simulator.get_mutable_context());
+  simulator.Initialize({.suppress_initialization_events = true});
+@endcode */
+class ContextSnapshot {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContextSnapshot)
+
+  /** Constructs an empty snapshot, which can't be restored until something
+  is saved into it. */
+  ContextSnapshot();
+
+  /** Constructs a snapshot of `context`. */
+  explicit ContextSnapshot(const Context<double>& context);
+
+  ~ContextSnapshot();
+
+  /** Replaces the contents of this snapshot with the values of `context`.
+  The buffer is only reallocated if it must grow.
+  @throws std::exception if `context` has an abstract value whose type is not
+  registered with RegisterAbstractType(). */
+  void Save(const Context<double>& context);
+
+  /** Sets the values of `context` to those of this snapshot. Restoring is
+  atomic: the structure is checked and the saved values (including the
+  abstract values, with ContextSnapshotTraits::Read()) are decoded before
+  anything is changed, so `context` is left unchanged when this throws.
+  @throws std::exception if this snapshot is empty or corrupt, if `context`
+  does not have the same structure (the sizes of the continuous state and of
+  each group of discrete state and numeric parameters, and the types of the
+  abstract values) as the Context that was saved, or if the Read() of an
+  abstract value's traits throws. */
+  void Restore(Context<double>* context) const;
+
+  /** Returns true if nothing has been saved into this snapshot. */
+  bool empty() const { return layout_.empty(); }
+
+  /** Returns the size in bytes of the saved values. */
+  int64_t size_bytes() const { return static_cast<int64_t>(data_.size()); }
+
+  /** Writes this snapshot to the file `filename`, replacing the file if it
+  exists.
+  @throws std::exception if this snapshot is empty or the file can't be
+  written. */
+  void SaveToFile(const std::filesystem::path& filename) const;
+
+  /** Reads a snapshot that was written by SaveToFile().
+  @throws std::exception if the file can't be read or isn't a snapshot. */
+  static ContextSnapshot LoadFromFile(const std::filesystem::path& filename);
+
+  /** Registers the abstract value type `V`, whose ContextSnapshotTraits must
+  be specialized, for use in snapshots. Registering a type more than once has
+  no effect. This function is thread-safe. */
+  template <typename V>
+  static void RegisterAbstractType() {
+    RegisterAbstractTypeImpl(
+        typeid(V),
+        [](const AbstractValue& value, std::vector<uint8_t>* buffer) {
+          ContextSnapshotTraits<V>::Write(value.get_value<V>(), buffer);
+        },
+        [](const uint8_t* data, size_t size, AbstractValue* value) {
+          ContextSnapshotTraits<V>::Read(data, size,
+                                         &value->get_mutable_value<V>());
+        });
+  }
+
+ private:
+  using WriteFunction = void (*)(const AbstractValue&, std::vector<uint8_t>*);
+  using ReadFunction = void (*)(const uint8_t*, size_t, AbstractValue*);
+
+  static void RegisterAbstractTypeImpl(const std::type_info& type,
+                                       WriteFunction write, ReadFunction read);
+
+  // The structure of the saved Context: the sizes of its numeric vectors and
+  // the hashes of the type names of its abstract values, each list preceded by
+  // its length.
+  std::vector<int64_t> layout_;
+  // The saved values.
+  std::vector<uint8_t> data_;
+};
+
+}  // namespace systems
+}  // namespace drake
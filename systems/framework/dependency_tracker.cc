@@ -3,6 +3,7 @@
 #include <algorithm>
 
 #include "drake/common/unused.h"
+#include "drake/systems/framework/cache_profiler.h"
 
 namespace drake {
 namespace systems {
@@ -33,7 +34,7 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
-  NotifySubscribers(change_event, 0);
+  NotifySubscribers(change_event, *this, *this, 0);
 }
 
 // A prerequisite says it has changed. Short circuit if we've already heard
@@ -42,6 +43,8 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
 void DependencyTracker::NotePrerequisiteChange(
     int64_t change_event,
     const DependencyTracker& prerequisite,
+    const DependencyTracker& source,
+    const DependencyTracker& upstream,
     int depth) const {
   unused(Indent);  // Avoid warning in non-Debug builds.
   DRAKE_LOGGER_DEBUG(
@@ -62,11 +65,17 @@ void DependencyTracker::NotePrerequisiteChange(
   last_change_event_ = change_event;
   // Invalidate associated cache entry value if any.
   cache_value_->mark_out_of_date();
+  if (cache_value_->profile() != nullptr) {
+    cache_value_->profile()->RecordInvalidation(source, upstream);
+  }
   // Follow up with downstream subscribers.
-  NotifySubscribers(change_event, depth);
+  NotifySubscribers(change_event, source,
+                    has_associated_cache_entry_ ? *this : upstream, depth);
 }
 
 void DependencyTracker::NotifySubscribers(int64_t change_event,
+                                          const DependencyTracker& source,
+                                          const DependencyTracker& upstream,
                                           int depth) const {
   DRAKE_LOGGER_DEBUG("{}... {} downstream subscribers.{}", Indent(depth),
                      num_subscribers(),
@@ -78,7 +87,8 @@ void DependencyTracker::NotifySubscribers(int64_t change_event,
     DRAKE_ASSERT(subscriber != nullptr);
     DRAKE_LOGGER_DEBUG("{}->{}", Indent(depth),
                        subscriber->GetPathDescription());
-    subscriber->NotePrerequisiteChange(change_event, *this, depth + 1);
+    subscriber->NotePrerequisiteChange(change_event, *this, source, upstream,
+                                       depth + 1);
   }
 
   num_downstream_notifications_sent_ += num_subscribers();
@@ -374,15 +374,24 @@ class DependencyTracker {
   // `prerequisite` reporting the change is provided here for enforcing
   // invariants in Debug builds. `depth` measures the notification chain length
   // and is useful for debugging and performance analysis. An initial caller
-  // should supply `depth`=0; it is incremented internally.
+  // should supply `depth`=0; it is incremented internally. The tracker that
+  // initiated the change is the `source`, and `upstream` is the nearest
+  // cache entry tracker on the path from it (or the `source` if there is
+  // none); these are only used for profiling.
   void NotePrerequisiteChange(int64_t change_event,
                               const DependencyTracker& prerequisite,
+                              const DependencyTracker& source,
+                              const DependencyTracker& upstream,
                               int depth) const;
 
   // Notifies downstream subscribers that they are no longer valid. This may
   // have been initiated by a change to our tracked value or an upstream
-  // prerequisite; downstream subscribers can't tell the difference.
-  void NotifySubscribers(int64_t change_event, int depth) const;
+  // prerequisite; downstream subscribers can't tell the difference. See
+  // NotePrerequisiteChange() for `source` and `upstream`.
+  void NotifySubscribers(int64_t change_event,
+                         const DependencyTracker& source,
+                         const DependencyTracker& upstream,
+                         int depth) const;
 
   std::string GetSystemPathname() const {
     DRAKE_DEMAND(owning_subcontext_!= nullptr);
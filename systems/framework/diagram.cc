@@ -1,18 +1,165 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <future>
 #include <limits>
+#include <mutex>
 #include <set>
 #include <stdexcept>
+#include <utility>
+
+#include "absl/container/inlined_vector.h"
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/abstract_value_cloner.h"
+#include "drake/systems/framework/periodic_event_timing.h"
 #include "drake/systems/framework/subvector.h"
 #include "drake/systems/framework/system_constraint.h"
 #include "drake/systems/framework/system_visitor.h"
 
 namespace drake {
 namespace systems {
+namespace {
+
+// Combines the statuses of the given subsystems' event handlers in order, the
+// same way as the serial dispatch does (i.e., up to the first failure).
+EventStatus CombineEventStatuses(const std::vector<SubsystemIndex>& subsystems,
+                                 const std::vector<EventStatus>& statuses) {
+  EventStatus overall_status = EventStatus::DidNothing();
+  for (const SubsystemIndex i : subsystems) {
+    overall_status.KeepMoreSevere(statuses[i]);
+    if (overall_status.failed()) break;
+  }
+  return overall_status;
+}
+
+// A unit of work for RunTaskGraph().
+struct GraphTask {
+  std::function<void()> run;
+  // The indices of the tasks that must finish before this one starts.
+  std::vector<int> prerequisites;
+  // The groups that this task holds exclusively while it runs.
+  std::vector<int> groups;
+  // Ranks the exceptions of failing tasks; see RunTaskGraph().
+  int rank{};
+};
+
+// Runs the given tasks on up to `num_threads` threads (the calling thread
+// among them). A task is started once all of its prerequisites have finished
+// and none of its groups is held by a running task. A task that throws does
+// not stop the others, except for those that (transitively) depend on it,
+// which are skipped. Once all tasks have finished or been skipped, the
+// exception of the failing task with the lowest (rank, index) is rethrown, so
+// that the choice doesn't depend on the order in which the tasks happened to
+// run.
+void RunTaskGraph(const std::vector<GraphTask>& tasks, int num_groups,
+                  int num_threads) {
+  const int num_tasks = static_cast<int>(tasks.size());
+  std::vector<int> num_pending(num_tasks);
+  std::vector<std::vector<int>> dependents(num_tasks);
+  std::vector<int> ready;
+  for (int t = 0; t < num_tasks; ++t) {
+    num_pending[t] = static_cast<int>(tasks[t].prerequisites.size());
+    for (const int prerequisite : tasks[t].prerequisites) {
+      dependents[prerequisite].push_back(t);
+    }
+    if (num_pending[t] == 0) {
+      ready.push_back(t);
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::vector<bool> busy(num_groups, false);
+  int num_running = 0;
+  int num_finished = 0;
+  std::exception_ptr error;
+  std::pair<int, int> error_key;
+  std::vector<bool> skipped(num_tasks, false);
+  auto is_free = [&busy](int group) {
+    return !busy[group];
+  };
+  auto work = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (num_finished < num_tasks) {
+      const auto iter = std::find_if(ready.begin(), ready.end(), [&](int t) {
+        return std::all_of(tasks[t].groups.begin(), tasks[t].groups.end(),
+                           is_free);
+      });
+      if (iter == ready.end()) {
+        // The task graph is acyclic, so some task must be running.
+        DRAKE_DEMAND(num_running > 0);
+        changed.wait(lock);
+        continue;
+      }
+      const int t = *iter;
+      ready.erase(iter);
+      for (const int group : tasks[t].groups) {
+        busy[group] = true;
+      }
+      ++num_running;
+      lock.unlock();
+
+      std::exception_ptr task_error;
+      try {
+        tasks[t].run();
+      } catch (...) {
+        task_error = std::current_exception();
+      }
+
+      lock.lock();
+      for (const int group : tasks[t].groups) {
+        busy[group] = false;
+      }
+      --num_running;
+      ++num_finished;
+      if (task_error != nullptr) {
+        const std::pair<int, int> key(tasks[t].rank, t);
+        if (error == nullptr || key < error_key) {
+          error = task_error;
+          error_key = key;
+        }
+        // The dependents of a failed task never become ready; count them as
+        // finished.
+        std::vector<int> unvisited(dependents[t]);
+        while (!unvisited.empty()) {
+          const int dependent = unvisited.back();
+          unvisited.pop_back();
+          if (!skipped[dependent]) {
+            skipped[dependent] = true;
+            ++num_finished;
+            unvisited.insert(unvisited.end(), dependents[dependent].begin(),
+                             dependents[dependent].end());
+          }
+        }
+      } else {
+        for (const int dependent : dependents[t]) {
+          if (--num_pending[dependent] == 0) {
+            ready.push_back(dependent);
+          }
+        }
+      }
+      changed.notify_all();
+    }
+  };
+
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i < std::min(num_threads, num_tasks); ++i) {
+    futures.push_back(std::async(std::launch::async, work));
+  }
+  work();
+  for (auto& future : futures) {
+    future.get();
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace
 
 template <typename T>
 Diagram<T>::~Diagram() {}
@@ -154,18 +301,17 @@ void Diagram<T>::SetDefaultParameters(const Context<T>& context,
     }
     numeric_parameter_offset += subcontext.num_numeric_parameter_groups();
 
-    std::vector<AbstractValue*> abstract_params;
-    for (int j = 0; j < subcontext.num_abstract_parameters(); ++j) {
-      abstract_params.push_back(&params->get_mutable_abstract_parameter(
-          abstract_parameter_offset + j));
-    }
+    // Access the abstract parameters through `params` rather than handing out
+    // references to them; see AbstractValues::get_mutable_value().
+    auto abstract_params = std::make_unique<AbstractValues>(
+        &params->get_mutable_abstract_parameters(), abstract_parameter_offset,
+        subcontext.num_abstract_parameters());
     abstract_parameter_offset += subcontext.num_abstract_parameters();
 
     Parameters<T> subparameters;
     subparameters.set_numeric_parameters(
         std::make_unique<DiscreteValues<T>>(numeric_params));
-    subparameters.set_abstract_parameters(
-        std::make_unique<AbstractValues>(abstract_params));
+    subparameters.set_abstract_parameters(std::move(abstract_params));
     subparameters.set_system_id(subcontext.get_system_id());
 
     registered_systems_[i]->SetDefaultParameters(subcontext, &subparameters);
@@ -222,22 +368,19 @@ void Diagram<T>::SetRandomParameters(const Context<T>& context,
     // three).
 
     std::vector<BasicVector<T>*> numeric_params;
-    std::vector<AbstractValue*> abstract_params;
     for (int j = 0; j < subcontext.num_numeric_parameter_groups(); ++j) {
       numeric_params.push_back(&params->get_mutable_numeric_parameter(
           numeric_parameter_offset + j));
     }
     numeric_parameter_offset += subcontext.num_numeric_parameter_groups();
-    for (int j = 0; j < subcontext.num_abstract_parameters(); ++j) {
-      abstract_params.push_back(&params->get_mutable_abstract_parameter(
-          abstract_parameter_offset + j));
-    }
+    auto abstract_params = std::make_unique<AbstractValues>(
+        &params->get_mutable_abstract_parameters(), abstract_parameter_offset,
+        subcontext.num_abstract_parameters());
     abstract_parameter_offset += subcontext.num_abstract_parameters();
     Parameters<T> subparameters;
     subparameters.set_numeric_parameters(
         std::make_unique<DiscreteValues<T>>(numeric_params));
-    subparameters.set_abstract_parameters(
-        std::make_unique<AbstractValues>(abstract_params));
+    subparameters.set_abstract_parameters(std::move(abstract_params));
     subparameters.set_system_id(subcontext.get_system_id());
 
     registered_systems_[i]->SetRandomParameters(subcontext, &subparameters,
@@ -305,12 +448,30 @@ void Diagram<T>::DoCalcTimeDerivatives(const Context<T>& context,
   DRAKE_DEMAND(num_subsystems() == n);
 
   // Evaluate the derivatives of each constituent system.
-  for (SubsystemIndex i(0); i < n; ++i) {
+  auto calc_derivatives = [&](SubsystemIndex i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     ContinuousState<T>& subderivatives =
         diagram_derivatives->get_mutable_substate(i);
     registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
+  };
+  if (parallel_task_graph_ == nullptr) {
+    for (SubsystemIndex i(0); i < n; ++i) {
+      calc_derivatives(i);
+    }
+    return;
   }
+
+  // Only the subsystems with continuous state take part in the concurrent
+  // evaluation; the others have nothing to compute.
+  std::vector<SubsystemIndex> subsystems;
+  for (SubsystemIndex i(0); i < n; ++i) {
+    if (diagram_derivatives->get_substate(i).size() > 0) {
+      subsystems.push_back(i);
+    } else {
+      calc_derivatives(i);
+    }
+  }
+  RunSubsystemTasks(*diagram_context, subsystems, calc_derivatives);
 }
 
 template <typename T>
@@ -887,12 +1048,16 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
   DRAKE_DEMAND(diagram_context != nullptr);
   DRAKE_DEMAND(info != nullptr);
 
+  // The buffer holds the next update time of each subsystem, followed by the
+  // next time of each group of periodic events in the timetable.
   CacheEntryValue& value =
       this->get_cache_entry(event_times_buffer_cache_index_)
       .get_mutable_cache_entry_value(context);
   auto& event_times_buffer = value.GetMutableValueOrThrow<std::vector<T>>();
-  DRAKE_DEMAND(
-      static_cast<int>(event_times_buffer.size()) == num_subsystems());
+  const int num_groups = static_cast<int>(periodic_event_groups_.size());
+  DRAKE_DEMAND(static_cast<int>(event_times_buffer.size()) ==
+               num_subsystems() + num_groups);
+  T* const group_times = event_times_buffer.data() + num_subsystems();
 
   // In assert-enabled builds, enforce the invariant that no stale values in
   // event_times_buffer are reused across invocations. In effect,
@@ -910,8 +1075,18 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
 
   *next_update_time = std::numeric_limits<double>::infinity();
 
-  // Iterate over the subsystems, and harvest the most imminent updates.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  // Find the most imminent group of periodic events in the timetable.
+  for (int g = 0; g < num_groups; ++g) {
+    group_times[g] = internal::GetNextSampleTime(
+        periodic_event_groups_[g].timing, context.get_time());
+    if (group_times[g] < *next_update_time) {
+      *next_update_time = group_times[g];
+    }
+  }
+
+  // Iterate over the subsystems whose timing is dynamic, and harvest the most
+  // imminent updates.
+  for (const SubsystemIndex i : dynamic_timing_subsystems_) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     CompositeEventCollection<T>& subinfo =
         info->get_mutable_subevent_collection(i);
@@ -925,6 +1100,44 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
     }
   }
 
+  // In assert-enabled builds, check that every other subsystem agrees with
+  // the timetable, i.e., that no subsystem that declared static event timing
+  // overrides DoCalcNextUpdateTime().
+  auto check_static_timing = [&]() {
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (registered_systems_[i]->get_static_timing_periodic_events()) {
+        event_times_buffer[i] = std::numeric_limits<double>::infinity();
+      }
+    }
+    for (int g = 0; g < num_groups; ++g) {
+      for (const TimetableEntry& entry : periodic_event_groups_[g].entries) {
+        if (group_times[g] < event_times_buffer[entry.subsystem]) {
+          event_times_buffer[entry.subsystem] = group_times[g];
+        }
+      }
+    }
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      const System<T>& system = *registered_systems_[i];
+      if (!system.get_static_timing_periodic_events()) continue;
+      CompositeEventCollection<T>& subinfo =
+          info->get_mutable_subevent_collection(i);
+      const T sub_time = system.CalcNextUpdateTime(
+          diagram_context->GetSubsystemContext(i), &subinfo);
+      subinfo.Clear();
+      if (!(sub_time == event_times_buffer[i])) {
+        throw std::logic_error(fmt::format(
+            "Diagram::CalcNextUpdateTime(): {} system '{}' returned the next "
+            "update time {} but its periodic events are next at {}. A "
+            "LeafSystem that overrides DoCalcNextUpdateTime() must not call "
+            "DeclareStaticEventTiming().",
+            system.GetSystemType(), system.GetSystemPathname(),
+            ExtractDoubleOrThrow(sub_time),
+            ExtractDoubleOrThrow(event_times_buffer[i])));
+      }
+    }
+  };
+  DRAKE_ASSERT_VOID(check_static_timing());
+
   // Check that all vector entries were replaced.
   auto none_are_nan = [](const std::vector<T>& vec) {
     using std::isnan;
@@ -933,12 +1146,96 @@ void Diagram<T>::DoCalcNextUpdateTime(const Context<T>& context,
   };
   DRAKE_ASSERT(none_are_nan(event_times_buffer));
 
-  // For all the subsystems whose next update time is bigger than
+  // For all the dynamic subsystems whose next update time is bigger than
   // next_update_time, clear their event collections.
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+  for (const SubsystemIndex i : dynamic_timing_subsystems_) {
     if (event_times_buffer[i] > *next_update_time)
       info->get_mutable_subevent_collection(i).Clear();
   }
+
+  // Add the events of the groups that occur at next_update_time. When more
+  // than one group does, a subsystem with events in several of them must
+  // receive its events in the order its own DoCalcNextUpdateTime() would have
+  // used, so those are merged by sequence. Use an InlinedVector so that the
+  // merge does not usually allocate.
+  int num_next_groups = 0;
+  for (int g = 0; g < num_groups; ++g) {
+    if (group_times[g] == *next_update_time) ++num_next_groups;
+  }
+  absl::InlinedVector<const TimetableEntry*, 16> merged_entries;
+  for (int g = 0; g < num_groups; ++g) {
+    if (!(group_times[g] == *next_update_time)) continue;
+    for (const TimetableEntry& entry : periodic_event_groups_[g].entries) {
+      if (num_next_groups > 1 && entry.in_several_groups) {
+        merged_entries.push_back(&entry);
+      } else {
+        entry.event->AddToComposite(
+            &info->get_mutable_subevent_collection(entry.subsystem));
+      }
+    }
+  }
+  std::sort(merged_entries.begin(), merged_entries.end(),
+            [](const TimetableEntry* a, const TimetableEntry* b) {
+              return a->sequence < b->sequence;
+            });
+  for (const TimetableEntry* entry : merged_entries) {
+    entry->event->AddToComposite(
+        &info->get_mutable_subevent_collection(entry->subsystem));
+  }
+}
+
+template <typename T>
+void Diagram<T>::CompilePeriodicEventTimetable() {
+  DRAKE_DEMAND(periodic_event_groups_.empty());
+  DRAKE_DEMAND(dynamic_timing_subsystems_.empty());
+  std::map<PeriodicEventData, int, PeriodicEventDataComparator> group_indices;
+  int sequence = 0;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const LeafCompositeEventCollection<T>* periodic_events =
+        registered_systems_[i]->get_static_timing_periodic_events();
+    if (periodic_events == nullptr) {
+      dynamic_timing_subsystems_.push_back(i);
+      continue;
+    }
+
+    // The events are numbered in the order of the three lists scanned by
+    // LeafSystem::DoCalcNextUpdateTime().
+    std::set<int> groups_of_subsystem;
+    auto add_entries = [&](const auto& typed_events) {
+      for (const auto* event : typed_events.get_events()) {
+        const PeriodicEventData* timing =
+            event->template get_event_data<PeriodicEventData>();
+        DRAKE_DEMAND(timing != nullptr);
+        const auto [iter, inserted] = group_indices.emplace(
+            *timing, static_cast<int>(periodic_event_groups_.size()));
+        if (inserted) {
+          periodic_event_groups_.push_back({*timing, {}});
+        }
+        periodic_event_groups_[iter->second].entries.push_back(
+            {sequence++, i, false, event});
+        groups_of_subsystem.insert(iter->second);
+      }
+    };
+    add_entries(periodic_events->get_publish_events());
+    add_entries(periodic_events->get_discrete_update_events());
+    add_entries(periodic_events->get_unrestricted_update_events());
+
+    if (groups_of_subsystem.size() > 1) {
+      for (const int g : groups_of_subsystem) {
+        for (TimetableEntry& entry : periodic_event_groups_[g].entries) {
+          if (entry.subsystem == i) entry.in_several_groups = true;
+        }
+      }
+    }
+  }
+
+  // The timing of this Diagram is static when that of every subsystem is,
+  // including child Diagrams (which are otherwise scheduled dynamically).
+  this->set_static_event_timing(std::all_of(
+      registered_systems_.begin(), registered_systems_.end(),
+      [](const auto& system) {
+        return system->has_static_event_timing();
+      }));
 }
 
 template <typename T>
@@ -1226,6 +1523,25 @@ EventStatus Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
+  if (parallel_task_graph_ != nullptr) {
+    // Run the handlers concurrently, then combine their statuses in order.
+    std::vector<SubsystemIndex> subsystems;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (diagram_events.get_subevent_collection(i).HasEvents()) {
+        subsystems.push_back(i);
+      }
+    }
+    std::vector<EventStatus> statuses(num_subsystems(),
+                                      EventStatus::DidNothing());
+    RunSubsystemTasks(*diagram_context, subsystems, [&](SubsystemIndex i) {
+      statuses[i] = registered_systems_[i]->CalcDiscreteVariableUpdate(
+          diagram_context->GetSubsystemContext(i),
+          diagram_events.get_subevent_collection(i),
+          &diagram_discrete->get_mutable_subdiscrete(i));
+    });
+    return CombineEventStatuses(subsystems, statuses);
+  }
+
   EventStatus overall_status = EventStatus::DidNothing();
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
     const EventCollection<DiscreteUpdateEvent<T>>& subevents =
@@ -1287,6 +1603,25 @@ EventStatus Diagram<T>::DispatchUnrestrictedUpdateHandler(
       dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
           events);
 
+  if (parallel_task_graph_ != nullptr) {
+    // Run the handlers concurrently, then combine their statuses in order.
+    std::vector<SubsystemIndex> subsystems;
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (diagram_events.get_subevent_collection(i).HasEvents()) {
+        subsystems.push_back(i);
+      }
+    }
+    std::vector<EventStatus> statuses(num_subsystems(),
+                                      EventStatus::DidNothing());
+    RunSubsystemTasks(*diagram_context, subsystems, [&](SubsystemIndex i) {
+      statuses[i] = registered_systems_[i]->CalcUnrestrictedUpdate(
+          diagram_context->GetSubsystemContext(i),
+          diagram_events.get_subevent_collection(i),
+          &diagram_state->get_mutable_substate(i));
+    });
+    return CombineEventStatuses(subsystems, statuses);
+  }
+
   EventStatus overall_status = EventStatus::DidNothing();
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
     const EventCollection<UnrestrictedUpdateEvent<T>>& subevents =
@@ -1426,6 +1761,7 @@ Diagram<T>::ConvertScalarType() const {
   }
   // Move the new systems into the blueprint.
   blueprint->systems = std::move(new_systems);
+  blueprint->parallelism = parallelism_;
 
   return blueprint;
 }
@@ -1548,6 +1884,8 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   output_port_ids_ = std::move(blueprint->output_port_ids);
   registered_systems_ = std::move(blueprint->systems);
 
+  CompilePeriodicEventTimetable();
+
   // This cache entry just maintains temporary storage. It is only ever used
   // by DoCalcNextUpdateTime(). Since this declaration of the cache entry
   // invokes no invalidation support from the cache system, it is the
@@ -1556,7 +1894,7 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   event_times_buffer_cache_index_ =
       this->DeclareCacheEntry(
           "event_times_buffer", ValueProducer(
-              std::vector<T>(num_subsystems()),
+              std::vector<T>(num_subsystems() + periodic_event_groups_.size()),
               &ValueProducer::NoopCalc),
           {this->nothing_ticket()}).cache_index();
 
@@ -1634,6 +1972,8 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
     residual_size += system->implicit_time_derivatives_residual_size();
   }
   this->set_implicit_time_derivatives_residual_size(residual_size);
+
+  set_parallelism(blueprint->parallelism);
 }
 
 template <typename T>
@@ -1672,6 +2012,233 @@ void Diagram<T>::ExportOutput(const OutputPortLocator& port, std::string name) {
   this->AddOutputPort(std::move(diagram_port));
 }
 
+template <typename T>
+struct Diagram<T>::ParallelTaskGraph {
+  // What must be done before, and what must be held exclusively during, a
+  // task that calculates something of a subsystem.
+  struct Needs {
+    // The indices (into `outputs`) of the subsystem output ports that must be
+    // up to date beforehand.
+    std::vector<int> outputs;
+    // The input ports of this Diagram that must be up to date beforehand.
+    std::vector<InputPortIndex> diagram_inputs;
+    // The groups that the task holds exclusively: the subsystem itself, and
+    // the producers of the abstract-valued inputs it consumes. A subsystem's
+    // group number is its index, and the group number of this Diagram's input
+    // port k is num_subsystems() + k.
+    std::vector<int> groups;
+  };
+
+  // A subsystem output port that is connected to a subsystem input port.
+  struct Output {
+    SubsystemIndex subsystem;
+    OutputPortIndex port;
+    Needs needs;
+  };
+
+  std::vector<Output> outputs;
+  // The needs of each subsystem's own calculations (derivatives and event
+  // handlers), which may consume all of its input ports. Indexed by
+  // SubsystemIndex.
+  std::vector<Needs> subsystems;
+};
+
+template <typename T>
+void Diagram<T>::set_parallelism(Parallelism parallelism) {
+  parallelism_ = parallelism;
+  parallel_task_graph_.reset();
+  if (parallelism.num_threads() == 1) {
+    return;
+  }
+
+  using Needs = typename ParallelTaskGraph::Needs;
+  auto graph = std::make_unique<ParallelTaskGraph>();
+  std::map<OutputPortLocator, int> output_indices;
+  for (const auto& [input, output] : connection_map_) {
+    if (output_indices.emplace(output, graph->outputs.size()).second) {
+      graph->outputs.push_back(
+          {GetSystemIndexOrAbort(output.first), output.second, {}});
+    }
+  }
+
+  // Adds to `needs` what is needed to evaluate the given subsystem input port.
+  auto add_input = [&](const InputPortLocator& input, Needs* needs) {
+    const bool is_abstract =
+        input.first->get_input_port(input.second).get_data_type() ==
+        kAbstractValued;
+    if (const auto iter = connection_map_.find(input);
+        iter != connection_map_.end()) {
+      const OutputPortLocator& output = iter->second;
+      needs->outputs.push_back(output_indices.at(output));
+      if (is_abstract) {
+        needs->groups.push_back(GetSystemIndexOrAbort(output.first));
+      }
+    } else if (const auto exported = input_port_map_.find(input);
+               exported != input_port_map_.end()) {
+      needs->diagram_inputs.push_back(exported->second);
+      if (is_abstract) {
+        needs->groups.push_back(num_subsystems() + exported->second);
+      }
+    }
+  };
+  auto remove_duplicates = [](auto* items) {
+    std::sort(items->begin(), items->end());
+    items->erase(std::unique(items->begin(), items->end()), items->end());
+  };
+  auto finalize = [&](Needs* needs) {
+    remove_duplicates(&needs->outputs);
+    remove_duplicates(&needs->diagram_inputs);
+    remove_duplicates(&needs->groups);
+  };
+
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    const System<T>& system = *registered_systems_[i];
+    Needs needs;
+    needs.groups.push_back(i);
+    for (InputPortIndex k(0); k < system.num_input_ports(); ++k) {
+      add_input({&system, k}, &needs);
+    }
+    finalize(&needs);
+    graph->subsystems.push_back(std::move(needs));
+  }
+
+  // An output port only consumes the input ports that it has direct
+  // feedthrough from.
+  std::map<SubsystemIndex, std::multimap<int, int>> feedthroughs;
+  for (auto& output : graph->outputs) {
+    const System<T>& system = *registered_systems_[output.subsystem];
+    auto [iter, inserted] = feedthroughs.try_emplace(output.subsystem);
+    if (inserted) {
+      iter->second = system.GetDirectFeedthroughs();
+    }
+    output.needs.groups.push_back(output.subsystem);
+    for (const auto& [input_port, output_port] : iter->second) {
+      if (output_port == output.port) {
+        add_input({&system, InputPortIndex(input_port)}, &output.needs);
+      }
+    }
+    finalize(&output.needs);
+  }
+
+  parallel_task_graph_ = std::move(graph);
+}
+
+template <typename T>
+void Diagram<T>::RunSubsystemTasks(
+    const DiagramContext<T>& context,
+    const std::vector<SubsystemIndex>& subsystems,
+    const std::function<void(SubsystemIndex)>& task) const {
+  // The concurrent tasks only read one another's values once they are cached,
+  // which relies on caching being enabled.
+  const bool caching_disabled =
+      this->get_cache_entry(event_times_buffer_cache_index_)
+          .is_cache_entry_disabled(context);
+  if (parallel_task_graph_ == nullptr || subsystems.empty() ||
+      caching_disabled) {
+    for (const SubsystemIndex i : subsystems) {
+      task(i);
+    }
+    return;
+  }
+  const ParallelTaskGraph& graph = *parallel_task_graph_;
+  using Needs = typename ParallelTaskGraph::Needs;
+
+  // Find the subsystem output ports that the tasks need, transitively, and
+  // the input ports of this Diagram that any of those need.
+  std::vector<bool> output_needed(graph.outputs.size(), false);
+  std::vector<bool> diagram_input_needed(this->num_input_ports(), false);
+  std::vector<int> unvisited;
+  auto visit = [&](const Needs& needs) {
+    for (const int k : needs.outputs) {
+      if (!output_needed[k]) {
+        output_needed[k] = true;
+        unvisited.push_back(k);
+      }
+    }
+    for (const InputPortIndex k : needs.diagram_inputs) {
+      diagram_input_needed[k] = true;
+    }
+  };
+  for (const SubsystemIndex i : subsystems) {
+    visit(graph.subsystems[i]);
+  }
+  while (!unvisited.empty()) {
+    const int k = unvisited.back();
+    unvisited.pop_back();
+    visit(graph.outputs[k].needs);
+  }
+
+  // The input ports of this Diagram are evaluated here, so that the tasks
+  // only read them.
+  for (InputPortIndex k(0); k < this->num_input_ports(); ++k) {
+    if (diagram_input_needed[k]) {
+      this->EvalAbstractInput(context, k);
+    }
+  }
+
+  // One task evaluates each of the needed output ports, and one task calls
+  // `task` for each of the given subsystems.
+  std::vector<GraphTask> tasks;
+  std::vector<int> output_task(graph.outputs.size(), -1);
+  for (int k = 0; k < static_cast<int>(graph.outputs.size()); ++k) {
+    if (output_needed[k]) {
+      output_task[k] = static_cast<int>(tasks.size());
+      const OutputPortLocator locator{
+          registered_systems_[graph.outputs[k].subsystem].get(),
+          graph.outputs[k].port};
+      tasks.push_back(GraphTask{
+          .run = [this, &context, locator]() {
+            EvalSubsystemOutputPort(context, locator);
+          },
+          .groups = graph.outputs[k].needs.groups});
+    }
+  }
+  auto add_prerequisites = [&](const Needs& needs, GraphTask* graph_task) {
+    for (const int k : needs.outputs) {
+      DRAKE_DEMAND(output_task[k] >= 0);
+      graph_task->prerequisites.push_back(output_task[k]);
+    }
+  };
+  for (int k = 0; k < static_cast<int>(graph.outputs.size()); ++k) {
+    if (output_needed[k]) {
+      add_prerequisites(graph.outputs[k].needs, &tasks[output_task[k]]);
+    }
+  }
+  const int num_output_tasks = static_cast<int>(tasks.size());
+  for (const SubsystemIndex i : subsystems) {
+    GraphTask graph_task{.run = [&task, i]() {
+                           task(i);
+                         },
+                         .groups = graph.subsystems[i].groups,
+                         .rank = i};
+    add_prerequisites(graph.subsystems[i], &graph_task);
+    tasks.push_back(std::move(graph_task));
+  }
+
+  // An output task is ranked by the lowest subsystem index whose task needs
+  // it (transitively), and precedes that task. Serial evaluation would have
+  // evaluated the output from within that subsystem's task, so the exception
+  // rethrown is the one that serial evaluation would have thrown.
+  std::vector<bool> ranked(num_output_tasks, false);
+  for (int t = num_output_tasks; t < static_cast<int>(tasks.size()); ++t) {
+    std::vector<int> unvisited(tasks[t].prerequisites);
+    while (!unvisited.empty()) {
+      const int prerequisite = unvisited.back();
+      unvisited.pop_back();
+      if (!ranked[prerequisite]) {
+        ranked[prerequisite] = true;
+        tasks[prerequisite].rank = tasks[t].rank;
+        unvisited.insert(unvisited.end(),
+                         tasks[prerequisite].prerequisites.begin(),
+                         tasks[prerequisite].prerequisites.end());
+      }
+    }
+  }
+
+  RunTaskGraph(tasks, num_subsystems() + this->num_input_ports(),
+               parallelism_.num_threads());
+}
+
 template <typename T>
 const AbstractValue& Diagram<T>::EvalSubsystemOutputPort(
     const DiagramContext<T>& context, const OutputPortLocator& id) const {
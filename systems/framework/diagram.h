@@ -11,6 +11,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
@@ -241,6 +242,64 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   bool AreConnected(const OutputPort<T>& output,
                     const InputPort<T>& input) const;
 
+  /// (Advanced) Sets the maximum number of threads (the calling thread among
+  /// them) used to evaluate this Diagram's subsystems concurrently. With the
+  /// default of Parallelism::None(), the subsystems are evaluated one at a
+  /// time, in the order they were added.
+  ///
+  /// When more than one thread is allowed, the following are run
+  /// concurrently for subsystems that don't depend on one another:
+  ///  - the time derivatives of the subsystems that have continuous state,
+  ///  - the discrete and unrestricted update handlers of the subsystems that
+  ///    have events to handle (applying the updates to the Context remains
+  ///    serial), and
+  ///  - beforehand, the subsystem output ports that those calculations
+  ///    consume, including (via direct feedthrough) the outputs that those
+  ///    outputs consume in turn.
+  ///
+  /// The task graph is derived once, here, from this Diagram's connections
+  /// and its subsystems' direct-feedthrough information. Each task only runs
+  /// once the outputs it consumes are up to date in the cache, so the
+  /// concurrent tasks merely read one another's values; when no task throws,
+  /// the values (and the cache) are the same as for serial evaluation,
+  /// regardless of the order in which the tasks happen to run. Publish events,
+  /// CalcNextUpdateTime(), and output ports evaluated from outside the Diagram
+  /// are unaffected.
+  ///
+  /// When a calculation throws, the behavior differs from serial evaluation,
+  /// which stops at the first failing subsystem: all of the other subsystems'
+  /// calculations (and update handlers) still run, except for those that
+  /// need an output whose evaluation threw. The exception that reaches the
+  /// caller is nonetheless the same one that serial evaluation would have
+  /// thrown, i.e., the one from the lowest-indexed failing subsystem
+  /// (counting a failed output evaluation towards the lowest-indexed
+  /// subsystem that needs it).
+  ///
+  /// Note that
+  ///  - All of the input ports of the subsystems taking part are evaluated
+  ///    up front, even ones that the serial evaluation would not have needed.
+  ///  - The value of an abstract-valued port may refer to the Context of the
+  ///    system that produced it (e.g., a geometry::QueryObject), so a
+  ///    subsystem that consumes an abstract-valued port never runs
+  ///    concurrently with the subsystem that produced it (or with the other
+  ///    consumers of abstract-valued ports from the same producer).
+  ///  - When caching is disabled in the Context, evaluation falls back to
+  ///    serial.
+  ///  - The worker threads are started anew for each calculation, so this
+  ///    only pays off when the subsystems are expensive (e.g., several
+  ///    plants, cameras, or estimators).
+  ///  - This only applies to this Diagram's immediate subsystems; a nested
+  ///    Diagram has its own setting.
+  ///  - The subsystems must tolerate running concurrently with each other,
+  ///    i.e., they must not share any mutable data other than through the
+  ///    Context.
+  ///
+  /// The setting is preserved by scalar conversion.
+  void set_parallelism(Parallelism parallelism);
+
+  /// Returns the parallelism set by set_parallelism().
+  Parallelism parallelism() const { return parallelism_; }
+
   using System<T>::GetSubsystemContext;
   using System<T>::GetMutableSubsystemContext;
 
@@ -528,6 +587,8 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     std::map<InputPortLocator, OutputPortLocator> connection_map;
     // All of the systems to be included in the diagram.
     internal::OwnedSystems<T> systems;
+    // The parallelism to use; see set_parallelism().
+    Parallelism parallelism;
   };
 
   // Constructs a Diagram from the Blueprint that a DiagramBuilder produces.
@@ -538,6 +599,10 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // Validates the given @p blueprint and sets up the Diagram accordingly.
   void Initialize(std::unique_ptr<Blueprint> blueprint);
 
+  // Fills periodic_event_groups_ and dynamic_timing_subsystems_ from the
+  // registered subsystems.
+  void CompilePeriodicEventTimetable();
+
   // Connects the given port to an input of the Diagram indicated by @p name.
   // If the named Diagram input does not exist, it is declared.
   void ExportOrConnectInput(const InputPortLocator& port, std::string name);
@@ -569,6 +634,18 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   typename DiagramContext<T>::OutputPortIdentifier
   ConvertToContextPortIdentifier(const OutputPortLocator& locator) const;
 
+  // Calls `task(i)` for each subsystem index in `subsystems` (which must be in
+  // increasing order). When parallelism is enabled, the calls are run
+  // concurrently according to the parallel_task_graph_; otherwise, they are
+  // made in order on the calling thread. In the concurrent case, a task that
+  // throws doesn't stop the others (other than those needing the outputs it
+  // failed to evaluate); the exception rethrown is the one that serial
+  // evaluation would have thrown, i.e., the one of the lowest-indexed failing
+  // subsystem.
+  void RunSubsystemTasks(const DiagramContext<T>& context,
+                         const std::vector<SubsystemIndex>& subsystems,
+                         const std::function<void(SubsystemIndex)>& task) const;
+
   // Returns true if every port mentioned in the connection map exists.
   bool PortsAreValid() const;
 
@@ -603,6 +680,35 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // allocated as a cache entry to avoid heap operations during simulation.
   CacheIndex event_times_buffer_cache_index_{};
 
+  // The timetable of the periodic events of the subsystems whose event timing
+  // is static (see System::get_static_timing_periodic_events()), compiled in
+  // Initialize(). DoCalcNextUpdateTime() computes the next time of each group
+  // of events with identical timing, and only calls CalcNextUpdateTime() on
+  // the subsystems listed in dynamic_timing_subsystems_.
+  struct TimetableEntry {
+    // The order in which the subsystem's own DoCalcNextUpdateTime() would
+    // collect this event when it fires simultaneously with others.
+    int sequence{};
+    SubsystemIndex subsystem;
+    // Whether the subsystem has events in more than one group.
+    bool in_several_groups{};
+    const Event<T>* event{};
+  };
+  struct PeriodicEventGroup {
+    PeriodicEventData timing;
+    // Sorted by subsystem and then by sequence.
+    std::vector<TimetableEntry> entries;
+  };
+  std::vector<PeriodicEventGroup> periodic_event_groups_;
+  std::vector<SubsystemIndex> dynamic_timing_subsystems_;
+
+  // The dependencies among the calculations of this Diagram's subsystems,
+  // which govern their concurrent evaluation. It is only computed when
+  // parallelism_ allows more than one thread; see set_parallelism().
+  struct ParallelTaskGraph;
+  Parallelism parallelism_;
+  std::unique_ptr<const ParallelTaskGraph> parallel_task_graph_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
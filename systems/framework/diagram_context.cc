@@ -157,7 +157,7 @@ void DiagramContext<T>::MakeState() {
 template <typename T>
 void DiagramContext<T>::MakeParameters() {
   std::vector<BasicVector<T>*> numeric_params;
-  std::vector<AbstractValue*> abstract_params;
+  std::vector<AbstractValues*> abstract_params;
   for (auto& subcontext : contexts_) {
     // Using `access` here to avoid sending invalidations.
     Parameters<T>& subparams =
@@ -165,9 +165,7 @@ void DiagramContext<T>::MakeParameters() {
     for (int i = 0; i < subparams.num_numeric_parameter_groups(); ++i) {
       numeric_params.push_back(&subparams.get_mutable_numeric_parameter(i));
     }
-    for (int i = 0; i < subparams.num_abstract_parameters(); ++i) {
-      abstract_params.push_back(&subparams.get_mutable_abstract_parameter(i));
-    }
+    abstract_params.push_back(&subparams.get_mutable_abstract_parameters());
   }
   auto params = std::make_unique<Parameters<T>>();
   params->set_numeric_parameters(
@@ -180,13 +178,19 @@ void DiagramContext<T>::MakeParameters() {
 
 template <typename T>
 DiagramContext<T>::DiagramContext(const DiagramContext& source)
-    : Context<T>(source),
+    : DiagramContext(source, false) {}
+
+template <typename T>
+DiagramContext<T>::DiagramContext(const DiagramContext& source,
+                                  bool copy_on_write)
+    : Context<T>(source, copy_on_write),
       contexts_(source.num_subcontexts()),
       state_(std::make_unique<DiagramState<T>>(source.num_subcontexts())) {
   // Clone all the subsystem contexts.
   for (SubsystemIndex i(0); i < num_subcontexts(); ++i) {
     DRAKE_DEMAND(source.contexts_[i] != nullptr);
-    AddSystem(i, Context<T>::CloneWithoutPointers(*source.contexts_[i]));
+    AddSystem(i, Context<T>::CloneWithoutPointers(*source.contexts_[i],
+                                                  copy_on_write));
   }
 
   // Build a superstate over the subsystem contexts.
@@ -203,6 +207,12 @@ std::unique_ptr<ContextBase> DiagramContext<T>::DoCloneWithoutPointers() const {
   return std::unique_ptr<ContextBase>(new DiagramContext<T>(*this));
 }
 
+template <typename T>
+std::unique_ptr<ContextBase>
+DiagramContext<T>::DoCloneCopyOnWriteWithoutPointers() const {
+  return std::unique_ptr<ContextBase>(new DiagramContext<T>(*this, true));
+}
+
 template <typename T>
 std::unique_ptr<State<T>> DiagramContext<T>::DoCloneState() const {
   auto clone = std::make_unique<DiagramState<T>>(num_subcontexts());
@@ -303,6 +313,15 @@ void DiagramContext<T>::DoPropagateCachingChange(
   }
 }
 
+template <typename T>
+void DiagramContext<T>::DoPropagateCacheProfiler(
+    CacheProfiler* profiler) const {
+  for (auto& subcontext : contexts_) {
+    DRAKE_ASSERT(subcontext != nullptr);
+    ContextBase::PropagateCacheProfiler(*subcontext, profiler);
+  }
+}
+
 template <typename T>
 void DiagramContext<T>::DoPropagateBuildTrackerPointerMap(
     const ContextBase& clone,
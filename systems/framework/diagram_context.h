@@ -128,6 +128,10 @@ class DiagramContext final : public Context<T> {
   /// not a complete copy.
   DiagramContext(const DiagramContext& source);
 
+  /// (Internal use only) The same, but if `copy_on_write` is true, the copy
+  /// is made for a copy-on-write clone; see ContextBase::CloneCopyOnWrite().
+  DiagramContext(const DiagramContext& source, bool copy_on_write);
+
  private:
   friend class DiagramContextTest;
   using ContextBase::AddInputPort;    // For DiagramContextTest.
@@ -135,6 +139,9 @@ class DiagramContext final : public Context<T> {
 
   std::unique_ptr<ContextBase> DoCloneWithoutPointers() const final;
 
+  std::unique_ptr<ContextBase> DoCloneCopyOnWriteWithoutPointers()
+      const final;
+
   std::unique_ptr<State<T>> DoCloneState() const final;
 
   // Print summary information for the diagram context and recurse into
@@ -174,6 +181,9 @@ class DiagramContext final : public Context<T> {
   void DoPropagateCachingChange(
       void (Cache::*caching_change)()) const final;
 
+  // Recursively starts or stops profiling the subcontexts' caches.
+  void DoPropagateCacheProfiler(CacheProfiler* profiler) const final;
+
   // For this method `this` is the source being copied into `clone`.
   void DoPropagateBuildTrackerPointerMap(
       const ContextBase& clone,
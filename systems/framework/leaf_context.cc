@@ -1,5 +1,6 @@
 #include "drake/systems/framework/leaf_context.h"
 
+#include <typeinfo>
 #include <utility>
 
 #include "drake/systems/framework/basic_vector.h"
@@ -16,9 +17,21 @@ template <typename T>
 LeafContext<T>::~LeafContext() {}
 
 template <typename T>
-LeafContext<T>::LeafContext(const LeafContext& source) : Context<T>(source) {
-  // Make a deep copy of the state.
-  state_ = source.CloneState();
+LeafContext<T>::LeafContext(const LeafContext& source)
+    : LeafContext(source, false) {}
+
+template <typename T>
+LeafContext<T>::LeafContext(const LeafContext& source, bool copy_on_write)
+    : Context<T>(source, copy_on_write) {
+  if (!copy_on_write) {
+    // Make a deep copy of the state.
+    state_ = source.CloneState();
+  } else {
+    // Share the abstract state. This is only reached for an exact LeafContext
+    // (see DoCloneCopyOnWriteWithoutPointers()), so DoCloneState() is ours.
+    state_ = source.CloneStateImpl(true);
+    state_->set_system_id(source.get_system_id());
+  }
 
   // Everything else was handled by the Context<T> copy constructor.
 }
@@ -28,8 +41,24 @@ std::unique_ptr<ContextBase> LeafContext<T>::DoCloneWithoutPointers() const {
   return std::unique_ptr<ContextBase>(new LeafContext<T>(*this));
 }
 
+template <typename T>
+std::unique_ptr<ContextBase>
+LeafContext<T>::DoCloneCopyOnWriteWithoutPointers() const {
+  // A derived context must be copied by its own DoCloneWithoutPointers().
+  if (typeid(*this) != typeid(LeafContext<T>)) {
+    return this->DoCloneWithoutPointers();
+  }
+  return std::unique_ptr<ContextBase>(new LeafContext<T>(*this, true));
+}
+
 template <typename T>
 std::unique_ptr<State<T>> LeafContext<T>::DoCloneState() const {
+  return CloneStateImpl(false);
+}
+
+template <typename T>
+std::unique_ptr<State<T>> LeafContext<T>::CloneStateImpl(
+    bool copy_on_write) const {
   auto clone = std::make_unique<State<T>>();
 
   // Make a deep copy of the continuous state using BasicVector::Clone().
@@ -42,9 +71,12 @@ std::unique_ptr<State<T>> LeafContext<T>::DoCloneState() const {
   clone->set_continuous_state(std::make_unique<ContinuousState<T>>(
       xc_vector.Clone(), num_q, num_v, num_z));
 
-  // Make deep copies of the discrete and abstract states.
+  // Make deep copies of the discrete and abstract states. (A copy-on-write
+  // clone shares the abstract values instead.)
   clone->set_discrete_state(state_->get_discrete_state().Clone());
-  clone->set_abstract_state(state_->get_abstract_state().Clone());
+  const AbstractValues& xa = state_->get_abstract_state();
+  clone->set_abstract_state(copy_on_write ? xa.CloneCopyOnWrite()
+                                          : xa.Clone());
 
   return clone;
 }
@@ -48,10 +48,19 @@ class LeafContext : public Context<T> {
   /// not a complete copy.
   LeafContext(const LeafContext& source);
 
+  /// (Internal use only) The same, but if `copy_on_write` is true, the copy
+  /// is made for a copy-on-write clone; see ContextBase::CloneCopyOnWrite().
+  LeafContext(const LeafContext& source, bool copy_on_write);
+
   /// Derived classes should reimplement and replace this; don't recursively
   /// invoke it.
   std::unique_ptr<ContextBase> DoCloneWithoutPointers() const override;
 
+  /// Makes a copy-on-write copy if this is exactly a %LeafContext, or else a
+  /// complete copy using DoCloneWithoutPointers().
+  std::unique_ptr<ContextBase> DoCloneCopyOnWriteWithoutPointers()
+      const override;
+
   std::unique_ptr<State<T>> DoCloneState() const override;
 
  private:
@@ -75,6 +84,10 @@ class LeafContext : public Context<T> {
 
   void notify_set_system_id(internal::SystemId id) final;
 
+  // Implements DoCloneState(). If `copy_on_write` is true, the abstract state
+  // is copied for a copy-on-write clone.
+  std::unique_ptr<State<T>> CloneStateImpl(bool copy_on_write) const;
+
   /// Returns a partial textual description of the Context, intended to be
   /// human-readable.  It is not guaranteed to be unambiguous nor complete.
   std::string do_to_string() const final;
@@ -7,45 +7,13 @@
 
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/pointer_cast.h"
+#include "drake/systems/framework/periodic_event_timing.h"
 #include "drake/systems/framework/system_symbolic_inspector.h"
 #include "drake/systems/framework/value_checker.h"
 
 namespace drake {
 namespace systems {
 
-namespace {
-
-// Returns the next sample time for the given @p attribute.
-template <typename T>
-T GetNextSampleTime(
-    const PeriodicEventData& attribute,
-    const T& current_time_sec) {
-  const double period = attribute.period_sec();
-  DRAKE_ASSERT(period > 0);
-  const double offset = attribute.offset_sec();
-  DRAKE_ASSERT(offset >= 0);
-
-  // If the first sample time hasn't arrived yet, then that is the next
-  // sample time.
-  if (current_time_sec < offset) {
-    return offset;
-  }
-
-  // Compute the index in the sequence of samples for the next time to sample,
-  // which should be greater than the present time.
-  using std::ceil;
-  const T offset_time = current_time_sec - offset;
-  const T next_k = ceil(offset_time / period);
-  T next_t = offset + next_k * period;
-  if (next_t <= current_time_sec) {
-    next_t = offset + (next_k + 1) * period;
-  }
-  DRAKE_ASSERT(next_t > current_time_sec);
-  return next_t;
-}
-
-}  // namespace
-
 template <typename T>
 LeafSystem<T>::~LeafSystem() {}
 
@@ -185,11 +153,8 @@ void LeafSystem<T>::SetDefaultParameters(
       p.SetFromVector(VectorX<T>::Constant(p.size(), 1.0));
     }
   }
-  for (int i = 0; i < parameters->num_abstract_parameters(); i++) {
-    AbstractValue& p = parameters->get_mutable_abstract_parameter(i);
-    auto model_value = model_abstract_parameters_.CloneModel(i);
-    p.SetFrom(*model_value);
-  }
+  AbstractValues& pa = parameters->get_mutable_abstract_parameters();
+  pa.SetFrom(AbstractValues(model_abstract_parameters_.CloneAllModels()));
 }
 
 template <typename T>
@@ -377,7 +342,7 @@ void LeafSystem<T>::DoCalcNextUpdateTime(
       const PeriodicEventData* event_data =
           event->template get_event_data<PeriodicEventData>();
       DRAKE_DEMAND(event_data != nullptr);
-      const T t = GetNextSampleTime(*event_data, context.get_time());
+      const T t = internal::GetNextSampleTime(*event_data, context.get_time());
       if (t < min_time) {
         min_time = t;
         *event_list = {event};
@@ -145,7 +145,8 @@ class LeafSystem : public System<T> {
   scalar types that are arithmetic, or aborts for scalar types that are not
   arithmetic. Subclasses that require aperiodic events should override, but
   be sure to invoke the parent class implementation at the start of the
-  override if you want periodic events to continue to be handled.
+  override if you want periodic events to continue to be handled. A subclass
+  that overrides this method must not call DeclareStaticEventTiming().
 
   @post `time` is set to a value greater than or equal to
         `context.get_time()` on return.
@@ -158,6 +159,21 @@ class LeafSystem : public System<T> {
                             CompositeEventCollection<T>* events,
                             T* time) const override;
 
+  /** Declares that this system's next update time is determined by its
+  declared periodic events alone, i.e., that neither this system nor any
+  subclass overrides DoCalcNextUpdateTime(). A Diagram compiles the periodic
+  events of the leaf subsystems that have made this declaration into a
+  timetable once, and schedules them from that timetable without calling
+  their CalcNextUpdateTime() at every step; it still calls
+  CalcNextUpdateTime() on all of its other subsystems. Systems with many
+  periodic events, or that are instantiated many times in one Diagram,
+  benefit the most. (In Debug builds, a Diagram throws if a system that made
+  this declaration computes a next update time that disagrees with the
+  timetable.) */
+  void DeclareStaticEventTiming() {
+    this->set_static_timing_periodic_events(&periodic_events_);
+  }
+
   // =========================================================================
   // Allocation helper utilities.
 
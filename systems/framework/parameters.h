@@ -125,6 +125,10 @@ class Parameters {
     return *abstract_parameters_;
   }
 
+  AbstractValues& get_mutable_abstract_parameters() {
+    return *abstract_parameters_;
+  }
+
   void set_abstract_parameters(
       std::unique_ptr<AbstractValues> abstract_params) {
     DRAKE_DEMAND(abstract_params != nullptr);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cmath>
+
+#include "drake/common/drake_assert.h"
+#include "drake/systems/framework/event.h"
+
+namespace drake {
+namespace systems {
+namespace internal {
+
+/* Returns the first time strictly after `current_time_sec` at which an event
+with the given periodic `attribute` is triggered. This is shared by
+LeafSystem::DoCalcNextUpdateTime() and the periodic event timetable of a
+Diagram, so that both schedule the events at exactly the same times. */
+template <typename T>
+T GetNextSampleTime(
+    const PeriodicEventData& attribute,
+    const T& current_time_sec) {
+  const double period = attribute.period_sec();
+  DRAKE_ASSERT(period > 0);
+  const double offset = attribute.offset_sec();
+  DRAKE_ASSERT(offset >= 0);
+
+  // If the first sample time hasn't arrived yet, then that is the next
+  // sample time.
+  if (current_time_sec < offset) {
+    return offset;
+  }
+
+  // Compute the index in the sequence of samples for the next time to sample,
+  // which should be greater than the present time.
+  using std::ceil;
+  const T offset_time = current_time_sec - offset;
+  const T next_k = ceil(offset_time / period);
+  T next_t = offset + next_k * period;
+  if (next_t <= current_time_sec) {
+    next_t = offset + (next_k + 1) * period;
+  }
+  DRAKE_ASSERT(next_t > current_time_sec);
+  return next_t;
+}
+
+}  // namespace internal
+}  // namespace systems
+}  // namespace drake
@@ -1454,6 +1454,24 @@ class System : public SystemBase {
     DRAKE_DEMAND(forced_publish_events_ != nullptr);
     return *forced_publish_events_;
   }
+
+  // (Internal use only) Returns this system's declared periodic events when
+  // they alone determine the result of CalcNextUpdateTime(), or nullptr when
+  // the next update time must be computed from a Context. A Diagram schedules
+  // the events of the subsystems that return non-null from a timetable that
+  // is compiled once, rather than calling their CalcNextUpdateTime() at every
+  // step.
+  const LeafCompositeEventCollection<T>* get_static_timing_periodic_events()
+      const {
+    return static_timing_periodic_events_;
+  }
+
+  // (Internal use only) Returns true when the result of CalcNextUpdateTime()
+  // depends on nothing but the time of the Context: for a leaf system, when
+  // get_static_timing_periodic_events() is non-null; for a Diagram, when that
+  // is true of all of its subsystems. Contexts that share a time then share
+  // their event schedule, which lets a BatchSimulator compute it once.
+  bool has_static_event_timing() const { return static_event_timing_; }
 #endif
 
  protected:
@@ -1890,6 +1908,21 @@ class System : public SystemBase {
     forced_unrestricted_update_events_ = std::move(forced);
   }
 
+  // (Internal use only) Sets the result of
+  // get_static_timing_periodic_events(). The collection must outlive this
+  // system.
+  void set_static_timing_periodic_events(
+      const LeafCompositeEventCollection<T>* events) {
+    static_timing_periodic_events_ = events;
+    static_event_timing_ = (events != nullptr);
+  }
+
+  // (Internal use only) Sets the result of has_static_event_timing(), for a
+  // Diagram.
+  void set_static_event_timing(bool static_event_timing) {
+    static_event_timing_ = static_event_timing;
+  }
+
   /** Returns the SystemScalarConverter for `this` system. */
   SystemScalarConverter& get_mutable_system_scalar_converter() {
     return system_scalar_converter_;
@@ -2010,6 +2043,13 @@ class System : public SystemBase {
   std::unique_ptr<EventCollection<UnrestrictedUpdateEvent<T>>>
       forced_unrestricted_update_events_{nullptr};
 
+  // See get_static_timing_periodic_events(). Not owned.
+  const LeafCompositeEventCollection<T>* static_timing_periodic_events_{
+      nullptr};
+
+  // See has_static_event_timing().
+  bool static_event_timing_{false};
+
   // Functions to convert this system to use alternative scalar types.
   SystemScalarConverter system_scalar_converter_;
 
@@ -1,9 +1,11 @@
 #include "drake/systems/framework/abstract_values.h"
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/systems/framework/test_utilities/pack_value.h"
 
 namespace drake {
@@ -34,6 +36,17 @@ TEST_F(AbstractStateTest, UnownedState) {
   EXPECT_EQ(76, UnpackIntValue(xa.get_value(1)));
 }
 
+TEST_F(AbstractStateTest, SpannedState) {
+  AbstractValues first(std::move(data_));
+  AbstractValues second(PackValue(1000));
+  AbstractValues xa(std::vector<AbstractValues*>{&first, &second});
+  ASSERT_EQ(3, xa.size());
+  EXPECT_EQ(&first.get_value(1), &xa.get_value(1));
+  EXPECT_EQ(1000, UnpackIntValue(xa.get_value(2)));
+  xa.get_mutable_value(2).set_value<int>(1001);
+  EXPECT_EQ(1001, UnpackIntValue(second.get_value(0)));
+}
+
 TEST_F(AbstractStateTest, SingleValueConstructor) {
   AbstractValues xa(PackValue<int>(1000));
   ASSERT_EQ(1, xa.size());
@@ -45,6 +58,84 @@ TEST_F(AbstractStateTest, Clone) {
   std::unique_ptr<AbstractValues> clone = xa.Clone();
   EXPECT_EQ(42, UnpackIntValue(clone->get_value(0)));
   EXPECT_EQ(76, UnpackIntValue(clone->get_value(1)));
+  EXPECT_NE(&xa.get_value(0), &clone->get_value(0));
+}
+
+// A copy-on-write clone shares the values until either it or the original
+// modifies them.
+TEST_F(AbstractStateTest, CopyOnWriteClone) {
+  AbstractValues first(std::move(data_));
+  AbstractValues second(PackValue(1000));
+  AbstractValues xa(std::vector<AbstractValues*>{&first, &second});
+  std::unique_ptr<AbstractValues> clone = xa.CloneCopyOnWrite();
+  ASSERT_EQ(3, clone->size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(&xa.get_value(i), &clone->get_value(i));
+  }
+
+  // Mutable access to a shared value copies it.
+  clone->get_mutable_value(0).set_value<int>(43);
+  EXPECT_EQ(42, UnpackIntValue(xa.get_value(0)));
+  EXPECT_EQ(43, UnpackIntValue(clone->get_value(0)));
+  // Through the spanning values too; now neither shares the value.
+  const AbstractValue* const shared = &second.get_value(0);
+  xa.get_mutable_value(2).set_value<int>(1001);
+  EXPECT_NE(shared, &second.get_value(0));
+  EXPECT_EQ(shared, &clone->get_value(2));
+  EXPECT_EQ(1000, UnpackIntValue(clone->get_value(2)));
+  EXPECT_EQ(&clone->get_mutable_value(2), shared);
+
+  // Setting a value from the one that it shares doesn't copy it.
+  const AbstractValue* const still_shared = &first.get_value(1);
+  xa.SetFrom(*clone);
+  EXPECT_EQ(still_shared, &first.get_value(1));
+  EXPECT_EQ(43, UnpackIntValue(first.get_value(0)));
+  EXPECT_EQ(1000, UnpackIntValue(second.get_value(0)));
+
+  // A value that was given out by get_mutable_value() is never shared again,
+  // since the reference may still be in use.
+  std::unique_ptr<AbstractValues> another = xa.CloneCopyOnWrite();
+  EXPECT_EQ(&xa.get_value(0), &another->get_value(0));
+  EXPECT_EQ(&xa.get_value(1), &another->get_value(1));
+  EXPECT_NE(&xa.get_value(2), &another->get_value(2));
+  EXPECT_EQ(1000, UnpackIntValue(another->get_value(2)));
+}
+
+// Const access to an unshared value copies a shared value without giving it
+// out, so a later copy-on-write clone shares the copy again.
+TEST_F(AbstractStateTest, CopyOnWriteUnsharedValue) {
+  const AbstractValues xa(std::move(data_));
+  std::unique_ptr<AbstractValues> clone = xa.CloneCopyOnWrite();
+  const AbstractValue* const shared = &xa.get_value(0);
+
+  const AbstractValue& unshared = clone->get_unshared_value(0);
+  EXPECT_NE(shared, &unshared);
+  EXPECT_EQ(&unshared, &clone->get_value(0));
+  EXPECT_EQ(42, UnpackIntValue(unshared));
+  EXPECT_EQ(shared, &xa.get_value(0));
+
+  // Neither one shares the value any longer, so this doesn't copy.
+  EXPECT_EQ(shared, &xa.get_unshared_value(0));
+
+  std::unique_ptr<AbstractValues> another = clone->CloneCopyOnWrite();
+  EXPECT_EQ(&unshared, &another->get_value(0));
+}
+
+// The copies that a copy-on-write clone makes are deep copies, even when the
+// values themselves hold containers.
+TEST_F(AbstractStateTest, CopyOnWriteCloneOfNestedValues) {
+  using NestedValues = copyable_unique_ptr<AbstractValues>;
+  auto inner = std::make_unique<AbstractValues>(PackValue(1000));
+  AbstractValues xa(std::make_unique<Value<NestedValues>>(std::move(inner)));
+  // Give out the value so that the copy-on-write clone must copy it.
+  const AbstractValues& nested =
+      *xa.get_mutable_value(0).get_value<NestedValues>();
+  std::unique_ptr<AbstractValues> clone = xa.CloneCopyOnWrite();
+  const AbstractValues& nested_clone =
+      *clone->get_value(0).get_value<NestedValues>();
+  EXPECT_NE(&nested, &nested_clone);
+  EXPECT_NE(&nested.get_value(0), &nested_clone.get_value(0));
+  EXPECT_EQ(1000, UnpackIntValue(nested_clone.get_value(0)));
 }
 
 }  // namespace
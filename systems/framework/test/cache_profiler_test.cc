@@ -0,0 +1,194 @@
+#include "drake/systems/framework/cache_profiler.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using EntryStatistics = CacheProfiler::EntryStatistics;
+
+// Outputs the current time.
+class Clock final : public LeafSystem<double> {
+ public:
+  Clock() {
+    DeclareVectorOutputPort("time", 1, &Clock::CalcTime, {time_ticket()});
+  }
+
+ private:
+  void CalcTime(const Context<double>& context,
+                BasicVector<double>* output) const {
+    (*output)[0] = context.get_time();
+  }
+};
+
+// Outputs twice its input.
+class Doubler final : public LeafSystem<double> {
+ public:
+  Doubler() {
+    DeclareVectorInputPort("u", 1);
+    DeclareVectorOutputPort("y", 1, &Doubler::CalcOutput);
+  }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    output->SetFromVector(2 * get_input_port().Eval(context));
+  }
+};
+
+class CacheProfilerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    DiagramBuilder<double> builder;
+    const auto& clock = *builder.AddNamedSystem<Clock>("clock");
+    const auto& doubler = *builder.AddNamedSystem<Doubler>("doubler");
+    builder.Connect(clock, doubler);
+    builder.ExportOutput(doubler.get_output_port());
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+  }
+
+  // Returns the statistics of the output port cache entry of the named
+  // subsystem.
+  EntryStatistics GetOutputStatistics(const std::string& name) const {
+    const CacheProfiler* profiler = context_->get_cache_profiler();
+    DRAKE_DEMAND(profiler != nullptr);
+    for (const EntryStatistics& stats : profiler->GetStatistics()) {
+      if (stats.system_pathname == "::_::" + name && stats.is_output_port) {
+        return stats;
+      }
+    }
+    throw std::runtime_error("No output port for " + name);
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(CacheProfilerTest, Statistics) {
+  EXPECT_EQ(context_->get_cache_profiler(), nullptr);
+  CacheProfiler& profiler = context_->EnableCacheProfiling();
+  EXPECT_EQ(context_->get_cache_profiler(), &profiler);
+  // Enabling again returns the same profiler.
+  EXPECT_EQ(&context_->EnableCacheProfiling(), &profiler);
+
+  for (int i = 0; i < 3; ++i) {
+    diagram_->get_output_port().Eval(*context_);
+  }
+  EntryStatistics doubler = GetOutputStatistics("doubler");
+  EntryStatistics clock = GetOutputStatistics("clock");
+  EXPECT_EQ(doubler.description, "output port 0(y) cache");
+  EXPECT_EQ(doubler.num_evaluations(), 3);
+  EXPECT_EQ(doubler.num_hits, 2);
+  EXPECT_EQ(doubler.num_misses, 1);
+  EXPECT_EQ(clock.num_hits, 0);
+  EXPECT_EQ(clock.num_misses, 1);
+  // The doubler's computation includes that of the clock.
+  EXPECT_GE(doubler.compute_time, clock.compute_time);
+  EXPECT_LE(doubler.self_time, doubler.compute_time);
+  EXPECT_EQ(doubler.num_invalidations, 0);
+
+  // A change of time reaches the doubler through the clock.
+  context_->SetTime(1.0);
+  context_->SetTime(2.0);
+  EXPECT_EQ(diagram_->get_output_port().Eval(*context_)[0], 4.0);
+  doubler = GetOutputStatistics("doubler");
+  clock = GetOutputStatistics("clock");
+  EXPECT_EQ(doubler.num_misses, 2);
+  EXPECT_EQ(doubler.num_invalidations, 2);
+  ASSERT_EQ(doubler.invalidation_sources.size(), 1);
+  EXPECT_EQ(doubler.invalidation_sources[0].first, "::_::clock:t");
+  EXPECT_EQ(doubler.invalidation_sources[0].second, 2);
+  EXPECT_EQ(clock.num_invalidations, 2);
+
+  // The statistics are sorted by compute time.
+  const std::vector<EntryStatistics> all = profiler.GetStatistics();
+  for (int i = 1; i < ssize(all); ++i) {
+    EXPECT_GE(all[i - 1].compute_time, all[i].compute_time);
+  }
+
+  profiler.Reset();
+  EXPECT_EQ(GetOutputStatistics("doubler").num_evaluations(), 0);
+  EXPECT_EQ(GetOutputStatistics("doubler").num_invalidations, 0);
+}
+
+TEST_F(CacheProfilerTest, ReportAndGraphviz) {
+  CacheProfiler& profiler = context_->EnableCacheProfiling();
+  diagram_->get_output_port().Eval(*context_);
+  context_->SetTime(1.0);
+  diagram_->get_output_port().Eval(*context_);
+
+  const std::string report = profiler.GetReport();
+  EXPECT_NE(report.find("4 evaluations, 0 hits, 4 misses"), std::string::npos)
+      << report;
+  EXPECT_NE(report.find("::_::doubler:output port 0(y) cache [output]"),
+            std::string::npos) << report;
+  EXPECT_NE(report.find("invalidated by ::_::clock:t (1)"), std::string::npos)
+      << report;
+  // Entries beyond the maximum are only counted.
+  EXPECT_NE(profiler.GetReport(1).find(" more entries."), std::string::npos);
+
+  const std::string graph = profiler.GetGraphvizString();
+  // Returns the name of the node whose label starts with `label`.
+  auto node_name = [&graph](const std::string& label) {
+    const size_t end = graph.find(" [label=\"" + label);
+    if (end == std::string::npos) return std::string("missing");
+    const size_t start = graph.rfind('\n', end) + 1;
+    return graph.substr(start + 2, end - start - 2);
+  };
+  const std::string time = node_name("::_::clock:t\"");
+  const std::string clock = node_name("::_::clock:output port 0(time) cache");
+  const std::string doubler = node_name("::_::doubler:output port 0(y) cache");
+  EXPECT_EQ(graph.find("digraph CacheProfile {"), 0) << graph;
+  // The time invalidates the clock, which invalidates the doubler.
+  EXPECT_NE(graph.find(time + " -> " + clock + " [label=\"1\""),
+            std::string::npos) << graph;
+  EXPECT_NE(graph.find(clock + " -> " + doubler + " [label=\"1\""),
+            std::string::npos) << graph;
+  EXPECT_NE(graph.find("::_::doubler:output port 0(y) cache\\n2 misses"),
+            std::string::npos) << graph;
+  EXPECT_EQ(profiler.GetGraphvizString(0).find("->"), std::string::npos);
+}
+
+TEST_F(CacheProfilerTest, EnableAndDisable) {
+  context_->EnableCacheProfiling();
+
+  // Clones are not profiled, but evaluate as usual.
+  auto clone = context_->Clone();
+  EXPECT_EQ(clone->get_cache_profiler(), nullptr);
+  EXPECT_EQ(diagram_->get_output_port().Eval(*clone)[0], 0.0);
+  EXPECT_EQ(GetOutputStatistics("doubler").num_evaluations(), 0);
+
+  // Disabling caching doesn't stop profiling; every evaluation is a miss.
+  context_->DisableCaching();
+  diagram_->get_output_port().Eval(*context_);
+  diagram_->get_output_port().Eval(*context_);
+  EXPECT_EQ(GetOutputStatistics("doubler").num_misses, 2);
+  context_->EnableCaching();
+
+  context_->DisableCacheProfiling();
+  EXPECT_EQ(context_->get_cache_profiler(), nullptr);
+  EXPECT_EQ(diagram_->get_output_port().Eval(*context_)[0], 0.0);
+  // Disabling again does nothing.
+  context_->DisableCacheProfiling();
+
+  const auto& subcontext = diagram_->GetSubsystemContext(
+      diagram_->GetSubsystemByName("clock"), *context_);
+  DRAKE_EXPECT_THROWS_MESSAGE(subcontext.EnableCacheProfiling(),
+                              ".*Cannot profile a non-root Context.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
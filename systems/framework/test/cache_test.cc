@@ -584,12 +584,15 @@ TEST_F(CacheTest, ValueMethodsWork) {
   EXPECT_THROW(value.PeekAbstractValueOrThrow(), std::logic_error);
   EXPECT_THROW(value.PeekValueOrThrow<int>(), std::logic_error);
 
+  // The flags can be queried regardless; a missing value is out of date.
+  EXPECT_TRUE(value.is_out_of_date());
+  EXPECT_TRUE(value.needs_recomputation());
+  EXPECT_FALSE(value.is_ready_to_use());
+
   if (kDrakeAssertIsArmed) {
     EXPECT_THROW(value.get_abstract_value(), std::logic_error);
     EXPECT_THROW(value.get_value<int>(), std::logic_error);
     EXPECT_THROW(value.set_value<int>(5), std::logic_error);
-    EXPECT_THROW(value.is_out_of_date(), std::logic_error);
-    EXPECT_THROW(value.needs_recomputation(), std::logic_error);
     EXPECT_THROW(value.mark_up_to_date(), std::logic_error);
     EXPECT_THROW(value.swap_value(&swap_with_me), std::logic_error);
   }
@@ -0,0 +1,289 @@
+#include "drake/systems/framework/context_snapshot.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+
+// A trivially copyable abstract value type that opts in to snapshots.
+struct Pose2 {
+  double x{};
+  double y{};
+  double theta{};
+};
+
+// An abstract value type that does not opt in.
+struct Unregistered {
+  int value{};
+};
+
+// An abstract value type whose saved value can't be restored when it is
+// negative.
+struct Fragile {
+  int value{};
+};
+
+template <>
+struct ContextSnapshotTraits<Pose2> : TriviallyCopyableSnapshotTraits<Pose2> {};
+
+template <>
+struct ContextSnapshotTraits<Fragile> {
+  static void Write(const Fragile& fragile, std::vector<uint8_t>* buffer) {
+    TriviallyCopyableSnapshotTraits<int>::Write(fragile.value, buffer);
+  }
+  static void Read(const uint8_t* data, size_t size, Fragile* fragile) {
+    TriviallyCopyableSnapshotTraits<int>::Read(data, size, &fragile->value);
+    if (fragile->value < 0) {
+      throw std::runtime_error("negative");
+    }
+  }
+};
+
+namespace {
+
+// A system with every kind of state and parameter, whose output depends on
+// all of them.
+class Everything final : public LeafSystem<double> {
+ public:
+  explicit Everything(bool with_unregistered = false) {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(3);
+    DeclareDiscreteState(1);
+    DeclareAbstractState(Value<Pose2>());
+    DeclareAbstractState(Value<std::string>("hello"));
+    DeclareNumericParameter(BasicVector<double>(Eigen::Vector2d(1.0, 2.0)));
+    DeclareAbstractParameter(Value<int>(7));
+    if (with_unregistered) {
+      DeclareAbstractState(Value<Unregistered>());
+    }
+    DeclareVectorOutputPort("sum", 1, &Everything::CalcSum);
+  }
+
+ private:
+  void CalcSum(const Context<double>& context,
+               BasicVector<double>* output) const {
+    (*output)[0] = context.get_continuous_state_vector().CopyToVector().sum() +
+                   context.get_discrete_state(0).value().sum() +
+                   context.get_abstract_state<Pose2>(0).theta +
+                   context.get_numeric_parameter(0).value().sum() +
+                   context.get_parameters().get_abstract_parameter<int>(0);
+  }
+};
+
+class ContextSnapshotTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ContextSnapshot::RegisterAbstractType<Pose2>();
+    DiagramBuilder<double> builder;
+    builder.AddNamedSystem<Everything>("a");
+    const auto& b = *builder.AddNamedSystem<Everything>("b");
+    builder.ExportOutput(b.get_output_port());
+    diagram_ = builder.Build();
+    context_ = diagram_->CreateDefaultContext();
+    Modify(1.0, context_.get());
+  }
+
+  // Sets every value of `context` to a function of `k`.
+  void Modify(double k, Context<double>* context) const {
+    context->SetTime(k);
+    context->SetAccuracy(k * 1e-3);
+    context->SetContinuousState(Eigen::Vector4d(1, 2, 3, 4) * k);
+    context->SetDiscreteState(0, Eigen::Vector3d(5, 6, 7) * k);
+    context->SetDiscreteState(3, Vector1d(8 * k));
+    for (const char* name : {"a", "b"}) {
+      Context<double>& subcontext = diagram_->GetMutableSubsystemContext(
+          diagram_->GetSubsystemByName(name), context);
+      subcontext.get_mutable_abstract_state<Pose2>(0) = Pose2{k, 2 * k, 3 * k};
+      subcontext.get_mutable_abstract_state<std::string>(1) =
+          std::string(static_cast<int>(k) + 1, 'x');
+      subcontext.get_mutable_numeric_parameter(0).SetFromVector(
+          Eigen::Vector2d(9, 10) * k);
+      subcontext.get_mutable_parameters().get_mutable_abstract_parameter<int>(
+          0) = static_cast<int>(11 * k);
+    }
+  }
+
+  // Expects every value of `context` to equal those of context_.
+  void ExpectMatches(const Context<double>& context) const {
+    EXPECT_EQ(context.get_time(), context_->get_time());
+    EXPECT_EQ(context.get_accuracy(), context_->get_accuracy());
+    EXPECT_TRUE(CompareMatrices(
+        context.get_continuous_state_vector().CopyToVector(),
+        context_->get_continuous_state_vector().CopyToVector()));
+    for (int i = 0; i < context.num_discrete_state_groups(); ++i) {
+      EXPECT_TRUE(CompareMatrices(context.get_discrete_state(i).value(),
+                                  context_->get_discrete_state(i).value()));
+    }
+    for (const char* name : {"a", "b"}) {
+      const System<double>& system = diagram_->GetSubsystemByName(name);
+      const Context<double>& expected =
+          diagram_->GetSubsystemContext(system, *context_);
+      const Context<double>& actual =
+          diagram_->GetSubsystemContext(system, context);
+      EXPECT_EQ(actual.get_abstract_state<Pose2>(0).theta,
+                expected.get_abstract_state<Pose2>(0).theta);
+      EXPECT_EQ(actual.get_abstract_state<std::string>(1),
+                expected.get_abstract_state<std::string>(1));
+      EXPECT_TRUE(CompareMatrices(actual.get_numeric_parameter(0).value(),
+                                  expected.get_numeric_parameter(0).value()));
+      EXPECT_EQ(actual.get_parameters().get_abstract_parameter<int>(0),
+                expected.get_parameters().get_abstract_parameter<int>(0));
+    }
+    EXPECT_EQ(diagram_->get_output_port().Eval(context)[0],
+              diagram_->get_output_port().Eval(*context_)[0]);
+  }
+
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(ContextSnapshotTest, SaveAndRestore) {
+  ContextSnapshot snapshot;
+  EXPECT_TRUE(snapshot.empty());
+  snapshot.Save(*context_);
+  EXPECT_FALSE(snapshot.empty());
+  EXPECT_GT(snapshot.size_bytes(), 0);
+
+  // Restore into a different context, and into the original after changes.
+  // The restores invalidate the cached output.
+  auto other = diagram_->CreateDefaultContext();
+  diagram_->get_output_port().Eval(*other);
+  snapshot.Restore(other.get());
+  ExpectMatches(*other);
+
+  const double expected_sum = diagram_->get_output_port().Eval(*context_)[0];
+  Modify(3.0, context_.get());
+  EXPECT_NE(diagram_->get_output_port().Eval(*context_)[0], expected_sum);
+  snapshot.Restore(context_.get());
+  EXPECT_EQ(diagram_->get_output_port().Eval(*context_)[0], expected_sum);
+  ExpectMatches(*other);
+
+  // Saving again replaces the contents, including the size of the string.
+  Modify(20.0, context_.get());
+  const int64_t old_size = snapshot.size_bytes();
+  snapshot.Save(*context_);
+  EXPECT_EQ(snapshot.size_bytes(), old_size + 2 * 19);
+  snapshot.Restore(other.get());
+  ExpectMatches(*other);
+
+  // The default accuracy is restored as well.
+  context_->SetAccuracy(std::nullopt);
+  ContextSnapshot(*context_).Restore(other.get());
+  EXPECT_EQ(other->get_accuracy(), std::nullopt);
+}
+
+TEST_F(ContextSnapshotTest, File) {
+  const std::filesystem::path filename =
+      std::filesystem::path(temp_directory()) / "context.snapshot";
+  ContextSnapshot(*context_).SaveToFile(filename);
+  const ContextSnapshot loaded = ContextSnapshot::LoadFromFile(filename);
+  auto other = diagram_->CreateDefaultContext();
+  loaded.Restore(other.get());
+  ExpectMatches(*other);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(ContextSnapshot().SaveToFile(filename),
+                              ".*snapshot is empty.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ContextSnapshot::LoadFromFile(filename.string() + ".missing"),
+      ".*can't be opened.*");
+  const std::filesystem::path bad = filename.string() + ".bad";
+  std::ofstream(bad) << "not a snapshot";
+  DRAKE_EXPECT_THROWS_MESSAGE(ContextSnapshot::LoadFromFile(bad),
+                              ".*not a Context snapshot.*");
+  std::filesystem::resize_file(filename, 30);
+  DRAKE_EXPECT_THROWS_MESSAGE(ContextSnapshot::LoadFromFile(filename),
+                              ".*truncated.*");
+}
+
+TEST_F(ContextSnapshotTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ContextSnapshot().Restore(context_.get()),
+                              ".*snapshot is empty.*");
+
+  // A context of a differently-structured system is rejected, unchanged.
+  const ContextSnapshot snapshot(*context_);
+  Everything leaf;
+  auto leaf_context = leaf.CreateDefaultContext();
+  DRAKE_EXPECT_THROWS_MESSAGE(snapshot.Restore(leaf_context.get()),
+                              ".*does not have the structure.*");
+  EXPECT_EQ(leaf_context->get_time(), 0.0);
+
+  // A snapshot with trailing data is corrupt.
+  const auto filename =
+      std::filesystem::path(temp_directory()) / "trailing.snapshot";
+  snapshot.SaveToFile(filename);
+  std::string bytes;
+  {
+    std::ifstream file(filename, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(file), {});
+  }
+  int64_t layout_size{};
+  std::memcpy(&layout_size, bytes.data() + 8, sizeof(layout_size));
+  const size_t data_size_offset = 16 + layout_size * sizeof(int64_t);
+  int64_t data_size{};
+  std::memcpy(&data_size, bytes.data() + data_size_offset, sizeof(data_size));
+  data_size += 8;
+  std::memcpy(bytes.data() + data_size_offset, &data_size, sizeof(data_size));
+  bytes.append(8, '\0');
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file << bytes;
+  }
+  auto context = context_->Clone();
+  Modify(2.0, context.get());
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ContextSnapshot::LoadFromFile(filename).Restore(context.get()),
+      ".*Corrupt snapshot.*");
+  EXPECT_EQ(context->get_time(), 2.0);
+
+  Everything unregistered(true);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ContextSnapshot(*unregistered.CreateDefaultContext()),
+      ".*type .*Unregistered can't be saved.*");
+}
+
+// A Restore() that fails leaves the Context unchanged, including when the
+// ContextSnapshotTraits::Read() of an abstract value throws.
+GTEST_TEST(ContextSnapshotAtomicTest, FailedRestore) {
+  class FragileSystem final : public LeafSystem<double> {
+   public:
+    FragileSystem() {
+      DeclareContinuousState(1);
+      DeclareAbstractState(Value<Fragile>());
+      DeclareAbstractState(Value<Fragile>());
+    }
+  };
+  ContextSnapshot::RegisterAbstractType<Fragile>();
+  const FragileSystem system;
+  auto context = system.CreateDefaultContext();
+  context->get_mutable_abstract_state<Fragile>(1).value = -1;
+  const ContextSnapshot snapshot(*context);
+
+  context->SetTime(2.0);
+  context->SetContinuousState(Vector1d(3.0));
+  context->get_mutable_abstract_state<Fragile>(0).value = 4;
+  context->get_mutable_abstract_state<Fragile>(1).value = 5;
+  DRAKE_EXPECT_THROWS_MESSAGE(snapshot.Restore(context.get()), "negative");
+  EXPECT_EQ(context->get_time(), 2.0);
+  EXPECT_EQ(context->get_continuous_state_vector()[0], 3.0);
+  EXPECT_EQ(context->get_abstract_state<Fragile>(0).value, 4);
+  EXPECT_EQ(context->get_abstract_state<Fragile>(1).value, 5);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -7,6 +7,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
@@ -14,6 +15,7 @@
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/fixed_input_port_value.h"
 #include "drake/systems/framework/leaf_context.h"
+#include "drake/systems/framework/leaf_output_port.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/framework/system.h"
 #include "drake/systems/framework/test_utilities/pack_value.h"
@@ -44,6 +46,15 @@ class SystemWithAbstractState : public LeafSystem<double> {
   ~SystemWithAbstractState() override {}
 };
 
+// Holds a whole Context as its abstract state.
+class SystemWithContextState : public LeafSystem<double> {
+ public:
+  SystemWithContextState() {
+    DeclareAbstractState(Value<copyable_unique_ptr<Context<double>>>());
+  }
+  ~SystemWithContextState() override {}
+};
+
 class SystemWithNumericParameters : public LeafSystem<double> {
  public:
   SystemWithNumericParameters() {
@@ -783,12 +794,109 @@ TEST_F(DiagramContextTest, CloneAccuracy) {
   EXPECT_EQ(clone->get_accuracy().value(), unity);
 }
 
+TEST_F(DiagramContextTest, CloneCopyOnWrite) {
+  auto clone = dynamic_pointer_cast<DiagramContext<double>>(
+      context_->CloneCopyOnWrite());
+  ASSERT_TRUE(clone != nullptr);
+  VerifyClonedState(clone->get_state());
+  VerifyClonedParameters(clone->get_parameters());
+
+  // The abstract state and parameters are shared until they are modified,
+  // whether by the clone or by the original.
+  EXPECT_EQ(&clone->get_abstract_state<int>(0),
+            &context_->get_abstract_state<int>(0));
+  EXPECT_EQ(&clone->get_abstract_parameter(0),
+            &context_->get_abstract_parameter(0));
+  clone->get_mutable_abstract_state<int>(0) = 43;
+  EXPECT_EQ(context_->get_abstract_state<int>(0), 42);
+  context_->get_mutable_abstract_parameter(0).set_value<int>(4096);
+  EXPECT_EQ(UnpackIntValue(clone->get_abstract_parameter(0)), 2048);
+  EXPECT_NE(&clone->get_abstract_parameter(0),
+            &context_->get_abstract_parameter(0));
+
+  // The numeric state and parameters are copied.
+  EXPECT_NE(&clone->get_numeric_parameter(0),
+            &context_->get_numeric_parameter(0));
+  clone->get_mutable_continuous_state_vector()[0] = 1024.0;
+  EXPECT_EQ(42.0, context_->get_continuous_state()[0]);
+
+  // The cache values are allocated when they are first needed.
+  const auto& output_port = integrator0_->get_output_port();
+  const CacheEntry& cache_entry =
+      dynamic_cast<const LeafOutputPort<double>&>(output_port).cache_entry();
+  const Context<double>& subcontext =
+      clone->GetSubsystemContext(SubsystemIndex(2));
+  EXPECT_TRUE(cache_entry.get_cache_entry_value(
+      context_->GetSubsystemContext(SubsystemIndex(2))).has_value());
+  EXPECT_FALSE(cache_entry.get_cache_entry_value(subcontext).has_value());
+  EXPECT_TRUE(cache_entry.is_out_of_date(subcontext));
+  EXPECT_EQ(output_port.Eval(subcontext)[0], 1024.0);
+  EXPECT_TRUE(cache_entry.get_cache_entry_value(subcontext).has_value());
+
+  // A clone of a copy-on-write clone is complete.
+  auto clone_of_clone =
+      dynamic_pointer_cast<DiagramContext<double>>(clone->Clone());
+  EXPECT_EQ(clone_of_clone->get_abstract_state<int>(0), 43);
+  EXPECT_EQ(output_port.Eval(clone_of_clone->GetSubsystemContext(
+      SubsystemIndex(2)))[0], 1024.0);
+}
+
+// Values to which mutable access was given out before the clone was made
+// aren't shared, since writing through those references would change the clone.
+TEST_F(DiagramContextTest, CloneCopyOnWriteAfterMutableAccess) {
+  int& state = context_->get_mutable_abstract_state<int>(0);
+  AbstractValue& parameter = context_->get_mutable_abstract_parameter(0);
+  auto clone = context_->CloneCopyOnWrite();
+  EXPECT_NE(&clone->get_abstract_state<int>(0), &state);
+  EXPECT_NE(&clone->get_abstract_parameter(0), &parameter);
+  state = 43;
+  parameter.set_value<int>(4096);
+  EXPECT_EQ(clone->get_abstract_state<int>(0), 42);
+  EXPECT_EQ(UnpackIntValue(clone->get_abstract_parameter(0)), 2048);
+}
+
+// A value that a copy-on-write clone copies is copied by its own
+// AbstractValue::Clone(), so a Context nested in it is cloned completely.
+TEST_F(DiagramContextTest, CloneCopyOnWriteNestedClone) {
+  using ContextPtr = copyable_unique_ptr<Context<double>>;
+  SystemWithContextState system;
+  auto outer = system.CreateDefaultContext();
+  outer->get_mutable_abstract_state<ContextPtr>(0) =
+      ContextPtr(context_->Clone());
+  auto outer_clone = outer->CloneCopyOnWrite();
+  const Context<double>& inner = *outer->get_abstract_state<ContextPtr>(0);
+  const Context<double>& inner_clone =
+      *outer_clone->get_abstract_state<ContextPtr>(0);
+  EXPECT_NE(&inner, &inner_clone);
+  EXPECT_NE(&inner.get_abstract_state<int>(0),
+            &inner_clone.get_abstract_state<int>(0));
+  EXPECT_NE(&inner.get_abstract_parameter(0),
+            &inner_clone.get_abstract_parameter(0));
+}
+
+// A frozen cache can't compute values, so a copy-on-write clone copies them.
+TEST_F(DiagramContextTest, CloneCopyOnWriteFrozenCache) {
+  const auto& output_port = integrator0_->get_output_port();
+  EXPECT_EQ(output_port.Eval(
+      context_->GetSubsystemContext(SubsystemIndex(2)))[0], 42.0);
+  context_->FreezeCache();
+  auto clone = dynamic_pointer_cast<DiagramContext<double>>(
+      context_->CloneCopyOnWrite());
+  EXPECT_TRUE(clone->is_cache_frozen());
+  EXPECT_EQ(output_port.Eval(
+      clone->GetSubsystemContext(SubsystemIndex(2)))[0], 42.0);
+}
+
 TEST_F(DiagramContextTest, SubcontextCloneIsError) {
   const auto& subcontext = context_->GetSubsystemContext(SubsystemIndex{0});
   DRAKE_EXPECT_THROWS_MESSAGE(
       subcontext.Clone(),
       "Context::Clone..: Cannot clone a non-root Context; "
       "this Context was created by 'adder0'.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      subcontext.CloneCopyOnWrite(),
+      "Context::CloneCopyOnWrite..: Cannot clone a non-root Context; "
+      "this Context was created by 'adder0'.");
 }
 
 TEST_F(DiagramContextTest, SubcontextSetTimeStateAndParametersFromIsError) {
@@ -0,0 +1,336 @@
+/* Tests the concurrent evaluation of a Diagram's subsystems, as enabled by
+Diagram::set_parallelism(). */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::VectorXd;
+
+// A first-order system, xdot = u, y = x, that calls `on_derivatives` whenever
+// its derivatives are calculated.
+class Integrand final : public LeafSystem<double> {
+ public:
+  explicit Integrand(std::function<void()> on_derivatives = {})
+      : on_derivatives_(std::move(on_derivatives)) {
+    DeclareContinuousState(1);
+    DeclareVectorInputPort("u", 1);
+    DeclareVectorOutputPort("y", 1, &Integrand::CalcOutput,
+                            {all_state_ticket()});
+  }
+
+ private:
+  void CalcOutput(const Context<double>& context,
+                  BasicVector<double>* output) const {
+    output->SetFromVector(context.get_continuous_state_vector().CopyToVector());
+  }
+
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    if (on_derivatives_) on_derivatives_();
+    derivatives->SetFromVector(get_input_port().Eval(context));
+  }
+
+  const std::function<void()> on_derivatives_;
+};
+
+// Blocks each caller of Arrive() until `num_callers` callers have arrived
+// (or a generous timeout has passed), so that the arrival of all of them
+// proves that they were running concurrently.
+class Rendezvous {
+ public:
+  explicit Rendezvous(int num_callers) : num_callers_(num_callers) {}
+
+  // Returns true iff all of the callers arrived.
+  bool Arrive() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ++num_arrived_;
+    all_arrived_.notify_all();
+    return all_arrived_.wait_for(lock, std::chrono::seconds(10), [this]() {
+      return num_arrived_ >= num_callers_;
+    });
+  }
+
+ private:
+  const int num_callers_;
+  std::mutex mutex_;
+  std::condition_variable all_arrived_;
+  int num_arrived_{0};
+};
+
+// Builds a diagram with two independent chains, source -> gain -> integrator,
+// whose integrators feed a third integrator through another gain.
+std::unique_ptr<Diagram<double>> MakeChains() {
+  DiagramBuilder<double> builder;
+  const auto& integrator_c = *builder.AddSystem<Integrator>(1);
+  for (const double value : {2.0, 3.0}) {
+    const auto& source = *builder.AddSystem<ConstantVectorSource>(value);
+    const auto& gain = *builder.AddSystem<Gain>(10.0, 1);
+    const auto& integrator = *builder.AddSystem<Integrator>(1);
+    builder.Connect(source, gain);
+    builder.Connect(gain, integrator);
+    if (value == 2.0) {
+      const auto& gain_c = *builder.AddSystem<Gain>(-1.0, 1);
+      builder.Connect(integrator, gain_c);
+      builder.Connect(gain_c, integrator_c);
+    }
+  }
+  return builder.Build();
+}
+
+GTEST_TEST(DiagramParallelismTest, SameDerivatives) {
+  auto diagram = MakeChains();
+  EXPECT_EQ(diagram->parallelism().num_threads(), 1);
+  auto context = diagram->CreateDefaultContext();
+  context->SetContinuousState(VectorXd::LinSpaced(3, 1.0, 3.0));
+  const VectorXd expected =
+      diagram->EvalTimeDerivatives(*context).CopyToVector();
+
+  diagram->set_parallelism(Parallelism(3));
+  EXPECT_EQ(diagram->parallelism().num_threads(), 3);
+  context = diagram->CreateDefaultContext();
+  context->SetContinuousState(VectorXd::LinSpaced(3, 1.0, 3.0));
+  EXPECT_TRUE(CompareMatrices(
+      diagram->EvalTimeDerivatives(*context).CopyToVector(), expected));
+
+  // With caching disabled, the evaluation is serial, with the same results.
+  context->SetContinuousState(VectorXd::LinSpaced(3, 1.0, 3.0));
+  context->DisableCaching();
+  EXPECT_TRUE(CompareMatrices(
+      diagram->EvalTimeDerivatives(*context).CopyToVector(), expected));
+
+  // Scalar conversion preserves the parallelism.
+  auto diagram_ad = System<double>::ToAutoDiffXd(*diagram);
+  EXPECT_EQ(diagram_ad->parallelism().num_threads(), 3);
+  auto context_ad = diagram_ad->CreateDefaultContext();
+  context_ad->SetTimeStateAndParametersFrom(*context);
+  EXPECT_TRUE(CompareMatrices(
+      math::DiscardGradient(
+          diagram_ad->EvalTimeDerivatives(*context_ad).CopyToVector()),
+      expected));
+}
+
+// Independent subsystems run concurrently, and an exception thrown by any of
+// them reaches the caller.
+GTEST_TEST(DiagramParallelismTest, Concurrency) {
+  Rendezvous rendezvous(2);
+  std::atomic<int> num_met{0};
+  auto meet = [&]() {
+    if (rendezvous.Arrive()) ++num_met;
+  };
+  bool fail = false;
+  DiagramBuilder<double> builder;
+  for (int i = 0; i < 2; ++i) {
+    const auto& source = *builder.AddSystem<ConstantVectorSource>(1.0);
+    const auto& integrand = *builder.AddSystem<Integrand>([&, i]() {
+      if (fail && i == 1) throw std::runtime_error("bad derivatives");
+      if (!fail) meet();
+    });
+    builder.Connect(source, integrand);
+  }
+  auto diagram = builder.Build();
+  diagram->set_parallelism(Parallelism(2));
+  auto context = diagram->CreateDefaultContext();
+  diagram->EvalTimeDerivatives(*context);
+  EXPECT_EQ(num_met, 2);
+
+  fail = true;
+  context->SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(diagram->EvalTimeDerivatives(*context),
+                              "bad derivatives");
+}
+
+// When several subsystems throw, all of them still run, and the exception of
+// the lowest-indexed one reaches the caller, as it would serially, even when
+// it is thrown last.
+GTEST_TEST(DiagramParallelismTest, SeveralExceptions) {
+  std::atomic<int> num_calls{0};
+  DiagramBuilder<double> builder;
+  for (int i = 0; i < 4; ++i) {
+    const auto& source = *builder.AddSystem<ConstantVectorSource>(1.0);
+    const auto& integrand = *builder.AddSystem<Integrand>([&, i]() {
+      ++num_calls;
+      if (i == 1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        throw std::runtime_error("first failure");
+      }
+      if (i == 3) throw std::runtime_error("second failure");
+    });
+    builder.Connect(source, integrand);
+  }
+  auto diagram = builder.Build();
+  diagram->set_parallelism(Parallelism(4));
+  auto context = diagram->CreateDefaultContext();
+  for (int trial = 0; trial < 5; ++trial) {
+    num_calls = 0;
+    context->SetTime(trial);
+    DRAKE_EXPECT_THROWS_MESSAGE(diagram->EvalTimeDerivatives(*context),
+                                "first failure");
+    EXPECT_EQ(num_calls, 4);
+  }
+}
+
+// A resource that records whether it was ever used concurrently.
+class Resource {
+ public:
+  void Use() {
+    if (++num_users_ > 1) overlapped_ = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    --num_users_;
+  }
+
+  bool overlapped() const { return overlapped_; }
+
+ private:
+  std::atomic<int> num_users_{0};
+  std::atomic<bool> overlapped_{false};
+};
+
+// Refers to a Resource, the way that a geometry::QueryObject refers to its
+// SceneGraph.
+struct ResourceHandle {
+  Resource* resource{};
+};
+
+// Outputs a handle to a Resource.
+class ResourceSource final : public LeafSystem<double> {
+ public:
+  explicit ResourceSource(Resource* resource) : resource_(resource) {
+    DeclareAbstractOutputPort("resource", &ResourceSource::CalcResource);
+  }
+
+ private:
+  void CalcResource(const Context<double>&, ResourceHandle* output) const {
+    output->resource = resource_;
+  }
+
+  Resource* const resource_;
+};
+
+// Uses the Resource on its input port to calculate its derivatives.
+class ResourceUser final : public LeafSystem<double> {
+ public:
+  ResourceUser() {
+    DeclareContinuousState(1);
+    DeclareAbstractInputPort("resource", Value<ResourceHandle>{});
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    get_input_port().Eval<ResourceHandle>(context).resource->Use();
+    derivatives->SetFromVector(VectorXd::Zero(1));
+  }
+};
+
+// Consumers of abstract-valued ports don't run concurrently with the
+// producer, nor with each other.
+GTEST_TEST(DiagramParallelismTest, AbstractValuedPorts) {
+  Resource resource;
+  DiagramBuilder<double> builder;
+  const auto& source = *builder.AddSystem<ResourceSource>(&resource);
+  for (int i = 0; i < 3; ++i) {
+    const auto& user = *builder.AddSystem<ResourceUser>();
+    builder.Connect(source, user);
+  }
+  auto diagram = builder.Build();
+  diagram->set_parallelism(Parallelism(3));
+  auto context = diagram->CreateDefaultContext();
+  diagram->EvalTimeDerivatives(*context);
+  EXPECT_FALSE(resource.overlapped());
+}
+
+// A system with one discrete state, x, that can be updated to u + 1 by
+// either a forced discrete update or a forced unrestricted update, or that
+// reports a failure instead.
+class Updater final : public LeafSystem<double> {
+ public:
+  explicit Updater(const bool* fail) : fail_(fail) {
+    DeclareDiscreteState(1);
+    DeclareVectorInputPort("u", 1);
+    DeclareStateOutputPort("x", DiscreteStateIndex(0));
+    DeclareForcedDiscreteUpdateEvent(&Updater::DiscreteUpdate);
+    DeclareForcedUnrestrictedUpdateEvent(&Updater::UnrestrictedUpdate);
+  }
+
+ private:
+  EventStatus DiscreteUpdate(const Context<double>& context,
+                             DiscreteValues<double>* next) const {
+    if (*fail_) return EventStatus::Failed(this, "no update");
+    next->set_value(get_input_port().Eval(context).array() + 1);
+    return EventStatus::Succeeded();
+  }
+
+  EventStatus UnrestrictedUpdate(const Context<double>& context,
+                                 State<double>* next) const {
+    if (*fail_) return EventStatus::Failed(this, "no update");
+    next->get_mutable_discrete_state().set_value(
+        get_input_port().Eval(context).array() + 1);
+    return EventStatus::Succeeded();
+  }
+
+  const bool* const fail_;
+};
+
+GTEST_TEST(DiagramParallelismTest, Updates) {
+  bool fail = false;
+  DiagramBuilder<double> builder;
+  const auto& source = *builder.AddSystem<ConstantVectorSource>(1.0);
+  const auto& first = *builder.AddNamedSystem<Updater>("first", &fail);
+  const auto& second = *builder.AddNamedSystem<Updater>("second", &fail);
+  builder.Connect(source, first);
+  builder.Connect(first, second);
+  auto diagram = builder.Build();
+  diagram->set_parallelism(Parallelism(2));
+  auto context = diagram->CreateDefaultContext();
+  context->SetDiscreteState(0, Vector1d(5.0));
+  context->SetDiscreteState(1, Vector1d(7.0));
+
+  auto discrete = diagram->AllocateDiscreteVariables();
+  diagram->CalcForcedDiscreteVariableUpdate(*context, discrete.get());
+  EXPECT_EQ(discrete->get_vector(0)[0], 2.0);
+  EXPECT_EQ(discrete->get_vector(1)[0], 6.0);
+
+  auto state = context->CloneState();
+  diagram->CalcForcedUnrestrictedUpdate(*context, state.get());
+  EXPECT_EQ(state->get_discrete_state().get_vector(0)[0], 2.0);
+  EXPECT_EQ(state->get_discrete_state().get_vector(1)[0], 6.0);
+
+  // The failure of the first subsystem is reported, as for serial evaluation.
+  fail = true;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram->CalcForcedDiscreteVariableUpdate(*context, discrete.get()),
+      ".*'::_::first'.*no update.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram->CalcForcedUnrestrictedUpdate(*context, state.get()),
+      ".*'::_::first'.*no update.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
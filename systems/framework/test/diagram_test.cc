@@ -30,6 +30,7 @@ using Eigen::Vector3d;
 using Eigen::Vector4d;
 using Eigen::VectorXd;
 using drake::systems::analysis_test::StatelessSystem;
+using testing::ElementsAre;
 using testing::ElementsAreArray;
 
 namespace drake {
@@ -1338,6 +1339,23 @@ TEST_F(DiagramOfDiagramsTest, DeclaredContextSizes) {
             context_->num_abstract_parameters());
 }
 
+// Setting the defaults of a Diagram of Diagrams doesn't give out mutable access
+// to its abstract state and parameters, so copy-on-write clones share them.
+TEST_F(DiagramOfDiagramsTest, CloneCopyOnWriteSharesDefaults) {
+  diagram_->SetDefaultContext(context_.get());
+  auto clone = context_->CloneCopyOnWrite();
+  ASSERT_GT(context_->num_abstract_states(), 0);
+  for (int i = 0; i < context_->num_abstract_states(); ++i) {
+    EXPECT_EQ(&clone->get_abstract_state().get_value(i),
+              &context_->get_abstract_state().get_value(i));
+  }
+  ASSERT_GT(context_->num_abstract_parameters(), 0);
+  for (int i = 0; i < context_->num_abstract_parameters(); ++i) {
+    EXPECT_EQ(&clone->get_abstract_parameter(i),
+              &context_->get_abstract_parameter(i));
+  }
+}
+
 // ContextSizes for a Diagram must be accumulated recursively. We checked
 // above that a Diagram built using DiagramBuilder counts properly. Diagrams
 // can also be built via scalar conversion. We'll check here that the
@@ -3720,6 +3738,207 @@ GTEST_TEST(MyEventTest, MyEventTestDiagram) {
   EXPECT_EQ(sys[4]->get_per_step_count(), 1);
 }
 
+// A system whose periodic events append their labels to a shared log when
+// handled. Optionally its timing is dynamic, adding a one-time publish event.
+class TimetableTestSystem : public LeafSystem<double> {
+ public:
+  struct Timing {
+    std::string label;
+    double period{};
+    double offset{};
+    bool discrete{};
+  };
+
+  TimetableTestSystem(std::vector<std::string>* log,
+                      const std::vector<Timing>& timings,
+                      std::optional<double> one_time = std::nullopt)
+      : log_(log), one_time_(one_time) {
+    DeclareDiscreteState(1);
+    for (const Timing& timing : timings) {
+      const std::string label = timing.label;
+      if (timing.discrete) {
+        DeclarePeriodicEvent(
+            timing.period, timing.offset,
+            DiscreteUpdateEvent<double>(
+                [log, label](const System<double>&, const Context<double>&,
+                             const DiscreteUpdateEvent<double>&,
+                             DiscreteValues<double>*) {
+                  log->push_back(label);
+                  return EventStatus::Succeeded();
+                }));
+      } else {
+        DeclarePeriodicEvent(
+            timing.period, timing.offset,
+            PublishEvent<double>(
+                [log, label](const System<double>&, const Context<double>&,
+                             const PublishEvent<double>&) {
+                  log->push_back(label);
+                  return EventStatus::Succeeded();
+                }));
+      }
+    }
+    if (!one_time_.has_value()) {
+      DeclareStaticEventTiming();
+    }
+  }
+
+ private:
+  void DoCalcNextUpdateTime(const Context<double>& context,
+                            CompositeEventCollection<double>* events,
+                            double* time) const final {
+    LeafSystem<double>::DoCalcNextUpdateTime(context, events, time);
+    if (!one_time_.has_value() || context.get_time() >= *one_time_ ||
+        *time < *one_time_) {
+      return;
+    }
+    if (*time > *one_time_) {
+      events->Clear();
+    }
+    *time = *one_time_;
+    PublishEvent<double> event(
+        [log = log_](const System<double>&, const Context<double>&,
+                     const PublishEvent<double>&) {
+          log->push_back("once");
+          return EventStatus::Succeeded();
+        });
+    event.AddToComposite(TriggerType::kTimed, events);
+  }
+
+  std::vector<std::string>* const log_;
+  const std::optional<double> one_time_;
+};
+
+// Steps `diagram` from time zero through its next `num_steps` update times,
+// returning the time and the handled events of each step.
+std::vector<std::string> StepThroughUpdates(const Diagram<double>& diagram,
+                                            std::vector<std::string>* log,
+                                            int num_steps) {
+  auto context = diagram.CreateDefaultContext();
+  auto events = diagram.AllocateCompositeEventCollection();
+  auto discrete = diagram.AllocateDiscreteVariables();
+  std::vector<std::string> result;
+  for (int i = 0; i < num_steps; ++i) {
+    const double time = diagram.CalcNextUpdateTime(*context, events.get());
+    context->SetTime(time);
+    log->clear();
+    diagram.Publish(*context, events->get_publish_events());
+    diagram.CalcDiscreteVariableUpdate(
+        *context, events->get_discrete_update_events(), discrete.get());
+    std::string step = fmt::format("{}:", time);
+    for (const std::string& label : *log) {
+      step += " " + label;
+    }
+    result.push_back(step);
+  }
+  return result;
+}
+
+// The Diagram schedules the periodic events of its leaf subsystems from its
+// timetable, and queries the subsystems with dynamic event timing (including
+// child Diagrams). Simultaneous events of one subsystem from different groups
+// of the timetable are collected in their declaration order.
+GTEST_TEST(PeriodicEventTimetableTest, MatchesLeafSystems) {
+  std::vector<std::string> log;
+  DiagramBuilder<double> builder;
+  builder.AddNamedSystem<TimetableTestSystem>(
+      "b", &log,
+      std::vector<TimetableTestSystem::Timing>{{"b0", 0.5, 0.0},
+                                               {"b1", 0.25, 0.125}});
+  // The (0.5, 0) events of "a" are in the timetable group first created by
+  // "b", so they are in a different order in the timetable than in the
+  // declarations of "a".
+  builder.AddNamedSystem<TimetableTestSystem>(
+      "a", &log,
+      std::vector<TimetableTestSystem::Timing>{{"a0", 0.25, 0.0},
+                                               {"a1", 0.5, 0.0},
+                                               {"a2", 0.5, 0.0, true}});
+  DiagramBuilder<double> child_builder;
+  child_builder.AddNamedSystem<TimetableTestSystem>(
+      "e", &log, std::vector<TimetableTestSystem::Timing>{{"e0", 0.25, 0.0}});
+  builder.AddSystem(child_builder.Build());
+  builder.AddNamedSystem<TimetableTestSystem>(
+      "c", &log, std::vector<TimetableTestSystem::Timing>{{"c0", 0.75, 0.0}},
+      0.375);
+  const auto diagram = builder.Build();
+
+  EXPECT_THAT(StepThroughUpdates(*diagram, &log, 6),
+              ElementsAre("0.125: b1", "0.25: a0 e0", "0.375: b1 once",
+                          "0.5: b0 a0 a1 e0 a2", "0.625: b1",
+                          "0.75: a0 e0 c0"));
+}
+
+// A subsystem that overrides DoCalcNextUpdateTime() without declaring static
+// event timing is queried by the Diagram, as it always was.
+GTEST_TEST(PeriodicEventTimetableTest, DynamicTimingByDefault) {
+  class Dynamic final : public LeafSystem<double> {
+   private:
+    void DoCalcNextUpdateTime(const Context<double>& context,
+                              CompositeEventCollection<double>* events,
+                              double* time) const final {
+      *time = 1.0;
+      PublishEvent<double>().AddToComposite(TriggerType::kTimed, events);
+    }
+  };
+  DiagramBuilder<double> builder;
+  builder.AddNamedSystem<Dynamic>("dynamic");
+  const auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  auto events = diagram->AllocateCompositeEventCollection();
+  EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()), 1.0);
+  EXPECT_TRUE(events->HasPublishEvents());
+}
+
+// A Diagram's event timing is static when that of every subsystem is,
+// including the subsystems of its child Diagrams.
+GTEST_TEST(PeriodicEventTimetableTest, StaticTimingOfDiagram) {
+  std::vector<std::string> log;
+  auto build = [&log](std::optional<double> child_one_time) {
+    DiagramBuilder<double> child_builder;
+    child_builder.AddNamedSystem<TimetableTestSystem>(
+        "e", &log, std::vector<TimetableTestSystem::Timing>{{"e0", 0.25, 0.0}},
+        child_one_time);
+    DiagramBuilder<double> builder;
+    builder.AddNamedSystem<TimetableTestSystem>(
+        "a", &log, std::vector<TimetableTestSystem::Timing>{{"a0", 0.5, 0.0}});
+    builder.AddSystem(child_builder.Build());
+    return builder.Build();
+  };
+  EXPECT_TRUE(build(std::nullopt)->has_static_event_timing());
+  EXPECT_FALSE(build(0.375)->has_static_event_timing());
+}
+
+// A subsystem that declares static event timing but overrides
+// DoCalcNextUpdateTime() is detected in Debug builds.
+GTEST_TEST(PeriodicEventTimetableTest, MisdeclaredStaticTiming) {
+  class Misdeclared final : public LeafSystem<double> {
+   public:
+    Misdeclared() { DeclareStaticEventTiming(); }
+
+   private:
+    void DoCalcNextUpdateTime(const Context<double>& context,
+                              CompositeEventCollection<double>* events,
+                              double* time) const final {
+      *time = 1.0;
+      PublishEvent<double>().AddToComposite(TriggerType::kTimed, events);
+    }
+  };
+  DiagramBuilder<double> builder;
+  builder.AddNamedSystem<Misdeclared>("misdeclared");
+  const auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  auto events = diagram->AllocateCompositeEventCollection();
+  if (kDrakeAssertIsArmed) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        diagram->CalcNextUpdateTime(*context, events.get()),
+        ".*Misdeclared system '::_::misdeclared' returned the next update "
+        "time 1 but its periodic events are next at inf.*"
+        "DeclareStaticEventTiming.*");
+  } else {
+    EXPECT_EQ(diagram->CalcNextUpdateTime(*context, events.get()),
+              std::numeric_limits<double>::infinity());
+  }
+}
+
 template <typename T>
 class ConstraintTestSystem : public LeafSystem<T> {
  public:
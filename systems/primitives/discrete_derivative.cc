@@ -36,6 +36,7 @@ DiscreteDerivative<T>::DiscreteDerivative(int num_inputs, double time_step,
       time_step_, 0.0, &DiscreteDerivative<T>::CalcDiscreteUpdate);
   this->DeclareForcedDiscreteUpdateEvent(
       &DiscreteDerivative<T>::CalcDiscreteUpdate);
+  this->DeclareStaticEventTiming();
 }
 
 template <typename T>
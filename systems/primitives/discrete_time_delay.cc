@@ -53,6 +53,7 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
     this->DeclarePeriodicUnrestrictedUpdateEvent(
         update_sec_, 0., &DiscreteTimeDelay::SaveInputAbstractValueToBuffer);
   }
+  this->DeclareStaticEventTiming();
 }
 
 template <typename T>
@@ -1,7 +1,9 @@
 #include "drake/systems/primitives/symbolic_vector_system.h"
 
 #include <algorithm>
+#include <exception>
 #include <optional>
+#include <vector>
 
 #include "drake/math/autodiff_gradient.h"
 
@@ -11,6 +13,7 @@ namespace systems {
 using Eigen::Ref;
 using symbolic::Environment;
 using symbolic::Expression;
+using symbolic::ExpressionTape;
 using symbolic::Jacobian;
 using symbolic::Substitution;
 using symbolic::Variable;
@@ -43,6 +46,28 @@ bool Includes(const Ref<const VectorX<Variable>>& variables,
   return false;
 }
 
+// Compiles @p expr, followed by the rows of @p jacobian, over @p variables.
+// Returns nullopt if there are no expressions, or if they can't be compiled
+// (in which case they are left to Expression::Evaluate()).
+std::optional<ExpressionTape> MaybeCompile(
+    const std::vector<Variable>& variables, const VectorX<Expression>& expr,
+    const MatrixX<Expression>& jacobian) {
+  if (expr.size() == 0) {
+    return std::nullopt;
+  }
+  VectorX<Expression> all(expr.size() + jacobian.size());
+  all.head(expr.size()) = expr;
+  for (int i = 0; i < jacobian.rows(); ++i) {
+    all.segment(expr.size() + i * jacobian.cols(), jacobian.cols()) =
+        jacobian.row(i).transpose();
+  }
+  try {
+    return ExpressionTape(variables, all);
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
 }  // namespace
 
 SymbolicVectorSystemBuilder SymbolicVectorSystemBuilder::LinearizeDynamics(
@@ -157,6 +182,13 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
     }
   }
 
+  // Compile the expressions iff T != Expression.
+  variables_.assign(vars_vec.data(), vars_vec.data() + vars_vec.size());
+  if constexpr (!std::is_same_v<T, Expression>) {
+    dynamics_tape_ = MaybeCompile(variables_, dynamics_, dynamics_jacobian_);
+    output_tape_ = MaybeCompile(variables_, output_, output_jacobian_);
+  }
+
   // Allocate a symbolic::Environment once to be cloned/reused below.
   for (const auto& v : all_vars) {
     env_.insert(v, 0.0);
@@ -214,15 +246,57 @@ void SymbolicVectorSystem<T>::PopulateFromContext(const Context<T>& context,
   }
 }
 
+template <typename T>
+VectorX<T> SymbolicVectorSystem<T>::CopyVariablesFromContext(
+    const Context<T>& context, bool needs_inputs) const {
+  const int num_states = state_vars_.size();
+  const int num_inputs = input_vars_.size();
+  const int num_parameters = parameter_vars_.size();
+  VectorX<T> values = VectorX<T>::Zero(variables_.size());
+  if (num_states > 0) {
+    const VectorBase<T>& state = (time_period_ > 0.0)
+                                     ? context.get_discrete_state_vector()
+                                     : context.get_continuous_state_vector();
+    for (int i = 0; i < num_states; ++i) {
+      values[i] = state[i];
+    }
+  }
+  // As in PopulateFromContext(), the inputs are evaluated only if needed.
+  if (num_inputs > 0 && needs_inputs) {
+    values.segment(num_states, num_inputs) =
+        this->get_input_port().Eval(context);
+  }
+  if (num_parameters > 0) {
+    values.segment(num_states + num_inputs, num_parameters) =
+        context.get_numeric_parameter(0).value();
+  }
+  if (time_var_) {
+    values[values.size() - 1] = context.get_time();
+  }
+  return values;
+}
+
 // TODO(eric.cousineau): Consider decoupling output from `VectorBase` and use
 // `EigenPtr` or something.
 
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<ExpressionTape>& tape, bool needs_inputs,
     VectorBase<double>* out) const {
   unused(jacobian);
+  if (tape) {
+    Eigen::VectorXd result(out->size());
+    tape->Evaluate(CopyVariablesFromContext(context, needs_inputs), &result);
+    // A non-finite result may come from an operation that the interpreter
+    // rejects (e.g., a division by zero); we evaluate those once more below so
+    // that it can throw.
+    if (result.allFinite()) {
+      out->SetFromVector(result);
+      return;
+    }
+  }
   Environment env = env_;
   PopulateFromContext(context, needs_inputs, &env);
   for (int i = 0; i < out->size(); i++) {
@@ -233,89 +307,46 @@ void SymbolicVectorSystem<double>::EvaluateWithContext(
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<ExpressionTape>& tape, bool needs_inputs,
     VectorBase<AutoDiffXd>* pout) const {
   VectorBase<AutoDiffXd>& out = *pout;
 
-  const BasicVector<AutoDiffXd> empty(0);
-  const AutoDiffXd& time = context.get_time();
-  const VectorBase<AutoDiffXd>& state =
-      (state_vars_.size() > 0)
-          ? ((time_period_ > 0.0) ? context.get_discrete_state_vector()
-                                  : context.get_continuous_state_vector())
-          : empty;
   // It is very important we don't evaluate the inputs if the expression doesn't
   // actually depend on it (as declared by the needs_inputs parameter). This
-  // avoids introducing spurious algebraic loops. In this case, `needs_inputs`
-  // is sufficient to know that there are input variables; we don't need to
-  // test the size of input_vars_.
-  const BasicVector<AutoDiffXd>& input =
-      needs_inputs ? get_input_port().Eval<BasicVector<AutoDiffXd>>(context)
-                   : empty;
-
-  const BasicVector<AutoDiffXd>& parameter =
-      (parameter_vars_.size() > 0) ? context.get_numeric_parameter(0) : empty;
-
-  // Figure out the length of the derivative vector.  The derivatives must all
-  // have size zero or the same non-zero size.
-  int num_gradients = time.derivatives().size();
-  auto set_num_gradients =
-      [&num_gradients](const VectorBase<AutoDiffXd>& vars) {
-        for (int i = 0; i < vars.size(); i++) {
-          if (vars[i].derivatives().size()) {
-            if (num_gradients == 0) {
-              num_gradients = static_cast<int>(vars[i].derivatives().size());
-            } else {
-              DRAKE_DEMAND(static_cast<int>(vars[i].derivatives().size()) ==
-                           num_gradients);
-            }
-          }
-        }
-      };
-  set_num_gradients(state);
-  if (needs_inputs) {
-    set_num_gradients(input);
-  }
-  set_num_gradients(parameter);
-
-  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(jacobian.cols(), num_gradients);
-  Environment env = env_;
-  if (time_var_) {
-    env[*time_var_] = time.value();
-    if (time.derivatives().size()) {
-      dvars.bottomRows<1>() = time.derivatives();
-    }
-  }
-  size_t dvars_row_idx = 0;
-  for (int i = 0; i < state_vars_.size(); i++, dvars_row_idx++) {
-    env[state_vars_[i]] = state[i].value();
-    if (state[i].derivatives().size()) {
-      dvars.row(dvars_row_idx) = state[i].derivatives();
-    }
-  }
-  if (needs_inputs) {
-    for (int i = 0; i < input_vars_.size(); i++, dvars_row_idx++) {
-      env[input_vars_[i]] = input[i].value();
-      if (input[i].derivatives().size()) {
-        dvars.row(dvars_row_idx) = input[i].derivatives();
+  // avoids introducing spurious algebraic loops.
+  const VectorX<AutoDiffXd> variables =
+      CopyVariablesFromContext(context, needs_inputs);
+  const Eigen::VectorXd values = math::DiscardGradient(variables);
+  // The derivatives must all have size zero or the same non-zero size.
+  const Eigen::MatrixXd dvars = math::ExtractGradient(variables);
+  const int num_vars = jacobian.cols();
+
+  // Now actually compute the output values and derivatives.
+  if (tape) {
+    // The tape holds the values, followed by the rows of the Jacobian.
+    Eigen::VectorXd result(tape->num_outputs());
+    tape->Evaluate(values, &result);
+    // As for T = double, non-finite results are evaluated once more below.
+    if (result.allFinite()) {
+      for (int i = 0; i < out.size(); i++) {
+        out[i].value() = result[i];
+        out[i].derivatives() =
+            dvars.transpose() *
+            result.segment(out.size() + i * num_vars, num_vars);
       }
+      return;
     }
-  } else {
-    dvars_row_idx += input_vars_.size();
   }
-  for (int i = 0; i < parameter_vars_.size(); i++, dvars_row_idx++) {
-    env[parameter_vars_[i]] = parameter[i].value();
-    if (parameter[i].derivatives().size()) {
-      dvars.row(dvars_row_idx) = parameter[i].derivatives();
-    }
+  Environment env = env_;
+  for (int j = 0; j < num_vars; j++) {
+    env[variables_[j]] = values[j];
   }
-
-  // Now actually compute the output values and derivatives.
-  Eigen::RowVectorXd dout_dvars(jacobian.cols());
+  Eigen::RowVectorXd dout_dvars(num_vars);
   for (int i = 0; i < out.size(); i++) {
     out[i].value() = expr[i].Evaluate(env);
 
-    for (int j = 0; j < jacobian.cols(); j++) {
+    for (int j = 0; j < num_vars; j++) {
       dout_dvars(j) = jacobian(i, j).Evaluate(env);
     }
     out[i].derivatives() = dout_dvars * dvars;
@@ -325,9 +356,10 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
 template <>
 void SymbolicVectorSystem<Expression>::EvaluateWithContext(
     const Context<Expression>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<ExpressionTape>& tape, bool needs_inputs,
     VectorBase<Expression>* out) const {
-  unused(jacobian);
+  unused(jacobian, tape);
   Substitution s;
   PopulateFromContext(context, needs_inputs, &s);
   for (int i = 0; i < out->size(); i++) {
@@ -339,8 +371,8 @@ template <typename T>
 void SymbolicVectorSystem<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* output_vector) const {
   DRAKE_DEMAND(output_.size() > 0);
-  EvaluateWithContext(context, output_, output_jacobian_, output_needs_inputs_,
-                      output_vector);
+  EvaluateWithContext(context, output_, output_jacobian_, output_tape_,
+                      output_needs_inputs_, output_vector);
 }
 
 template <typename T>
@@ -348,7 +380,7 @@ void SymbolicVectorSystem<T>::DoCalcTimeDerivatives(
     const Context<T>& context, ContinuousState<T>* derivatives) const {
   DRAKE_DEMAND(time_period_ == 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_jacobian_, dynamics_tape_,
                       dynamics_needs_inputs_,
                       &derivatives->get_mutable_vector());
 }
@@ -359,7 +391,7 @@ EventStatus SymbolicVectorSystem<T>::CalcDiscreteUpdate(
     drake::systems::DiscreteValues<T>* updates) const {
   DRAKE_DEMAND(time_period_ > 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_jacobian_, dynamics_tape_,
                       dynamics_needs_inputs_, &updates->get_mutable_vector());
   return EventStatus::Succeeded();
 }
@@ -10,6 +10,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic/expression.h"
+#include "drake/common/symbolic/expression_tape.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -32,6 +33,16 @@ namespace systems {
 ///                                              .Build();
 /// @endcode
 ///
+/// For T = double and T = AutoDiffXd, the dynamics and the output are compiled
+/// at construction into a symbolic::ExpressionTape (together with their
+/// Jacobian matrices for AutoDiffXd), which evaluates them without walking the
+/// expression trees; expressions that can't be compiled (e.g., those with an
+/// if-then-else) are evaluated by symbolic::Expression::Evaluate() instead.
+/// When a compiled evaluation produces an infinity or a NaN, the expressions
+/// are evaluated once more by symbolic::Expression::Evaluate(), so that a
+/// division by zero, or a function evaluated outside of its domain (e.g., the
+/// log of a negative number), throws just as it does without compilation.
+///
 /// Note: This will not be as performant as writing your own LeafSystem.
 /// It is meant primarily for rapid prototyping.
 ///
@@ -184,10 +195,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   void PopulateFromContext(const Context<T>& context, bool needs_inputs,
                            Container* penv) const;
 
+  // Returns the values of variables_ in the context. The inputs are zero
+  // unless needs_inputs is true.
+  VectorX<T> CopyVariablesFromContext(const Context<T>& context,
+                                      bool needs_inputs) const;
+
   // Evaluate context to a vector.
   void EvaluateWithContext(const Context<T>& context,
                            const VectorX<symbolic::Expression>& expr,
                            const MatrixX<symbolic::Expression>& jacobian,
+                           const std::optional<symbolic::ExpressionTape>& tape,
                            bool needs_inputs, VectorBase<T>* out) const;
 
   void CalcOutput(const Context<T>& context,
@@ -218,6 +235,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   MatrixX<symbolic::Expression> dynamics_jacobian_{};
   MatrixX<symbolic::Expression> output_jacobian_{};
 
+  // The state, input, parameter, and time variables, in the order of the
+  // columns of the Jacobians and of the parameters of the tapes.
+  std::vector<symbolic::Variable> variables_;
+
+  // The dynamics and the output compiled over variables_, followed (iff T ==
+  // AutoDiffXd) by the rows of their Jacobians. Each is empty if T ==
+  // symbolic::Expression or if the expressions can't be compiled.
+  std::optional<symbolic::ExpressionTape> dynamics_tape_;
+  std::optional<symbolic::ExpressionTape> output_tape_;
+
   template <typename U>
   friend class SymbolicVectorSystem;
 };
@@ -427,21 +454,24 @@ class SymbolicVectorSystemBuilder {
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<symbolic::ExpressionTape>& tape, bool needs_inputs,
     VectorBase<double>* out) const;
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<symbolic::ExpressionTape>& tape, bool needs_inputs,
     VectorBase<AutoDiffXd>* out) const;
 
 template <>
 void SymbolicVectorSystem<symbolic::Expression>::EvaluateWithContext(
     const Context<symbolic::Expression>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const MatrixX<symbolic::Expression>& jacobian,
+    const std::optional<symbolic::ExpressionTape>& tape, bool needs_inputs,
     VectorBase<symbolic::Expression>* out) const;
 #endif
 
@@ -1,6 +1,7 @@
 #include "drake/systems/primitives/symbolic_vector_system.h"
 
 #include <memory>
+#include <stdexcept>
 
 #include <gtest/gtest.h>
 
@@ -417,6 +418,78 @@ TEST_F(SymbolicVectorSystemTest, IntegratorNoFeedthrough) {
   EXPECT_FALSE(system->HasDirectFeedthrough(0, 0));
 }
 
+// The dynamics and the output, which are compiled for T = double, match their
+// evaluation by Expression::Evaluate().
+TEST_F(SymbolicVectorSystemTest, CompiledEvaluation) {
+  const Expression s = sin(x_[0] * x_[1]);
+  const Vector2<Expression> dynamics(
+      s * p_[0] - pow(x_[1], 3) + u_[0], s / (1 + t_ * t_) + exp(-p_[1]));
+  const Vector2<Expression> output(sqrt(x_[0] * x_[0] + u_[1]), cos(s));
+  auto system = SymbolicVectorSystemBuilder()
+                    .time(t_)
+                    .state(x_)
+                    .input(u_)
+                    .parameter(p_)
+                    .dynamics(dynamics)
+                    .output(output)
+                    .Build();
+
+  auto context = system->CreateDefaultContext();
+  context->SetTime(0.7);
+  context->SetContinuousState(Vector2d{0.45, -1.3});
+  system->get_input_port().FixValue(context.get(), Vector2d{0.2, 1.5});
+  context->get_mutable_numeric_parameter(0).SetFromVector(Vector2d{2.0, 0.3});
+  const Environment env{{t_, 0.7},   {x_[0], 0.45}, {x_[1], -1.3},
+                        {u_[0], 0.2}, {u_[1], 1.5},  {p_[0], 2.0},
+                        {p_[1], 0.3}};
+
+  EXPECT_TRUE(CompareMatrices(
+      system->EvalTimeDerivatives(*context).CopyToVector(),
+      Vector2d{dynamics[0].Evaluate(env), dynamics[1].Evaluate(env)}, 1e-15));
+  EXPECT_TRUE(CompareMatrices(
+      system->get_output_port().Eval(*context),
+      Vector2d{output[0].Evaluate(env), output[1].Evaluate(env)}, 1e-15));
+}
+
+// Expressions that can't be compiled are still evaluated.
+TEST_F(SymbolicVectorSystemTest, UncompiledEvaluation) {
+  const Variable& x{x_[0]};
+  auto system = SymbolicVectorSystemBuilder()
+                    .state(x)
+                    .dynamics(-x)
+                    .output(if_then_else(x > 0, x, 2 * x))
+                    .Build();
+  auto context = system->CreateDefaultContext();
+  context->SetContinuousState(Vector1d{-0.5});
+  EXPECT_EQ(system->get_output_port().Eval(*context)[0], -1.0);
+  EXPECT_EQ(system->EvalTimeDerivatives(*context)[0], 0.5);
+}
+
+// Compiled expressions throw where Expression::Evaluate() does, for both
+// T = double and T = AutoDiffXd.
+TEST_F(SymbolicVectorSystemTest, CompiledEvaluationErrors) {
+  const Variable& x{x_[0]};
+  auto system = SymbolicVectorSystemBuilder()
+                    .state(x)
+                    .dynamics(1 / x)
+                    .output(log(x))
+                    .Build();
+  auto context = system->CreateDefaultContext();
+  context->SetContinuousState(Vector1d{-1.0});
+  EXPECT_NO_THROW(system->EvalTimeDerivatives(*context));
+  EXPECT_THROW(system->get_output_port().Eval(*context), std::domain_error);
+  context->SetContinuousState(Vector1d{0.0});
+  EXPECT_THROW(system->EvalTimeDerivatives(*context), std::runtime_error);
+
+  auto autodiff_system = system->ToAutoDiffXd();
+  auto autodiff_context = autodiff_system->CreateDefaultContext();
+  autodiff_context->SetContinuousState(
+      math::InitializeAutoDiff(Vector1d{-1.0}));
+  EXPECT_NO_THROW(autodiff_system->EvalTimeDerivatives(*autodiff_context));
+  EXPECT_THROW(autodiff_system->get_output_port().Eval(*autodiff_context),
+               std::domain_error);
+}
+
 TEST_F(SymbolicVectorSystemTest, ContinuousTimeSymbolic) {
   auto system = SymbolicVectorSystemBuilder()
                     .time(t_)
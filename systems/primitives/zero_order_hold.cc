@@ -35,6 +35,7 @@ ZeroOrderHold<T>::ZeroOrderHold(
         &ZeroOrderHold::LatchInputAbstractValueToState);
     this->DeclareStateOutputPort("y", state_index);
   }
+  this->DeclareStaticEventTiming();
 }
 
 template <typename T>
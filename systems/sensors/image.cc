@@ -22,7 +22,7 @@ void ConvertDepthPixelwise(const InputImage& input, OutputImage* output,
     return;
   }
   const typename InputImage::T* const in = input.at(0, 0);
-  typename OutputImage::T* const out = output->at(0, 0);
+  typename OutputImage::T* const out = output->mutable_data();
   for (int i = 0; i < size; ++i) {
     out[i] = func(in[i]);
   }
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
-#include "drake/common/drake_copyable.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/systems/sensors/pixel_types.h"
@@ -63,6 +65,22 @@ using ImageAny = std::variant<
 ///
 /// The origin of image coordinate system is on the left-upper corner.
 ///
+/// Copying an image is cheap: the copy shares the (reference-counted) pixel
+/// memory of the original until either of them is mutated via mutable_data(),
+/// the non-const at(), or resize(), at which point the mutated image first
+/// takes its own copy of the pixels (i.e., the pixels are copy-on-write). In
+/// particular, images passed from port to port, held in state, or cloned
+/// along with a Context are not copied pixel by pixel. Images that share
+/// pixels may be read (and copied) by different threads at the same time.
+///
+/// A pointer returned by mutable_data() or the non-const at() may be used to
+/// write pixels until the image is next copied, resized, assigned to, moved
+/// from, or destroyed. In particular, once the image has been copied, writing
+/// through an earlier pointer would also change the copy; call mutable_data()
+/// again instead. A pointer returned by the const at() may be used to read
+/// pixels until the image is next mutated, resized, assigned to, moved from,
+/// or destroyed.
+///
 /// @tparam kPixelType The pixel type enum that denotes the pixel format and the
 /// data type of a channel.
 /// TODO(zachfang): move most of the function definitions in this class to the
@@ -70,7 +88,51 @@ using ImageAny = std::variant<
 template <PixelType kPixelType>
 class Image {
  public:
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Image)
+  /// Makes a copy of `other`, which shares its pixels (see the class
+  /// overview).
+  Image(const Image& other)
+      : width_(other.width_), height_(other.height_), data_(other.data_) {
+    if (data_ == nullptr) {
+      return;
+    }
+    if (data_->num_views > 0) {
+      // Pixels that are viewed outside of `other` (see MakeDataView()) are
+      // written without unsharing them, so they can't be shared.
+      data_ = std::make_shared<Pixels>(data_->values);
+    } else {
+      other.writable_.store(nullptr, std::memory_order_relaxed);
+    }
+  }
+
+  /// Makes this image a copy of `other`, which shares its pixels (see the
+  /// class overview).
+  Image& operator=(const Image& other) {
+    if (this != &other) {
+      *this = Image(other);
+    }
+    return *this;
+  }
+
+  /// Moves the pixels of `other` into a new image, leaving `other` empty.
+  Image(Image&& other) noexcept
+      : width_(std::move(other.width_)),
+        height_(std::move(other.height_)),
+        data_(std::move(other.data_)),
+        writable_(other.writable_.exchange(nullptr,
+                                           std::memory_order_relaxed)) {}
+
+  /// Moves the pixels of `other` into this image, leaving `other` empty.
+  Image& operator=(Image&& other) noexcept {
+    if (this != &other) {
+      width_ = std::move(other.width_);
+      height_ = std::move(other.height_);
+      data_ = std::move(other.data_);
+      writable_.store(
+          other.writable_.exchange(nullptr, std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    return *this;
+  }
 
   /// This is used by generic helpers such as drake::Value to deduce a non-type
   /// template argument.
@@ -105,11 +167,13 @@ class Image {
   /// width, height and an initial value for all the channels in all the pixels.
   /// The width and height can be either both zero or both strictly positive.
   Image(int width, int height, T initial_value)
-      : width_(width),
-        height_(height),
-        data_(width * height * kNumChannels, initial_value) {
+      : width_(width), height_(height) {
     DRAKE_THROW_UNLESS((width >= 0) && (height >= 0));
     DRAKE_THROW_UNLESS((width == 0) == (height == 0));
+    if (width > 0) {
+      data_ = std::make_shared<Pixels>(
+          std::vector<T>(width * height * kNumChannels, initial_value));
+    }
   }
 
   /// Returns the size of width for the image
@@ -128,8 +192,18 @@ class Image {
   void resize(int width, int height) {
     DRAKE_THROW_UNLESS((width >= 0) && (height >= 0));
     DRAKE_THROW_UNLESS((width == 0) == (height == 0));
-    data_.resize(width * height * kNumChannels);
-    std::fill(data_.begin(), data_.end(), 0);
+    const int new_size = width * height * kNumChannels;
+    writable_.store(nullptr, std::memory_order_relaxed);
+    if (data_ != nullptr && data_.use_count() == 1) {
+      data_->values.resize(new_size);
+      std::fill(data_->values.begin(), data_->values.end(), 0);
+    } else if (new_size > 0) {
+      // Leave any shared (or viewed) pixels to the images (or views) that
+      // share them.
+      data_ = std::make_shared<Pixels>(std::vector<T>(new_size, 0));
+    } else {
+      data_.reset();
+    }
     width_ = width;
     height_ = height;
   }
@@ -144,10 +218,14 @@ class Image {
   /// uint8_t green = image.at(x, y)[1];
   /// uint8_t blue  = image.at(x, y)[2];
   /// uint8_t alpha = image.at(x, y)[3];
+  ///
+  /// If this image shares its pixels with copies of it, it first takes its own
+  /// copy of them. See the class overview for how long the returned pointer
+  /// remains valid.
   T* at(int x, int y) {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    return mutable_data() + (x + y * width_) * kNumChannels;
   }
 
   /// Const version of at() method.  See the document for the non-const version
@@ -155,19 +233,96 @@ class Image {
   const T* at(int x, int y) const {
     DRAKE_ASSERT(x >= 0 && x < width_);
     DRAKE_ASSERT(y >= 0 && y < height_);
-    return data_.data() + (x + y * width_) * kNumChannels;
+    return pixels() + (x + y * width_) * kNumChannels;
+  }
+
+  /// Returns a pointer to the first channel of the first pixel, for writing
+  /// the pixels in bulk; the pixels are stored row by row, and the channels of
+  /// each pixel are contiguous. Returns nullptr if the image is empty. If this
+  /// image shares its pixels with copies of it, it first takes its own copy of
+  /// them. See the class overview for how long the returned pointer remains
+  /// valid.
+  T* mutable_data() {
+    // Only the first call after the image was last copied (or resized, etc.)
+    // checks whether the pixels are shared, so that writing pixel by pixel via
+    // at() doesn't touch their reference count.
+    T* writable = writable_.load(std::memory_order_relaxed);
+    if (writable == nullptr && data_ != nullptr) {
+      if (data_.use_count() - data_->num_views > 1) {
+        data_ = std::make_shared<Pixels>(data_->values);
+      }
+      writable = data_->values.data();
+      writable_.store(writable, std::memory_order_relaxed);
+    }
+    return writable;
+  }
+
+  /// (Advanced) Returns a shared pointer to the pixels, as for mutable_data(),
+  /// which keeps them alive even after this image is resized, assigned to, or
+  /// destroyed. This is intended for views of the pixels that may outlive the
+  /// image (e.g., NumPy arrays in Python). While such a pointer exists, this
+  /// image writes its pixels in place (until it is resized or assigned to),
+  /// and copies of this image take their own copy of the pixels instead of
+  /// sharing them, so that the view always reflects the pixels of this image
+  /// only. Returns nullptr if the image is empty.
+  std::shared_ptr<T> MakeDataView() {
+    T* const data = mutable_data();
+    if (data == nullptr) {
+      return nullptr;
+    }
+    ++data_->num_views;
+    return std::shared_ptr<T>(data, [pixels = data_](T*) {
+      --pixels->num_views;
+    });
+  }
+
+  /// Returns true iff this image and `other` share the same pixel memory,
+  /// i.e., one is a copy of the other and neither has been mutated since.
+  bool SharesPixelsWith(const Image& other) const {
+    return data_ != nullptr && data_ == other.data_;
+  }
+
+  /// Returns true iff this image shares its pixels with another image, so that
+  /// writing them would first copy them (see the class overview). While other
+  /// threads copy or destroy images that share these pixels, the result may
+  /// be out of date by the time it is returned.
+  bool SharesPixels() const {
+    return data_ != nullptr && data_.use_count() - data_->num_views > 1;
   }
 
   /// Compares whether two images are exactly the same.
   bool operator==(const Image& other) const {
     return width_ == other.width_ && height_ == other.height_ &&
-           data_ == other.data_;
+           (data_ == other.data_ || size() == 0 ||
+            data_->values == other.data_->values);
   }
 
  private:
+  // The pixel values, along with the number of pointers returned by
+  // MakeDataView() that are still alive. Each such pointer also holds a
+  // reference to this.
+  struct Pixels {
+    explicit Pixels(std::vector<T> values_in) : values(std::move(values_in)) {}
+
+    std::vector<T> values;
+    std::atomic<int> num_views{0};
+  };
+
+  const T* pixels() const {
+    return data_ != nullptr ? data_->values.data() : nullptr;
+  }
+
   reset_after_move<int> width_;
   reset_after_move<int> height_;
-  std::vector<T> data_;
+  // The pixels, which are shared among copies of this image (see the class
+  // overview). This is null when the image is empty.
+  std::shared_ptr<Pixels> data_;
+  // The pixels, once mutable_data() has found that they aren't shared, until
+  // the image is next copied, resized, or assigned to; otherwise, null. This
+  // is atomic only because copying the image (which may happen on several
+  // threads at once) clears it; relaxed accesses cost the same as accessing
+  // a plain pointer.
+  mutable std::atomic<T*> writable_{nullptr};
 };
 
 /// Converts a single channel 32-bit float depth image with depths in meters to
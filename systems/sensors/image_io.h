@@ -176,6 +176,13 @@ class ImageIo {
     SaveImpl(&image, format, buffer);
   }
 
+  /** (Advanced) Sets the zlib compression level used when saving PNG images,
+  from 0 (no compression) to 9 (smallest files). Lower levels encode faster at
+  the cost of larger files; the images remain lossless. When never set, VTK's
+  default level is used.
+  @throws std::exception if `level` is not in [0, 9]. */
+  void SetPngCompressionLevel(int level);
+
  private:
   // ImageAnyConstPtr is like ImageAny but with `const Image<kPixelType>*`
   // passed by const pointer instead of a `Image<kPixelType>` (by value).
@@ -223,6 +230,8 @@ class ImageIo {
   // TODO(jwnimmer-tri) Expose this so that Drake-internal callers can customize
   // their error handling.
   drake::internal::DiagnosticPolicy diagnostic_;
+
+  std::optional<int> png_compression_level_;
 };
 
 }  // namespace sensors
@@ -207,7 +207,7 @@ void CopyVtkToDrakeImage(const LoaderTools& tools, Image<kPixelType>* image) {
   const int width = metadata.width;
   const int height = metadata.height;
   image->resize(width, height);
-  T* dest = image->at(0, 0);
+  T* dest = image->mutable_data();
   if constexpr (sizeof(T) > 1) {
     DRAKE_DEMAND(!add_alpha);
     DRAKE_DEMAND(!drop_alpha);
@@ -8,6 +8,7 @@
 #include <vtkImageData.h>     // vtkCommonDataModel
 #include <vtkImageWriter.h>   // vtkIOImage
 #include <vtkNew.h>           // vtkCommonCore
+#include <vtkPNGWriter.h>     // vtkIOImage
 #include <vtkSmartPointer.h>  // vtkCommonCore
 
 #include "drake/systems/sensors/image_io_internal.h"
@@ -43,6 +44,16 @@ void CopyImage(const Image<kPixelType>& source_image,
 
 }  // namespace
 
+void ImageIo::SetPngCompressionLevel(int level) {
+  if (level < 0 || level > 9) {
+    throw std::logic_error(fmt::format(
+        "ImageIo::SetPngCompressionLevel(): the level must be in [0, 9]; "
+        "given {}",
+        level));
+  }
+  png_compression_level_ = level;
+}
+
 void ImageIo::SaveImpl(ImageAnyConstPtr image_any,
                        std::optional<ImageFileFormat> format,
                        OutputAny output_any) const {
@@ -72,6 +83,11 @@ void ImageIo::SaveImpl(ImageAnyConstPtr image_any,
   } else {
     writer = internal::MakeWriter(chosen_format, std::get<1>(output_any));
   }
+  if (png_compression_level_.has_value() &&
+      chosen_format == ImageFileFormat::kPng) {
+    static_cast<vtkPNGWriter*>(writer.Get())
+        ->SetCompressionLevel(*png_compression_level_);
+  }
 
   // Copy the Drake image buffer to a VTK image buffer. Drake uses (x=0, y=0)
   // as the top left corner, but VTK uses it as the bottom left corner, and
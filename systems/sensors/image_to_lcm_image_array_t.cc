@@ -8,6 +8,7 @@
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
 
+using drake::geometry::render::RenderStatistics;
 using std::string;
 
 namespace drake {
@@ -201,6 +202,8 @@ void ImageToLcmImageArrayT::CalcImageArray(
     packed.header = {};
     packed.header.utime = utime;
     packed.header.frame_name = name;
+    const RenderStatistics::ScopedTimer timer(statistics(),
+                                              "ImageToLcmImageArrayT/encode");
     PackImageToLcmImageT(value, type, &packed, do_compress_);
   }
 }
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/geometry/render/render_statistics.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
@@ -79,6 +82,20 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
     return this->DeclareAbstractInputPort(name, Value<Image<kPixelType>>());
   }
 
+  /// Sets the statistics that collect the time spent encoding (i.e., copying
+  /// or compressing) each image into the message, as the stage
+  /// "ImageToLcmImageArrayT/encode", or, if null, stops collecting them.
+  /// The time spent calculating the input images themselves is not included.
+  void set_statistics(
+      std::shared_ptr<geometry::render::RenderStatistics> statistics) {
+    statistics_ = std::move(statistics);
+  }
+
+  /// Returns the statistics set by set_statistics(), or null.
+  geometry::render::RenderStatistics* statistics() const {
+    return statistics_.get();
+  }
+
  private:
   void CalcImageArray(const systems::Context<double>& context,
                       lcmt_image_array* msg) const;
@@ -90,6 +107,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  std::shared_ptr<geometry::render::RenderStatistics> statistics_;
 };
 
 }  // namespace sensors
@@ -2,14 +2,24 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/text_logging.h"
 #include "drake/systems/sensors/image_io.h"
 
 namespace drake {
@@ -36,7 +46,222 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
   ImageIo{}.Save(image, file_path, ImageFileFormat::kPng);
 }
 
-ImageWriter::ImageWriter() {
+namespace {
+
+enum class QueueFullPolicy { kBlock, kDropNewest, kDropOldest };
+
+QueueFullPolicy ParseQueueFullPolicy(const std::string& policy) {
+  if (policy == "block") return QueueFullPolicy::kBlock;
+  if (policy == "drop_newest") return QueueFullPolicy::kDropNewest;
+  if (policy == "drop_oldest") return QueueFullPolicy::kDropOldest;
+  throw std::logic_error(fmt::format(
+      "ImageWriter: unknown queue_full_policy '{}'; must be one of 'block', "
+      "'drop_newest', or 'drop_oldest'",
+      policy));
+}
+
+}  // namespace
+
+class ImageWriter::Worker {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Worker)
+
+  explicit Worker(const ImageWriterParams& params)
+      : png_compression_level_(params.png_compression_level),
+        max_queue_size_(params.max_queue_size),
+        queue_full_policy_(ParseQueueFullPolicy(params.queue_full_policy)) {
+    if (params.num_threads < 0) {
+      throw std::logic_error(
+          fmt::format("ImageWriter: num_threads must be non-negative; given {}",
+                      params.num_threads));
+    }
+    if (params.max_queue_size < 1) {
+      throw std::logic_error(
+          fmt::format("ImageWriter: max_queue_size must be positive; given {}",
+                      params.max_queue_size));
+    }
+    if (png_compression_level_.has_value()) {
+      // Let ImageIo validate the level.
+      ImageIo{}.SetPngCompressionLevel(*png_compression_level_);
+    }
+    for (int i = 0; i < params.num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        RunThread();
+      });
+    }
+  }
+
+  ~Worker() {
+    Flush();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    job_available_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  // Writes the image to the named file: immediately, when writing
+  // synchronously, or else by enqueuing a copy of it for the threads.
+  template <PixelType kPixelType>
+  void Write(const Image<kPixelType>& image, std::string file_name) {
+    const Clock::time_point capture_time = Clock::now();
+    if (threads_.empty()) {
+      try {
+        Save(image, file_name);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++statistics_.num_failed;
+        throw;
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      RecordWritten(capture_time);
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (static_cast<int>(queue_.size()) >= max_queue_size_) {
+      switch (queue_full_policy_) {
+        case QueueFullPolicy::kBlock:
+          progress_.wait(lock, [this]() {
+            return static_cast<int>(queue_.size()) < max_queue_size_;
+          });
+          break;
+        case QueueFullPolicy::kDropNewest:
+          ++statistics_.num_dropped;
+          return;
+        case QueueFullPolicy::kDropOldest:
+          queue_.pop_front();
+          ++statistics_.num_dropped;
+          break;
+      }
+    }
+    queue_.push_back(Job{ImageAny(image), std::move(file_name), capture_time});
+    statistics_.max_queue_depth =
+        std::max(statistics_.max_queue_depth, queue_depth());
+    lock.unlock();
+    job_available_.notify_one();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    progress_.wait(lock, [this]() {
+      return queue_depth() == 0;
+    });
+  }
+
+  Statistics GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics result = statistics_;
+    result.queue_depth = queue_depth();
+    return result;
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // A captured image waiting to be written.
+  struct Job {
+    ImageAny image;
+    std::string file_name;
+    Clock::time_point capture_time;
+  };
+
+  template <PixelType kPixelType>
+  void Save(const Image<kPixelType>& image,
+            const std::string& file_name) const {
+    ImageIo image_io;
+    if (png_compression_level_.has_value()) {
+      image_io.SetPngCompressionLevel(*png_compression_level_);
+    }
+    image_io.Save(image, file_name);
+  }
+
+  // The body of each of the threads: writes images until told to stop.
+  void RunThread() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      job_available_.wait(lock, [this]() {
+        return stopping_ || !queue_.empty();
+      });
+      if (queue_.empty()) {
+        return;
+      }
+      const Job job = std::move(queue_.front());
+      queue_.pop_front();
+      ++num_in_progress_;
+      lock.unlock();
+      // There is room in the queue now.
+      progress_.notify_all();
+
+      std::string error;
+      try {
+        std::visit(
+            [this, &job](const auto& image) {
+              Save(image, job.file_name);
+            },
+            job.image);
+      } catch (const std::exception& e) {
+        error = e.what();
+      }
+
+      lock.lock();
+      --num_in_progress_;
+      if (error.empty()) {
+        RecordWritten(job.capture_time);
+      } else {
+        ++statistics_.num_failed;
+        if (statistics_.num_failed == 1) {
+          drake::log()->warn(
+              "ImageWriter: failed to write '{}': {} (further failures will "
+              "not be logged)",
+              job.file_name, error);
+        }
+      }
+      progress_.notify_all();
+    }
+  }
+
+  // Records a successful write of an image captured at the given time.
+  // The caller must hold mutex_.
+  void RecordWritten(Clock::time_point capture_time) {
+    const double latency =
+        std::chrono::duration<double>(Clock::now() - capture_time).count();
+    ++statistics_.num_written;
+    total_latency_ += latency;
+    statistics_.mean_latency = total_latency_ / statistics_.num_written;
+    statistics_.max_latency = std::max(statistics_.max_latency, latency);
+  }
+
+  // The number of images waiting to be written or being written. The caller
+  // must hold mutex_.
+  int queue_depth() const {
+    return static_cast<int>(queue_.size()) + num_in_progress_;
+  }
+
+  const std::optional<int> png_compression_level_;
+  const int max_queue_size_;
+  const QueueFullPolicy queue_full_policy_;
+
+  mutable std::mutex mutex_;
+  // Signaled when a job is enqueued or the threads must stop.
+  std::condition_variable job_available_;
+  // Signaled when a job is dequeued or finished.
+  std::condition_variable progress_;
+  std::deque<Job> queue_;
+  int num_in_progress_{0};
+  bool stopping_{false};
+  Statistics statistics_;
+  double total_latency_{0};
+  std::vector<std::thread> threads_;
+};
+
+ImageWriter::ImageWriter() : ImageWriter(ImageWriterParams{}) {}
+
+ImageWriter::ImageWriter(const ImageWriterParams& params)
+    : params_(params), worker_(std::make_unique<Worker>(params)) {
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
   extensions_[PixelType::kRgba8U] = ".png";
@@ -54,6 +279,8 @@ ImageWriter::ImageWriter() {
   DeclareForcedPublishEvent(&ImageWriter::WriteAllImages);
 }
 
+ImageWriter::~ImageWriter() = default;
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -174,12 +401,20 @@ void ImageWriter::ResetAllImageCounts() const {
   }
 }
 
+ImageWriter::Statistics ImageWriter::GetStatistics() const {
+  return worker_->GetStatistics();
+}
+
+void ImageWriter::Flush() const {
+  worker_->Flush();
+}
+
 template <PixelType kPixelType>
 void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  ImageIo{}.Save(image,
+  worker_->Write(image,
                  MakeFileName(data.format, data.pixel_type, context.get_time(),
                               port.get_name(), data.count++));
 }
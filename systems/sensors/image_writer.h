@@ -6,12 +6,16 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
 
@@ -57,6 +61,45 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
 
 //@}
 
+/** Configures how an ImageWriter encodes and writes its images. By default,
+ images are written synchronously, with default compression.  */
+struct ImageWriterParams {
+  /** Passes this object to an Archive.
+   Refer to @ref yaml_serialization "YAML Serialization" for background.  */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(num_threads));
+    a->Visit(DRAKE_NVP(max_queue_size));
+    a->Visit(DRAKE_NVP(queue_full_policy));
+    a->Visit(DRAKE_NVP(png_compression_level));
+  }
+
+  /** The number of background threads that encode and write images. When
+   zero, each image is encoded and written by the publish event that captures
+   it. Otherwise, publish events only capture (copy) the images and the
+   threads write them.  */
+  int num_threads{0};
+
+  /** The maximum number of captured images that may be waiting for a thread
+   to write them. Ignored when `num_threads` is zero.  */
+  int max_queue_size{32};
+
+  /** What a publish event does with a captured image when the queue is full.
+   Must be one of:
+     - "block": waits until a thread makes room for the image;
+     - "drop_newest": discards the captured image;
+     - "drop_oldest": discards the oldest image in the queue to make room for
+       the captured image.
+   Ignored when `num_threads` is zero.  */
+  std::string queue_full_policy{"block"};
+
+  /** The zlib compression level of PNG files, from 0 (no compression) to 9
+   (smallest files). Low levels encode much faster, at the cost of larger
+   files; the images remain lossless either way. When not set, the default
+   level of ImageIo is used. TIFF files are unaffected.  */
+  std::optional<int> png_compression_level;
+};
+
 /** A system for periodically writing images to the file system. The system also
  provides direct image writing via a forced publish event. The system does not
  have a fixed set of input ports; the system can have an arbitrary number of
@@ -100,14 +143,40 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  simultaneously to disk. Note that one can invoke a forced publish on this
  system using the same context multiple times, resulting in multiple
  write operations, with each operation overwriting the same file(s).
+
+ <h3>Asynchronous writing</h3>
+
+ Encoding and writing images can take much longer than rendering them. When
+ constructed with ImageWriterParams::num_threads greater than zero, the
+ publish events of an %ImageWriter only copy the images (which shares their
+ pixels; see Image) and compute their file names; a pool of background
+ threads then encodes and writes them, in the order they were captured.
+ Captured images wait in a bounded queue; what happens when the queue is full
+ is set by ImageWriterParams::queue_full_policy. Images that fail to be
+ written are counted and logged (once) rather than thrown. Flush() waits until
+ all captured images have been written; destroying the %ImageWriter flushes
+ it. GetStatistics() reports the queue's depth and the latency of the writes.
  */
 class ImageWriter : public LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageWriter)
 
-  /** Constructs default instance with no image ports.  */
+  /** Constructs default instance with no image ports, which writes its
+   images synchronously.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports, which writes its images as
+   configured by `params`.
+   @throws std::exception if `params.num_threads` is negative,
+                          `params.max_queue_size` is not positive,
+                          `params.queue_full_policy` is not recognized, or
+                          `params.png_compression_level` is not in [0, 9].  */
+  explicit ImageWriter(const ImageWriterParams& params);
+
+  /** Writes any images that are still waiting to be written, and then stops
+   the background threads (if any).  */
+  ~ImageWriter() override;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -228,6 +297,38 @@ class ImageWriter : public LeafSystem<double> {
   // Resets the saved image count for all declared input ports to zero.
   void ResetAllImageCounts() const;
 
+  /** Statistics of the images captured by an %ImageWriter; see
+   GetStatistics(). Latencies are wall-clock durations measured from the
+   moment a publish event captures an image until its file has been
+   written.  */
+  struct Statistics {
+    /** The number of images written.  */
+    int64_t num_written{};
+    /** The number of images that could not be written.  */
+    int64_t num_failed{};
+    /** The number of images discarded because the queue was full.  */
+    int64_t num_dropped{};
+    /** The number of captured images that are waiting to be written or are
+     being written.  */
+    int queue_depth{};
+    /** The largest `queue_depth` observed.  */
+    int max_queue_depth{};
+    /** The mean latency of the written images, in seconds.  */
+    double mean_latency{};
+    /** The largest latency of the written images, in seconds.  */
+    double max_latency{};
+  };
+
+  /** Returns the statistics of the images captured so far.  */
+  Statistics GetStatistics() const;
+
+  /** Blocks until all captured images have been written (or have failed to
+   be written). When writing synchronously, returns immediately.  */
+  void Flush() const;
+
+  /** Returns the parameters this writer was constructed with.  */
+  const ImageWriterParams& params() const { return params_; }
+
  private:
 #ifndef DRAKE_DOXYGEN_CXX
   // Friend for facilitating unit testing.
@@ -238,6 +339,10 @@ class ImageWriter : public LeafSystem<double> {
   template <PixelType kPixelType>
   void WriteImage(const Context<double>& context, int index) const;
 
+  // The queue and threads that write the captured images (or, when writing
+  // synchronously, the bookkeeping of the writes); defined in the .cc file.
+  class Worker;
+
   // Writes an image for each configured input port.
   EventStatus WriteAllImages(const Context<double>& context) const;
 
@@ -286,6 +391,9 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  const ImageWriterParams params_;
+  std::unique_ptr<Worker> worker_;
 };
 
 }  // namespace sensors
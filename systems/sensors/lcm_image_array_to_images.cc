@@ -71,7 +71,7 @@ bool DecompressVtk(ImageFileFormat format, const lcmt_image* lcm_image,
                         format);
     return false;
   }
-  exporter->Export(image->at(0, 0));
+  exporter->Export(image->mutable_data());
   return true;
 }
 
@@ -80,7 +80,7 @@ bool DecompressZlib(const lcmt_image* lcm_image, Image<kPixelType>* image) {
   // NOLINTNEXTLINE(runtime/int)
   unsigned long dest_len = image->width() * image->height() * image->kPixelSize;
   const int status =
-      uncompress(reinterpret_cast<Bytef*>(image->at(0, 0)), &dest_len,
+      uncompress(reinterpret_cast<Bytef*>(image->mutable_data()), &dest_len,
                  lcm_image->data.data(), lcm_image->size);
   if (status != Z_OK) {
     drake::log()->error("zlib decompression failed on incoming LCM image: {}",
@@ -102,7 +102,7 @@ bool UnpackLcmImage(const lcmt_image* lcm_image, Image<kPixelType>* image) {
 
   switch (lcm_image->compression_method) {
     case lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED: {
-      memcpy(image->at(0, 0), lcm_image->data.data(), image->size());
+      memcpy(image->mutable_data(), lcm_image->data.data(), image->size());
       return true;
     }
     case lcmt_image::COMPRESSION_METHOD_ZLIB: {
@@ -0,0 +1,203 @@
+#include "drake/systems/sensors/multi_camera_renderer.h"
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/geometry/scene_graph.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::render::ColorImageRequest;
+using geometry::render::DepthImageRequest;
+using geometry::render::ImageRequest;
+using geometry::render::LabelImageRequest;
+using geometry::render::RenderCameraCore;
+using math::RigidTransformd;
+
+namespace {
+
+/* Makes `image` ready to be overwritten by a render of the given camera. The
+output ports share the pixels of the previous render, so writing them would
+first copy them, only for the render to overwrite the copy. Instead, `image`
+swaps buffers with `spare`, which holds the pixels of the render before that;
+those are no longer shared once the output ports have moved on. */
+template <PixelType kPixelType>
+void PrepareToRender(const RenderCameraCore& core, Image<kPixelType>* image,
+                     Image<kPixelType>* spare) {
+  if (image->SharesPixels()) {
+    std::swap(*image, *spare);
+  }
+  const int width = core.intrinsics().width();
+  const int height = core.intrinsics().height();
+  if (image->SharesPixels() || image->width() != width ||
+      image->height() != height) {
+    *image = Image<kPixelType>(width, height);
+  }
+}
+
+}  // namespace
+
+MultiCameraRenderer::MultiCameraRenderer(
+    std::vector<CameraRenderRequest> requests)
+    : requests_(std::move(requests)) {
+  DRAKE_THROW_UNLESS(!requests_.empty());
+  for (const CameraRenderRequest& request : requests_) {
+    DRAKE_THROW_UNLESS(!request.render_label_image ||
+                       request.color_camera.has_value());
+  }
+
+  this->DeclareAbstractInputPort("geometry_query",
+                                 Value<QueryObject<double>>{});
+
+  images_cache_entry_ = &this->DeclareCacheEntry(
+      "images", RenderedImages{}, &MultiCameraRenderer::CalcImages,
+      {this->all_input_ports_ticket()});
+
+  ports_.resize(requests_.size());
+  for (int i = 0; i < num_cameras(); ++i) {
+    const CameraRenderRequest& request = requests_[i];
+    CameraPorts& ports = ports_[i];
+    if (request.color_camera.has_value()) {
+      ports.color_image =
+          &DeclareImageOutputPort(i, "color_image", &CameraRenderResult::color);
+    }
+    if (request.depth_camera.has_value()) {
+      ports.depth_image_32F = &DeclareImageOutputPort(
+          i, "depth_image_32f", &CameraRenderResult::depth);
+    }
+    if (request.render_label_image) {
+      ports.label_image =
+          &DeclareImageOutputPort(i, "label_image", &CameraRenderResult::label);
+    }
+    ports.body_pose_in_world = &this->DeclareAbstractOutputPort(
+        fmt::format("camera{}_body_pose_in_world", i),
+        []() {
+          return AbstractValue::Make<RigidTransformd>();
+        },
+        [this, i](const Context<double>& context, AbstractValue* output) {
+          const CameraRenderRequest& camera = requests_[i];
+          RigidTransformd& X_WB = output->get_mutable_value<RigidTransformd>();
+          if (camera.parent_id == SceneGraph<double>::world_frame_id()) {
+            X_WB = camera.X_PB;
+          } else {
+            const auto& query_object =
+                get_input_port().Eval<QueryObject<double>>(context);
+            X_WB = query_object.GetPoseInWorld(camera.parent_id) * camera.X_PB;
+          }
+        },
+        {this->all_input_ports_ticket()});
+  }
+}
+
+template <typename ImageType>
+const OutputPort<double>& MultiCameraRenderer::DeclareImageOutputPort(
+    int camera, const char* name, ImageType CameraRenderResult::*image) {
+  return this->DeclareAbstractOutputPort(
+      fmt::format("camera{}_{}", camera, name),
+      []() {
+        return AbstractValue::Make<ImageType>();
+      },
+      [this, camera, image](const Context<double>& context,
+                            AbstractValue* output) {
+        // The copy shares the rendered pixels.
+        output->get_mutable_value<ImageType>() =
+            EvalImages(context)[camera].*image;
+      },
+      {images_cache_entry_->ticket()});
+}
+
+const CameraRenderRequest& MultiCameraRenderer::request(int camera) const {
+  DRAKE_DEMAND(camera >= 0 && camera < num_cameras());
+  return requests_[camera];
+}
+
+const OutputPort<double>& MultiCameraRenderer::color_image_output_port(
+    int camera) const {
+  DRAKE_THROW_UNLESS(camera >= 0 && camera < num_cameras());
+  if (ports_[camera].color_image == nullptr) {
+    throw std::logic_error(fmt::format(
+        "MultiCameraRenderer: camera {} doesn't render color images", camera));
+  }
+  return *ports_[camera].color_image;
+}
+
+const OutputPort<double>& MultiCameraRenderer::depth_image_32F_output_port(
+    int camera) const {
+  DRAKE_THROW_UNLESS(camera >= 0 && camera < num_cameras());
+  if (ports_[camera].depth_image_32F == nullptr) {
+    throw std::logic_error(fmt::format(
+        "MultiCameraRenderer: camera {} doesn't render depth images", camera));
+  }
+  return *ports_[camera].depth_image_32F;
+}
+
+const OutputPort<double>& MultiCameraRenderer::label_image_output_port(
+    int camera) const {
+  DRAKE_THROW_UNLESS(camera >= 0 && camera < num_cameras());
+  if (ports_[camera].label_image == nullptr) {
+    throw std::logic_error(fmt::format(
+        "MultiCameraRenderer: camera {} doesn't render label images", camera));
+  }
+  return *ports_[camera].label_image;
+}
+
+const OutputPort<double>& MultiCameraRenderer::body_pose_in_world_output_port(
+    int camera) const {
+  DRAKE_THROW_UNLESS(camera >= 0 && camera < num_cameras());
+  return *ports_[camera].body_pose_in_world;
+}
+
+const std::vector<CameraRenderResult>& MultiCameraRenderer::EvalImages(
+    const Context<double>& context) const {
+  return images_cache_entry_->Eval<RenderedImages>(context).results;
+}
+
+void MultiCameraRenderer::CalcImages(const Context<double>& context,
+                                     RenderedImages* images) const {
+  const auto& query_object =
+      get_input_port().Eval<QueryObject<double>>(context);
+  std::vector<CameraRenderResult>& results = images->results;
+  std::vector<CameraRenderResult>& spares = images->spares;
+  results.resize(requests_.size());
+  spares.resize(requests_.size());
+
+  // The requests of each camera are adjacent, so that the images from the same
+  // viewpoint share a viewpoint update in the render engine.
+  std::vector<ImageRequest> image_requests;
+  for (int i = 0; i < num_cameras(); ++i) {
+    const CameraRenderRequest& request = requests_[i];
+    CameraRenderResult& result = results[i];
+    CameraRenderResult& spare = spares[i];
+    result.X_WB = query_object.GetPoseInWorld(request.parent_id) * request.X_PB;
+    if (request.color_camera.has_value()) {
+      const RenderCameraCore& core = request.color_camera->core();
+      const RigidTransformd X_WC =
+          result.X_WB * core.sensor_pose_in_camera_body();
+      PrepareToRender(core, &result.color, &spare.color);
+      image_requests.push_back(
+          ColorImageRequest{*request.color_camera, X_WC, &result.color});
+      if (request.render_label_image) {
+        PrepareToRender(core, &result.label, &spare.label);
+        image_requests.push_back(
+            LabelImageRequest{*request.color_camera, X_WC, &result.label});
+      }
+    }
+    if (request.depth_camera.has_value()) {
+      const RenderCameraCore& core = request.depth_camera->core();
+      PrepareToRender(core, &result.depth, &spare.depth);
+      image_requests.push_back(DepthImageRequest{
+          *request.depth_camera,
+          result.X_WB * core.sensor_pose_in_camera_body(), &result.depth});
+    }
+  }
+  query_object.RenderImages(image_requests);
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/render_cameras_in_parallel.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** Renders the images of several cameras that view the same scene, all from a
+single evaluation of its input. Compared to one RgbdSensor per camera, the
+geometry poses are brought up to date once, and the images (including the
+color, depth, and label images of each camera) are rendered in a single
+geometry::QueryObject::RenderImages() batch per render engine, which lets the
+engine share the work the images have in common.
+
+@system
+name: MultiCameraRenderer
+input_ports:
+- geometry_query
+output_ports:
+- camera0_color_image (optional)
+- camera0_depth_image_32f (optional)
+- camera0_label_image (optional)
+- camera0_body_pose_in_world
+- ...
+- camera{N-1}_color_image (optional)
+- camera{N-1}_depth_image_32f (optional)
+- camera{N-1}_label_image (optional)
+- camera{N-1}_body_pose_in_world
+@endsystem
+
+Each camera is described by a CameraRenderRequest; an image output port is
+only declared for the kinds of images its request asks for. All of the images
+are rendered (once) when any of the image output ports is evaluated; the output
+ports share their pixels with that rendering, so evaluating them doesn't copy
+the images. Each image is double buffered, so that rendering anew doesn't copy
+the pixels that the output ports still share either.
+
+@experimental
+@ingroup sensor_systems */
+class MultiCameraRenderer final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultiCameraRenderer);
+
+  /** Constructs a renderer for the given cameras.
+  @throws std::exception if `requests` is empty, or if a request has
+          `render_label_image` set but no color camera. */
+  explicit MultiCameraRenderer(std::vector<CameraRenderRequest> requests);
+
+  /** Returns the number of cameras. */
+  int num_cameras() const { return static_cast<int>(requests_.size()); }
+
+  /** Returns the request that describes the given `camera`.
+  @pre 0 <= camera < num_cameras(). */
+  const CameraRenderRequest& request(int camera) const;
+
+  /** Returns the geometry::QueryObject<double>-valued input port. */
+  const InputPort<double>& query_object_input_port() const {
+    return get_input_port();
+  }
+
+  /** Returns the ImageRgba8U-valued output port of the given `camera`.
+  @throws std::exception if the camera has no color camera. */
+  const OutputPort<double>& color_image_output_port(int camera) const;
+
+  /** Returns the ImageDepth32F-valued output port of the given `camera`.
+  @throws std::exception if the camera has no depth camera. */
+  const OutputPort<double>& depth_image_32F_output_port(int camera) const;
+
+  /** Returns the ImageLabel16I-valued output port of the given `camera`.
+  @throws std::exception if the camera doesn't render label images. */
+  const OutputPort<double>& label_image_output_port(int camera) const;
+
+  /** Returns the abstract-valued output port (containing a RigidTransform)
+  which reports the pose of the given `camera`'s body in the world frame. */
+  const OutputPort<double>& body_pose_in_world_output_port(int camera) const;
+
+ private:
+  struct CameraPorts {
+    const OutputPort<double>* color_image{};
+    const OutputPort<double>* depth_image_32F{};
+    const OutputPort<double>* label_image{};
+    const OutputPort<double>* body_pose_in_world{};
+  };
+
+  // Declares the output port `camera{camera}_{name}`, which reports the given
+  // `image` of the camera's result.
+  template <typename ImageType>
+  const OutputPort<double>& DeclareImageOutputPort(
+      int camera, const char* name, ImageType CameraRenderResult::*image);
+
+  // The value of the images cache entry.
+  struct RenderedImages {
+    // The most recently rendered images of each camera.
+    std::vector<CameraRenderResult> results;
+    // The back buffers of `results`; see PrepareToRender().
+    std::vector<CameraRenderResult> spares;
+  };
+
+  // Renders all of the images into the cache entry.
+  void CalcImages(const Context<double>& context, RenderedImages* images) const;
+
+  const std::vector<CameraRenderResult>& EvalImages(
+      const Context<double>& context) const;
+
+  const std::vector<CameraRenderRequest> requests_;
+  std::vector<CameraPorts> ports_;
+  const CacheEntry* images_cache_entry_{};
+};
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,125 @@
+#include "drake/systems/sensors/render_cameras_in_parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+using geometry::QueryObject;
+using geometry::render::ColorImageRequest;
+using geometry::render::DepthImageRequest;
+using geometry::render::ImageRequest;
+using geometry::render::LabelImageRequest;
+using geometry::render::RenderCameraCore;
+using geometry::render::RenderEngine;
+using math::RigidTransformd;
+
+namespace {
+
+template <PixelType kPixelType>
+void ResizeIfNeeded(const RenderCameraCore& core, Image<kPixelType>* image) {
+  const int width = core.intrinsics().width();
+  const int height = core.intrinsics().height();
+  if (image->width() != width || image->height() != height) {
+    image->resize(width, height);
+  }
+}
+
+}  // namespace
+
+void RenderCamerasInParallel(const QueryObject<double>& query_object,
+                             const std::vector<CameraRenderRequest>& requests,
+                             Parallelism parallelism,
+                             std::vector<CameraRenderResult>* results) {
+  DRAKE_THROW_UNLESS(results != nullptr);
+  for (const CameraRenderRequest& request : requests) {
+    DRAKE_THROW_UNLESS(!request.render_label_image ||
+                       request.color_camera.has_value());
+  }
+  results->resize(requests.size());
+
+  // Sort the images into those that can be rendered concurrently and those
+  // that can't. Each image request carries its own camera pose, so concurrent
+  // renders never depend on an engine's shared viewpoint. Along the way,
+  // querying the camera poses brings the scene graph's pose cache up to date,
+  // so the renders below only read it.
+  std::vector<ImageRequest> concurrent_requests;
+  std::vector<ImageRequest> serial_requests;
+  auto add_request = [&](const RenderCameraCore& core, ImageRequest request) {
+    const RenderEngine* engine =
+        query_object.GetRenderEngineByName(core.renderer_name());
+    // An unknown engine name is reported by the render call itself.
+    const bool concurrent =
+        engine != nullptr && engine->SupportsConcurrentRendering();
+    (concurrent ? concurrent_requests : serial_requests)
+        .push_back(std::move(request));
+  };
+  for (size_t i = 0; i < requests.size(); ++i) {
+    const CameraRenderRequest& request = requests[i];
+    CameraRenderResult& result = (*results)[i];
+    result.X_WB = query_object.GetPoseInWorld(request.parent_id) * request.X_PB;
+    if (request.color_camera.has_value()) {
+      const RenderCameraCore& core = request.color_camera->core();
+      const RigidTransformd X_WC =
+          result.X_WB * core.sensor_pose_in_camera_body();
+      ResizeIfNeeded(core, &result.color);
+      add_request(core, ColorImageRequest{*request.color_camera, X_WC,
+                                          &result.color});
+      if (request.render_label_image) {
+        ResizeIfNeeded(core, &result.label);
+        add_request(core, LabelImageRequest{*request.color_camera, X_WC,
+                                            &result.label});
+      } else {
+        result.label.resize(0, 0);
+      }
+    } else {
+      result.color.resize(0, 0);
+      result.label.resize(0, 0);
+    }
+    if (request.depth_camera.has_value()) {
+      const RenderCameraCore& core = request.depth_camera->core();
+      ResizeIfNeeded(core, &result.depth);
+      add_request(core, DepthImageRequest{
+                            *request.depth_camera,
+                            result.X_WB * core.sensor_pose_in_camera_body(),
+                            &result.depth});
+    } else {
+      result.depth.resize(0, 0);
+    }
+  }
+
+  // The worker threads (and the calling thread, once it has rendered the
+  // serial images as a single batch) claim the concurrent images one at a
+  // time.
+  const int num_concurrent = static_cast<int>(concurrent_requests.size());
+  std::atomic<int> next_request{0};
+  auto render_concurrent = [&]() {
+    for (int r = next_request++; r < num_concurrent; r = next_request++) {
+      query_object.RenderImages({concurrent_requests[r]});
+    }
+  };
+  const int num_threads = std::min(parallelism.num_threads(), num_concurrent);
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i < num_threads; ++i) {
+    futures.push_back(std::async(std::launch::async, render_concurrent));
+  }
+  if (!serial_requests.empty()) {
+    query_object.RenderImages(serial_requests);
+  }
+  render_concurrent();
+  // Propagate any exception thrown on a worker thread.
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
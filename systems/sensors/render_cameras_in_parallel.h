@@ -0,0 +1,91 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/render/render_camera.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+
+/** The images to render for a single camera in RenderCamerasInParallel(). The
+camera body B is affixed to the frame P (with id `parent_id`) at the fixed pose
+`X_PB`; the color and depth sensors are posed relative to B as documented in
+RgbdSensor.
+
+@experimental */
+struct CameraRenderRequest {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CameraRenderRequest)
+  CameraRenderRequest() = default;
+
+  /** The id of the frame P to which the camera body is affixed. */
+  geometry::FrameId parent_id;
+
+  /** The pose of the camera body B in P. */
+  math::RigidTransformd X_PB;
+
+  /** If given, a color image is rendered with this camera. */
+  std::optional<geometry::render::ColorRenderCamera> color_camera;
+
+  /** If given, a depth image is rendered with this camera. */
+  std::optional<geometry::render::DepthRenderCamera> depth_camera;
+
+  /** If true, a label image is rendered with the color camera (which must,
+  therefore, be given). */
+  bool render_label_image{false};
+};
+
+/** The images rendered for a single CameraRenderRequest. Images that weren't
+requested are zero-sized.
+
+@experimental */
+struct CameraRenderResult {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CameraRenderResult)
+  CameraRenderResult() = default;
+
+  /** The pose of the camera body B in the world frame. */
+  math::RigidTransformd X_WB;
+
+  ImageRgba8U color;
+  ImageDepth32F depth;
+  ImageLabel16I label;
+};
+
+/** Renders all of the images for the given camera `requests`, distributing the
+individual renders across up to `parallelism` threads (the calling thread
+among them).
+
+Only images whose render engine reports that it
+@ref geometry::render::RenderEngine::SupportsConcurrentRendering
+"supports concurrent rendering" are rendered concurrently, each with its own
+call to QueryObject::RenderImages(); the remaining images are rendered as a
+single batch on the calling thread. Because all of the
+renders read the same `query_object`, its underlying Context must not be
+modified while this function runs.
+
+@param query_object  The query object providing the scene to render.
+@param requests      The cameras to render.
+@param parallelism   The maximum number of threads to use.
+@param[out] results  On return, `results->at(i)` holds the images for
+                     `requests[i]`. Images already present in `results` are
+                     reused when they have the requested size.
+@throws std::exception if `results` is null, if a request has
+        `render_label_image` set but no color camera, or if any render fails
+        (e.g., a camera names an unknown render engine).
+
+@experimental */
+void RenderCamerasInParallel(const geometry::QueryObject<double>& query_object,
+                             const std::vector<CameraRenderRequest>& requests,
+                             Parallelism parallelism,
+                             std::vector<CameraRenderResult>* results);
+
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
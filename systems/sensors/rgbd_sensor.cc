@@ -15,6 +15,7 @@ using geometry::QueryObject;
 using geometry::SceneGraph;
 using geometry::render::ColorRenderCamera;
 using geometry::render::DepthRenderCamera;
+using geometry::render::RenderStatistics;
 using math::RigidTransformd;
 
 RgbdSensor::RgbdSensor(FrameId parent_id, const RigidTransformd& X_PB,
@@ -105,6 +106,8 @@ const OutputPort<double>& RgbdSensor::image_time_output_port() const {
 
 void RgbdSensor::CalcColorImage(const Context<double>& context,
                                 ImageRgba8U* color_image) const {
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RgbdSensor/color_image");
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderColorImage(color_camera_, parent_frame_id_, X_PB_,
                                 color_image);
@@ -112,6 +115,8 @@ void RgbdSensor::CalcColorImage(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
                                    ImageDepth32F* depth_image) const {
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RgbdSensor/depth_image_32f");
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderDepthImage(depth_camera_, parent_frame_id_, X_PB_,
                                 depth_image);
@@ -119,6 +124,8 @@ void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RgbdSensor/depth_image_16u");
   ImageDepth32F depth32(depth_image->width(), depth_image->height());
   CalcDepthImage32F(context, &depth32);
   ConvertDepth32FTo16U(depth32, depth_image);
@@ -126,6 +133,8 @@ void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
 
 void RgbdSensor::CalcLabelImage(const Context<double>& context,
                                 ImageLabel16I* label_image) const {
+  const RenderStatistics::ScopedTimer timer(statistics(),
+                                            "RgbdSensor/label_image");
   const QueryObject<double>& query_object = get_query_object(context);
   query_object.RenderLabelImage(color_camera_, parent_frame_id_, X_PB_,
                                 label_image);
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <utility>
+
 #include "drake/common/drake_copyable.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/render/render_camera.h"
+#include "drake/geometry/render/render_statistics.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/camera_info.h"
@@ -175,6 +179,22 @@ class RgbdSensor final : public LeafSystem<double> {
    the current time). */
   const OutputPort<double>& image_time_output_port() const;
 
+  /** Sets the statistics that collect the time spent calculating each of this
+   sensor's images ("RgbdSensor/color_image", "RgbdSensor/depth_image_32f",
+   "RgbdSensor/depth_image_16u", and "RgbdSensor/label_image"), or, if null,
+   stops collecting them. To also see the stages of the rendering itself, set
+   the same statistics on the render engine(s); see
+   geometry::render::RenderEngine::set_statistics().  */
+  void set_statistics(
+      std::shared_ptr<geometry::render::RenderStatistics> statistics) {
+    statistics_ = std::move(statistics);
+  }
+
+  /** Returns the statistics set by set_statistics(), or null. */
+  geometry::render::RenderStatistics* statistics() const {
+    return statistics_.get();
+  }
+
  private:
   // The calculator methods for the four output ports.
   void CalcColorImage(const Context<double>& context,
@@ -213,6 +233,8 @@ class RgbdSensor final : public LeafSystem<double> {
   const geometry::render::DepthRenderCamera depth_camera_;
   // The position of the camera's B frame relative to its parent frame P.
   const math::RigidTransformd X_PB_;
+
+  std::shared_ptr<geometry::render::RenderStatistics> statistics_;
 };
 
 }  // namespace sensors
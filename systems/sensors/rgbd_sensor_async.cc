@@ -7,9 +7,10 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/systems/framework/diagram_builder.h"
-#include "drake/systems/sensors/rgbd_sensor.h"
+#include "drake/systems/sensors/render_cameras_in_parallel.h"
 
 /* Here's an outline of how RgbdSensorAsync is implemented.
 
@@ -29,10 +30,11 @@ different phase offsets:
 The only real trick is how to sufficiently encapsulate a rendering task so that
 it can run on a background thread. The Worker accomplishes that using a helper
 class, the SnapshotSensor. The SnapshotSensor (itself a diagram) contains a
-QueryObjectChef and RgbdSensor connected in series. The Worker allocates a
-standalone SnapshotSensor Context and fixes the chef's input port(s) to be a
-copy of the scene graph's FramePoseVector input port(s), and uses the RgbdSensor
-to produce a rendered image on its output port. */
+QueryObjectChef. The Worker allocates a standalone SnapshotSensor Context and
+fixes the chef's input port(s) to be a copy of the scene graph's
+FramePoseVector input port(s), and renders the images from the chef's
+QueryObject with RenderCamerasInParallel(), so that the color, depth, and label
+images are rendered concurrently when the render engine supports it. */
 
 namespace drake {
 namespace systems {
@@ -45,11 +47,9 @@ using geometry::QueryObject;
 using geometry::Role;
 using geometry::SceneGraph;
 using geometry::SceneGraphInspector;
-using geometry::render::ClippingRange;
 using geometry::render::ColorRenderCamera;
-using geometry::render::DepthRange;
 using geometry::render::DepthRenderCamera;
-using geometry::render::RenderCameraCore;
+using geometry::render::RenderStatistics;
 using math::RigidTransformd;
 
 namespace {
@@ -116,37 +116,44 @@ class QueryObjectChef final : public LeafSystem<double> {
   CacheIndex scratch_index_;
 };
 
-/* Combines QueryObjectChef + RgbdSensor in series, creating a sensor that
-renders from a static FramePoseVector instead of a live QueryObject. */
+/* Wraps a QueryObjectChef, creating a sensor that renders the images of the
+given `request` from a static FramePoseVector instead of a live QueryObject. */
 class SnapshotSensor final : public Diagram<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SnapshotSensor)
 
-  SnapshotSensor(const SceneGraph<double>* scene_graph, FrameId parent_id,
-                 const RigidTransformd& X_PB, ColorRenderCamera color_camera,
-                 DepthRenderCamera depth_camera) {
+  SnapshotSensor(const SceneGraph<double>* scene_graph,
+                 CameraRenderRequest request)
+      : request_(std::move(request)) {
     DRAKE_DEMAND(scene_graph != nullptr);
     geometry_version_ = scene_graph->model_inspector().geometry_version();
     DiagramBuilder<double> builder;
     auto* chef = builder.AddNamedSystem<QueryObjectChef>("chef", scene_graph);
-    auto* rgbd = builder.AddNamedSystem<RgbdSensor>("camera", parent_id, X_PB,
-                                                    color_camera, depth_camera);
-    builder.Connect(*chef, *rgbd);
     for (InputPortIndex i{0}; i < chef->num_input_ports(); ++i) {
       const auto& input_port = chef->get_input_port(i);
       builder.ExportInput(input_port, input_port.get_name());
     }
-    for (OutputPortIndex i{0}; i < rgbd->num_output_ports(); ++i) {
-      const auto& output_port = rgbd->get_output_port(i);
-      builder.ExportOutput(output_port, output_port.get_name());
-    }
+    builder.ExportOutput(chef->get_output_port(), "query");
     builder.BuildInto(this);
   }
 
+  /* Renders the images of this sensor's request; the color, depth, and label
+  images are rendered concurrently if their render engine supports it. */
+  CameraRenderResult Render(const Context<double>& context) const {
+    const auto& query_object =
+        GetOutputPort("query").template Eval<QueryObject<double>>(context);
+    std::vector<CameraRenderResult> results;
+    // There are at most three images to render.
+    RenderCamerasInParallel(query_object, {request_}, Parallelism(3),
+                            &results);
+    return std::move(results[0]);
+  }
+
   /* Returns the version as of when this sensor was created. */
   const GeometryVersion& geometry_version() const { return geometry_version_; }
 
  private:
+  CameraRenderRequest request_;
   GeometryVersion geometry_version_;
 };
 
@@ -170,11 +177,12 @@ class Worker {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Worker)
 
   Worker(std::shared_ptr<const SnapshotSensor> sensor, bool color, bool depth,
-         bool label)
+         bool label, std::shared_ptr<RenderStatistics> statistics)
       : sensor_{std::move(sensor)},
         color_{color},
         depth_{depth},
-        label_{label} {
+        label_{label},
+        statistics_{std::move(statistics)} {
     DRAKE_DEMAND(sensor_ != nullptr);
     sensor_context_ = sensor_->CreateDefaultContext();
   }
@@ -193,6 +201,7 @@ class Worker {
   const bool color_;
   const bool depth_;
   const bool label_;
+  const std::shared_ptr<RenderStatistics> statistics_;
   std::unique_ptr<Context<double>> sensor_context_;
   std::future<RenderedImages> future_;
 };
@@ -234,8 +243,6 @@ RgbdSensorAsync::RgbdSensorAsync(const SceneGraph<double>* scene_graph,
   DRAKE_THROW_UNLESS(output_delay < (1 / fps));
   DRAKE_THROW_UNLESS(color_camera_.has_value() || depth_camera_.has_value());
   DRAKE_THROW_UNLESS(!render_label_image || color_camera_.has_value());
-  // TODO(jwnimmer-tri) Check that the render engine named by either of the two
-  // cameras is not the (known non-threadsafe) VTK engine.
 
   // Input.
   DeclareAbstractInputPort("geometry_query", Value<QueryObject<double>>{});
@@ -313,33 +320,22 @@ EventStatus RgbdSensorAsync::Initialize(const Context<double>& context,
   unused(context);
   TickTockState& next_state = get_mutable_state(state);
 
-  // If we are only going to render one of color or depth, invent dummy
-  // properties for the other one to simplify the SnapshotSensor code.
-  std::optional<ColorRenderCamera> color = color_camera_;
-  std::optional<DepthRenderCamera> depth = depth_camera_;
-  if (!color.has_value()) {
-    DRAKE_DEMAND(depth.has_value());
-    const RenderCameraCore& core = depth->core();
-    color.emplace(core);
-  }
-  if (!depth.has_value()) {
-    DRAKE_DEMAND(color.has_value());
-    const RenderCameraCore& core = color->core();
-    const ClippingRange& clip = core.clipping();
-    // N.B. Avoid using clip.far() here; it can trip the "16 bit mm depth"
-    // logger spam from RgbdSensor.
-    depth.emplace(core, DepthRange(clip.near(), clip.near() * 1.001));
-  }
+  CameraRenderRequest request;
+  request.parent_id = parent_id_;
+  request.X_PB = X_PB_;
+  request.color_camera = color_camera_;
+  request.depth_camera = depth_camera_;
+  request.render_label_image = render_label_image_;
 
   // The `sensor` is a separate, nested system that actually renders images.
   // The outer system (`this`) is just the event shims that will tick it. Our
   // job during initialization is to reset the nested system and any prior
   // output.
-  auto sensor = std::make_shared<const SnapshotSensor>(
-      scene_graph_, parent_id_, X_PB_, std::move(*color), std::move(*depth));
-  next_state.worker =
-      std::make_shared<Worker>(std::move(sensor), color_camera_.has_value(),
-                               depth_camera_.has_value(), render_label_image_);
+  auto sensor =
+      std::make_shared<const SnapshotSensor>(scene_graph_, std::move(request));
+  next_state.worker = std::make_shared<Worker>(
+      std::move(sensor), color_camera_.has_value(), depth_camera_.has_value(),
+      render_label_image_, statistics_);
   next_state.output = {};
   return EventStatus::Succeeded();
 }
@@ -445,6 +441,9 @@ void RgbdSensorAsync::CalcImageTime(const Context<double>& context,
 namespace {
 
 void Worker::Start(double context_time, const QueryObject<double>& query) {
+  const RenderStatistics::ScopedTimer timer(statistics_.get(),
+                                            "RgbdSensorAsync/capture");
+
   // Confirm that the geometry version number has not changed since Initialize.
   const GeometryVersion& initialize_version = sensor_->geometry_version();
   const GeometryVersion& current_version = query.inspector().geometry_version();
@@ -490,32 +489,27 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
   // Launch the rendering task.
   auto task = [this, context_time,
                poses = std::move(poses)]() -> RenderedImages {
+    const RenderStatistics::ScopedTimer task_timer(statistics_.get(),
+                                                   "RgbdSensorAsync/render");
     for (const auto& [port_name, pose_vector] : poses) {
       const auto& input_port = sensor_->GetInputPort(port_name);
       input_port.FixValue(sensor_context_.get(), pose_vector);
     }
+    CameraRenderResult images = sensor_->Render(*sensor_context_);
     RenderedImages result;
-    // TODO(jwnimmer-tri) Is there any way we can steal (move) the images from
-    // the output ports, to avoid extra copying? I suppose we could call the
-    // QueryObject directly instead of the RgbdSensor, but that would involve
-    // duplicating (copying) some of its functionality into this class.
     if (color_) {
-      result.color = std::make_shared<const ImageRgba8U>(
-          sensor_->GetOutputPort("color_image")
-              .template Eval<ImageRgba8U>(*sensor_context_));
+      result.color =
+          std::make_shared<const ImageRgba8U>(std::move(images.color));
     }
     if (depth_) {
-      result.depth = std::make_shared<const ImageDepth32F>(
-          sensor_->GetOutputPort("depth_image_32f")
-              .template Eval<ImageDepth32F>(*sensor_context_));
+      result.depth =
+          std::make_shared<const ImageDepth32F>(std::move(images.depth));
     }
     if (label_) {
-      result.label = std::make_shared<const ImageLabel16I>(
-          sensor_->GetOutputPort("label_image")
-              .template Eval<ImageLabel16I>(*sensor_context_));
+      result.label =
+          std::make_shared<const ImageLabel16I>(std::move(images.label));
     }
-    result.X_WB = sensor_->GetOutputPort("body_pose_in_world")
-                      .template Eval<RigidTransformd>(*sensor_context_);
+    result.X_WB = images.X_WB;
     result.time = context_time;
     return result;
   };
@@ -526,6 +520,9 @@ RenderedImages Worker::Finish() {
   if (!future_.valid()) {
     return {};
   }
+  // This is the time that the simulation thread is blocked on the rendering.
+  const RenderStatistics::ScopedTimer timer(statistics_.get(),
+                                            "RgbdSensorAsync/wait");
   future_.wait();
   return future_.get();
 }
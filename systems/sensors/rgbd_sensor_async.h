@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <utility>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/render/render_camera.h"
+#include "drake/geometry/render/render_statistics.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/leaf_system.h"
@@ -21,10 +24,16 @@ background thread to offer improved performance.
 
 @experimental
 
-@warning This system is intended for use only with the out-of-process glTF
-rendering engine (MakeRenderEngineGltfClient()). Other render engines (e.g.,
-MakeRenderEngineVtk() or MakeRenderEngineGl()) are either not thread-safe or
-perform poorly when used here. We hope to add async support for those engines
+@warning This system is intended for use only with render engines that can
+render on a background thread: the out-of-process glTF rendering engine
+(MakeRenderEngineGltfClient()) or the VTK engine (MakeRenderEngineVtk()). Each
+sensor renders with its own clone of the engine, so multiple sensors (and the
+rest of the simulation) can render at the same time. With an engine that
+@ref geometry::render::RenderEngine::SupportsConcurrentRendering
+"supports concurrent rendering" (e.g., VTK), a sensor's color, depth, and label
+images are also rendered concurrently with each other (see
+RenderCamerasInParallel()). The GL engine
+(MakeRenderEngineGl()) is not thread-safe; we hope to add async support for it
 down the road (see #19437 for details).
 
 @system
@@ -77,7 +86,9 @@ rendering's `output_delay`. This helps smooth over the runtime latency
 associated with rendering.
 
 See also RgbdSensorDiscrete for a simpler (unthreaded) discrete sensor model, or
-RgbdSensor for a continuous model.
+RgbdSensor for a continuous model. To render many cameras of the same scene at
+once (rather than rendering them in the background), see
+RenderCamerasInParallel().
 
 @warning As the moment, this implementation cannnot respond to changes to
 geometry shapes, textures, etc. after a simulation has started. The only thing
@@ -181,6 +192,27 @@ class RgbdSensorAsync final : public LeafSystem<double> {
   simulation), the value will be NaN. */
   const OutputPort<double>& image_time_output_port() const;
 
+  /** Sets the statistics that collect the time spent in each stage of this
+  sensor's work, or, if null, stops collecting them. The stages are
+  "RgbdSensorAsync/capture" (copying the poses at the capture event),
+  "RgbdSensorAsync/render" (the whole rendering task, on the background
+  thread), and "RgbdSensorAsync/wait" (the time the output event is blocked
+  waiting for the rendering to finish). To see the stages of the render engine
+  itself, set the same statistics on the render engine(s) of the
+  `scene_graph`.
+
+  The statistics take effect when the sensor is next initialized (e.g., by
+  Simulator::Initialize()). */
+  void set_statistics(
+      std::shared_ptr<geometry::render::RenderStatistics> statistics) {
+    statistics_ = std::move(statistics);
+  }
+
+  /** Returns the statistics set by set_statistics(), or null. */
+  geometry::render::RenderStatistics* statistics() const {
+    return statistics_.get();
+  }
+
  private:
   struct TickTockState;
 
@@ -206,6 +238,7 @@ class RgbdSensorAsync final : public LeafSystem<double> {
   const std::optional<geometry::render::ColorRenderCamera> color_camera_;
   const std::optional<geometry::render::DepthRenderCamera> depth_camera_;
   const bool render_label_image_;
+  std::shared_ptr<geometry::render::RenderStatistics> statistics_;
 };
 
 }  // namespace sensors
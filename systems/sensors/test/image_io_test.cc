@@ -157,6 +157,35 @@ GTEST_TEST(ImageIoTest, SaveToOutputArgumentMatchesReturnValue) {
   EXPECT_EQ(save_output, ImageIo{}.Save(image, format));
 }
 
+// The PNG compression level trades size for speed, but remains lossless.
+GTEST_TEST(ImageIoTest, PngCompressionLevel) {
+  ImageGrey8U image(64, 32);
+  for (int y = 0; y < image.height(); ++y) {
+    for (int x = 0; x < image.width(); ++x) {
+      image.at(x, y)[0] = (x / 8 + y / 8) % 2 == 0 ? 0 : 255;
+    }
+  }
+  const auto format = ImageFileFormat::kPng;
+  ImageIo fastest;
+  fastest.SetPngCompressionLevel(0);
+  ImageIo smallest;
+  smallest.SetPngCompressionLevel(9);
+  const std::vector<uint8_t> fastest_bytes = fastest.Save(image, format);
+  const std::vector<uint8_t> smallest_bytes = smallest.Save(image, format);
+  EXPECT_GT(fastest_bytes.size(), smallest_bytes.size());
+  for (const auto* bytes : {&fastest_bytes, &smallest_bytes}) {
+    ImageGrey8U readback;
+    ImageIo{}.Load(ImageIo::ByteSpan{bytes->data(), bytes->size()}, format,
+                   &readback);
+    EXPECT_EQ(readback, image);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(fastest.SetPngCompressionLevel(10),
+                              ".*must be in \\[0, 9\\].*");
+  DRAKE_EXPECT_THROWS_MESSAGE(fastest.SetPngCompressionLevel(-1),
+                              ".*must be in \\[0, 9\\].*");
+}
+
 // Saving without an ImageFileFormat uses the extension to infer the format.
 GTEST_TEST(ImageIoTest, SaveToFileInfersFormat) {
   const ImageRgba8U image(1, 1);
@@ -1,5 +1,8 @@
 #include "drake/systems/sensors/image.h"
 
+#include <memory>
+#include <utility>
+
 #include <gtest/gtest.h>
 
 namespace drake {
@@ -207,6 +210,125 @@ GTEST_TEST(TestImage, ResizeTest) {
   EXPECT_EQ(dut.size(), 0);
 }
 
+// Copies share their pixels until one of them is mutated.
+GTEST_TEST(TestImage, CopyOnWriteTest) {
+  const ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  ImageRgba8U copy = image;
+  ImageRgba8U copy_of_copy = copy;
+  EXPECT_TRUE(copy.SharesPixelsWith(image));
+  EXPECT_TRUE(copy_of_copy.SharesPixelsWith(image));
+  EXPECT_TRUE(image.SharesPixels());
+  // Reading doesn't unshare.
+  const ImageRgba8U& const_copy = copy;
+  EXPECT_EQ(const_copy.at(1, 2)[3], kInitialValue);
+  EXPECT_TRUE(copy.SharesPixelsWith(image));
+
+  // Writing a copy only affects that copy.
+  copy.at(1, 2)[3] = 7;
+  EXPECT_FALSE(copy.SharesPixelsWith(image));
+  EXPECT_TRUE(copy_of_copy.SharesPixelsWith(image));
+  EXPECT_EQ(copy.at(1, 2)[3], 7);
+  EXPECT_EQ(image.at(1, 2)[3], kInitialValue);
+  EXPECT_EQ(copy_of_copy.at(1, 2)[3], kInitialValue);
+  EXPECT_FALSE(copy == image);
+  EXPECT_TRUE(copy_of_copy == image);
+
+  // An image that no longer shares its pixels writes them in place.
+  const uint8_t* const pixels = copy.at(0, 0);
+  copy.at(0, 0)[0] = 8;
+  EXPECT_EQ(copy.at(0, 0), pixels);
+
+  // Resizing leaves the shared pixels to the other images.
+  copy_of_copy.resize(2, 1);
+  EXPECT_FALSE(copy_of_copy.SharesPixelsWith(image));
+  EXPECT_FALSE(copy_of_copy.SharesPixels());
+  EXPECT_FALSE(image.SharesPixels());
+  EXPECT_EQ(copy_of_copy.at(1, 0)[0], 0);
+  EXPECT_EQ(image.width(), kWidth);
+  EXPECT_EQ(image.at(1, 0)[0], kInitialValue);
+
+  // Empty images share nothing, but compare equal.
+  const ImageRgba8U empty;
+  const ImageRgba8U empty_copy = empty;
+  EXPECT_FALSE(empty_copy.SharesPixelsWith(empty));
+  EXPECT_FALSE(empty.SharesPixels());
+  EXPECT_TRUE(empty_copy == empty);
+  ImageRgba8U resized_empty(1, 1);
+  resized_empty.resize(0, 0);
+  EXPECT_TRUE(resized_empty == empty);
+}
+
+// mutable_data() unshares the pixels once; the pointer it returns writes only
+// this image's pixels until the image is copied.
+GTEST_TEST(TestImage, MutableDataTest) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  const ImageRgba8U copy = image;
+  uint8_t* const data = image.mutable_data();
+  EXPECT_FALSE(image.SharesPixelsWith(copy));
+  EXPECT_EQ(image.mutable_data(), data);
+  EXPECT_EQ(image.at(0, 0), data);
+  EXPECT_EQ(image.at(1, 2), data + (1 + 2 * kWidth) * image.kNumChannels);
+  data[3] = 7;
+  EXPECT_EQ(image.at(0, 0)[3], 7);
+  EXPECT_EQ(copy.at(0, 0)[3], kInitialValue);
+
+  // After another copy, the pixels are shared again, and writing unshares
+  // them anew.
+  const ImageRgba8U second_copy = image;
+  EXPECT_TRUE(second_copy.SharesPixelsWith(image));
+  image.mutable_data()[3] = 8;
+  EXPECT_FALSE(second_copy.SharesPixelsWith(image));
+  EXPECT_EQ(second_copy.at(0, 0)[3], 7);
+
+  // A moved-to image keeps writing the same pixels.
+  uint8_t* const moved_data = image.mutable_data();
+  ImageRgba8U moved = std::move(image);
+  EXPECT_EQ(moved.mutable_data(), moved_data);
+  EXPECT_EQ(image.mutable_data(), nullptr);
+
+  // An empty image has no data.
+  ImageRgba8U empty;
+  EXPECT_EQ(empty.mutable_data(), nullptr);
+}
+
+// The pixels of an image with a live data view are never shared, and the view
+// outlives resizing the image.
+GTEST_TEST(TestImage, DataViewTest) {
+  ImageRgba8U image(kWidth, kHeight, kInitialValue);
+  ImageRgba8U copy_before = image;
+  std::shared_ptr<uint8_t> view = image.MakeDataView();
+  EXPECT_FALSE(image.SharesPixelsWith(copy_before));
+  EXPECT_EQ(view.get(), image.at(0, 0));
+
+  // Copies made while the view is alive take their own pixels, so writing
+  // through the view only changes the viewed image.
+  const ImageRgba8U copy_during = image;
+  EXPECT_FALSE(copy_during.SharesPixelsWith(image));
+  // The view doesn't count as sharing, since the image writes in place.
+  EXPECT_FALSE(image.SharesPixels());
+  view.get()[0] = 9;
+  EXPECT_EQ(image.at(0, 0)[0], 9);
+  EXPECT_EQ(copy_during.at(0, 0)[0], kInitialValue);
+  EXPECT_EQ(copy_before.at(0, 0)[0], kInitialValue);
+  // The image keeps writing the viewed pixels in place.
+  image.at(0, 0)[1] = 10;
+  EXPECT_EQ(view.get()[1], 10);
+
+  // Resizing leaves the viewed pixels to the view.
+  image.resize(2, 1);
+  EXPECT_EQ(view.get()[0], 9);
+  EXPECT_NE(image.at(0, 0), view.get());
+
+  // Once the view is gone, copies share the pixels again.
+  std::shared_ptr<uint8_t> second_view = image.MakeDataView();
+  second_view.reset();
+  const ImageRgba8U copy_after = image;
+  EXPECT_TRUE(copy_after.SharesPixelsWith(image));
+
+  ImageRgba8U empty;
+  EXPECT_EQ(empty.MakeDataView(), nullptr);
+}
+
 GTEST_TEST(ImageTest, DepthImage32FTo16U) {
   // Create a list of test inputs and outputs (pixels).
   using InPixel = ImageDepth32F::Traits;
@@ -4,8 +4,10 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -232,6 +234,7 @@ class ImageWriterTest : public ::testing::Test {
     EXPECT_TRUE(status.succeeded());
     EXPECT_TRUE(fs::exists(expected_file));
     EXPECT_EQ(1, tester.port_count(port.get_index()));
+    EXPECT_EQ(1, writer.GetStatistics().num_written);
     add_file_for_cleanup(expected_file.string());
 
     Image<kPixelType> readback;
@@ -668,6 +671,122 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+// Declares a color port on `writer` whose files are named by count, and
+// captures `num_images` images from it with forced publishes. Returns the
+// names of the files the images are written to.
+std::vector<std::string> CaptureColorImages(const ImageWriter& writer,
+                                            const InputPort<double>& port,
+                                            int num_images) {
+  ImageWriterTester tester(writer);
+  auto context = writer.AllocateContext();
+  port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+  std::vector<std::string> file_names;
+  for (int i = 0; i < num_images; ++i) {
+    file_names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U,
+        context->get_time(), port.get_name(), i));
+    writer.ForcedPublish(*context);
+  }
+  return file_names;
+}
+
+// Writing asynchronously writes the same files as writing synchronously,
+// once the writer has been flushed.
+TEST_F(ImageWriterTest, AsynchronousWriting) {
+  ImageWriterParams params;
+  params.num_threads = 2;
+  params.max_queue_size = 2;
+  params.png_compression_level = 1;
+  ImageWriter writer(params);
+  fs::path path(temp_dir());
+  path.append("async_{count:03}");
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "color", path.string(), 0.1, 0.0);
+
+  const int kNumImages = 10;
+  const std::vector<std::string> file_names =
+      CaptureColorImages(writer, port, kNumImages);
+  for (const auto& file_name : file_names) {
+    add_file_for_cleanup(file_name);
+  }
+  writer.Flush();
+
+  const ImageWriter::Statistics statistics = writer.GetStatistics();
+  EXPECT_EQ(statistics.num_written, kNumImages);
+  EXPECT_EQ(statistics.num_failed, 0);
+  EXPECT_EQ(statistics.num_dropped, 0);
+  EXPECT_EQ(statistics.queue_depth, 0);
+  // At most max_queue_size images wait while num_threads are being written.
+  EXPECT_GE(statistics.max_queue_depth, 1);
+  EXPECT_LE(statistics.max_queue_depth, 4);
+  EXPECT_GT(statistics.mean_latency, 0);
+  EXPECT_GE(statistics.max_latency, statistics.mean_latency);
+
+  for (const auto& file_name : file_names) {
+    ImageRgba8U readback;
+    ASSERT_TRUE(LoadImage(file_name, &readback)) << file_name;
+    EXPECT_EQ(readback, test_image<PixelType::kRgba8U>());
+  }
+}
+
+// Images that don't fit in the queue are dropped (when so configured), and
+// images still waiting to be written are written upon destruction.
+TEST_F(ImageWriterTest, AsynchronousDropAndFlushOnDestruction) {
+  for (const std::string policy : {"drop_newest", "drop_oldest"}) {
+    SCOPED_TRACE(policy);
+    ImageWriterParams params;
+    params.num_threads = 1;
+    params.max_queue_size = 1;
+    params.queue_full_policy = policy;
+    auto writer = std::make_unique<ImageWriter>(params);
+    fs::path path(temp_dir());
+    path.append(policy + "_{count:03}");
+    const auto& port = writer->DeclareImageInputPort<PixelType::kRgba8U>(
+        "color", path.string(), 0.1, 0.0);
+
+    const int kNumImages = 20;
+    const std::vector<std::string> file_names =
+        CaptureColorImages(*writer, port, kNumImages);
+    for (const auto& file_name : file_names) {
+      add_file_for_cleanup(file_name);
+    }
+    const ImageWriter::Statistics statistics = writer->GetStatistics();
+    EXPECT_LE(statistics.max_queue_depth, 2);
+
+    writer.reset();
+    int num_files = 0;
+    for (const auto& file_name : file_names) {
+      num_files += fs::exists(file_name);
+    }
+    EXPECT_GE(num_files, 1);
+    // Every captured image was either dropped or written.
+    EXPECT_EQ(num_files + statistics.num_dropped, kNumImages);
+    // The last image is only ever dropped by drop_newest.
+    if (policy == "drop_oldest") {
+      EXPECT_TRUE(fs::exists(file_names.back()));
+    }
+  }
+}
+
+TEST_F(ImageWriterTest, BadParams) {
+  ImageWriterParams params;
+  params.num_threads = -1;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{params},
+                              ".*num_threads must be non-negative.*");
+  params = {};
+  params.max_queue_size = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{params},
+                              ".*max_queue_size must be positive.*");
+  params = {};
+  params.queue_full_policy = "wait";
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{params},
+                              ".*unknown queue_full_policy 'wait'.*");
+  params = {};
+  params.png_compression_level = 10;
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter{params},
+                              ".*must be in \\[0, 9\\].*");
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -0,0 +1,189 @@
+#include "drake/systems/sensors/multi_camera_renderer.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/test_utilities/dummy_render_engine.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::internal::DummyRenderEngine;
+using geometry::render::ColorRenderCamera;
+using geometry::render::DepthRenderCamera;
+using geometry::render::RenderCameraCore;
+using geometry::render::RenderEngine;
+using math::RigidTransformd;
+
+/* A render engine whose images encode the height of the viewpoint above the
+world origin. */
+class HeightRenderEngine final : public DummyRenderEngine {
+ public:
+  HeightRenderEngine() = default;
+
+ private:
+  std::unique_ptr<RenderEngine> DoClone() const final {
+    return std::make_unique<HeightRenderEngine>(*this);
+  }
+
+  float height() const { return last_updated_X_WC().translation().z(); }
+
+  void DoRenderColorImage(const ColorRenderCamera& camera,
+                          ImageRgba8U* output) const final {
+    DummyRenderEngine::DoRenderColorImage(camera, output);
+    output->at(0, 0)[0] = static_cast<uint8_t>(height());
+  }
+
+  void DoRenderDepthImage(const DepthRenderCamera& camera,
+                          ImageDepth32F* output) const final {
+    DummyRenderEngine::DoRenderDepthImage(camera, output);
+    std::fill(output->at(0, 0), output->at(0, 0) + output->size(), height());
+  }
+
+  void DoRenderLabelImage(const ColorRenderCamera& camera,
+                          ImageLabel16I* output) const final {
+    DummyRenderEngine::DoRenderLabelImage(camera, output);
+    output->at(0, 0)[0] = static_cast<int16_t>(height());
+  }
+};
+
+/* Makes a request for a camera `height` meters above the world origin. */
+CameraRenderRequest MakeRequest(double height) {
+  const RenderCameraCore core("height", {8, 6, M_PI / 4}, {0.1, 10.0}, {});
+  CameraRenderRequest request;
+  request.parent_id = SceneGraph<double>::world_frame_id();
+  request.X_PB = RigidTransformd(Vector3d(0, 0, height));
+  request.color_camera = ColorRenderCamera(core);
+  request.depth_camera = DepthRenderCamera(core, {0.1, 10.0});
+  request.render_label_image = true;
+  return request;
+}
+
+GTEST_TEST(MultiCameraRendererTest, RendersAllCamerasInOneEvaluation) {
+  std::vector<CameraRenderRequest> requests{MakeRequest(1), MakeRequest(2),
+                                            MakeRequest(3)};
+  // A depth-only camera.
+  requests.back().color_camera.reset();
+  requests.back().render_label_image = false;
+
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  scene_graph->AddRenderer("height", std::make_unique<HeightRenderEngine>());
+  auto* renderer = builder.AddSystem<MultiCameraRenderer>(requests);
+  builder.Connect(scene_graph->get_query_output_port(),
+                  renderer->query_object_input_port());
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  const Context<double>& renderer_context =
+      renderer->GetMyContextFromRoot(*context);
+
+  EXPECT_EQ(renderer->num_cameras(), 3);
+  EXPECT_EQ(renderer->num_output_ports(), 3 + 3 + 1 + 3);
+  EXPECT_EQ(renderer->color_image_output_port(1).get_name(),
+            "camera1_color_image");
+  EXPECT_EQ(renderer->depth_image_32F_output_port(2).get_name(),
+            "camera2_depth_image_32f");
+  DRAKE_EXPECT_THROWS_MESSAGE(renderer->color_image_output_port(2),
+                              ".*camera 2 doesn't render color images.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(renderer->label_image_output_port(2),
+                              ".*camera 2 doesn't render label images.*");
+
+  for (int i = 0; i < 2; ++i) {
+    const float height = i + 1;
+    const auto& color =
+        renderer->color_image_output_port(i).Eval<ImageRgba8U>(
+            renderer_context);
+    ASSERT_EQ(color.width(), 8);
+    EXPECT_EQ(color.at(0, 0)[0], height);
+    EXPECT_EQ(renderer->label_image_output_port(i)
+                  .Eval<ImageLabel16I>(renderer_context)
+                  .at(0, 0)[0],
+              height);
+    EXPECT_EQ(renderer->depth_image_32F_output_port(i)
+                  .Eval<ImageDepth32F>(renderer_context)
+                  .at(7, 5)[0],
+              height);
+  }
+  EXPECT_EQ(renderer->depth_image_32F_output_port(2)
+                .Eval<ImageDepth32F>(renderer_context)
+                .at(0, 0)[0],
+            3);
+  EXPECT_EQ(renderer->body_pose_in_world_output_port(2)
+                .Eval<RigidTransformd>(renderer_context)
+                .translation()
+                .z(),
+            3);
+
+  // All of the images came from a single batch: one viewpoint update per
+  // camera, and one render per image.
+  const QueryObject<double>& query_object =
+      renderer->query_object_input_port().Eval<QueryObject<double>>(
+          renderer_context);
+  const auto* engine = dynamic_cast<const HeightRenderEngine*>(
+      query_object.GetRenderEngineByName("height"));
+  ASSERT_NE(engine, nullptr);
+  EXPECT_EQ(engine->num_viewpoint_updates(), 3);
+  EXPECT_EQ(engine->num_color_renders(), 2);
+  EXPECT_EQ(engine->num_depth_renders(), 3);
+  EXPECT_EQ(engine->num_label_renders(), 2);
+
+  // Evaluating the ports again doesn't render again.
+  renderer->color_image_output_port(0).Eval<ImageRgba8U>(renderer_context);
+  EXPECT_EQ(engine->num_color_renders(), 2);
+}
+
+// Rendering anew writes into a back buffer, rather than copying the pixels that
+// the output port's value still shares.
+GTEST_TEST(MultiCameraRendererTest, DoubleBuffering) {
+  DiagramBuilder<double> builder;
+  auto* scene_graph = builder.AddSystem<SceneGraph<double>>();
+  scene_graph->AddRenderer("height", std::make_unique<HeightRenderEngine>());
+  auto* renderer = builder.AddSystem<MultiCameraRenderer>(
+      std::vector<CameraRenderRequest>{MakeRequest(1)});
+  builder.Connect(scene_graph->get_query_output_port(),
+                  renderer->query_object_input_port());
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  const Context<double>& renderer_context =
+      renderer->GetMyContextFromRoot(*context);
+  const OutputPort<double>& depth_port =
+      renderer->depth_image_32F_output_port(0);
+
+  const float* const first =
+      depth_port.Eval<ImageDepth32F>(renderer_context).at(0, 0);
+  context->SetTime(1);
+  const float* const second =
+      depth_port.Eval<ImageDepth32F>(renderer_context).at(0, 0);
+  EXPECT_NE(second, first);
+  // The output port has moved on to the second render, so the third render
+  // reuses the pixels of the first.
+  context->SetTime(2);
+  const ImageDepth32F& third = depth_port.Eval<ImageDepth32F>(renderer_context);
+  EXPECT_EQ(third.at(0, 0), first);
+  EXPECT_EQ(third.at(0, 0)[0], 1);
+}
+
+GTEST_TEST(MultiCameraRendererTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(MultiCameraRenderer({}), ".*empty.*");
+  std::vector<CameraRenderRequest> requests{MakeRequest(1)};
+  requests[0].color_camera.reset();
+  DRAKE_EXPECT_THROWS_MESSAGE(MultiCameraRenderer(requests),
+                              ".*render_label_image.*");
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
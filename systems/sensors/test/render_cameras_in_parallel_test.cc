@@ -0,0 +1,212 @@
+#include "drake/systems/sensors/render_cameras_in_parallel.h"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/test_utilities/dummy_render_engine.h"
+
+namespace drake {
+namespace systems {
+namespace sensors {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::QueryObject;
+using geometry::SceneGraph;
+using geometry::internal::DummyRenderEngine;
+using geometry::render::ColorRenderCamera;
+using geometry::render::DepthRenderCamera;
+using geometry::render::RenderCameraCore;
+using geometry::render::RenderEngine;
+using geometry::render::RenderLabel;
+using math::RigidTransformd;
+
+/* A render engine whose images encode the viewpoint they were rendered from:
+the depth image is filled with the height of the camera above the world
+origin. It records the threads that rendered. If the engine supports
+concurrent rendering, it takes the viewpoint of a batch's image from its
+request (as required), rather than from UpdateViewpoint(). */
+class ViewpointRenderEngine final : public DummyRenderEngine {
+ public:
+  explicit ViewpointRenderEngine(bool concurrent) : concurrent_(concurrent) {}
+
+  void UpdateViewpoint(const RigidTransformd& X_WC) final { X_WC_ = X_WC; }
+
+  int num_render_threads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(render_threads_.size());
+  }
+
+ private:
+  std::unique_ptr<RenderEngine> DoClone() const final {
+    return std::make_unique<ViewpointRenderEngine>(concurrent_);
+  }
+
+  bool DoSupportsConcurrentRendering() const final { return concurrent_; }
+
+  void DoRenderImages(
+      const std::vector<geometry::render::ImageRequest>& requests) final {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      render_threads_.insert(std::this_thread::get_id());
+    }
+    if (!concurrent_) {
+      RenderEngine::DoRenderImages(requests);
+      return;
+    }
+    for (const auto& request : requests) {
+      std::visit(
+          [](const auto& r) {
+            Fill(r.X_WC.translation().z(), r.image);
+          },
+          request);
+    }
+  }
+
+  void DoRenderColorImage(const ColorRenderCamera&,
+                          ImageRgba8U* output) const final {
+    Fill(X_WC_.translation().z(), output);
+  }
+
+  void DoRenderDepthImage(const DepthRenderCamera&,
+                          ImageDepth32F* output) const final {
+    Fill(X_WC_.translation().z(), output);
+  }
+
+  void DoRenderLabelImage(const ColorRenderCamera&,
+                          ImageLabel16I* output) const final {
+    Fill(X_WC_.translation().z(), output);
+  }
+
+  static void Fill(float height, ImageRgba8U* output) {
+    output->at(0, 0)[0] = static_cast<uint8_t>(height);
+  }
+
+  static void Fill(float height, ImageDepth32F* output) {
+    std::fill(output->at(0, 0), output->at(0, 0) + output->size(), height);
+  }
+
+  static void Fill(float height, ImageLabel16I* output) {
+    output->at(0, 0)[0] = static_cast<int16_t>(height);
+  }
+
+  const bool concurrent_;
+  RigidTransformd X_WC_;
+  mutable std::mutex mutex_;
+  std::unordered_set<std::thread::id> render_threads_;
+};
+
+class RenderCamerasInParallelTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    scene_graph_.AddRenderer("concurrent",
+                             std::make_unique<ViewpointRenderEngine>(true));
+    scene_graph_.AddRenderer("serial",
+                             std::make_unique<ViewpointRenderEngine>(false));
+    context_ = scene_graph_.CreateDefaultContext();
+    // SceneGraph's context holds copies of the engines.
+    const QueryObject<double>& query_object = this->query_object();
+    concurrent_ = static_cast<const ViewpointRenderEngine*>(
+        query_object.GetRenderEngineByName("concurrent"));
+    serial_ = static_cast<const ViewpointRenderEngine*>(
+        query_object.GetRenderEngineByName("serial"));
+  }
+
+  const QueryObject<double>& query_object() const {
+    return scene_graph_.get_query_output_port().Eval<QueryObject<double>>(
+        *context_);
+  }
+
+  /* Makes a request for a camera `height` meters above the world origin. */
+  CameraRenderRequest MakeRequest(const std::string& renderer_name,
+                                  double height) const {
+    const RenderCameraCore core(renderer_name, {8, 6, M_PI / 4}, {0.1, 10.0},
+                                {});
+    CameraRenderRequest request;
+    request.parent_id = scene_graph_.world_frame_id();
+    request.X_PB = RigidTransformd(Vector3d(0, 0, height));
+    request.color_camera = ColorRenderCamera(core);
+    request.depth_camera = DepthRenderCamera(core, {0.1, 10.0});
+    request.render_label_image = true;
+    return request;
+  }
+
+  SceneGraph<double> scene_graph_;
+  std::unique_ptr<Context<double>> context_;
+  const ViewpointRenderEngine* concurrent_{};
+  const ViewpointRenderEngine* serial_{};
+};
+
+TEST_F(RenderCamerasInParallelTest, RendersEachCameraFromItsViewpoint) {
+  std::vector<CameraRenderRequest> requests;
+  for (int i = 1; i <= 12; ++i) {
+    requests.push_back(MakeRequest(i % 4 == 0 ? "serial" : "concurrent", i));
+  }
+  // A depth-only camera.
+  requests.push_back(MakeRequest("concurrent", 20));
+  requests.back().color_camera.reset();
+  requests.back().render_label_image = false;
+
+  std::vector<CameraRenderResult> results;
+  RenderCamerasInParallel(query_object(), requests, Parallelism(4), &results);
+  ASSERT_EQ(results.size(), requests.size());
+  for (int i = 0; i < 12; ++i) {
+    const float height = i + 1;
+    const CameraRenderResult& result = results[i];
+    EXPECT_EQ(result.X_WB.translation().z(), height);
+    ASSERT_EQ(result.depth.width(), 8);
+    ASSERT_EQ(result.depth.height(), 6);
+    EXPECT_EQ(result.depth.at(7, 5)[0], height);
+    EXPECT_EQ(result.color.at(0, 0)[0], height);
+    EXPECT_EQ(result.label.at(0, 0)[0], height);
+  }
+  EXPECT_EQ(results.back().color.size(), 0);
+  EXPECT_EQ(results.back().label.size(), 0);
+  EXPECT_EQ(results.back().depth.at(0, 0)[0], 20);
+
+  // The serial engine was only used by the calling thread.
+  EXPECT_EQ(serial_->num_render_threads(), 1);
+  EXPECT_GE(concurrent_->num_render_threads(), 1);
+  EXPECT_LE(concurrent_->num_render_threads(), 4);
+
+  // With no parallelism, the results are the same.
+  std::vector<CameraRenderResult> serial_results;
+  RenderCamerasInParallel(query_object(), requests, Parallelism::None(),
+                          &serial_results);
+  for (size_t i = 0; i < requests.size(); ++i) {
+    EXPECT_EQ(serial_results[i].color, results[i].color);
+    EXPECT_EQ(serial_results[i].depth, results[i].depth);
+    EXPECT_EQ(serial_results[i].label, results[i].label);
+  }
+}
+
+TEST_F(RenderCamerasInParallelTest, Errors) {
+  std::vector<CameraRenderRequest> requests{MakeRequest("concurrent", 1)};
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderCamerasInParallel(query_object(), requests,
+                                                      Parallelism(2), nullptr),
+                              ".*results != nullptr.*");
+
+  std::vector<CameraRenderResult> results;
+  requests[0].color_camera.reset();
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderCamerasInParallel(query_object(), requests,
+                                                      Parallelism(2), &results),
+                              ".*render_label_image.*");
+
+  requests = {MakeRequest("concurrent", 1), MakeRequest("no_such_engine", 2)};
+  EXPECT_THROW(RenderCamerasInParallel(query_object(), requests,
+                                       Parallelism(2), &results),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace sensors
+}  // namespace systems
+}  // namespace drake
@@ -1,5 +1,11 @@
 #include "drake/systems/sensors/rgbd_sensor_async.h"
 
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -35,7 +41,9 @@ using systems::EventCollection;
 using systems::UnrestrictedUpdateEvent;
 
 /* A render engine for unit testing that always outputs images that are entirely
-filled with the clear color, empty label, or too-far depth measurement. */
+filled with the clear color, empty label, or too-far depth measurement. If
+`concurrent` is true, the engine claims to support concurrent rendering and
+counts its calls to RenderImages() (across all of its clones). */
 class SimpleRenderEngine final : public DummyRenderEngine {
  public:
   static constexpr uint8_t kClearColor = 66;
@@ -45,13 +53,49 @@ class SimpleRenderEngine final : public DummyRenderEngine {
       ImageTraits<PixelType::kDepth16U>::kTooFar;
   static const RenderLabel& kClearLabel;
 
-  SimpleRenderEngine() { this->set_force_accept(true); }
+  explicit SimpleRenderEngine(bool concurrent = false)
+      : concurrent_(concurrent) {
+    this->set_force_accept(true);
+  }
+
+  int num_batches() const { return *num_batches_; }
 
  private:
   std::unique_ptr<RenderEngine> DoClone() const final {
     return std::make_unique<SimpleRenderEngine>(*this);
   }
 
+  bool DoSupportsConcurrentRendering() const final { return concurrent_; }
+
+  void DoRenderImages(
+      const std::vector<geometry::render::ImageRequest>& requests) final {
+    if (!concurrent_) {
+      DummyRenderEngine::DoRenderImages(requests);
+      return;
+    }
+    // Concurrent batches neither update the viewpoint nor touch the (unsynced)
+    // counters of the DummyRenderEngine.
+    ++(*num_batches_);
+    for (const auto& request : requests) {
+      std::visit(
+          [](const auto& r) {
+            const auto& intrinsics = r.camera.core().intrinsics();
+            using ImageType = std::decay_t<decltype(*r.image)>;
+            if constexpr (std::is_same_v<ImageType, ImageRgba8U>) {
+              *r.image = ImageType(intrinsics.width(), intrinsics.height(),
+                                   kClearColor);
+            } else if constexpr (std::is_same_v<ImageType, ImageDepth32F>) {
+              *r.image = ImageType(intrinsics.width(), intrinsics.height(),
+                                   kClearDepth32);
+            } else {
+              *r.image = ImageType(intrinsics.width(), intrinsics.height(),
+                                   kClearLabel);
+            }
+          },
+          request);
+    }
+  }
+
   void DoRenderColorImage(const ColorRenderCamera& camera,
                           ImageRgba8U* output) const final {
     DummyRenderEngine::DoRenderColorImage(camera, output);
@@ -72,6 +116,10 @@ class SimpleRenderEngine final : public DummyRenderEngine {
     *output = ImageLabel16I(camera.core().intrinsics().width(),
                             camera.core().intrinsics().height(), kClearLabel);
   }
+
+  bool concurrent_{};
+  std::shared_ptr<std::atomic<int>> num_batches_{
+      std::make_shared<std::atomic<int>>(0)};
 };
 
 const RenderLabel& SimpleRenderEngine::kClearLabel = RenderLabel::kEmpty;
@@ -412,6 +460,39 @@ TEST_F(RgbdSensorAsyncTest, RenderBackgroundColor) {
                   .succeeded());
 }
 
+// With an engine that supports concurrent rendering, each of the sensor's
+// images is rendered by a separate RenderImages() call (so that they can run
+// on separate threads), with the same results.
+TEST_F(RgbdSensorAsyncTest, RenderConcurrently) {
+  DiagramBuilder<double> builder;
+  auto [plant, scene_graph] = AddMultibodyPlantSceneGraph(&builder, 0);
+  auto engine = std::make_unique<SimpleRenderEngine>(true /* concurrent */);
+  const SimpleRenderEngine* const engine_ptr = engine.get();
+  scene_graph.AddRenderer(kRendererName, std::move(engine));
+  const FrameId parent_id = SceneGraph<double>::world_frame_id();
+  const double fps = 4;
+  const double capture_offset = 0.001;
+  const double output_delay = 0.200;
+  const bool render_label_image = true;
+  const auto* dut = builder.AddSystem<RgbdSensorAsync>(
+      &scene_graph, parent_id, RigidTransform<double>(), fps, capture_offset,
+      output_delay, color_camera_, depth_camera_, render_label_image);
+  builder.Connect(scene_graph.get_query_output_port(), dut->get_input_port());
+  for (OutputPortIndex i{0}; i < dut->num_output_ports(); ++i) {
+    const auto& output_port = dut->get_output_port(i);
+    builder.ExportOutput(output_port, output_port.get_name());
+  }
+  plant.Finalize();
+  Simulator<double> simulator(builder.Build());
+
+  // The first tick is at 1ms and its tock at 201ms.
+  simulator.AdvanceTo(0.202);
+  ExpectClearImages(simulator.get_system(), simulator.get_context(), 0.001);
+  // The color, depth, and label images were rendered separately (by the
+  // sensor's clone of the engine, which shares the count).
+  EXPECT_EQ(engine_ptr->num_batches(), 3);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
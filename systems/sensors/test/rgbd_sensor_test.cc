@@ -34,6 +34,7 @@ using geometry::render::DepthRange;
 using geometry::render::DepthRenderCamera;
 using geometry::render::RenderCameraCore;
 using geometry::render::RenderEngine;
+using geometry::render::RenderStatistics;
 using math::RigidTransformd;
 using math::RollPitchYawd;
 using std::make_pair;
@@ -408,6 +409,33 @@ TEST_F(RgbdSensorTest, ConstructCameraWithNonTrivialOffsetsDeprecated) {
       CompareMatrices(sensor.X_BD().GetAsMatrix4(), X_BD.GetAsMatrix4()));
 }
 
+// Tests that the sensor times the calculation of its images once statistics are
+// set.
+TEST_F(RgbdSensorTest, Statistics) {
+  auto make_sensor = [this](SceneGraph<double>*) {
+    return make_unique<RgbdSensor>(SceneGraph<double>::world_frame_id(),
+                                   RigidTransformd{}, color_camera_,
+                                   depth_camera_);
+  };
+  MakeCameraDiagram(make_sensor);
+  EXPECT_EQ(sensor_->statistics(), nullptr);
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+
+  auto statistics = std::make_shared<RenderStatistics>();
+  sensor_->set_statistics(statistics);
+  EXPECT_EQ(sensor_->statistics(), statistics.get());
+  sensor_->color_image_output_port().Eval<ImageRgba8U>(*sensor_context_);
+  sensor_->depth_image_16U_output_port().Eval<ImageDepth16U>(*sensor_context_);
+  sensor_->label_image_output_port().Eval<ImageLabel16I>(*sensor_context_);
+  EXPECT_EQ(statistics->GetStageSummary("RgbdSensor/color_image")->count, 1);
+  EXPECT_EQ(statistics->GetStageSummary("RgbdSensor/label_image")->count, 1);
+  // The 16-bit depth image is converted from a 32-bit depth image.
+  EXPECT_EQ(statistics->GetStageSummary("RgbdSensor/depth_image_16u")->count,
+            1);
+  EXPECT_EQ(statistics->GetStageSummary("RgbdSensor/depth_image_32f")->count,
+            1);
+}
+
 // We don't explicitly test any of the image outputs. The image outputs simply
 // wrap the corresponding QueryObject call; the only calculations they do is to
 // produce the X_PC matrix (which is implicitly tested in the construction tests
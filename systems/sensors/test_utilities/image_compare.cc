@@ -86,7 +86,7 @@ AssertionResult LoadImage(const fs::path& filename, Image<kPixelType>* image) {
     return AssertionFailure() << "Found wrong channels=" << channels;
   }
   image->resize(width, height);
-  exporter->Export(image->at(0, 0));
+  exporter->Export(image->mutable_data());
   return AssertionSuccess();
 }
 
@@ -43,6 +43,7 @@ LIBDRAKE_COMPONENTS = [
     "//geometry/render/shaders",
     "//geometry/render_gl",
     "//geometry/render_gltf_client",
+    "//geometry/render_ray_cast",
     "//geometry/render_vtk",
     "//lcm",
     "//manipulation/kinova_jaco",
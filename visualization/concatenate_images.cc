@@ -1,5 +1,7 @@
 #include "drake/visualization/concatenate_images.h"
 
+#include <algorithm>
+
 namespace drake {
 namespace visualization {
 
@@ -41,6 +43,18 @@ const InputPort<T>& ConcatenateImages<T>::get_input_port(int row,
 template <typename T>
 void ConcatenateImages<T>::CalcOutput(const Context<T>& context,
                                       ImageRgba8U* output) const {
+  // With a single input, the output is the input; copying the image only
+  // shares its pixels.
+  if (rows_ == 1 && cols_ == 1) {
+    const InputPort<T>& input = *inputs_(0, 0);
+    if (input.HasValue(context)) {
+      *output = input.template Eval<ImageRgba8U>(context);
+    } else {
+      output->resize(0, 0);
+    }
+    return;
+  }
+
   // Gather the the input images and their dimensions.
   const ImageRgba8U empty;
   MatrixX<const ImageRgba8U*> images(rows_, cols_);
@@ -83,11 +97,9 @@ void ConcatenateImages<T>::CalcOutput(const Context<T>& context,
       const int u_offset = cell_widths.row(0).head(col).sum();
       const int v_offset = cell_heights.col(0).head(row).sum();
       for (int v = 0; v < image.height(); ++v) {
-        for (int u = 0; u < image.width(); ++u) {
-          for (int ch = 0; ch < kNumChannels; ++ch) {
-            output->at(u_offset + u, v_offset + v)[ch] = image.at(u, v)[ch];
-          }
-        }
+        const uint8_t* const source_row = image.at(0, v);
+        std::copy(source_row, source_row + image.width() * kNumChannels,
+                  output->at(u_offset, v_offset + v));
       }
     }
   }
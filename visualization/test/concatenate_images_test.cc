@@ -61,6 +61,22 @@ GTEST_TEST(ConcatenateImagesTest, Basic) {
   EXPECT_EQ(actual, expected);
 }
 
+// A single input image is passed through without copying its pixels.
+GTEST_TEST(ConcatenateImagesTest, SingleImageSharesPixels) {
+  const ConcatenateImages<double> dut(1, 1);
+  auto context = dut.CreateDefaultContext();
+  const auto& output = dut.GetOutputPort("color_image");
+  EXPECT_EQ(output.template Eval<ImageRgba8U>(*context).size(), 0);
+
+  const ImageRgba8U image(4, 2, 9);
+  const auto& input =
+      dut.get_input_port(0, 0).FixValue(context.get(), image);
+  const auto& actual = output.template Eval<ImageRgba8U>(*context);
+  EXPECT_EQ(actual, image);
+  EXPECT_TRUE(
+      actual.SharesPixelsWith(input.get_value().get_value<ImageRgba8U>()));
+}
+
 // Checks the output width and height for various input image sizes.
 GTEST_TEST(ConcatenateImagesTest, TilingSize) {
   // Prepare the suite of tests.